@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AttachInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachInstances"; }
     Aws::String SerializePayload() const override;
 
 
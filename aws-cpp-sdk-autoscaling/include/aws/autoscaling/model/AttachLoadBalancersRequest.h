@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AttachLoadBalancersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachLoadBalancers"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CompleteLifecycleActionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CompleteLifecycleAction"; }
     Aws::String SerializePayload() const override;
 
 
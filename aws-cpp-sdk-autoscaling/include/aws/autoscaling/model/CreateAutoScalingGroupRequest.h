@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateAutoScalingGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateAutoScalingGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateLaunchConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateLaunchConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
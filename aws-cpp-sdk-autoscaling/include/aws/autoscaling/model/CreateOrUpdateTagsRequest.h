@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateOrUpdateTagsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateOrUpdateTags"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteAutoScalingGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteAutoScalingGroup"; }
     Aws::String SerializePayload() const override;
 
 
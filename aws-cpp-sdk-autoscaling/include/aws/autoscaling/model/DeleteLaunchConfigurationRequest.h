@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteLaunchConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteLaunchConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
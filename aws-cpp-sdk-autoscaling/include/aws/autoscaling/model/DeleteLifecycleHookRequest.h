@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteLifecycleHookRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteLifecycleHook"; }
     Aws::String SerializePayload() const override;
 
 
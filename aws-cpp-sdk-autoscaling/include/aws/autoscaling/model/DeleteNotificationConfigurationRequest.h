@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteNotificationConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteNotificationConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeletePolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeletePolicy"; }
     Aws::String SerializePayload() const override;
 
 
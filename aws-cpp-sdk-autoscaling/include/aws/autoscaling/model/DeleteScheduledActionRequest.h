@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteScheduledActionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteScheduledAction"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteTagsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteTags"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     DescribeAdjustmentTypesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAdjustmentTypes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeAutoScalingGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAutoScalingGroups"; }
     Aws::String SerializePayload() const override;
 
 
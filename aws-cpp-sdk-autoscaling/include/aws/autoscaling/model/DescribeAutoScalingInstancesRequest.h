@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeAutoScalingInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAutoScalingInstances"; }
     Aws::String SerializePayload() const override;
 
 
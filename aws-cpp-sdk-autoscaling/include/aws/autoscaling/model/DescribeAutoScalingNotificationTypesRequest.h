@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     DescribeAutoScalingNotificationTypesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAutoScalingNotificationTypes"; }
     Aws::String SerializePayload() const override;
 
 
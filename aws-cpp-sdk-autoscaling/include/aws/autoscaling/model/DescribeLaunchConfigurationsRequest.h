@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeLaunchConfigurationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLaunchConfigurations"; }
     Aws::String SerializePayload() const override;
 
 
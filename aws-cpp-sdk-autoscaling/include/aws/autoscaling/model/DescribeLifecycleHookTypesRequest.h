@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     DescribeLifecycleHookTypesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLifecycleHookTypes"; }
     Aws::String SerializePayload() const override;
 
 
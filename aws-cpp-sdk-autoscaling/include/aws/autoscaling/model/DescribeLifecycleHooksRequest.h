@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeLifecycleHooksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLifecycleHooks"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeLoadBalancersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLoadBalancers"; }
     Aws::String SerializePayload() const override;
 
 
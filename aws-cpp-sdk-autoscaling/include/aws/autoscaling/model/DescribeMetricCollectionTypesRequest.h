@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     DescribeMetricCollectionTypesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeMetricCollectionTypes"; }
     Aws::String SerializePayload() const override;
 
 
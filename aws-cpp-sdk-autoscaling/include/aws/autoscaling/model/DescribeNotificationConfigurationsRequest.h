@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeNotificationConfigurationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeNotificationConfigurations"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribePoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribePolicies"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeScalingActivitiesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeScalingActivities"; }
     Aws::String SerializePayload() const override;
 
 
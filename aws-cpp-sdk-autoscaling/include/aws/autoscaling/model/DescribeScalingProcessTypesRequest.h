@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     DescribeScalingProcessTypesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeScalingProcessTypes"; }
     Aws::String SerializePayload() const override;
 
 
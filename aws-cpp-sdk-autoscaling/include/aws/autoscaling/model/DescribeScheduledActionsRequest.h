@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeScheduledActionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeScheduledActions"; }
     Aws::String SerializePayload() const override;
 
 
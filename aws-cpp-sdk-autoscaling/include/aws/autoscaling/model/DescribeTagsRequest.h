@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeTagsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeTags"; }
     Aws::String SerializePayload() const override;
 
 
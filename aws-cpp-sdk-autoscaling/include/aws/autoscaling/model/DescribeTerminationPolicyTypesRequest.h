@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     DescribeTerminationPolicyTypesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeTerminationPolicyTypes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DetachInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachInstances"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DetachLoadBalancersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachLoadBalancers"; }
     Aws::String SerializePayload() const override;
 
 
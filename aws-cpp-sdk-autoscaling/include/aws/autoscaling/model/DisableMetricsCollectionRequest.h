@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DisableMetricsCollectionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisableMetricsCollection"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     EnableMetricsCollectionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnableMetricsCollection"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     EnterStandbyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnterStandby"; }
     Aws::String SerializePayload() const override;
 
 
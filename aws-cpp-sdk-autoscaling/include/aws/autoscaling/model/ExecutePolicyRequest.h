@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ExecutePolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ExecutePolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ExitStandbyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ExitStandby"; }
     Aws::String SerializePayload() const override;
 
 
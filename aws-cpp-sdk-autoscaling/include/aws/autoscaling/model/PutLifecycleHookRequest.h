@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PutLifecycleHookRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutLifecycleHook"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutNotificationConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutNotificationConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
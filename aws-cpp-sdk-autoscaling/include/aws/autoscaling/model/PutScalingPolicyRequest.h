@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     PutScalingPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutScalingPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PutScheduledUpdateGroupActionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutScheduledUpdateGroupAction"; }
     Aws::String SerializePayload() const override;
 
 
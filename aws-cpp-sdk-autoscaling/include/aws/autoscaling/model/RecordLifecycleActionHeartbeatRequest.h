@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RecordLifecycleActionHeartbeatRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RecordLifecycleActionHeartbeat"; }
     Aws::String SerializePayload() const override;
 
 
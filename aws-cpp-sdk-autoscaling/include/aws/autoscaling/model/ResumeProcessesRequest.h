@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ResumeProcessesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ResumeProcesses"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     SetDesiredCapacityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetDesiredCapacity"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     SetInstanceHealthRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetInstanceHealth"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SuspendProcessesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SuspendProcesses"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     TerminateInstanceInAutoScalingGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "TerminateInstanceInAutoScalingGroup"; }
     Aws::String SerializePayload() const override;
 
 
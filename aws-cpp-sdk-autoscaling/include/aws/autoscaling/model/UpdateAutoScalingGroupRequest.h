@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UpdateAutoScalingGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateAutoScalingGroup"; }
     Aws::String SerializePayload() const override;
 
 
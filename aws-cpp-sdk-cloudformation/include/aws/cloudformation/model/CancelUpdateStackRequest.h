@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CancelUpdateStackRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CancelUpdateStack"; }
     Aws::String SerializePayload() const override;
 
 
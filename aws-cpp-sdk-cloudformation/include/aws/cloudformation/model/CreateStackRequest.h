@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     CreateStackRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateStack"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteStackRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteStack"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeAccountLimitsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAccountLimits"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeStackEventsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeStackEvents"; }
     Aws::String SerializePayload() const override;
 
 
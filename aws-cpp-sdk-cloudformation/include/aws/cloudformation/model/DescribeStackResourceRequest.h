@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeStackResourceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeStackResource"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeStackResourcesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeStackResources"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     EstimateTemplateCostRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EstimateTemplateCost"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetStackPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetStackPolicy"; }
     Aws::String SerializePayload() const override;
 
 
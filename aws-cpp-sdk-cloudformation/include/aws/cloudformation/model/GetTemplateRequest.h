@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetTemplateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetTemplate"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetTemplateSummaryRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetTemplateSummary"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListStackResourcesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListStackResources"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ListStacksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListStacks"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SetStackPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetStackPolicy"; }
     Aws::String SerializePayload() const override;
 
 
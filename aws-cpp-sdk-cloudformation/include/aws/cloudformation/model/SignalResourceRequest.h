@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SignalResourceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SignalResource"; }
     Aws::String SerializePayload() const override;
 
 
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     UpdateStackRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateStack"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ValidateTemplateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ValidateTemplate"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateInvalidation2015_04_17Request();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateInvalidation2015_04_17"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateStreamingDistribution2015_04_17Request();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateStreamingDistribution2015_04_17"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteCloudFrontOriginAccessIdentity2015_04_17Request();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteCloudFrontOriginAccessIdentity2015_04_17"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
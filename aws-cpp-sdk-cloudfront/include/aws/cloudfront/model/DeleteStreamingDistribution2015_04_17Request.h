@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteStreamingDistribution2015_04_17Request();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteStreamingDistribution2015_04_17"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
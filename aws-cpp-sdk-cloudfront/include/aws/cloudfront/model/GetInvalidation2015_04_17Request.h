@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetInvalidation2015_04_17Request();
+    inline virtual const char* GetServiceRequestName() const override { return "GetInvalidation2015_04_17"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetStreamingDistribution2015_04_17Request();
+    inline virtual const char* GetServiceRequestName() const override { return "GetStreamingDistribution2015_04_17"; }
     Aws::String SerializePayload() const override;
 
 
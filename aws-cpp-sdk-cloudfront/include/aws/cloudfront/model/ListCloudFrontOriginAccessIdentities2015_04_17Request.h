@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListCloudFrontOriginAccessIdentities2015_04_17Request();
+    inline virtual const char* GetServiceRequestName() const override { return "ListCloudFrontOriginAccessIdentities2015_04_17"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
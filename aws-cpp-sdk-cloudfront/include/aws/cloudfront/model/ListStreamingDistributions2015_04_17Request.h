@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListStreamingDistributions2015_04_17Request();
+    inline virtual const char* GetServiceRequestName() const override { return "ListStreamingDistributions2015_04_17"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
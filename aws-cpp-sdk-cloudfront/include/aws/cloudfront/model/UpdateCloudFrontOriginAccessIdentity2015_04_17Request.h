@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     UpdateCloudFrontOriginAccessIdentity2015_04_17Request();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateCloudFrontOriginAccessIdentity2015_04_17"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
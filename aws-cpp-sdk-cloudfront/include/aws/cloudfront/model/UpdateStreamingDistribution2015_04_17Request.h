@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     UpdateStreamingDistribution2015_04_17Request();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateStreamingDistribution2015_04_17"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
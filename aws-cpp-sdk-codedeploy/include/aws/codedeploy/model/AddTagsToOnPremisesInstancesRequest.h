@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     AddTagsToOnPremisesInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddTagsToOnPremisesInstances"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     BatchGetApplicationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "BatchGetApplications"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     BatchGetDeploymentsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "BatchGetDeployments"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
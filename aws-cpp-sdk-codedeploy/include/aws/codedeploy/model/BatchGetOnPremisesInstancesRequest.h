@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     BatchGetOnPremisesInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "BatchGetOnPremisesInstances"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateDeploymentConfigRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDeploymentConfig"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
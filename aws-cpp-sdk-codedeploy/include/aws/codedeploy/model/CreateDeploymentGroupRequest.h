@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     CreateDeploymentGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDeploymentGroup"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
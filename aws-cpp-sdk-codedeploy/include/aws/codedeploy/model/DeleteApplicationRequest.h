@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteApplicationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteApplication"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteDeploymentConfigRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDeploymentConfig"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
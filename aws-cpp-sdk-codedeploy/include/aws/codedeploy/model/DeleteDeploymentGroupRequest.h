@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteDeploymentGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDeploymentGroup"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeregisterOnPremisesInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeregisterOnPremisesInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
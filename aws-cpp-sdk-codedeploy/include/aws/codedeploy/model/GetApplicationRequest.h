@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetApplicationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetApplication"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
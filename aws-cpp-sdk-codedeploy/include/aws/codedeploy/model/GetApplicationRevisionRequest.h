@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     GetApplicationRevisionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetApplicationRevision"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetDeploymentConfigRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetDeploymentConfig"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
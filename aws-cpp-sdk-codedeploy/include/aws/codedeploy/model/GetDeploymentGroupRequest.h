@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetDeploymentGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetDeploymentGroup"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetDeploymentInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetDeploymentInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
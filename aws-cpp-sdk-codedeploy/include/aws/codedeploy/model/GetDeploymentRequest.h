@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetDeploymentRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetDeployment"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
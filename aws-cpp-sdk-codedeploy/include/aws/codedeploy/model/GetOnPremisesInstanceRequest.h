@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetOnPremisesInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetOnPremisesInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     ListApplicationRevisionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListApplicationRevisions"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
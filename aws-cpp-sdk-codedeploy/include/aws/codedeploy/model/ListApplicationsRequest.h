@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListApplicationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListApplications"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
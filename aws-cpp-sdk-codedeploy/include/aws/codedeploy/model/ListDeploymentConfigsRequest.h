@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListDeploymentConfigsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListDeploymentConfigs"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
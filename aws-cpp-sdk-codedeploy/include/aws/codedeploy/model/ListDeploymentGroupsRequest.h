@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListDeploymentGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListDeploymentGroups"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
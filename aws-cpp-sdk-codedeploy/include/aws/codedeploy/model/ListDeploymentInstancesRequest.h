@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ListDeploymentInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListDeploymentInstances"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     ListDeploymentsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListDeployments"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
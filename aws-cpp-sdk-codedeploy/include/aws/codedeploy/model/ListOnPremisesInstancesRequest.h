@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     ListOnPremisesInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListOnPremisesInstances"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
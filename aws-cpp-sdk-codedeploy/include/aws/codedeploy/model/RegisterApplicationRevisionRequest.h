@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RegisterApplicationRevisionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterApplicationRevision"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
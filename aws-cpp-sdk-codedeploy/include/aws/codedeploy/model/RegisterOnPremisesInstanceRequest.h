@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RegisterOnPremisesInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterOnPremisesInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
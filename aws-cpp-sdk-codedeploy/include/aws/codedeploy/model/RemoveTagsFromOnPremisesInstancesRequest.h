@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     RemoveTagsFromOnPremisesInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemoveTagsFromOnPremisesInstances"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     StopDeploymentRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "StopDeployment"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     UpdateDeploymentGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateDeploymentGroup"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
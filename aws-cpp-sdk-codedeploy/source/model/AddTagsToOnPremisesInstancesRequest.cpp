@@ -53,7 +53,7 @@ Aws::String AddTagsToOnPremisesInstancesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection AddTagsToOnPremisesInstancesRequest::GetRequestSpecificHeaders() const
@@ -41,7 +41,7 @@ Aws::String BatchGetApplicationsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection BatchGetApplicationsRequest::GetRequestSpecificHeaders() const
@@ -41,7 +41,7 @@ Aws::String BatchGetDeploymentsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection BatchGetDeploymentsRequest::GetRequestSpecificHeaders() const
@@ -41,7 +41,7 @@ Aws::String BatchGetOnPremisesInstancesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection BatchGetOnPremisesInstancesRequest::GetRequestSpecificHeaders() const
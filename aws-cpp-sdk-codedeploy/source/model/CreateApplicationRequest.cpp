@@ -36,7 +36,7 @@ Aws::String CreateApplicationRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateApplicationRequest::GetRequestSpecificHeaders() const
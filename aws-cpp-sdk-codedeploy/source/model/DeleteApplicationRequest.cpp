@@ -36,7 +36,7 @@ Aws::String DeleteApplicationRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteApplicationRequest::GetRequestSpecificHeaders() const
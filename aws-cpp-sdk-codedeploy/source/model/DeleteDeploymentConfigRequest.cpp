@@ -36,7 +36,7 @@ Aws::String DeleteDeploymentConfigRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteDeploymentConfigRequest::GetRequestSpecificHeaders() const
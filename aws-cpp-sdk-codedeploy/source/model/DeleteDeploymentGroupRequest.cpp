@@ -43,7 +43,7 @@ Aws::String DeleteDeploymentGroupRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteDeploymentGroupRequest::GetRequestSpecificHeaders() const
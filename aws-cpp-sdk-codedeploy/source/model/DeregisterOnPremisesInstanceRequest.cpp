@@ -36,7 +36,7 @@ Aws::String DeregisterOnPremisesInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeregisterOnPremisesInstanceRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String GetApplicationRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetApplicationRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String GetApplicationRevisionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetApplicationRevisionRequest::GetRequestSpecificHeaders() const
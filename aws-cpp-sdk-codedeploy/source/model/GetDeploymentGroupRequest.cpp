@@ -43,7 +43,7 @@ Aws::String GetDeploymentGroupRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetDeploymentGroupRequest::GetRequestSpecificHeaders() const
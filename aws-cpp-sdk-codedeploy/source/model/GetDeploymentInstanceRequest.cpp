@@ -43,7 +43,7 @@ Aws::String GetDeploymentInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetDeploymentInstanceRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String GetDeploymentRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetDeploymentRequest::GetRequestSpecificHeaders() const
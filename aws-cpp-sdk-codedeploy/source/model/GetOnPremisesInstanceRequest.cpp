@@ -36,7 +36,7 @@ Aws::String GetOnPremisesInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetOnPremisesInstanceRequest::GetRequestSpecificHeaders() const
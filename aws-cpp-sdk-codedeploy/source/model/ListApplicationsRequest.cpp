@@ -36,7 +36,7 @@ Aws::String ListApplicationsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListApplicationsRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String ListDeploymentConfigsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListDeploymentConfigsRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String ListDeploymentGroupsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListDeploymentGroupsRequest::GetRequestSpecificHeaders() const
@@ -55,7 +55,7 @@ Aws::String ListDeploymentInstancesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListDeploymentInstancesRequest::GetRequestSpecificHeaders() const
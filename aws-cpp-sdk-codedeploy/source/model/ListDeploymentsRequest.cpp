@@ -69,7 +69,7 @@ Aws::String ListDeploymentsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListDeploymentsRequest::GetRequestSpecificHeaders() const
@@ -54,7 +54,7 @@ Aws::String ListOnPremisesInstancesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListOnPremisesInstancesRequest::GetRequestSpecificHeaders() const
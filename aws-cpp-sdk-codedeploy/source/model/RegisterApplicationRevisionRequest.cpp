@@ -50,7 +50,7 @@ Aws::String RegisterApplicationRevisionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RegisterApplicationRevisionRequest::GetRequestSpecificHeaders() const
@@ -53,7 +53,7 @@ Aws::String RemoveTagsFromOnPremisesInstancesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RemoveTagsFromOnPremisesInstancesRequest::GetRequestSpecificHeaders() const
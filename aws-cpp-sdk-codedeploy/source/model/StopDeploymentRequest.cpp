@@ -36,7 +36,7 @@ Aws::String StopDeploymentRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection StopDeploymentRequest::GetRequestSpecificHeaders() const
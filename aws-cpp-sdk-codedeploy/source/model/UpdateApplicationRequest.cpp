@@ -43,7 +43,7 @@ Aws::String UpdateApplicationRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateApplicationRequest::GetRequestSpecificHeaders() const
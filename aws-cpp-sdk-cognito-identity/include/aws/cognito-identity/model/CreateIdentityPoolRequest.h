@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateIdentityPoolRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateIdentityPool"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
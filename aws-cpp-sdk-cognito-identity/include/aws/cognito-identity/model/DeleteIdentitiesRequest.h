@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DeleteIdentitiesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteIdentities"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteIdentityPoolRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteIdentityPool"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
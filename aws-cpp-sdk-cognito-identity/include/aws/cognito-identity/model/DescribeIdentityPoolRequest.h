@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeIdentityPoolRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeIdentityPool"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeIdentityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeIdentity"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
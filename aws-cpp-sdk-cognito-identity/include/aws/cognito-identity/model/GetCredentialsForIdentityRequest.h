@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     GetCredentialsForIdentityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetCredentialsForIdentity"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     GetIdRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetId"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
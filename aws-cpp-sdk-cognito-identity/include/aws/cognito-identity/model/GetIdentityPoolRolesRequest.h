@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetIdentityPoolRolesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetIdentityPoolRoles"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
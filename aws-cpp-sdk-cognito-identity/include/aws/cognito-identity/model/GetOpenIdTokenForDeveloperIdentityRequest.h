@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     GetOpenIdTokenForDeveloperIdentityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetOpenIdTokenForDeveloperIdentity"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
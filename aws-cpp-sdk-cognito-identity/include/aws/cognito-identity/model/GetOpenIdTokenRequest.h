@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     GetOpenIdTokenRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetOpenIdToken"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListIdentitiesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListIdentities"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListIdentityPoolsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListIdentityPools"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     LookupDeveloperIdentityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "LookupDeveloperIdentity"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     MergeDeveloperIdentitiesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "MergeDeveloperIdentities"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
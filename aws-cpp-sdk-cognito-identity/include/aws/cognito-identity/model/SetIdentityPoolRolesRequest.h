@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetIdentityPoolRolesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetIdentityPoolRoles"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UnlinkDeveloperIdentityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UnlinkDeveloperIdentity"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     UnlinkIdentityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UnlinkIdentity"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     UpdateIdentityPoolRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateIdentityPool"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
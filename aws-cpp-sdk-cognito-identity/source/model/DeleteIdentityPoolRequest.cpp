@@ -36,7 +36,7 @@ Aws::String DeleteIdentityPoolRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteIdentityPoolRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DescribeIdentityPoolRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeIdentityPoolRequest::GetRequestSpecificHeaders() const
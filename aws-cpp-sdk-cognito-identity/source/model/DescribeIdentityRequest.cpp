@@ -36,7 +36,7 @@ Aws::String DescribeIdentityRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeIdentityRequest::GetRequestSpecificHeaders() const
@@ -55,7 +55,7 @@ Aws::String GetIdRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetIdRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String GetIdentityPoolRolesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetIdentityPoolRolesRequest::GetRequestSpecificHeaders() const
@@ -48,7 +48,7 @@ Aws::String GetOpenIdTokenRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetOpenIdTokenRequest::GetRequestSpecificHeaders() const
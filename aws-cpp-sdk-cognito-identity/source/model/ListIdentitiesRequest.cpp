@@ -59,7 +59,7 @@ Aws::String ListIdentitiesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListIdentitiesRequest::GetRequestSpecificHeaders() const
@@ -44,7 +44,7 @@ Aws::String ListIdentityPoolsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListIdentityPoolsRequest::GetRequestSpecificHeaders() const
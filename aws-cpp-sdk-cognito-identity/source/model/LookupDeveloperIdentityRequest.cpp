@@ -65,7 +65,7 @@ Aws::String LookupDeveloperIdentityRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection LookupDeveloperIdentityRequest::GetRequestSpecificHeaders() const
@@ -57,7 +57,7 @@ Aws::String MergeDeveloperIdentitiesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection MergeDeveloperIdentitiesRequest::GetRequestSpecificHeaders() const
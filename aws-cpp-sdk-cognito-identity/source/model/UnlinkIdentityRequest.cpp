@@ -60,7 +60,7 @@ Aws::String UnlinkIdentityRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UnlinkIdentityRequest::GetRequestSpecificHeaders() const
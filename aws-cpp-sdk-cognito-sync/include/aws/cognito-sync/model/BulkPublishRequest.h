@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     BulkPublishRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "BulkPublish"; }
     Aws::String SerializePayload() const override;
 
 
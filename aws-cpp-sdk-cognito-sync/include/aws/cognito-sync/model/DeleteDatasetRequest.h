@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteDatasetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDataset"; }
     Aws::String SerializePayload() const override;
 
 
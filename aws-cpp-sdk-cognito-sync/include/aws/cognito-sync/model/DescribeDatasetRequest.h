@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeDatasetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDataset"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeIdentityPoolUsageRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeIdentityPoolUsage"; }
     Aws::String SerializePayload() const override;
 
 
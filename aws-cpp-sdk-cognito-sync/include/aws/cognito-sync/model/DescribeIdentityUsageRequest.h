@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeIdentityUsageRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeIdentityUsage"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetBulkPublishDetailsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBulkPublishDetails"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetCognitoEventsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetCognitoEvents"; }
     Aws::String SerializePayload() const override;
 
 
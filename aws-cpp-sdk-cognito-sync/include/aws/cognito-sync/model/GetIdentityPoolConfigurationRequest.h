@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetIdentityPoolConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetIdentityPoolConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListDatasetsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListDatasets"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListRecordsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListRecords"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RegisterDeviceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterDevice"; }
     Aws::String SerializePayload() const override;
 
 
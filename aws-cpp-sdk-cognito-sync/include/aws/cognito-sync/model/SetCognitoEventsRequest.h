@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetCognitoEventsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetCognitoEvents"; }
     Aws::String SerializePayload() const override;
 
 
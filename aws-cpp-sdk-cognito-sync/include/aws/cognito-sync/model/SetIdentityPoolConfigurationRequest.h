@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     SetIdentityPoolConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetIdentityPoolConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SubscribeToDatasetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SubscribeToDataset"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UnsubscribeFromDatasetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UnsubscribeFromDataset"; }
     Aws::String SerializePayload() const override;
 
 
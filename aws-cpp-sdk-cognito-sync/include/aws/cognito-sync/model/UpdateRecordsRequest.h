@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     UpdateRecordsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateRecords"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
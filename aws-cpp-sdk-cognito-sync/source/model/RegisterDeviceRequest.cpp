@@ -44,7 +44,7 @@ Aws::String RegisterDeviceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
@@ -42,7 +42,7 @@ Aws::String SetCognitoEventsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
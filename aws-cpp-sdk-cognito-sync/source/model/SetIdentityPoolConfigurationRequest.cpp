@@ -44,7 +44,7 @@ Aws::String SetIdentityPoolConfigurationRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
@@ -60,7 +60,7 @@ Aws::String UpdateRecordsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateRecordsRequest::GetRequestSpecificHeaders() const
@@ -0,0 +1,402 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/crypto/Sha256HMAC.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char* ALLOCATION_TAG = "AWSAuthSignerTest";
+
+class RotatingCredentialsProvider : public AWSCredentialsProvider
+{
+public:
+    RotatingCredentialsProvider(const AWSCredentials& credentials) : m_credentials(credentials) {}
+
+    AWSCredentials GetAWSCredentials() override { return m_credentials; }
+
+    void SetCredentials(const AWSCredentials& credentials) { m_credentials = credentials; }
+
+private:
+    AWSCredentials m_credentials;
+};
+
+static std::shared_ptr<HttpRequest> CreateRequest()
+{
+    auto request = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, URI("https://dynamodb.us-east-1.amazonaws.com/"), HttpMethod::HTTP_POST);
+    request->SetHeaderValue(HOST_HEADER, "dynamodb.us-east-1.amazonaws.com");
+    request->SetHeaderValue("x-amz-target", "DynamoDB_20120810.GetItem");
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *body << "{\"TableName\":\"table\",\"Key\":{\"id\":{\"S\":\"1\"}}}";
+    request->AddContentBody(body);
+    return request;
+}
+
+//signs a fresh request with both signers, retrying if the clock ticked over between the two so the signatures are comparable.
+static void SignWithBoth(const AWSAuthV4Signer& first, const AWSAuthV4Signer& second, Aws::String& firstAuth, Aws::String& secondAuth)
+{
+    for (int attempt = 0; attempt < 5; ++attempt)
+    {
+        auto firstRequest = CreateRequest();
+        auto secondRequest = CreateRequest();
+        ASSERT_TRUE(first.SignRequest(*firstRequest));
+        ASSERT_TRUE(second.SignRequest(*secondRequest));
+
+        if (firstRequest->GetHeaderValue("x-amz-date") == secondRequest->GetHeaderValue("x-amz-date"))
+        {
+            firstAuth = firstRequest->GetAwsAuthorization();
+            secondAuth = secondRequest->GetAwsAuthorization();
+            return;
+        }
+    }
+
+    FAIL() << "Could not sign two requests within the same second";
+}
+
+static ByteBuffer Hmac(const ByteBuffer& key, const Aws::String& data)
+{
+    Sha256HMAC hmac;
+    return hmac.Calculate(ByteBuffer((unsigned char*)data.c_str(), data.length()), key).GetResult();
+}
+
+//Straightforward SigV4 built from URI and HttpRequest accessors, used to check the signer's single-pass canonicalization.
+static Aws::String ComputeReferenceAuthorization(const HttpRequest& request, const AWSCredentials& credentials, const char* region, const char* service)
+{
+    Aws::StringStream canonicalRequest;
+    canonicalRequest << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod()) << "\n" << request.GetUri().GetURLEncodedPath() << "\n";
+    const Aws::String& queryString = request.GetQueryString();
+    if (queryString.size() > 1)
+    {
+        canonicalRequest << queryString.substr(1) << (queryString.find("=") == Aws::String::npos ? "=" : "");
+    }
+    canonicalRequest << "\n";
+
+    Aws::StringStream signedHeaders;
+    for (const auto& header : request.GetHeaders())
+    {
+        if (header.first == "authorization")
+        {
+            continue;
+        }
+        canonicalRequest << header.first << ":" << header.second << "\n";
+        signedHeaders << (signedHeaders.str().empty() ? "" : ";") << header.first;
+    }
+    canonicalRequest << "\n" << signedHeaders.str() << "\n" << request.GetHeaderValue("x-amz-content-sha256");
+
+    Sha256 sha256;
+    Aws::String date = request.GetHeaderValue("x-amz-date");
+    Aws::String simpleDate = date.substr(0, 8);
+    Aws::String scope = simpleDate + "/" + region + "/" + service + "/aws4_request";
+    Aws::String stringToSign = "AWS4-HMAC-SHA256\n" + date + "\n" + scope + "\n" +
+        HashingUtils::HexEncode(sha256.Calculate(canonicalRequest.str()).GetResult());
+
+    Aws::String secret = "AWS4" + credentials.GetAWSSecretKey();
+    ByteBuffer key = Hmac(ByteBuffer((unsigned char*)secret.c_str(), secret.length()), simpleDate);
+    key = Hmac(key, region);
+    key = Hmac(key, service);
+    key = Hmac(key, "aws4_request");
+
+    return "AWS4-HMAC-SHA256 Credential=" + credentials.GetAWSAccessKeyId() + "/" + scope + ", SignedHeaders=" + signedHeaders.str() +
+        ", Signature=" + HashingUtils::HexEncode(Hmac(key, stringToSign));
+}
+
+TEST(AWSAuthSignerTest, TestSignatureMatchesReferenceImplementation)
+{
+    AWSCredentials credentials("akid", "secret");
+    auto credentialsProvider = Aws::MakeShared<RotatingCredentialsProvider>(ALLOCATION_TAG, credentials);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", Aws::Region::US_EAST_1);
+
+    std::shared_ptr<HttpRequest> request = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, URI("https://bucket.s3.amazonaws.com//photos/my pic+1.jpg/"), HttpMethod::HTTP_PUT);
+    request->AddQueryStringParameter("uploadId", "abc def");
+    request->AddQueryStringParameter("partNumber", "2");
+    request->SetHeaderValue("x-amz-meta-Owner", "  someone  ");
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *body << "part data";
+    request->AddContentBody(body);
+
+    ASSERT_TRUE(signer.SignRequest(*request));
+    ASSERT_STREQ(ComputeReferenceAuthorization(*request, credentials, "us-east-1", "s3").c_str(), request->GetAwsAuthorization().c_str());
+
+    //a bare path and no query string
+    request = CreateRequest();
+    ASSERT_TRUE(signer.SignRequest(*request));
+    ASSERT_STREQ(ComputeReferenceAuthorization(*request, credentials, "us-east-1", "s3").c_str(), request->GetAwsAuthorization().c_str());
+}
+
+TEST(AWSAuthSignerTest, TestUnsignedPayloadOverTls)
+{
+    auto credentialsProvider = Aws::MakeShared<RotatingCredentialsProvider>(ALLOCATION_TAG, AWSCredentials("akid", "secret"));
+    AWSAuthV4Signer signer(credentialsProvider, "s3", Aws::Region::US_EAST_1, PayloadSigningPolicy::UNSIGNED_OVER_TLS);
+
+    auto request = CreateRequest();
+    ASSERT_TRUE(signer.SignRequest(*request));
+    ASSERT_EQ("UNSIGNED-PAYLOAD", request->GetHeaderValue("x-amz-content-sha256"));
+
+    //plain http has nothing protecting the body, so it is still hashed.
+    std::shared_ptr<HttpRequest> httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, URI("http://bucket.s3.amazonaws.com/key"), HttpMethod::HTTP_PUT);
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *body << "data";
+    httpRequest->AddContentBody(body);
+    ASSERT_TRUE(signer.SignRequest(*httpRequest));
+
+    Sha256 sha256;
+    ASSERT_EQ(HashingUtils::HexEncode(sha256.Calculate(Aws::String("data")).GetResult()), httpRequest->GetHeaderValue("x-amz-content-sha256"));
+}
+
+TEST(AWSAuthSignerTest, TestPresetPayloadHashIsNotRecomputed)
+{
+    AWSCredentials credentials("akid", "secret");
+    auto credentialsProvider = Aws::MakeShared<RotatingCredentialsProvider>(ALLOCATION_TAG, credentials);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", Aws::Region::US_EAST_1);
+
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *body << "data";
+    std::shared_ptr<HttpRequest> request = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, URI("http://bucket.s3.amazonaws.com/key"), HttpMethod::HTTP_PUT);
+    request->AddContentBody(body);
+    ASSERT_TRUE(signer.SignRequest(*request));
+    Aws::String payloadHash = request->GetHeaderValue("x-amz-content-sha256");
+
+    //a retry of the same payload: the hash carried over from the first attempt is signed as is, the body is not read again.
+    body->seekg(0, body->end);
+    std::shared_ptr<HttpRequest> retry = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, URI("http://bucket.s3.amazonaws.com/key"), HttpMethod::HTTP_PUT);
+    retry->AddContentBody(body);
+    retry->SetHeaderValue("x-amz-content-sha256", payloadHash);
+    ASSERT_TRUE(signer.SignRequest(*retry));
+
+    ASSERT_EQ(payloadHash, retry->GetHeaderValue("x-amz-content-sha256"));
+    ASSERT_EQ(std::streampos(4), body->tellg());
+    ASSERT_STREQ(ComputeReferenceAuthorization(*retry, credentials, "us-east-1", "s3").c_str(), retry->GetAwsAuthorization().c_str());
+}
+
+//reads the body the way CurlHttpClient::ReadBody does: check the length, go back, read a piece.
+static Aws::String ReadLikeHttpClient(Aws::IOStream& body)
+{
+    Aws::String result;
+    char buffer[16 * 1024];
+    for (;;)
+    {
+        auto currentPos = body.tellg();
+        body.seekg(0, body.end);
+        auto length = body.tellg();
+        body.seekg(currentPos, body.beg);
+        size_t amountToRead = static_cast<size_t>(std::min<decltype(length)>(length - currentPos, sizeof(buffer)));
+        if (amountToRead == 0)
+        {
+            return result;
+        }
+
+        body.read(buffer, amountToRead);
+        result.append(buffer, static_cast<size_t>(body.gcount()));
+    }
+}
+
+TEST(AWSAuthSignerTest, TestStreamingPayloadSignsEachChunk)
+{
+    AWSCredentials credentials("akid", "secret");
+    auto credentialsProvider = Aws::MakeShared<RotatingCredentialsProvider>(ALLOCATION_TAG, credentials);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", Aws::Region::US_EAST_1, PayloadSigningPolicy::STREAMING);
+
+    Aws::String payload;
+    for (size_t i = 0; i < 150 * 1024; ++i)
+    {
+        payload.push_back(static_cast<char>('a' + i % 26));
+    }
+
+    std::shared_ptr<HttpRequest> request = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, URI("https://bucket.s3.amazonaws.com/key"), HttpMethod::HTTP_PUT);
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *body << payload;
+    request->AddContentBody(body);
+
+    ASSERT_TRUE(signer.SignRequest(*request));
+    ASSERT_EQ("STREAMING-AWS4-HMAC-SHA256-PAYLOAD", request->GetHeaderValue("x-amz-content-sha256"));
+    ASSERT_EQ("aws-chunked", request->GetHeaderValue("content-encoding"));
+    ASSERT_EQ("153600", request->GetHeaderValue("x-amz-decoded-content-length"));
+    ASSERT_STREQ(ComputeReferenceAuthorization(*request, credentials, "us-east-1", "s3").c_str(), request->GetAwsAuthorization().c_str());
+
+    Aws::String encoded = ReadLikeHttpClient(*request->GetContentBody());
+    ASSERT_EQ(request->GetHeaderValue("content-length"), StringUtils::to_string(encoded.length()));
+
+    //rewinding restarts the signature chain and produces the same bytes again.
+    request->GetContentBody()->clear();
+    request->GetContentBody()->seekg(0, std::ios_base::beg);
+    ASSERT_EQ(encoded, ReadLikeHttpClient(*request->GetContentBody()));
+
+    //walk the frames and check each chunk signature against the chain seeded by the request signature.
+    const Aws::String& authorization = request->GetAwsAuthorization();
+    Aws::String previousSignature = authorization.substr(authorization.find("Signature=") + strlen("Signature="));
+    Aws::String date = request->GetHeaderValue("x-amz-date");
+    Aws::String scope = date.substr(0, 8) + "/us-east-1/s3/aws4_request";
+    Aws::String secret = "AWS4" + credentials.GetAWSSecretKey();
+    ByteBuffer key = Hmac(ByteBuffer((unsigned char*)secret.c_str(), secret.length()), date.substr(0, 8));
+    key = Hmac(Hmac(Hmac(key, "us-east-1"), "s3"), "aws4_request");
+
+    Sha256 sha256;
+    Aws::String decoded;
+    size_t position = 0;
+    size_t chunkCount = 0;
+    for (;;)
+    {
+        size_t headerEnd = encoded.find("\r\n", position);
+        ASSERT_NE(Aws::String::npos, headerEnd);
+        Aws::String header = encoded.substr(position, headerEnd - position);
+        size_t separator = header.find(";chunk-signature=");
+        ASSERT_NE(Aws::String::npos, separator);
+        size_t chunkLength = static_cast<size_t>(strtol(header.substr(0, separator).c_str(), nullptr, 16));
+        Aws::String chunkSignature = header.substr(separator + strlen(";chunk-signature="));
+        Aws::String chunk = encoded.substr(headerEnd + 2, chunkLength);
+        ASSERT_EQ("\r\n", encoded.substr(headerEnd + 2 + chunkLength, 2));
+
+        Aws::String stringToSign = "AWS4-HMAC-SHA256-PAYLOAD\n" + date + "\n" + scope + "\n" + previousSignature + "\n" +
+            HashingUtils::HexEncode(sha256.Calculate(Aws::String()).GetResult()) + "\n" + HashingUtils::HexEncode(sha256.Calculate(chunk).GetResult());
+        ASSERT_EQ(HashingUtils::HexEncode(Hmac(key, stringToSign)), chunkSignature);
+
+        previousSignature = chunkSignature;
+        decoded.append(chunk);
+        position = headerEnd + 2 + chunkLength + 2;
+        ++chunkCount;
+        if (chunkLength == 0)
+        {
+            break;
+        }
+    }
+
+    ASSERT_EQ(encoded.length(), position);
+    ASSERT_EQ(4u, chunkCount);
+    ASSERT_EQ(payload, decoded);
+}
+
+TEST(AWSAuthSignerTest, TestCachedSigningKeyMatchesFreshDerivation)
+{
+    auto credentialsProvider = Aws::MakeShared<RotatingCredentialsProvider>(ALLOCATION_TAG, AWSCredentials("akid", "secret"));
+    AWSAuthV4Signer warmSigner(credentialsProvider, "dynamodb", Aws::Region::US_EAST_1);
+
+    //populate the cache, then compare against a signer that has to derive the key.
+    auto request = CreateRequest();
+    ASSERT_TRUE(warmSigner.SignRequest(*request));
+
+    AWSAuthV4Signer coldSigner(credentialsProvider, "dynamodb", Aws::Region::US_EAST_1);
+    Aws::String warmAuth, coldAuth;
+    SignWithBoth(warmSigner, coldSigner, warmAuth, coldAuth);
+
+    ASSERT_FALSE(warmAuth.empty());
+    ASSERT_EQ(coldAuth, warmAuth);
+}
+
+TEST(AWSAuthSignerTest, TestCredentialRotationInvalidatesSigningKey)
+{
+    auto credentialsProvider = Aws::MakeShared<RotatingCredentialsProvider>(ALLOCATION_TAG, AWSCredentials("akid", "secret"));
+    auto oldCredentialsProvider = Aws::MakeShared<RotatingCredentialsProvider>(ALLOCATION_TAG, AWSCredentials("akid", "secret"));
+    AWSAuthV4Signer signer(credentialsProvider, "dynamodb", Aws::Region::US_EAST_1);
+    AWSAuthV4Signer oldSigner(oldCredentialsProvider, "dynamodb", Aws::Region::US_EAST_1);
+
+    auto request = CreateRequest();
+    ASSERT_TRUE(signer.SignRequest(*request));
+
+    //same access key, new secret: the cached key must not be reused.
+    credentialsProvider->SetCredentials(AWSCredentials("akid", "rotatedSecret"));
+    auto newCredentialsProvider = Aws::MakeShared<RotatingCredentialsProvider>(ALLOCATION_TAG, AWSCredentials("akid", "rotatedSecret"));
+    AWSAuthV4Signer newSigner(newCredentialsProvider, "dynamodb", Aws::Region::US_EAST_1);
+
+    Aws::String rotatedAuth, freshAuth;
+    SignWithBoth(signer, newSigner, rotatedAuth, freshAuth);
+    ASSERT_EQ(freshAuth, rotatedAuth);
+
+    Aws::String oldAuth;
+    SignWithBoth(signer, oldSigner, rotatedAuth, oldAuth);
+    ASSERT_NE(oldAuth, rotatedAuth);
+}
+
+//Not a pass/fail test: reports per-request signing cost when the derived key is reused versus rederived every time.
+TEST(AWSAuthSignerTest, DISABLED_SigningKeyCacheBenchmark)
+{
+    static const int ITERATIONS = 2000;
+
+    auto credentialsProvider = Aws::MakeShared<RotatingCredentialsProvider>(ALLOCATION_TAG, AWSCredentials("akid", "secret"));
+    AWSAuthV4Signer signer(credentialsProvider, "dynamodb", Aws::Region::US_EAST_1);
+    AWSCredentials credentials[] = { AWSCredentials("akid", "secret"), AWSCredentials("akid", "otherSecret") };
+
+    auto request = CreateRequest();
+
+    //alternating secrets forces a key derivation on every request, which is what every request used to pay.
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        credentialsProvider->SetCredentials(credentials[i % 2]);
+        signer.SignRequest(*request);
+    }
+    auto uncached = std::chrono::steady_clock::now() - start;
+
+    credentialsProvider->SetCredentials(credentials[0]);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        signer.SignRequest(*request);
+    }
+    auto cached = std::chrono::steady_clock::now() - start;
+
+    std::cout << "SigV4 signing, derived key per request: "
+        << std::chrono::duration_cast<std::chrono::nanoseconds>(uncached).count() / ITERATIONS << " ns/request" << std::endl;
+    std::cout << "SigV4 signing, cached signing key:      "
+        << std::chrono::duration_cast<std::chrono::nanoseconds>(cached).count() / ITERATIONS << " ns/request" << std::endl;
+}
+
+#ifdef AWS_CUSTOM_MEMORY_MANAGEMENT
+
+//Not a pass/fail test: reports how many allocations signing a typical request costs once the signing key is cached.
+TEST(AWSAuthSignerTest, DISABLED_SignRequestAllocationBenchmark)
+{
+    static const int ITERATIONS = 200;
+
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto credentialsProvider = Aws::MakeShared<RotatingCredentialsProvider>(ALLOCATION_TAG, AWSCredentials("akid", "secret"));
+    AWSAuthV4Signer signer(credentialsProvider, "dynamodb", Aws::Region::US_EAST_1);
+    auto request = CreateRequest();
+    request->AddQueryStringParameter("marker", "some/key name");
+    signer.SignRequest(*request);
+
+    uint64_t allocationsBefore = memorySystem.GetTotalAllocationCount();
+    uint64_t bytesBefore = memorySystem.GetTotalBytesAllocated();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        signer.SignRequest(*request);
+    }
+
+    std::cout << "SigV4 signing: " << (memorySystem.GetTotalAllocationCount() - allocationsBefore) / ITERATIONS << " allocations, "
+        << (memorySystem.GetTotalBytesAllocated() - bytesBefore) / ITERATIONS << " bytes per request" << std::endl;
+
+    AWS_END_MEMORY_TEST
+}
+
+#endif // AWS_CUSTOM_MEMORY_MANAGEMENT
@@ -23,8 +23,15 @@
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/StringUtils.h>
+
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
 #include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
 #include <thread>
 #include <fstream>
 
@@ -361,4 +368,182 @@ TEST(InstanceProfileCredentialsProviderTest, TestEC2MetadataClientReturnsBadData
     AWS_END_MEMORY_TEST
 }
 
+//hands out numbered generations whose key and secret always carry the same number.
+class GenerationalCredentialsProvider : public RefreshingAWSCredentialsProvider
+{
+public:
+    GenerationalCredentialsProvider(long refreshRateMs) : RefreshingAWSCredentialsProvider(refreshRateMs), m_loads(0), m_failLoads(false)
+    {
+    }
+
+    ~GenerationalCredentialsProvider()
+    {
+        StopRefreshing();
+    }
+
+    int GetLoadCount() const { return m_loads; }
+    void SetFailLoads(bool failLoads) { m_failLoads = failLoads; }
+
+protected:
+    bool LoadCredentials(AWSCredentials& credentials) override
+    {
+        if (m_failLoads)
+        {
+            return false;
+        }
+        int generation = ++m_loads;
+        credentials = AWSCredentials("AccessKey" + StringUtils::to_string(generation), "SecretKey" + StringUtils::to_string(generation));
+        return true;
+    }
+
+private:
+    std::atomic<int> m_loads;
+    std::atomic<bool> m_failLoads;
+};
+
+TEST(RefreshingAWSCredentialsProviderTest, TestReloadsInTheBackground)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    GenerationalCredentialsProvider provider(20);
+    ASSERT_EQ(0, provider.GetLoadCount());
+    ASSERT_STREQ("AccessKey1", provider.GetAWSCredentials().GetAWSAccessKeyId().c_str());
+
+    //nobody asks for credentials while we wait, the refresh thread renews them anyway.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (provider.GetLoadCount() < 3 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_LE(3, provider.GetLoadCount());
+
+    //failed reloads keep serving the last good credentials.
+    provider.SetFailLoads(true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    Aws::String lastKey = provider.GetAWSCredentials().GetAWSAccessKeyId();
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    ASSERT_EQ(lastKey, provider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_STRNE("", lastKey.c_str());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(RefreshingAWSCredentialsProviderTest, TestReadersSeeConsistentSnapshotsDuringRefresh)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    GenerationalCredentialsProvider provider(1);
+    std::atomic<bool> mismatched(false);
+    Aws::Vector<std::thread> readers;
+    for (int t = 0; t < 8; ++t)
+    {
+        readers.push_back(std::thread([&]()
+        {
+            auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+            while (std::chrono::steady_clock::now() < end)
+            {
+                AWSCredentials credentials = provider.GetAWSCredentials();
+                if (credentials.GetAWSAccessKeyId().substr(9) != credentials.GetAWSSecretKey().substr(9))
+                {
+                    mismatched = true;
+                }
+            }
+        }));
+    }
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    ASSERT_FALSE(mismatched);
+    ASSERT_LT(1, provider.GetLoadCount());
+
+    AWS_END_MEMORY_TEST
+}
+
+//the way the profile and instance providers read credentials before: a mutex and an expiry check on every call.
+class MutexCredentialsProvider : public AWSCredentialsProvider
+{
+public:
+    MutexCredentialsProvider() : m_credentials("AccessKey", "SecretKey", Aws::String(600, 't'))
+    {
+    }
+
+    AWSCredentials GetAWSCredentials() override
+    {
+        std::lock_guard<std::mutex> locker(m_reloadMutex);
+        IsTimeToRefresh(1000 * 60 * 15);
+        return m_credentials;
+    }
+
+private:
+    AWSCredentials m_credentials;
+    std::mutex m_reloadMutex;
+};
+
+class FixedCredentialsProvider : public RefreshingAWSCredentialsProvider
+{
+public:
+    FixedCredentialsProvider() : RefreshingAWSCredentialsProvider(1000 * 60 * 15)
+    {
+    }
+
+    ~FixedCredentialsProvider()
+    {
+        StopRefreshing();
+    }
 
+protected:
+    bool LoadCredentials(AWSCredentials& credentials) override
+    {
+        credentials = AWSCredentials("AccessKey", "SecretKey", Aws::String(600, 't'));
+        return true;
+    }
+};
+
+static std::chrono::steady_clock::duration ReadConcurrently(AWSCredentialsProvider& provider, int threadCount, int iterations)
+{
+    std::atomic<bool> go(false);
+    Aws::Vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.push_back(std::thread([&]()
+        {
+            while (!go)
+            {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < iterations; ++i)
+            {
+                provider.GetAWSCredentials();
+            }
+        }));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go = true;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    return std::chrono::steady_clock::now() - start;
+}
+
+//Not a pass/fail test: prints GetAWSCredentials() cost with 64 threads signing at once.
+TEST(RefreshingAWSCredentialsProviderTest, DISABLED_ConcurrentReadBenchmark)
+{
+    static const int THREADS = 64;
+    static const int ITERATIONS = 5000;
+
+    MutexCredentialsProvider mutexProvider;
+    FixedCredentialsProvider snapshotProvider;
+    snapshotProvider.GetAWSCredentials();
+
+    auto mutexTime = ReadConcurrently(mutexProvider, THREADS, ITERATIONS);
+    auto snapshotTime = ReadConcurrently(snapshotProvider, THREADS, ITERATIONS);
+
+    double reads = static_cast<double>(THREADS) * ITERATIONS;
+    std::cout << THREADS << " threads, " << ITERATIONS << " reads each:" << std::endl
+        << "  mutex per read:    " << std::chrono::duration_cast<std::chrono::nanoseconds>(mutexTime).count() / reads << " ns per read" << std::endl
+        << "  snapshot per read: " << std::chrono::duration_cast<std::chrono::nanoseconds>(snapshotTime).count() / reads << " ns per read" << std::endl;
+}
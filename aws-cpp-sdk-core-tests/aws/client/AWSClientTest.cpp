@@ -16,13 +16,27 @@
 #include <aws/external/gtest.h>
 #include <aws/testing/MemoryTesting.h>
 #include <aws/core/client/AWSClient.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
 #include <aws/core/client/AWSError.h>
 #include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/client/HistogramRequestMetricsCollector.h>
+#include <aws/core/client/TokenBucketRetryStrategy.h>
 #include <aws/core/AmazonWebServiceRequest.h>
 #include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/memory/stl/AWSAllocator.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <future>
+#include <mutex>
+#include <thread>
 
 using namespace Aws::Client;
 using namespace Aws::Http;
@@ -53,17 +67,262 @@ protected:
     }
 };
  
+class MockSigner : public AWSAuthSigner
+{
+public:
+    bool SignRequest(HttpRequest&) const override { return true; }
+    bool PresignRequest(HttpRequest&, long long) const override { return true; }
+    const char* GetServiceName() const override { return "mock"; }
+};
+
+//fails the first failureCount requests with a 503, then succeeds.
+class FlakyHttpClient : public HttpClient
+{
+public:
+    FlakyHttpClient(int failureCount) : m_failuresLeft(failureCount), m_requestCount(0) {}
+
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request,
+        Aws::Utils::RateLimits::RateLimiterInterface*,
+        Aws::Utils::RateLimits::RateLimiterInterface*) const override
+    {
+        ++m_requestCount;
+        if (request.GetContentBody())
+        {
+            Aws::StringStream body;
+            body << request.GetContentBody()->rdbuf();
+            m_bodies.push_back(body.str());
+        }
+        if (request.HasHeader("x-amz-content-sha256"))
+        {
+            m_payloadHashes.push_back(request.GetHeaderValue("x-amz-content-sha256"));
+        }
+        //every attempt takes 250us to get its first byte back
+        TransferTimings timings;
+        timings.timeToFirstByteMicros = 250;
+        request.SetTransferTimings(timings);
+        auto response = Aws::MakeShared<Standard::StandardHttpResponse>(ALLOCATION_TAG, request);
+        response->SetResponseCode(m_failuresLeft-- > 0 ? HttpResponseCode::SERVICE_UNAVAILABLE : HttpResponseCode::OK);
+        return response;
+    }
+
+    int GetRequestCount() const { return m_requestCount; }
+    const Aws::Vector<Aws::String>& GetBodies() const { return m_bodies; }
+    const Aws::Vector<Aws::String>& GetPayloadHashes() const { return m_payloadHashes; }
+
+private:
+    mutable int m_failuresLeft;
+    mutable int m_requestCount;
+    mutable Aws::Vector<Aws::String> m_bodies;
+    mutable Aws::Vector<Aws::String> m_payloadHashes;
+};
+
+//calls back on a thread of its own for every attempt, the way an event loop http client does.
+class EventLoopHttpClient : public FlakyHttpClient
+{
+public:
+    EventLoopHttpClient(int failureCount) : FlakyHttpClient(failureCount) {}
+
+    ~EventLoopHttpClient()
+    {
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+        const HttpResponseCallback& callback,
+        Aws::Utils::RateLimits::RateLimiterInterface*,
+        Aws::Utils::RateLimits::RateLimiterInterface*,
+        std::chrono::milliseconds) const override
+    {
+        std::lock_guard<std::mutex> locker(m_threadsMutex);
+        m_threads.emplace_back([this, request, callback]()
+        {
+            callback(MakeRequest(*request, nullptr, nullptr));
+        });
+        m_loopThreadIds.push_back(m_threads.back().get_id());
+    }
+
+    Aws::Vector<std::thread::id> GetLoopThreadIds() const
+    {
+        std::lock_guard<std::mutex> locker(m_threadsMutex);
+        return m_loopThreadIds;
+    }
+
+private:
+    mutable std::mutex m_threadsMutex;
+    mutable Aws::Vector<std::thread> m_threads;
+    mutable Aws::Vector<std::thread::id> m_loopThreadIds;
+};
+
+class ThreadRecordingSigner : public MockSigner
+{
+public:
+    bool SignRequest(HttpRequest&) const override
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_signingThreadIds.push_back(std::this_thread::get_id());
+        return true;
+    }
+
+    Aws::Vector<std::thread::id> GetSigningThreadIds() const
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        return m_signingThreadIds;
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    mutable Aws::Vector<std::thread::id> m_signingThreadIds;
+};
+
+//runs every task on the submitting thread, so async calls against a blocking http client complete before they return.
+class InlineExecutor : public Aws::Utils::Threading::Executor
+{
+protected:
+    bool SubmitToThread(std::function<void()>&& task) override
+    {
+        task();
+        return true;
+    }
+};
+
+class FlakyHttpClientFactory : public HttpClientFactory
+{
+public:
+    FlakyHttpClientFactory(const std::shared_ptr<FlakyHttpClient>& client) : m_client(client) {}
+
+    std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration&) const override { return m_client; }
+
+private:
+    std::shared_ptr<FlakyHttpClient> m_client;
+};
+
+static ClientConfiguration MakeFastRetryConfiguration()
+{
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(ALLOCATION_TAG, 3, 1);
+    config.executor = Aws::MakeShared<InlineExecutor>(ALLOCATION_TAG);
+    return config;
+}
+
+class AsyncRetryingAWSClient : public AWSClient
+{
+public:
+    AsyncRetryingAWSClient(const std::shared_ptr<FlakyHttpClient>& httpClient) :
+        AWSClient(MakeShared<FlakyHttpClientFactory>(ALLOCATION_TAG, httpClient), MakeFastRetryConfiguration(),
+            MakeShared<MockSigner>(ALLOCATION_TAG), nullptr, nullptr)
+    {
+    }
+
+    AsyncRetryingAWSClient(const std::shared_ptr<FlakyHttpClient>& httpClient, const ClientConfiguration& config) :
+        AWSClient(MakeShared<FlakyHttpClientFactory>(ALLOCATION_TAG, httpClient), config,
+            MakeShared<MockSigner>(ALLOCATION_TAG), nullptr, nullptr)
+    {
+    }
+
+    AsyncRetryingAWSClient(const std::shared_ptr<FlakyHttpClient>& httpClient, const std::shared_ptr<AWSAuthSigner>& signer) :
+        AWSClient(MakeShared<FlakyHttpClientFactory>(ALLOCATION_TAG, httpClient), MakeFastRetryConfiguration(),
+            signer, nullptr, nullptr)
+    {
+    }
+
+    AsyncRetryingAWSClient(const std::shared_ptr<FlakyHttpClient>& httpClient, const ClientConfiguration& config,
+        const std::shared_ptr<AWSAuthSigner>& signer) :
+        AWSClient(MakeShared<FlakyHttpClientFactory>(ALLOCATION_TAG, httpClient), config, signer, nullptr, nullptr)
+    {
+    }
+
+    HttpResponseOutcome InvokeAttemptExhaustively(const Aws::String& uri, const AmazonWebServiceRequest& request) const
+    {
+        return AttemptExhaustively(uri, request, HttpMethod::HTTP_POST);
+    }
+
+    void InvokeAttemptExhaustivelyAsync(const Aws::String& uri, const AmazonWebServiceRequest& request, const HttpResponseOutcomeHandler& handler) const
+    {
+        AttemptExhaustivelyAsync(uri, request, HttpMethod::HTTP_POST, handler);
+    }
+
+    void InvokeAttemptExhaustivelyAsync(const Aws::String& uri, const HttpResponseOutcomeHandler& handler, const char* requestName = nullptr) const
+    {
+        AttemptExhaustivelyAsync(uri, HttpMethod::HTTP_GET, handler, requestName);
+    }
+
+protected:
+    AWSError<CoreErrors> BuildAWSError(const std::shared_ptr<Aws::Http::HttpResponse>& response) const override
+    {
+        AWS_UNREFERENCED_PARAM(response);
+        return AWSError<CoreErrors>(CoreErrors::SERVICE_UNAVAILABLE, true);
+    }
+};
+
+//counts the attempts that go through its BuildHttpRequest override.
+class BuildCountingAWSClient : public AsyncRetryingAWSClient
+{
+public:
+    BuildCountingAWSClient(const std::shared_ptr<FlakyHttpClient>& httpClient) : AsyncRetryingAWSClient(httpClient), m_buildCount(0) {}
+
+    int GetBuildCount() const { return m_buildCount; }
+
+protected:
+    void BuildHttpRequest(const AmazonWebServiceRequest& request, const std::shared_ptr<HttpRequest>& httpRequest) const override
+    {
+        ++m_buildCount;
+        AsyncRetryingAWSClient::BuildHttpRequest(request, httpRequest);
+    }
+
+private:
+    mutable int m_buildCount;
+};
+
 class AmazonWebServiceRequestMock : public AmazonWebServiceRequest
 {
 public:
+    AmazonWebServiceRequestMock() : m_requestName(nullptr) {}
+
     std::shared_ptr<Aws::IOStream> GetBody() const override { return m_body; }
     void SetBody(const std::shared_ptr<Aws::IOStream>& body) { m_body = body; }
     HeaderValueCollection GetHeaders() const override { return m_headers; }
     void SetHeaders(const HeaderValueCollection& value) { m_headers = value; }
+    const char* GetServiceRequestName() const override { return m_requestName; }
+    void SetServiceRequestName(const char* value) { m_requestName = value; }
 
 private:
     std::shared_ptr<Aws::IOStream> m_body;
     HeaderValueCollection m_headers;    
+    const char* m_requestName;
+};
+
+//counts how many times the client asks for the serialized payload.
+class CountingSerializationRequest : public AmazonWebServiceRequest
+{
+public:
+    CountingSerializationRequest(const Aws::String& payload) : m_payload(payload), m_getBodyCount(0), m_getHeadersCount(0) {}
+
+    std::shared_ptr<Aws::IOStream> GetBody() const override
+    {
+        ++m_getBodyCount;
+        auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+        *body << m_payload;
+        return body;
+    }
+
+    HeaderValueCollection GetHeaders() const override
+    {
+        ++m_getHeadersCount;
+        HeaderValueCollection headers;
+        headers[Http::CONTENT_TYPE_HEADER] = "application/x-amz-json-1.0";
+        return headers;
+    }
+
+    int GetBodyCount() const { return m_getBodyCount; }
+    int GetHeadersCount() const { return m_getHeadersCount; }
+
+private:
+    Aws::String m_payload;
+    mutable int m_getBodyCount;
+    mutable int m_getHeadersCount;
 };
 
 TEST(AWSClientTest, TestBuildHttpRequestWithHeadersOnly)
@@ -182,3 +441,261 @@ TEST(AWSClientTest, TestHostHeaderOverride)
 
     AWS_END_MEMORY_TEST
 }
+
+TEST(AWSClientTest, TestAsyncAttemptRetriesUntilSuccess)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    auto httpClient = Aws::MakeShared<FlakyHttpClient>(ALLOCATION_TAG, 2);
+    AsyncRetryingAWSClient awsClient(httpClient);
+
+    bool handlerCalled = false;
+    bool succeeded = false;
+    awsClient.InvokeAttemptExhaustivelyAsync("http://www.uri.com", [&](const HttpResponseOutcome& outcome)
+    {
+        handlerCalled = true;
+        succeeded = outcome.IsSuccess();
+    });
+
+    ASSERT_TRUE(handlerCalled);
+    ASSERT_TRUE(succeeded);
+    ASSERT_EQ(3, httpClient->GetRequestCount());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientTest, TestAsyncAttemptGivesUpWhenRetriesExhausted)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    auto httpClient = Aws::MakeShared<FlakyHttpClient>(ALLOCATION_TAG, 100);
+    AsyncRetryingAWSClient awsClient(httpClient);
+
+    bool handlerCalled = false;
+    bool succeeded = true;
+    awsClient.InvokeAttemptExhaustivelyAsync("http://www.uri.com", [&](const HttpResponseOutcome& outcome)
+    {
+        handlerCalled = true;
+        succeeded = outcome.IsSuccess();
+    });
+
+    ASSERT_TRUE(handlerCalled);
+    ASSERT_FALSE(succeeded);
+    ASSERT_EQ(4, httpClient->GetRequestCount());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientTest, TestAsyncAttemptLeavesTheEventLoopThread)
+{
+    auto httpClient = Aws::MakeShared<EventLoopHttpClient>(ALLOCATION_TAG, 2);
+    auto signer = Aws::MakeShared<ThreadRecordingSigner>(ALLOCATION_TAG);
+    ClientConfiguration config = MakeFastRetryConfiguration();
+    config.executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 1);
+    AsyncRetryingAWSClient awsClient(httpClient, config, signer);
+
+    std::promise<std::thread::id> handlerThread;
+    std::thread::id callerThread = std::this_thread::get_id();
+    awsClient.InvokeAttemptExhaustivelyAsync("http://www.uri.com", [&](const HttpResponseOutcome& outcome)
+    {
+        EXPECT_TRUE(outcome.IsSuccess());
+        handlerThread.set_value(std::this_thread::get_id());
+    });
+    std::thread::id handlerThreadId = handlerThread.get_future().get();
+
+    ASSERT_EQ(3, httpClient->GetRequestCount());
+    auto loopThreadIds = httpClient->GetLoopThreadIds();
+    auto signingThreadIds = signer->GetSigningThreadIds();
+    ASSERT_EQ(3u, loopThreadIds.size());
+    ASSERT_EQ(3u, signingThreadIds.size());
+
+    //the first attempt is signed on the executor too, and so is every retry even though the failure arrived on a loop thread.
+    ASSERT_NE(callerThread, handlerThreadId);
+    for (auto loopThreadId : loopThreadIds)
+    {
+        ASSERT_NE(loopThreadId, handlerThreadId);
+        for (auto signingThreadId : signingThreadIds)
+        {
+            ASSERT_NE(callerThread, signingThreadId);
+            ASSERT_NE(loopThreadId, signingThreadId);
+        }
+    }
+}
+
+TEST(AWSClientTest, TestRetriesReuseSerializedPayloadAndHash)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    auto httpClient = Aws::MakeShared<FlakyHttpClient>(ALLOCATION_TAG, 2);
+    auto credentialsProvider = Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "akid", "secret");
+    AsyncRetryingAWSClient awsClient(httpClient, Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, credentialsProvider, "dynamodb", Region::US_EAST_1));
+
+    CountingSerializationRequest request("{\"TableName\":\"retries\"}");
+    HttpResponseOutcome outcome = awsClient.InvokeAttemptExhaustively("http://dynamodb.us-east-1.amazonaws.com", request);
+
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(3, httpClient->GetRequestCount());
+    ASSERT_EQ(1, request.GetBodyCount());
+    //everything but the payload is rebuilt for each attempt.
+    ASSERT_EQ(3, request.GetHeadersCount());
+
+    //every attempt has to send the whole body even though the previous one read it to the end.
+    ASSERT_EQ(3u, httpClient->GetBodies().size());
+    for (const auto& body : httpClient->GetBodies())
+    {
+        ASSERT_EQ("{\"TableName\":\"retries\"}", body);
+    }
+
+    ASSERT_EQ(3u, httpClient->GetPayloadHashes().size());
+    ASSERT_EQ(64u, httpClient->GetPayloadHashes()[0].length());
+    ASSERT_EQ(httpClient->GetPayloadHashes()[0], httpClient->GetPayloadHashes()[1]);
+    ASSERT_EQ(httpClient->GetPayloadHashes()[0], httpClient->GetPayloadHashes()[2]);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientTest, TestAsyncRetriesReuseSerializedPayload)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    auto httpClient = Aws::MakeShared<FlakyHttpClient>(ALLOCATION_TAG, 2);
+    AsyncRetryingAWSClient awsClient(httpClient);
+
+    CountingSerializationRequest request("payload");
+    bool succeeded = false;
+    awsClient.InvokeAttemptExhaustivelyAsync("http://www.uri.com", request, [&](const HttpResponseOutcome& outcome)
+    {
+        succeeded = outcome.IsSuccess();
+    });
+
+    ASSERT_TRUE(succeeded);
+    ASSERT_EQ(3, httpClient->GetRequestCount());
+    ASSERT_EQ(1, request.GetBodyCount());
+    ASSERT_EQ(3u, httpClient->GetBodies().size());
+    ASSERT_EQ("payload", httpClient->GetBodies()[2]);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientTest, TestEveryAttemptGoesThroughBuildHttpRequest)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    auto httpClient = Aws::MakeShared<FlakyHttpClient>(ALLOCATION_TAG, 2);
+    BuildCountingAWSClient awsClient(httpClient);
+
+    CountingSerializationRequest request("payload");
+    ASSERT_TRUE(awsClient.InvokeAttemptExhaustively("http://www.uri.com", request).IsSuccess());
+    ASSERT_EQ(3, awsClient.GetBuildCount());
+
+    bool succeeded = false;
+    auto asyncHttpClient = Aws::MakeShared<FlakyHttpClient>(ALLOCATION_TAG, 2);
+    BuildCountingAWSClient asyncClient(asyncHttpClient);
+    asyncClient.InvokeAttemptExhaustivelyAsync("http://www.uri.com", request, [&](const HttpResponseOutcome& outcome)
+    {
+        succeeded = outcome.IsSuccess();
+    });
+    ASSERT_TRUE(succeeded);
+    ASSERT_EQ(3, asyncClient.GetBuildCount());
+
+    //the override sees the payload serialized once per call, not once per attempt.
+    ASSERT_EQ(2, request.GetBodyCount());
+    ASSERT_EQ("payload", asyncHttpClient->GetBodies()[2]);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientTest, TestRetryBudgetIsSharedAcrossRequests)
+{
+    auto httpClient = Aws::MakeShared<FlakyHttpClient>(ALLOCATION_TAG, 1000);
+    auto retryBudget = Aws::MakeShared<TokenBucketRetryStrategy>(ALLOCATION_TAG, Aws::MakeShared<DefaultRetryStrategy>(ALLOCATION_TAG, 10, 1), 10, 5, 10);
+    ClientConfiguration config;
+    config.retryStrategy = retryBudget;
+    AsyncRetryingAWSClient client(httpClient, config);
+    AmazonWebServiceRequestMock request;
+
+    //two retries drain the bucket, after that requests fail on their first error.
+    ASSERT_FALSE(client.InvokeAttemptExhaustively("http://www.uri.com/path", request).IsSuccess());
+    ASSERT_EQ(3, httpClient->GetRequestCount());
+    ASSERT_EQ(0, retryBudget->GetAvailableTokens());
+    ASSERT_FALSE(client.InvokeAttemptExhaustively("http://www.uri.com/path", request).IsSuccess());
+    ASSERT_EQ(4, httpClient->GetRequestCount());
+
+    //successes are reported back to the strategy and refill the bucket.
+    auto healthyClient = Aws::MakeShared<FlakyHttpClient>(ALLOCATION_TAG, 0);
+    AsyncRetryingAWSClient recoveredClient(healthyClient, config);
+    ASSERT_TRUE(recoveredClient.InvokeAttemptExhaustively("http://www.uri.com/path", request).IsSuccess());
+    ASSERT_EQ(1, retryBudget->GetAvailableTokens());
+}
+
+TEST(AWSClientTest, TestCancelledRequestsLeaveTheRetryBudgetAlone)
+{
+    auto httpClient = Aws::MakeShared<FlakyHttpClient>(ALLOCATION_TAG, 1000);
+    auto retryBudget = Aws::MakeShared<TokenBucketRetryStrategy>(ALLOCATION_TAG, Aws::MakeShared<DefaultRetryStrategy>(ALLOCATION_TAG, 10, 1), 10, 5, 10);
+    ClientConfiguration config = MakeFastRetryConfiguration();
+    config.retryStrategy = retryBudget;
+    AsyncRetryingAWSClient client(httpClient, config);
+    AmazonWebServiceRequestMock request;
+    httpClient->DisableRequestProcessing();
+
+    ASSERT_FALSE(client.InvokeAttemptExhaustively("http://www.uri.com/path", request).IsSuccess());
+    bool failed = false;
+    client.InvokeAttemptExhaustivelyAsync("http://www.uri.com/path", request, [&](const HttpResponseOutcome& outcome)
+    {
+        failed = !outcome.IsSuccess();
+    });
+    ASSERT_TRUE(failed);
+    ASSERT_EQ(2, httpClient->GetRequestCount());
+    ASSERT_EQ(10, retryBudget->GetAvailableTokens());
+}
+
+TEST(AWSClientTest, TestRequestMetricsCoverEveryAttempt)
+{
+    auto collector = Aws::MakeShared<HistogramRequestMetricsCollector>(ALLOCATION_TAG);
+    ClientConfiguration config = MakeFastRetryConfiguration();
+    config.metricsCollector = collector;
+    auto httpClient = Aws::MakeShared<FlakyHttpClient>(ALLOCATION_TAG, 2);
+    AsyncRetryingAWSClient awsClient(httpClient, config);
+
+    AmazonWebServiceRequestMock request;
+    request.SetServiceRequestName("GetObject");
+    ASSERT_TRUE(awsClient.InvokeAttemptExhaustively("http://www.uri.com", request).IsSuccess());
+
+    auto histograms = collector->GetHistograms("mock", "GetObject");
+    ASSERT_NE(nullptr, histograms);
+    ASSERT_EQ(1u, histograms->GetPhase(RequestPhase::TOTAL).GetTotalCount());
+    ASSERT_EQ(1u, histograms->GetPhase(RequestPhase::SERIALIZE).GetTotalCount());
+    ASSERT_EQ(1u, histograms->GetPhase(RequestPhase::SIGN).GetTotalCount());
+    ASSERT_EQ(1u, histograms->GetPhase(RequestPhase::RETRY_SLEEP).GetTotalCount());
+    //per attempt phases add up over the three attempts
+    ASSERT_EQ(750, histograms->GetPhase(RequestPhase::TIME_TO_FIRST_BYTE).GetMax());
+    ASSERT_EQ(3, histograms->attempts.GetMax());
+    ASSERT_EQ(0u, histograms->failures.load());
+    //phases the http client didn't report aren't recorded at all
+    ASSERT_EQ(0u, histograms->GetPhase(RequestPhase::DNS_LOOKUP).GetTotalCount());
+    ASSERT_EQ(0u, histograms->GetPhase(RequestPhase::RESPONSE_PARSE).GetTotalCount());
+
+    //calls without a request object name their operation themselves; failed calls are counted
+    auto failingHttpClient = Aws::MakeShared<FlakyHttpClient>(ALLOCATION_TAG, 10);
+    AsyncRetryingAWSClient failingClient(failingHttpClient, config);
+    bool succeeded = true;
+    failingClient.InvokeAttemptExhaustivelyAsync("http://www.uri.com", [&](const HttpResponseOutcome& outcome)
+    {
+        succeeded = outcome.IsSuccess();
+    }, "ListBuckets");
+    ASSERT_FALSE(succeeded);
+
+    auto listHistograms = collector->GetHistograms("mock", "ListBuckets");
+    ASSERT_NE(nullptr, listHistograms);
+    ASSERT_EQ(1u, listHistograms->failures.load());
+    ASSERT_EQ(4, listHistograms->attempts.GetMax());
+    ASSERT_EQ(1000, listHistograms->GetPhase(RequestPhase::TIME_TO_FIRST_BYTE).GetMax());
+
+    //operations sent with the same http method are still told apart
+    AmazonWebServiceRequestMock headRequest;
+    headRequest.SetServiceRequestName("HeadObject");
+    ASSERT_TRUE(awsClient.InvokeAttemptExhaustively("http://www.uri.com", headRequest).IsSuccess());
+    ASSERT_EQ(1u, collector->GetHistograms("mock", "GetObject")->GetPhase(RequestPhase::TOTAL).GetTotalCount());
+    ASSERT_EQ(1u, collector->GetHistograms("mock", "HeadObject")->GetPhase(RequestPhase::TOTAL).GetTotalCount());
+    ASSERT_EQ(3u, collector->GetOperations().size());
+}
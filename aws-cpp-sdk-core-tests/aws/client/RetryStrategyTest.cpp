@@ -0,0 +1,265 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/client/JitteredRetryStrategy.h>
+#include <aws/core/client/TokenBucketRetryStrategy.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+using namespace Aws::Client;
+
+static const char* ALLOCATION_TAG = "RetryStrategyTest";
+
+TEST(RetryStrategyTest, TestFullJitterStaysUnderExponentialCeiling)
+{
+    JitteredRetryStrategy strategy(JitterMode::FULL, 3, 25, 1000);
+    AWSError<CoreErrors> error(CoreErrors::THROTTLING, true);
+
+    for (long retries = 0; retries < 40; ++retries)
+    {
+        long ceiling = retries < 6 ? 25L << retries : 1000L;
+        long lowest = ceiling, highest = 0;
+        for (int i = 0; i < 2000; ++i)
+        {
+            long delay = strategy.CalculateDelayBeforeNextRetry(error, retries);
+            ASSERT_LE(0, delay);
+            ASSERT_GE(ceiling, delay);
+            lowest = (std::min)(lowest, delay);
+            highest = (std::max)(highest, delay);
+        }
+        //spread over the whole range rather than clustered.
+        ASSERT_GT(ceiling / 4, lowest);
+        ASSERT_LT(ceiling * 3 / 4, highest);
+    }
+}
+
+TEST(RetryStrategyTest, TestDecorrelatedJitterStaysBetweenBaseAndCeiling)
+{
+    JitteredRetryStrategy strategy(JitterMode::DECORRELATED, 3, 25, 1000);
+    AWSError<CoreErrors> error(CoreErrors::THROTTLING, true);
+
+    for (long retries = 0; retries < 40; ++retries)
+    {
+        long ceiling = retries < 4 ? 25L * static_cast<long>(std::pow(3, retries)) : 1000L;
+        for (int i = 0; i < 2000; ++i)
+        {
+            long delay = strategy.CalculateDelayBeforeNextRetry(error, retries);
+            ASSERT_LE(25, delay);
+            ASSERT_GE(ceiling, delay);
+        }
+    }
+}
+
+TEST(RetryStrategyTest, TestJitteredStrategyHonorsMaxRetriesAndRetryability)
+{
+    JitteredRetryStrategy strategy(JitterMode::FULL, 3);
+    AWSError<CoreErrors> retryable(CoreErrors::SERVICE_UNAVAILABLE, true);
+    AWSError<CoreErrors> notRetryable(CoreErrors::ACCESS_DENIED, false);
+
+    ASSERT_TRUE(strategy.ShouldRetry(retryable, 0));
+    ASSERT_TRUE(strategy.ShouldRetry(retryable, 2));
+    ASSERT_FALSE(strategy.ShouldRetry(retryable, 3));
+    ASSERT_FALSE(strategy.ShouldRetry(notRetryable, 0));
+}
+
+TEST(RetryStrategyTest, TestTokenBucketStopsRetryingWhenDrainedAndRefillsOnSuccess)
+{
+    auto retryForever = Aws::MakeShared<DefaultRetryStrategy>(ALLOCATION_TAG, 1000, 1);
+    TokenBucketRetryStrategy strategy(retryForever, 20, 5, 10);
+    AWSError<CoreErrors> throttled(CoreErrors::THROTTLING, true);
+    AWSError<CoreErrors> connectionError(CoreErrors::NETWORK_CONNECTION, true);
+    AWSError<CoreErrors> notRetryable(CoreErrors::ACCESS_DENIED, false);
+
+    //non retryable errors cost nothing.
+    ASSERT_FALSE(strategy.ShouldRetry(notRetryable, 0));
+    ASSERT_EQ(20, strategy.GetAvailableTokens());
+
+    ASSERT_TRUE(strategy.ShouldRetry(connectionError, 0));
+    ASSERT_EQ(10, strategy.GetAvailableTokens());
+    ASSERT_TRUE(strategy.ShouldRetry(throttled, 0));
+    ASSERT_TRUE(strategy.ShouldRetry(throttled, 1));
+    ASSERT_EQ(0, strategy.GetAvailableTokens());
+    ASSERT_FALSE(strategy.ShouldRetry(throttled, 0));
+
+    //a retry that succeeded earns back what it was charged, a first time success a single token.
+    strategy.OnRequestSucceeded(1, throttled);
+    ASSERT_EQ(5, strategy.GetAvailableTokens());
+    strategy.OnRequestSucceeded(0, AWSError<CoreErrors>());
+    ASSERT_EQ(6, strategy.GetAvailableTokens());
+    ASSERT_TRUE(strategy.ShouldRetry(throttled, 0));
+    ASSERT_FALSE(strategy.ShouldRetry(connectionError, 0));
+    strategy.OnRequestSucceeded(2, connectionError);
+    ASSERT_EQ(11, strategy.GetAvailableTokens());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        strategy.OnRequestSucceeded(0, AWSError<CoreErrors>());
+    }
+    ASSERT_EQ(20, strategy.GetAvailableTokens());
+}
+
+struct SimulationResult
+{
+    long requests;
+    long attempts;
+    long failedRequests;
+    long peakAttemptsPerMs;
+    long recoveryMs;
+};
+
+struct SimulatedAttempt
+{
+    long time;
+    size_t client;
+    long retries;
+    const AWSError<CoreErrors>* lastError;
+};
+
+/**
+ * A fleet of clients sending a steady stream of requests to a service that can take SERVICE_CAPACITY per ms. For
+ * OUTAGE_MS its capacity drops to a fifth and the excess is throttled; on top of that a small share of requests fail
+ * with a 5xx at random. Each client gets its own strategy from makeStrategy, like an AWSClient with its own
+ * ClientConfiguration. Time is simulated in 1 ms ticks.
+ */
+template<typename STRATEGY_FACTORY>
+static SimulationResult SimulateFleet(STRATEGY_FACTORY makeStrategy)
+{
+    static const size_t CLIENTS = 50;
+    static const long REQUEST_INTERVAL_MS = 10;
+    static const long SERVICE_CAPACITY = 10;
+    static const long OUTAGE_START_MS = 2000;
+    static const long OUTAGE_MS = 1000;
+    static const long SIMULATION_MS = 8000;
+    static const double SERVER_ERROR_RATE = 0.01;
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+
+    Aws::Vector<std::shared_ptr<RetryStrategy>> strategies;
+    for (size_t i = 0; i < CLIENTS; ++i)
+    {
+        strategies.push_back(makeStrategy());
+    }
+
+    //attempts due at each ms; retries scheduled past the end of the run are dropped from the accounting.
+    Aws::Vector<Aws::Vector<SimulatedAttempt>> schedule(SIMULATION_MS);
+    for (long time = 0; time < SIMULATION_MS; ++time)
+    {
+        for (size_t client = 0; client < CLIENTS; ++client)
+        {
+            if ((time + static_cast<long>(client)) % REQUEST_INTERVAL_MS == 0)
+            {
+                SimulatedAttempt attempt = { time, client, 0, nullptr };
+                schedule[time].push_back(attempt);
+            }
+        }
+    }
+
+    SimulationResult result = { 0, 0, 0, 0, 0 };
+    long lastOverloadedMs = 0;
+    AWSError<CoreErrors> throttled(CoreErrors::THROTTLING, true);
+    AWSError<CoreErrors> serverError(CoreErrors::SERVICE_UNAVAILABLE, true);
+
+    for (long time = 0; time < SIMULATION_MS; ++time)
+    {
+        Aws::Vector<SimulatedAttempt>& arrivals = schedule[time];
+        std::shuffle(arrivals.begin(), arrivals.end(), random);
+
+        bool inOutage = time >= OUTAGE_START_MS && time < OUTAGE_START_MS + OUTAGE_MS;
+        long capacity = inOutage ? SERVICE_CAPACITY / 5 : SERVICE_CAPACITY;
+        long arrived = static_cast<long>(arrivals.size());
+        result.attempts += arrived;
+        result.peakAttemptsPerMs = (std::max)(result.peakAttemptsPerMs, arrived);
+        if (arrived > capacity)
+        {
+            lastOverloadedMs = time;
+        }
+
+        for (long i = 0; i < arrived; ++i)
+        {
+            SimulatedAttempt attempt = arrivals[i];
+            if (attempt.retries == 0)
+            {
+                ++result.requests;
+            }
+
+            const RetryStrategy& strategy = *strategies[attempt.client];
+            const AWSError<CoreErrors>* error = i >= capacity ? &throttled : (chance(random) < SERVER_ERROR_RATE ? &serverError : nullptr);
+            if (!error)
+            {
+                strategy.OnRequestSucceeded(attempt.retries, attempt.lastError ? *attempt.lastError : AWSError<CoreErrors>());
+            }
+            else if (!strategy.ShouldRetry(*error, attempt.retries))
+            {
+                ++result.failedRequests;
+            }
+            else
+            {
+                long retryAt = time + (std::max)(1L, strategy.CalculateDelayBeforeNextRetry(*error, attempt.retries));
+                if (retryAt < SIMULATION_MS)
+                {
+                    SimulatedAttempt retry = { retryAt, attempt.client, attempt.retries + 1, error };
+                    schedule[retryAt].push_back(retry);
+                }
+            }
+        }
+    }
+
+    result.recoveryMs = (std::max)(0L, lastOverloadedMs + 1 - (OUTAGE_START_MS + OUTAGE_MS));
+    return result;
+}
+
+static void PrintSimulationResult(const char* name, const SimulationResult& result)
+{
+    std::cout << "  " << std::left << std::setw(28) << name << std::right
+        << " amplification " << std::fixed << std::setprecision(2) << static_cast<double>(result.attempts) / result.requests
+        << ", failed " << std::setw(5) << result.failedRequests << " of " << result.requests
+        << ", peak " << std::setw(4) << result.peakAttemptsPerMs << " attempts/ms"
+        << ", overloaded until " << std::setw(5) << result.recoveryMs << " ms after the outage" << std::endl;
+}
+
+//Not a pass/fail test: prints load amplification of each strategy for a fleet hit by a throttling outage.
+TEST(RetryStrategyTest, DISABLED_ThrottlingOutageSimulation)
+{
+    std::cout << "50 clients, 5 requests/ms against a service taking 10/ms, 2/ms during a 1 s outage, 1% 5xx:" << std::endl;
+
+    PrintSimulationResult("DefaultRetryStrategy", SimulateFleet([]()
+    {
+        return Aws::MakeShared<DefaultRetryStrategy>(ALLOCATION_TAG);
+    }));
+    PrintSimulationResult("full jitter", SimulateFleet([]()
+    {
+        return Aws::MakeShared<JitteredRetryStrategy>(ALLOCATION_TAG, JitterMode::FULL);
+    }));
+    PrintSimulationResult("decorrelated jitter", SimulateFleet([]()
+    {
+        return Aws::MakeShared<JitteredRetryStrategy>(ALLOCATION_TAG, JitterMode::DECORRELATED);
+    }));
+    PrintSimulationResult("full jitter + token bucket", SimulateFleet([]()
+    {
+        return Aws::MakeShared<TokenBucketRetryStrategy>(ALLOCATION_TAG);
+    }));
+}
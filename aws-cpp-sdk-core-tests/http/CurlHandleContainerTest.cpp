@@ -0,0 +1,203 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#if ENABLE_CURL_CLIENT
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/http/curl/CurlHandleContainer.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSStack.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Http;
+
+TEST(CurlHandleContainerTest, TestHandleStaysWithReleasingThread)
+{
+    CurlHandleContainer container(8);
+
+    CURL* first = container.AcquireCurlHandle();
+    ASSERT_NE(nullptr, first);
+    container.ReleaseCurlHandle(first);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        CURL* handle = container.AcquireCurlHandle();
+        ASSERT_EQ(first, handle);
+        container.ReleaseCurlHandle(handle);
+    }
+}
+
+TEST(CurlHandleContainerTest, TestHandlesAreNeverSharedAndPoolStaysWithinMaxSize)
+{
+    static const unsigned MAX_SIZE = 4;
+    static const int THREADS = 16;
+    static const int ITERATIONS = 2000;
+    CurlHandleContainer container(MAX_SIZE);
+
+    std::mutex handlesMutex;
+    Aws::Set<CURL*> inUse;
+    Aws::Set<CURL*> seen;
+    std::atomic<bool> handedOutTwice(false);
+
+    Aws::Vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.push_back(std::thread([&]()
+        {
+            for (int i = 0; i < ITERATIONS; ++i)
+            {
+                CURL* handle = container.AcquireCurlHandle();
+                {
+                    std::lock_guard<std::mutex> locker(handlesMutex);
+                    if (!inUse.insert(handle).second)
+                    {
+                        handedOutTwice = true;
+                    }
+                    seen.insert(handle);
+                }
+                std::this_thread::yield();
+                {
+                    std::lock_guard<std::mutex> locker(handlesMutex);
+                    inUse.erase(handle);
+                }
+                container.ReleaseCurlHandle(handle);
+            }
+        }));
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_FALSE(handedOutTwice);
+    ASSERT_TRUE(inUse.empty());
+    ASSERT_LE(seen.size(), MAX_SIZE);
+}
+
+//the pool as it was before: one stack behind a mutex and a condition variable.
+class MutexHandlePool
+{
+public:
+    MutexHandlePool(unsigned size)
+    {
+        for (unsigned i = 0; i < size; ++i)
+        {
+            m_handles.push(curl_easy_init());
+        }
+    }
+
+    ~MutexHandlePool()
+    {
+        while (!m_handles.empty())
+        {
+            curl_easy_cleanup(m_handles.top());
+            m_handles.pop();
+        }
+    }
+
+    CURL* Acquire()
+    {
+        std::unique_lock<std::mutex> locker(m_mutex);
+        while (m_handles.empty())
+        {
+            m_conditionVariable.wait(locker);
+        }
+        CURL* handle = m_handles.top();
+        m_handles.pop();
+        return handle;
+    }
+
+    void Release(CURL* handle)
+    {
+        std::unique_lock<std::mutex> locker(m_mutex);
+        m_handles.push(handle);
+        locker.unlock();
+        m_conditionVariable.notify_one();
+    }
+
+private:
+    Aws::Stack<CURL*> m_handles;
+    std::mutex m_mutex;
+    std::condition_variable m_conditionVariable;
+};
+
+template<typename ACQUIRE, typename RELEASE>
+static std::chrono::steady_clock::duration RunContended(int threadCount, int iterations, ACQUIRE acquire, RELEASE release)
+{
+    std::atomic<bool> go(false);
+    Aws::Vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.push_back(std::thread([&]()
+        {
+            while (!go)
+            {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < iterations; ++i)
+            {
+                release(acquire());
+            }
+        }));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go = true;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    return std::chrono::steady_clock::now() - start;
+}
+
+//Not a pass/fail test: prints acquire/release throughput of the old and new pools with 64 threads sharing 64 handles.
+TEST(CurlHandleContainerTest, DISABLED_ContendedAcquireReleaseBenchmark)
+{
+    static const int THREADS = 64;
+    static const int ITERATIONS = 20000;
+
+    CurlHandleContainer container(THREADS);
+    //warm the pool up to its full size so neither run measures handle creation.
+    Aws::Vector<CURL*> warm;
+    for (int i = 0; i < THREADS; ++i)
+    {
+        warm.push_back(container.AcquireCurlHandle());
+    }
+    for (auto handle : warm)
+    {
+        container.ReleaseCurlHandle(handle);
+    }
+
+    MutexHandlePool mutexPool(THREADS);
+
+    auto mutexTime = RunContended(THREADS, ITERATIONS, [&]() { return mutexPool.Acquire(); }, [&](CURL* handle) { mutexPool.Release(handle); });
+    auto containerTime = RunContended(THREADS, ITERATIONS, [&]() { return container.AcquireCurlHandle(); },
+        [&](CURL* handle) { container.ReleaseCurlHandle(handle); });
+
+    double operations = static_cast<double>(THREADS) * ITERATIONS;
+    std::cout << THREADS << " threads, " << ITERATIONS << " acquire/release pairs each:" << std::endl
+        << "  mutex + condition variable: " << std::chrono::duration_cast<std::chrono::nanoseconds>(mutexTime).count() / operations << " ns per pair" << std::endl
+        << "  CurlHandleContainer:        " << std::chrono::duration_cast<std::chrono::nanoseconds>(containerTime).count() / operations << " ns per pair" << std::endl;
+}
+
+#endif // ENABLE_CURL_CLIENT
@@ -17,8 +17,10 @@
 #include <aws/testing/MemoryTesting.h>
 
 #include <aws/core/http/URI.h>
+#include <aws/core/utils/StringUtils.h>
 
 using namespace Aws::Http;
+using namespace Aws::Utils;
 TEST(URITest, DefaultConstructor)
 {
     AWS_BEGIN_MEMORY_TEST(16, 10)
@@ -216,3 +218,24 @@ TEST(URITest, TestParseWithColon)
     AWS_END_MEMORY_TEST
 }
 
+
+TEST(URITest, TestURLEncodePathAppends)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::String encoded("GET\n");
+    URI::URLEncodePath("//path/with space//caf\xc3\xa9/", encoded);
+    EXPECT_EQ("GET\n/path/with%20space/caf%FFFFFFC3%FFFFFFA9/", encoded);
+    EXPECT_EQ(encoded.substr(4), URI::URLEncodePath("//path/with space//caf\xc3\xa9/"));
+
+    //the string returning overloads agree with the appending ones
+    Aws::String segment;
+    StringUtils::URLEncode("a b~", 4, segment);
+    EXPECT_EQ(StringUtils::URLEncode("a b~"), segment);
+
+    encoded.clear();
+    URI::URLEncodePath("", encoded);
+    EXPECT_TRUE(encoded.empty());
+
+    AWS_END_MEMORY_TEST
+}
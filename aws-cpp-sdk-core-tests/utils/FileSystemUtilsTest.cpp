@@ -0,0 +1,83 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+using namespace Aws::Utils;
+
+static const char* TEST_DIRECTORY = "FileSystemUtilsTestDir";
+
+static Aws::String TestPath(const Aws::String& relativePath)
+{
+    return Aws::String(TEST_DIRECTORY) + PATH_DELIM + relativePath;
+}
+
+static void WriteTestFile(const Aws::String& relativePath, size_t size)
+{
+    std::ofstream file(TestPath(relativePath).c_str(), std::ios::binary | std::ios::trunc);
+    for (size_t i = 0; i < size; ++i)
+    {
+        file.put('x');
+    }
+}
+
+TEST(FileSystemUtilsTest, TestListFilesRecursively)
+{
+    Aws::String nested = Aws::String("logs") + PATH_DELIM + "2015";
+    ASSERT_TRUE(FileSystemUtils::CreateDirectoryIfNotExists(TEST_DIRECTORY));
+    ASSERT_TRUE(FileSystemUtils::CreateDirectoryIfNotExists(TestPath("logs").c_str()));
+    ASSERT_TRUE(FileSystemUtils::CreateDirectoryIfNotExists(TestPath(nested).c_str()));
+    ASSERT_TRUE(FileSystemUtils::CreateDirectoryIfNotExists(TestPath("empty").c_str()));
+
+    Aws::String nestedFile = nested + PATH_DELIM + "app.log";
+    Aws::String emptyFile = Aws::String("logs") + PATH_DELIM + "empty.log";
+    WriteTestFile("top.txt", 5);
+    WriteTestFile(nestedFile, 1000);
+    WriteTestFile(emptyFile, 0);
+
+    Aws::Vector<DirectoryEntry> entries;
+    //a trailing delimiter on the directory doesn't change the relative paths.
+    ASSERT_TRUE(FileSystemUtils::ListFilesRecursively((Aws::String(TEST_DIRECTORY) + PATH_DELIM).c_str(), entries));
+
+    std::sort(entries.begin(), entries.end(), [](const DirectoryEntry& left, const DirectoryEntry& right) { return left.m_relativePath < right.m_relativePath; });
+    ASSERT_EQ(3u, entries.size());
+    ASSERT_EQ(nestedFile, entries[0].m_relativePath);
+    ASSERT_EQ(1000u, entries[0].m_fileSize);
+    ASSERT_EQ(emptyFile, entries[1].m_relativePath);
+    ASSERT_EQ(0u, entries[1].m_fileSize);
+    ASSERT_EQ("top.txt", entries[2].m_relativePath);
+    ASSERT_EQ(5u, entries[2].m_fileSize);
+
+    Aws::Vector<DirectoryEntry> missing;
+    ASSERT_FALSE(FileSystemUtils::ListFilesRecursively(TestPath("missing").c_str(), missing));
+    ASSERT_EQ(0u, missing.size());
+
+    ASSERT_TRUE(FileSystemUtils::RemoveFileIfExists(TestPath("top.txt").c_str()));
+    ASSERT_TRUE(FileSystemUtils::RemoveFileIfExists(TestPath(nestedFile).c_str()));
+    ASSERT_TRUE(FileSystemUtils::RemoveFileIfExists(TestPath(emptyFile).c_str()));
+    //std::remove takes empty directories on posix platforms.
+    std::remove(TestPath(nested).c_str());
+    std::remove(TestPath("logs").c_str());
+    std::remove(TestPath("empty").c_str());
+    std::remove(TEST_DIRECTORY);
+}
@@ -0,0 +1,115 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/HdrHistogram.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <algorithm>
+#include <random>
+#include <thread>
+
+using namespace Aws::Utils;
+
+TEST(HdrHistogramTest, TestEmptyHistogram)
+{
+    HdrHistogram histogram;
+    ASSERT_EQ(0u, histogram.GetTotalCount());
+    ASSERT_EQ(0, histogram.GetMin());
+    ASSERT_EQ(0, histogram.GetMax());
+    ASSERT_EQ(0, histogram.GetValueAtPercentile(99.0));
+    ASSERT_DOUBLE_EQ(0.0, histogram.GetMean());
+}
+
+TEST(HdrHistogramTest, TestSmallValuesAreExact)
+{
+    HdrHistogram histogram;
+    for (int64_t value = 1; value <= 100; ++value)
+    {
+        histogram.Record(value);
+    }
+    histogram.Record(-5);
+
+    ASSERT_EQ(100u, histogram.GetTotalCount());
+    ASSERT_EQ(1, histogram.GetMin());
+    ASSERT_EQ(100, histogram.GetMax());
+    ASSERT_EQ(50, histogram.GetValueAtPercentile(50.0));
+    ASSERT_EQ(99, histogram.GetValueAtPercentile(99.0));
+    ASSERT_EQ(100, histogram.GetValueAtPercentile(100.0));
+    ASSERT_DOUBLE_EQ(50.5, histogram.GetMean());
+}
+
+TEST(HdrHistogramTest, TestPercentilesStayWithinPrecision)
+{
+    std::mt19937_64 random(7);
+    std::lognormal_distribution<double> latencies(8.0, 1.5);
+    Aws::Vector<int64_t> values;
+    HdrHistogram histogram;
+    for (int i = 0; i < 100000; ++i)
+    {
+        int64_t value = static_cast<int64_t>(latencies(random));
+        values.push_back(value);
+        histogram.Record(value);
+    }
+    std::sort(values.begin(), values.end());
+
+    for (double percentile : { 50.0, 90.0, 99.0, 99.9, 99.99 })
+    {
+        int64_t exact = values[static_cast<size_t>(std::ceil(percentile / 100.0 * values.size())) - 1];
+        int64_t reported = histogram.GetValueAtPercentile(percentile);
+        ASSERT_GE(reported, exact);
+        ASSERT_LE(reported, exact + exact / 64 + 1);
+    }
+    ASSERT_EQ(values.front(), histogram.GetMin());
+    ASSERT_EQ(values.back(), histogram.GetMax());
+}
+
+TEST(HdrHistogramTest, TestLargeValuesAreClamped)
+{
+    HdrHistogram histogram;
+    histogram.Record(HdrHistogram::MAX_VALUE + 1000);
+    ASSERT_EQ(HdrHistogram::MAX_VALUE, histogram.GetMax());
+    ASSERT_EQ(HdrHistogram::MAX_VALUE, histogram.GetValueAtPercentile(100.0));
+
+    histogram.Reset();
+    ASSERT_EQ(0u, histogram.GetTotalCount());
+    ASSERT_EQ(0, histogram.GetMax());
+}
+
+TEST(HdrHistogramTest, TestConcurrentRecording)
+{
+    static const int THREADS = 4;
+    static const int VALUES = 50000;
+    HdrHistogram histogram;
+    Aws::Vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.push_back(std::thread([&histogram, t]()
+        {
+            for (int i = 0; i < VALUES; ++i)
+            {
+                histogram.Record(t * VALUES + i);
+            }
+        }));
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(static_cast<uint64_t>(THREADS * VALUES), histogram.GetTotalCount());
+    ASSERT_EQ(0, histogram.GetMin());
+    ASSERT_EQ(THREADS * VALUES - 1, histogram.GetMax());
+}
@@ -0,0 +1,228 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/Crc32.h>
+#include <aws/core/utils/crypto/MultiHash.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char* ALLOCATION_TAG = "MultiHashTest";
+
+static ByteBuffer ToBuffer(const char* str)
+{
+    return ByteBuffer(reinterpret_cast<const unsigned char*>(str), strlen(str));
+}
+
+TEST(MultiHashTest, TestKnownDigests)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    MultiHash empty(MultiHash::MD5_DIGEST | MultiHash::SHA256_DIGEST | MultiHash::CRC32_DIGEST);
+    ASSERT_TRUE(empty.Calculate(nullptr, 0));
+    ASSERT_STREQ("d41d8cd98f00b204e9800998ecf8427e", HashingUtils::HexEncode(empty.GetMD5()).c_str());
+    ASSERT_STREQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", HashingUtils::HexEncode(empty.GetSHA256()).c_str());
+    ASSERT_EQ(0u, empty.GetCRC32());
+    ASSERT_EQ(0u, empty.GetBytesHashed());
+
+    ByteBuffer abc = ToBuffer("abc");
+    MultiHash abcHash(MultiHash::MD5_DIGEST | MultiHash::SHA256_DIGEST | MultiHash::CRC32_DIGEST);
+    ASSERT_TRUE(abcHash.Calculate(abc.GetUnderlyingData(), abc.GetLength()));
+    ASSERT_STREQ("900150983cd24fb0d6963f7d28e17f72", HashingUtils::HexEncode(abcHash.GetMD5()).c_str());
+    ASSERT_STREQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", HashingUtils::HexEncode(abcHash.GetSHA256()).c_str());
+    ASSERT_EQ(0x352441C2u, abcHash.GetCRC32());
+    ASSERT_EQ(3u, abcHash.GetBytesHashed());
+
+    //the standard check value for CRC-32.
+    ByteBuffer check = ToBuffer("123456789");
+    ASSERT_EQ(0xCBF43926u, Crc32::Calculate(check.GetUnderlyingData(), check.GetLength()));
+
+    //digests that weren't asked for stay empty.
+    MultiHash md5Only(MultiHash::MD5_DIGEST);
+    ASSERT_TRUE(md5Only.Calculate(abc.GetUnderlyingData(), abc.GetLength()));
+    ASSERT_EQ(16u, md5Only.GetMD5().GetLength());
+    ASSERT_EQ(0u, md5Only.GetSHA256().GetLength());
+    ASSERT_EQ(0u, md5Only.GetCRC32());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(MultiHashTest, TestMatchesSingleDigestHashing)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::String payload;
+    for (unsigned i = 0; i < 100000; ++i)
+    {
+        payload.push_back(static_cast<char>((i * 31) ^ (i >> 7)));
+    }
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(payload.c_str());
+
+    MultiHash oneShot(MultiHash::MD5_DIGEST | MultiHash::SHA256_DIGEST | MultiHash::CRC32_DIGEST);
+    ASSERT_TRUE(oneShot.Calculate(data, payload.size()));
+    ASSERT_EQ(HashingUtils::CalculateMD5(payload), oneShot.GetMD5());
+    ASSERT_EQ(HashingUtils::CalculateSHA256(payload), oneShot.GetSHA256());
+
+    //pieces of awkward sizes give the same digests as one call.
+    MultiHash pieces(MultiHash::MD5_DIGEST | MultiHash::SHA256_DIGEST | MultiHash::CRC32_DIGEST);
+    size_t offset = 0;
+    for (size_t piece = 1; offset < payload.size(); piece = piece * 3 + 1)
+    {
+        size_t length = std::min(piece, payload.size() - offset);
+        pieces.Update(data + offset, length);
+        offset += length;
+    }
+    ASSERT_TRUE(pieces.Finish());
+    ASSERT_EQ(oneShot.GetMD5(), pieces.GetMD5());
+    ASSERT_EQ(oneShot.GetSHA256(), pieces.GetSHA256());
+    ASSERT_EQ(oneShot.GetCRC32(), pieces.GetCRC32());
+    ASSERT_EQ(payload.size(), pieces.GetBytesHashed());
+
+    //a stream is hashed from the start and left where it was.
+    Aws::StringStream stream(payload);
+    stream.seekg(1234);
+    MultiHash streamHash(MultiHash::MD5_DIGEST | MultiHash::SHA256_DIGEST | MultiHash::CRC32_DIGEST);
+    ASSERT_TRUE(streamHash.Calculate(stream));
+    ASSERT_EQ(std::streampos(1234), stream.tellg());
+    ASSERT_EQ(oneShot.GetMD5(), streamHash.GetMD5());
+    ASSERT_EQ(oneShot.GetSHA256(), streamHash.GetSHA256());
+    ASSERT_EQ(oneShot.GetCRC32(), streamHash.GetCRC32());
+
+    //once finished, further updates are ignored.
+    streamHash.Update(data, 10);
+    ASSERT_EQ(payload.size(), streamHash.GetBytesHashed());
+
+    AWS_END_MEMORY_TEST
+}
+
+typedef std::basic_stringbuf<char, std::char_traits<char>, Aws::Allocator<char> > AwsStringBuf;
+
+//a request body that counts how many bytes are read out of it.
+class CountingStringBuf : public AwsStringBuf
+{
+public:
+    CountingStringBuf(const Aws::String& contents) : AwsStringBuf(contents), m_bytesRead(0) {}
+
+    uint64_t GetBytesRead() const { return m_bytesRead; }
+
+protected:
+    std::streamsize xsgetn(char* s, std::streamsize n) override
+    {
+        std::streamsize read = AwsStringBuf::xsgetn(s, n);
+        m_bytesRead += read;
+        return read;
+    }
+
+private:
+    uint64_t m_bytesRead;
+};
+
+//Not a pass/fail test on timing: it reports how many payload bytes get hashed per byte uploaded for one 5MB part, the way
+//the transfer manager used to prepare it (MD5 for Content-MD5, the signer's SHA-256, MD5 again for the ETag check) and
+//with a single MultiHash pass whose results feed all three.
+TEST(MultiHashTest, DISABLED_UploadPartBytesHashedBenchmark)
+{
+    static const size_t PART_SIZE = 5 * 1024 * 1024;
+    static const int ITERATIONS = 4;
+
+    Aws::String part;
+    part.reserve(PART_SIZE);
+    for (size_t i = 0; i < PART_SIZE; ++i)
+    {
+        part.push_back(static_cast<char>(i * 2654435761u >> 24));
+    }
+
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "akid", "secret");
+    AWSAuthV4Signer signer(credentialsProvider, "s3", Aws::Region::US_EAST_1);
+
+    uint64_t separateBytesHashed = 0;
+    uint64_t multiHashBytesHashed = 0;
+    std::chrono::steady_clock::duration separateTime(0);
+    std::chrono::steady_clock::duration multiHashTime(0);
+    Aws::String separatePayloadHash;
+    Aws::String multiHashPayloadHash;
+
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration)
+    {
+        {
+            CountingStringBuf bodyBuf(part);
+            auto body = Aws::MakeShared<Aws::IOStream>(ALLOCATION_TAG, &bodyBuf);
+            auto start = std::chrono::steady_clock::now();
+
+            Aws::String contentMD5 = HashingUtils::Base64Encode(HashingUtils::CalculateMD5(*body));
+            Standard::StandardHttpRequest request(URI("http://bucket.s3.amazonaws.com/key"), HttpMethod::HTTP_PUT);
+            request.SetHeaderValue("content-md5", contentMD5);
+            request.AddContentBody(body);
+            ASSERT_TRUE(signer.SignRequest(request));
+            Aws::String etag = HashingUtils::HexEncode(HashingUtils::CalculateMD5(*body));
+
+            separateTime += std::chrono::steady_clock::now() - start;
+            separateBytesHashed += bodyBuf.GetBytesRead();
+            separatePayloadHash = request.GetHeaderValue("x-amz-content-sha256");
+            ASSERT_EQ(32u, etag.size());
+        }
+
+        {
+            CountingStringBuf bodyBuf(part);
+            auto body = Aws::MakeShared<Aws::IOStream>(ALLOCATION_TAG, &bodyBuf);
+            auto start = std::chrono::steady_clock::now();
+
+            MultiHash partHash(MultiHash::MD5_DIGEST | MultiHash::SHA256_DIGEST);
+            ASSERT_TRUE(partHash.Calculate(reinterpret_cast<const unsigned char*>(part.c_str()), part.size()));
+            Aws::String contentMD5 = HashingUtils::Base64Encode(partHash.GetMD5());
+            Standard::StandardHttpRequest request(URI("http://bucket.s3.amazonaws.com/key"), HttpMethod::HTTP_PUT);
+            request.SetHeaderValue("content-md5", contentMD5);
+            request.SetHeaderValue("x-amz-content-sha256", HashingUtils::HexEncode(partHash.GetSHA256()));
+            request.AddContentBody(body);
+            ASSERT_TRUE(signer.SignRequest(request));
+            Aws::String etag = HashingUtils::HexEncode(HashingUtils::Base64Decode(contentMD5));
+
+            multiHashTime += std::chrono::steady_clock::now() - start;
+            multiHashBytesHashed += partHash.GetBytesHashed() + bodyBuf.GetBytesRead();
+            multiHashPayloadHash = request.GetHeaderValue("x-amz-content-sha256");
+            ASSERT_EQ(32u, etag.size());
+        }
+    }
+
+    ASSERT_EQ(separatePayloadHash, multiHashPayloadHash);
+
+    uint64_t bytesUploaded = static_cast<uint64_t>(PART_SIZE) * ITERATIONS;
+    double separateRatio = static_cast<double>(separateBytesHashed) / bytesUploaded;
+    double multiHashRatio = static_cast<double>(multiHashBytesHashed) / bytesUploaded;
+    ASSERT_EQ(bytesUploaded, multiHashBytesHashed);
+    ASSERT_LT(multiHashRatio, separateRatio);
+
+    std::cout << "Not a pass/fail test: bytes hashed per byte uploaded, separate digests: " << separateRatio
+        << " (" << std::chrono::duration_cast<std::chrono::milliseconds>(separateTime).count() / ITERATIONS << "ms per part)"
+        << ", MultiHash: " << multiHashRatio
+        << " (" << std::chrono::duration_cast<std::chrono::milliseconds>(multiHashTime).count() / ITERATIONS << "ms per part)" << std::endl;
+}
@@ -0,0 +1,150 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <cstring>
+#include <iostream>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+static const char* ALLOCATION_TAG = "PreallocatedStreamBufTest";
+
+//the way CurlHttpClient sizes and reads a request body.
+static size_t ReadLikeHttpClient(Aws::IOStream& body, char* destination, size_t capacity)
+{
+    auto currentPos = body.tellg();
+    body.seekg(0, body.end);
+    auto length = body.tellg();
+    body.seekg(currentPos, body.beg);
+
+    size_t total = 0;
+    while (total < static_cast<size_t>(length) && total < capacity)
+    {
+        body.read(destination + total, std::min<size_t>(16 * 1024, capacity - total));
+        total += static_cast<size_t>(body.gcount());
+    }
+    return total;
+}
+
+TEST(PreallocatedStreamBufTest, TestReadsCallerMemoryInPlace)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    ByteBuffer source(reinterpret_cast<const unsigned char*>("0123456789abcdefXXXX"), 20);
+    //only the first 16 bytes are the payload, the rest is left over in the buffer.
+    PreallocatedIOStream body(&source, 16);
+
+    char read[32];
+    ASSERT_EQ(16u, ReadLikeHttpClient(body, read, sizeof(read)));
+    ASSERT_EQ(0, memcmp("0123456789abcdef", read, 16));
+    ASSERT_TRUE(body.eof());
+
+    //hashing reads from the start and puts the position back, as the signer and Content-MD5 do.
+    body.clear();
+    body.seekg(4);
+    ASSERT_EQ(HashingUtils::CalculateMD5(Aws::String("0123456789abcdef")), HashingUtils::CalculateMD5(body));
+    ASSERT_EQ(std::streampos(4), body.tellg());
+    ASSERT_EQ('4', body.get());
+
+    body.seekg(-3, body.end);
+    ASSERT_EQ('d', body.get());
+    body.seekg(1, body.cur);
+    ASSERT_EQ('f', body.peek());
+    body.seekg(0, body.end);
+    ASSERT_EQ(std::streampos(16), body.tellg());
+
+    //out of range seeks fail.
+    body.seekg(17);
+    ASSERT_TRUE(body.fail());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PreallocatedStreamBufTest, TestWritesInPlace)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    unsigned char memory[8] = {};
+    PreallocatedStreamBuf streamBuf(memory, sizeof(memory));
+    Aws::IOStream stream(&streamBuf);
+
+    stream << "abc";
+    ASSERT_EQ(std::streampos(3), stream.tellp());
+    stream.seekp(6);
+    stream.write("gh", 2);
+    ASSERT_TRUE(stream.good());
+    ASSERT_EQ(0, memcmp("abc\0\0\0gh", memory, sizeof(memory)));
+    ASSERT_EQ(memory, streamBuf.GetBuffer());
+
+    //the memory doesn't grow.
+    stream.write("i", 1);
+    ASSERT_TRUE(stream.bad());
+
+    AWS_END_MEMORY_TEST
+}
+
+//Not a pass/fail test on the numbers: for one 5MB upload part, reports the bytes copied into the request body and the memory
+//allocated for it when the body is a StringStream filled from the part buffer (as the transfer manager did) and when it is a
+//PreallocatedIOStream over the buffer.
+TEST(PreallocatedStreamBufTest, DISABLED_UploadPartBytesCopiedBenchmark)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    static const size_t PART_SIZE = 5 * 1024 * 1024;
+
+    ByteBuffer partBuffer(PART_SIZE);
+    for (size_t i = 0; i < PART_SIZE; ++i)
+    {
+        partBuffer[i] = static_cast<uint8_t>(i * 2654435761u >> 24);
+    }
+    ByteBuffer sent(PART_SIZE);
+
+    uint64_t bytesBefore = memorySystem.GetTotalBytesAllocated();
+    uint64_t copiedIntoStringStream = 0;
+    {
+        auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+        body->write(reinterpret_cast<const char*>(partBuffer.GetUnderlyingData()), PART_SIZE);
+        copiedIntoStringStream = static_cast<uint64_t>(body->tellp());
+        body->seekg(0);
+        ASSERT_EQ(PART_SIZE, ReadLikeHttpClient(*body, reinterpret_cast<char*>(sent.GetUnderlyingData()), PART_SIZE));
+        ASSERT_EQ(partBuffer, sent);
+    }
+    uint64_t stringStreamBytesAllocated = memorySystem.GetTotalBytesAllocated() - bytesBefore;
+
+    bytesBefore = memorySystem.GetTotalBytesAllocated();
+    {
+        auto body = Aws::MakeShared<PreallocatedIOStream>(ALLOCATION_TAG, &partBuffer, PART_SIZE);
+        ASSERT_EQ(PART_SIZE, ReadLikeHttpClient(*body, reinterpret_cast<char*>(sent.GetUnderlyingData()), PART_SIZE));
+        ASSERT_EQ(partBuffer, sent);
+    }
+    uint64_t preallocatedBytesAllocated = memorySystem.GetTotalBytesAllocated() - bytesBefore;
+
+    ASSERT_EQ(PART_SIZE, copiedIntoStringStream);
+    ASSERT_GE(stringStreamBytesAllocated, PART_SIZE);
+    ASSERT_LT(preallocatedBytesAllocated, 4096u);
+
+    std::cout << "Not a pass/fail test: per 5MB part, StringStream body copied " << copiedIntoStringStream << " bytes and allocated "
+        << stringStreamBytesAllocated << " bytes; PreallocatedIOStream body copied 0 bytes and allocated " << preallocatedBytesAllocated << " bytes" << std::endl;
+
+    AWS_END_MEMORY_TEST
+}
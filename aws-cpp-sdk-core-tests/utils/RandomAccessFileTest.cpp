@@ -0,0 +1,129 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/RandomAccessFile.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+using namespace Aws::Utils;
+
+static const char* TEST_FILE_NAME = "RandomAccessFileTest.dat";
+
+TEST(RandomAccessFileTest, TestRangesWrittenOutOfOrder)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    static const size_t RANGE_SIZE = 64 * 1024 + 7;
+    static const size_t RANGE_COUNT = 8;
+
+    {
+        RandomAccessFile file;
+        ASSERT_TRUE(file.OpenForWrite(TEST_FILE_NAME, RANGE_SIZE * RANGE_COUNT));
+        ASSERT_EQ(RANGE_SIZE * RANGE_COUNT, file.GetSize());
+
+        //every range written from its own thread, last range first, through the one handle.
+        Aws::Vector<std::thread> writers;
+        for (size_t range = RANGE_COUNT; range-- > 0;)
+        {
+            writers.emplace_back([&file, range]()
+            {
+                Aws::Vector<char> data(RANGE_SIZE, static_cast<char>('a' + range));
+                ASSERT_TRUE(file.WriteAt(range * RANGE_SIZE, data.data(), data.size()));
+            });
+        }
+        for (auto& writer : writers)
+        {
+            writer.join();
+        }
+
+        char buffer[16];
+        ASSERT_EQ(16, file.ReadAt(3 * RANGE_SIZE - 8, buffer, sizeof(buffer)));
+        ASSERT_EQ(Aws::String("cccccccc") + "dddddddd", Aws::String(buffer, sizeof(buffer)));
+
+        //reads stop at the end of the file.
+        ASSERT_EQ(4, file.ReadAt(RANGE_SIZE * RANGE_COUNT - 4, buffer, sizeof(buffer)));
+        ASSERT_EQ(0, file.ReadAt(RANGE_SIZE * RANGE_COUNT, buffer, sizeof(buffer)));
+    }
+
+    {
+        RandomAccessFile file;
+        ASSERT_TRUE(file.OpenForRead(TEST_FILE_NAME));
+        ASSERT_EQ(RANGE_SIZE * RANGE_COUNT, file.GetSize());
+
+        Aws::Vector<char> contents(RANGE_SIZE * RANGE_COUNT);
+        ASSERT_EQ(static_cast<int64_t>(contents.size()), file.ReadAt(0, contents.data(), contents.size()));
+        for (size_t i = 0; i < contents.size(); ++i)
+        {
+            ASSERT_EQ(static_cast<char>('a' + i / RANGE_SIZE), contents[i]);
+        }
+    }
+
+    //a smaller write truncates what was there before.
+    {
+        RandomAccessFile file;
+        ASSERT_TRUE(file.OpenForWrite(TEST_FILE_NAME, 10));
+    }
+    std::ifstream sizeCheck(TEST_FILE_NAME, std::ios::binary | std::ios::ate);
+    ASSERT_EQ(std::streampos(10), sizeCheck.tellg());
+    sizeCheck.close();
+
+    RandomAccessFile missing;
+    ASSERT_FALSE(missing.OpenForRead("RandomAccessFileTestMissing.dat"));
+    ASSERT_FALSE(missing.IsOpen());
+
+    ASSERT_TRUE(FileSystemUtils::RemoveFileIfExists(TEST_FILE_NAME));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(RandomAccessFileTest, TestReopenWithoutTruncating)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    {
+        RandomAccessFile file;
+        ASSERT_TRUE(file.OpenForWrite(TEST_FILE_NAME, 8));
+        ASSERT_TRUE(file.WriteAt(0, "abcd", 4));
+    }
+
+    //reopening keeps the range already written, and the rest can still be filled in.
+    {
+        RandomAccessFile file;
+        ASSERT_TRUE(file.OpenForWrite(TEST_FILE_NAME, 8, false));
+        ASSERT_EQ(8u, file.GetSize());
+        ASSERT_TRUE(file.WriteAt(4, "efgh", 4));
+    }
+
+    {
+        RandomAccessFile file;
+        ASSERT_TRUE(file.OpenForRead(TEST_FILE_NAME));
+        ASSERT_NE(0u, file.GetModifiedTime());
+
+        char contents[8];
+        ASSERT_EQ(8, file.ReadAt(0, contents, sizeof(contents)));
+        ASSERT_EQ(0, memcmp(contents, "abcdefgh", sizeof(contents)));
+    }
+
+    ASSERT_TRUE(FileSystemUtils::RemoveFileIfExists(TEST_FILE_NAME));
+
+    AWS_END_MEMORY_TEST
+}
@@ -0,0 +1,368 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <chrono>
+#include <iostream>
+
+using namespace Aws::Utils::Json;
+using namespace Aws::Utils;
+
+TEST(JsonReaderTest, TestTokenSequence)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::StringStream json;
+    json << " {\"name\" : \"value\", \"count\":-12, \"ratio\":1.5e2, \"flags\":[true, false, null], \"empty\":{}} ";
+    JsonReader reader(json);
+
+    ASSERT_EQ(JsonToken::BEGIN_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ("name", reader.GetString());
+    ASSERT_EQ(JsonToken::STRING, reader.Next());
+    ASSERT_EQ("value", reader.GetString());
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ(JsonToken::NUMBER, reader.Next());
+    ASSERT_EQ(-12, reader.GetInteger());
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ(JsonToken::NUMBER, reader.Next());
+    ASSERT_DOUBLE_EQ(150.0, reader.GetDouble());
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ(JsonToken::BEGIN_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::BOOL, reader.Next());
+    ASSERT_TRUE(reader.GetBool());
+    ASSERT_EQ(JsonToken::BOOL, reader.Next());
+    ASSERT_FALSE(reader.GetBool());
+    ASSERT_EQ(JsonToken::NULL_VALUE, reader.Next());
+    ASSERT_EQ(JsonToken::END_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ("empty", reader.GetString());
+    ASSERT_EQ(JsonToken::BEGIN_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::END_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::END_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::END_DOCUMENT, reader.Next());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(JsonReaderTest, TestStringEscapes)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::StringStream json;
+    json << "[\"quote\\\" slash\\/ backslash\\\\ \\t\\n\", \"\\u00e9\\u20AC\\ud83d\\ude00\"]";
+    JsonReader reader(json);
+
+    ASSERT_EQ(JsonToken::BEGIN_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::STRING, reader.Next());
+    ASSERT_EQ("quote\" slash/ backslash\\ \t\n", reader.GetString());
+    ASSERT_EQ(JsonToken::STRING, reader.Next());
+    ASSERT_EQ("\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80", reader.GetString());
+    ASSERT_EQ(JsonToken::END_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::END_DOCUMENT, reader.Next());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(JsonReaderTest, TestTokensSpanningBufferBoundaries)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::String longValue(20000, 'x');
+    longValue[8190] = 'y';
+    Aws::StringStream json;
+    json << "{\"padding\":\"" << Aws::String(8180, 'p') << "\",\"escaped\\u0041\":\"" << longValue << "\",\"n\":1234567890123}";
+    JsonReader reader(json);
+
+    ASSERT_EQ(JsonToken::BEGIN_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    reader.Next();
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ("escapedA", reader.GetString());
+    ASSERT_EQ(JsonToken::STRING, reader.Next());
+    ASSERT_EQ(longValue, reader.GetString());
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ(JsonToken::NUMBER, reader.Next());
+    ASSERT_EQ(1234567890123LL, reader.GetInt64());
+    ASSERT_EQ(JsonToken::END_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::END_DOCUMENT, reader.Next());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(JsonReaderTest, TestSkipAndReadValue)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::StringStream json;
+    json << "{\"skipped\":{\"a\":[1,{\"b\":[]}],\"c\":\"}\"},\"kept\":{\"s\":\"str\",\"i\":7,\"d\":0.25,\"l\":[\"x\",\"y\"],\"t\":true},\"last\":1}";
+    JsonReader reader(json);
+
+    ASSERT_EQ(JsonToken::BEGIN_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ(JsonToken::BEGIN_OBJECT, reader.Next());
+    reader.SkipValue();
+    ASSERT_EQ(JsonToken::END_OBJECT, reader.GetCurrentToken());
+
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ("kept", reader.GetString());
+    reader.Next();
+    JsonValue kept = reader.ReadValue();
+    ASSERT_EQ("str", kept.GetString("s"));
+    ASSERT_EQ(7, kept.GetInteger("i"));
+    ASSERT_DOUBLE_EQ(0.25, kept.GetDouble("d"));
+    ASSERT_EQ(2u, kept.GetArray("l").GetLength());
+    ASSERT_EQ("y", kept.GetArray("l")[1].AsString());
+    ASSERT_TRUE(kept.GetBool("t"));
+
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ("last", reader.GetString());
+    ASSERT_EQ(JsonToken::NUMBER, reader.Next());
+    ASSERT_EQ(JsonToken::END_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::END_DOCUMENT, reader.Next());
+
+    AWS_END_MEMORY_TEST
+}
+
+static JsonToken ReadToEnd(const char* document)
+{
+    Aws::StringStream json;
+    json << document;
+    JsonReader reader(json);
+    JsonToken token;
+    do
+    {
+        token = reader.Next();
+    } while (token != JsonToken::END_DOCUMENT && token != JsonToken::PARSE_ERROR);
+
+    return token;
+}
+
+TEST(JsonReaderTest, TestMalformedDocuments)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    ASSERT_EQ(JsonToken::END_DOCUMENT, ReadToEnd(""));
+    ASSERT_EQ(JsonToken::END_DOCUMENT, ReadToEnd("[]"));
+    ASSERT_EQ(JsonToken::PARSE_ERROR, ReadToEnd("{\"a\":1,}"));
+    ASSERT_EQ(JsonToken::PARSE_ERROR, ReadToEnd("[1,]"));
+    ASSERT_EQ(JsonToken::PARSE_ERROR, ReadToEnd("{\"a\" 1}"));
+    ASSERT_EQ(JsonToken::PARSE_ERROR, ReadToEnd("{\"a\":1"));
+    ASSERT_EQ(JsonToken::PARSE_ERROR, ReadToEnd("[\"unterminated]"));
+    ASSERT_EQ(JsonToken::PARSE_ERROR, ReadToEnd("[tru]"));
+    ASSERT_EQ(JsonToken::PARSE_ERROR, ReadToEnd("[1-2]"));
+    ASSERT_EQ(JsonToken::PARSE_ERROR, ReadToEnd("{} {}"));
+
+    Aws::StringStream json;
+    json << "{\"a\":\"\\q\"}";
+    JsonReader reader(json);
+    reader.Next();
+    reader.Next();
+    ASSERT_EQ(JsonToken::PARSE_ERROR, reader.Next());
+    ASSERT_FALSE(reader.WasParseSuccessful());
+    ASSERT_FALSE(reader.GetErrorMessage().empty());
+    ASSERT_EQ(JsonToken::PARSE_ERROR, reader.Next());
+
+    AWS_END_MEMORY_TEST
+}
+
+//a DynamoDB Scan page of roughly pageBytes bytes.
+static Aws::String MakeScanPage(size_t pageBytes)
+{
+    Aws::StringStream page;
+    page << "{\"Count\":0,\"Items\":[";
+    size_t count = 0;
+    while (static_cast<size_t>(page.tellp()) < pageBytes)
+    {
+        page << (count ? "," : "") << "{\"id\":{\"S\":\"user-" << count << "\"},\"score\":{\"N\":\"" << count * 7 << "\"},"
+            << "\"email\":{\"S\":\"user" << count << "@example.com\"},\"active\":{\"BOOL\":true},"
+            << "\"tags\":{\"SS\":[\"alpha\",\"beta\",\"gamma\"]},\"bio\":{\"S\":\"" << Aws::String(120, 'b') << "\"}}";
+        ++count;
+    }
+    page << "],\"ScannedCount\":" << count << ",\"ConsumedCapacity\":{\"TableName\":\"t\",\"CapacityUnits\":128.5}}";
+    return page.str();
+}
+
+typedef Aws::Vector<Aws::Map<Aws::String, Aws::String>> ScanItems;
+
+//walks the DOM the way generated result classes do today.
+static size_t ParseScanPageWithJsonValue(Aws::IStream& body)
+{
+    ScanItems items;
+    JsonValue jsonValue(body);
+    Array<JsonValue> itemsJsonList = jsonValue.GetArray("Items");
+    for (unsigned itemsIndex = 0; itemsIndex < itemsJsonList.GetLength(); ++itemsIndex)
+    {
+        Aws::Map<Aws::String, JsonValue> attributeMapJsonMap = itemsJsonList[itemsIndex].GetAllObjects();
+        Aws::Map<Aws::String, Aws::String> attributes;
+        for (auto& attribute : attributeMapJsonMap)
+        {
+            JsonValue attributeValue = attribute.second.AsObject();
+            attributes[attribute.first] = attributeValue.ValueExists("S") ? attributeValue.GetString("S") : attributeValue.GetString("N");
+        }
+        items.push_back(std::move(attributes));
+    }
+    return items.size();
+}
+
+//reads a Scan page the way DynamoDB's ReadItemPage does, keeping only S and N attribute values.
+static ScanItems ReadScanPage(JsonReader& reader, long& scannedCount)
+{
+    ScanItems items;
+    reader.Next();
+    reader.ReadObject([&](const Aws::String& name)
+    {
+        if (name == "Items")
+        {
+            reader.ReadArray([&]()
+            {
+                if (reader.GetCurrentToken() != JsonToken::BEGIN_OBJECT)
+                {
+                    return;
+                }
+                Aws::Map<Aws::String, Aws::String> attributes;
+                reader.ReadObject([&](const Aws::String& attributeName)
+                {
+                    Aws::String& value = attributes[attributeName];
+                    reader.ReadObject([&](const Aws::String& type)
+                    {
+                        if ((type == "S" || type == "N") && reader.GetCurrentToken() == JsonToken::STRING)
+                        {
+                            value = reader.GetString();
+                        }
+                    });
+                });
+                items.push_back(std::move(attributes));
+            });
+        }
+        else if (name == "ScannedCount" && reader.GetCurrentToken() == JsonToken::NUMBER)
+        {
+            scannedCount = reader.GetInteger();
+        }
+    });
+    return items;
+}
+
+static size_t ParseScanPageWithJsonReader(Aws::IStream& body)
+{
+    JsonReader reader(body);
+    long scannedCount = 0;
+    ScanItems items = ReadScanPage(reader, scannedCount);
+    return reader.WasParseSuccessful() ? items.size() : 0;
+}
+
+TEST(JsonReaderTest, TestScanPageMatchesJsonValue)
+{
+    Aws::String page = MakeScanPage(64 * 1024);
+    Aws::StringStream domBody(page), readerBody(page);
+    size_t domCount = ParseScanPageWithJsonValue(domBody);
+    ASSERT_LT(0u, domCount);
+    ASSERT_EQ(domCount, ParseScanPageWithJsonReader(readerBody));
+}
+
+TEST(JsonReaderTest, TestScanPageWithUnexpectedItems)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    static const char* pages[] =
+    {
+        "{\"Items\":null,\"ScannedCount\":3}",
+        "{\"Items\":{\"id\":{\"S\":\"a\"}},\"ScannedCount\":3}",
+        "{\"Items\":\"a\",\"ScannedCount\":3}",
+        "{\"Items\":[],\"ScannedCount\":3}",
+    };
+    for (const char* page : pages)
+    {
+        Aws::StringStream body(page);
+        JsonReader reader(body);
+        long scannedCount = 0;
+        ASSERT_TRUE(ReadScanPage(reader, scannedCount).empty());
+        ASSERT_TRUE(reader.WasParseSuccessful());
+        ASSERT_EQ(3, scannedCount);
+        ASSERT_EQ(JsonToken::END_DOCUMENT, reader.Next());
+    }
+
+    //elements and attribute values of the wrong shape are dropped without losing track of the ones around them.
+    Aws::StringStream body("{\"Items\":[null,1,[{\"id\":{\"S\":\"nested\"}}],{\"id\":{\"S\":\"a\"},\"n\":null,"
+        "\"score\":{\"N\":null,\"SS\":[\"x\",null]},\"email\":{\"S\":\"e\"}},{\"id\":{\"S\":\"b\"}}],"
+        "\"Unknown\":{\"deep\":[[{}]]},\"ScannedCount\":2}");
+    JsonReader reader(body);
+    long scannedCount = 0;
+    ScanItems items = ReadScanPage(reader, scannedCount);
+    ASSERT_TRUE(reader.WasParseSuccessful());
+    ASSERT_EQ(2, scannedCount);
+    ASSERT_EQ(2u, items.size());
+    ASSERT_EQ("a", items[0]["id"]);
+    ASSERT_EQ("", items[0]["score"]);
+    ASSERT_EQ("e", items[0]["email"]);
+    ASSERT_EQ("b", items[1]["id"]);
+
+    AWS_END_MEMORY_TEST
+}
+
+#ifdef AWS_CUSTOM_MEMORY_MANAGEMENT
+
+//Not a pass/fail test: prints peak memory and throughput of the DOM and pull parsers on a 1 MB Scan page.
+TEST(JsonReaderTest, DISABLED_ScanPageParseBenchmark)
+{
+    static const int ITERATIONS = 10;
+    uint64_t domPeak = 0, readerPeak = 0;
+    std::chrono::steady_clock::duration domTime, readerTime;
+
+    {
+        AWS_BEGIN_MEMORY_TEST(1024, 10)
+        Aws::String page = MakeScanPage(1024 * 1024);
+        uint64_t baseline = memorySystem.GetCurrentBytesAllocated();
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            Aws::StringStream body(page);
+            ParseScanPageWithJsonValue(body);
+        }
+        domTime = std::chrono::steady_clock::now() - start;
+        domPeak = memorySystem.GetMaxBytesAllocated() - baseline;
+        AWS_END_MEMORY_TEST
+    }
+
+    {
+        AWS_BEGIN_MEMORY_TEST(1024, 10)
+        Aws::String page = MakeScanPage(1024 * 1024);
+        uint64_t baseline = memorySystem.GetCurrentBytesAllocated();
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            Aws::StringStream body(page);
+            ParseScanPageWithJsonReader(body);
+        }
+        readerTime = std::chrono::steady_clock::now() - start;
+        readerPeak = memorySystem.GetMaxBytesAllocated() - baseline;
+        AWS_END_MEMORY_TEST
+    }
+
+    std::cout << "1 MB Scan page (peak bytes includes the copy of the page in the body stream):" << std::endl
+        << "  JsonValue DOM: peak " << domPeak / 1024 << " KB, "
+        << std::chrono::duration_cast<std::chrono::microseconds>(domTime).count() / ITERATIONS << " us per page" << std::endl
+        << "  JsonReader:    peak " << readerPeak / 1024 << " KB, "
+        << std::chrono::duration_cast<std::chrono::microseconds>(readerTime).count() / ITERATIONS << " us per page" << std::endl;
+}
+
+#endif // AWS_CUSTOM_MEMORY_MANAGEMENT
@@ -17,7 +17,10 @@
 #include <aws/testing/MemoryTesting.h>
 
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <chrono>
+#include <iostream>
 
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
@@ -359,3 +362,115 @@ TEST(JsonSerializerTest, TestNullSanity)
     AWS_END_MEMORY_TEST
 }
 
+TEST(JsonSerializerTest, TestCompactStreamMatchesCompactString)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Array<JsonValue> nested(3);
+    nested[0].AsInteger(-42);
+    nested[1].AsDouble(0.1);
+    nested[2].AsObject(JsonValue().WithBool("flag", true));
+
+    JsonValue value;
+    value.WithString("plain", "value with / slash")
+        .WithString("escaped", "quote\" backslash\\ tab\t newline\n bell\a")
+        .WithInt64("big", 9007199254740993LL)
+        .WithBool("falseKey", false)
+        .WithArray("nested", nested)
+        .WithObject("empty", JsonValue().AsObject(JsonValue()))
+        .WithArray("emptyArray", Array<JsonValue>(0));
+
+    Aws::StringStream stream;
+    value.WriteCompact(stream);
+    ASSERT_EQ(value.WriteCompact(), stream.str());
+    ASSERT_EQ(Aws::String::npos, stream.str().find('\n'));
+
+    JsonValue reparsed(stream.str());
+    ASSERT_TRUE(reparsed.WasParseSuccessful());
+    ASSERT_EQ("quote\" backslash\\ tab\t newline\n bell\a", reparsed.GetString("escaped"));
+    ASSERT_EQ(9007199254740993LL, reparsed.GetInt64("big"));
+    ASSERT_DOUBLE_EQ(0.1, reparsed.GetArray("nested")[1].AsDouble());
+    ASSERT_TRUE(reparsed.GetArray("nested")[2].GetBool("flag"));
+
+    Aws::StringStream nullStream;
+    JsonValue().WriteCompact(nullStream);
+    ASSERT_EQ("{}", nullStream.str());
+
+    AWS_END_MEMORY_TEST
+}
+
+//roughly the shape of a DynamoDB PutItem payload: a table name and an item of typed attribute values.
+static JsonValue MakePutItemPayload(int itemIndex)
+{
+    JsonValue item;
+    Aws::StringStream id;
+    id << "user-" << itemIndex;
+    item.WithObject("id", JsonValue().WithString("S", id.str()));
+    item.WithObject("score", JsonValue().WithString("N", "123456"));
+    item.WithObject("email", JsonValue().WithString("S", "someone@example.com"));
+    item.WithObject("active", JsonValue().WithBool("BOOL", true));
+    Array<Aws::String> tags(4);
+    tags[0] = "alpha";
+    tags[1] = "beta";
+    tags[2] = "gamma";
+    tags[3] = "delta";
+    item.WithObject("tags", JsonValue().WithArray("SS", tags));
+    item.WithObject("address", JsonValue().WithObject("M", JsonValue()
+        .WithObject("street", JsonValue().WithString("S", "410 Terry Ave N"))
+        .WithObject("city", JsonValue().WithString("S", "Seattle"))
+        .WithObject("zip", JsonValue().WithString("N", "98109"))));
+
+    JsonValue payload;
+    payload.WithString("TableName", "benchmark-table");
+    payload.WithObject("Item", item);
+    payload.WithString("ReturnConsumedCapacity", "TOTAL");
+    return payload;
+}
+
+//Not a pass/fail test: prints wire size and serialize + hash time for readable vs compact payloads.
+TEST(JsonSerializerTest, DISABLED_CompactPayloadBenchmark)
+{
+    static const int ITERATIONS = 2000;
+    Aws::Vector<JsonValue> payloads;
+    for (int i = 0; i < 16; ++i)
+    {
+        payloads.push_back(MakePutItemPayload(i));
+    }
+
+    size_t readableBytes = 0, compactBytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        Aws::String body = payloads[i % payloads.size()].WriteReadable();
+        readableBytes += body.length();
+        HashingUtils::CalculateSHA256(body);
+    }
+    auto readableTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        Aws::String body = payloads[i % payloads.size()].WriteCompact();
+        compactBytes += body.length();
+        HashingUtils::CalculateSHA256(body);
+    }
+    auto compactStringTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        Aws::StringStream body;
+        payloads[i % payloads.size()].WriteCompact(body);
+        HashingUtils::CalculateSHA256(body);
+    }
+    auto compactStreamTime = std::chrono::steady_clock::now() - start;
+
+    ASSERT_LT(compactBytes, readableBytes);
+    std::cout << "PutItem-shaped payloads, " << ITERATIONS << " serialize + sha256 passes:" << std::endl
+        << "  WriteReadable:         " << readableBytes / ITERATIONS << " bytes, "
+        << std::chrono::duration_cast<std::chrono::microseconds>(readableTime).count() << " us" << std::endl
+        << "  WriteCompact (string): " << compactBytes / ITERATIONS << " bytes, "
+        << std::chrono::duration_cast<std::chrono::microseconds>(compactStringTime).count() << " us" << std::endl
+        << "  WriteCompact (stream): " << compactBytes / ITERATIONS << " bytes, "
+        << std::chrono::duration_cast<std::chrono::microseconds>(compactStreamTime).count() << " us" << std::endl;
+}
@@ -22,7 +22,18 @@
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/StringUtils.h>
-
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSQueue.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <iostream>
+#include <mutex>
+#include <streambuf>
 #include <thread>
 
 using namespace Aws::Utils;
@@ -149,3 +160,342 @@ TEST(LoggingTest, testTraceLogLevel)
 
     AWS_END_MEMORY_TEST
 }
+
+//stream buffer that holds up whoever writes to it until it is opened, and can discard what it's given.
+class GatedStreamBuf : public std::streambuf
+{
+public:
+    GatedStreamBuf(bool open, bool discard) : m_open(open), m_discard(discard) {}
+
+    void Open()
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_open = true;
+        m_signal.notify_all();
+    }
+
+    const Aws::String& GetContents() const { return m_contents; }
+
+protected:
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        std::unique_lock<std::mutex> locker(m_mutex);
+        m_signal.wait(locker, [this]() { return m_open; });
+        if (!m_discard)
+        {
+            m_contents.append(s, static_cast<size_t>(n));
+        }
+        return n;
+    }
+
+    int_type overflow(int_type c) override
+    {
+        char ch = traits_type::to_char_type(c);
+        xsputn(&ch, 1);
+        return c;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_signal;
+    bool m_open;
+    bool m_discard;
+    Aws::String m_contents;
+};
+
+TEST(LoggingTest, testDropPolicyCountsDroppedStatements)
+{
+    AWS_BEGIN_MEMORY_TEST(32, 10)
+
+    GatedStreamBuf streamBuf(false, false);
+    auto stream = Aws::MakeShared<Aws::OStream>(AllocationTag, &streamBuf);
+    static const uint64_t STATEMENTS = 100;
+    uint64_t dropped = 0;
+    {
+        DefaultLogSystem logSystem(LogLevel::Trace, stream, 4, LogOverflowPolicy::DROP);
+        //the writer gets stuck on the closed stream, so the queue fills up and the rest is dropped without blocking us.
+        for (uint64_t i = 0; i < STATEMENTS; ++i)
+        {
+            logSystem.Log(LogLevel::Info, "LoggingTest", "statement %d", static_cast<int>(i));
+        }
+        dropped = logSystem.GetDroppedStatementCount();
+        streamBuf.Open();
+    }
+
+    ASSERT_LT(0u, dropped);
+    Aws::Vector<Aws::String> loggedStatements = StringUtils::SplitOnLine(streamBuf.GetContents());
+    ASSERT_EQ(STATEMENTS, loggedStatements.size() + dropped);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(LoggingTest, testBlockPolicyKeepsEveryStatementInOrder)
+{
+    AWS_BEGIN_MEMORY_TEST(32, 10)
+
+    static const int THREADS = 4;
+    static const int STATEMENTS = 500;
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    {
+        DefaultLogSystem logSystem(LogLevel::Trace, ss, 4, LogOverflowPolicy::BLOCK);
+        Aws::Vector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t)
+        {
+            threads.push_back(std::thread([&logSystem, t]()
+            {
+                for (int i = 0; i < STATEMENTS; ++i)
+                {
+                    logSystem.Log(LogLevel::Info, "LoggingTest", "producer %d statement %d", t, i);
+                }
+            }));
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        ASSERT_EQ(0u, logSystem.GetDroppedStatementCount());
+    }
+
+    Aws::Vector<Aws::String> loggedStatements = StringUtils::SplitOnLine(ss->str());
+    ASSERT_EQ(static_cast<size_t>(THREADS * STATEMENTS), loggedStatements.size());
+    int nextStatement[THREADS] = { 0 };
+    for (auto& statement : loggedStatements)
+    {
+        int producer = -1, index = -1;
+        ASSERT_EQ(2, sscanf(statement.c_str() + statement.find("producer"), "producer %d statement %d", &producer, &index));
+        ASSERT_EQ(nextStatement[producer]++, index);
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+//the log system as it was before: a queue behind a mutex, copied out and flushed on every batch.
+class MutexQueueLogSystem : public FormattedLogSystem
+{
+public:
+    MutexQueueLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& log) : FormattedLogSystem(logLevel), m_log(log), m_stop(false)
+    {
+        m_thread = std::thread([this]()
+        {
+            bool done = false;
+            while (!done)
+            {
+                std::unique_lock<std::mutex> locker(m_mutex);
+                m_signal.wait(locker, [this]() { return m_stop || !m_queue.empty(); });
+                Aws::Vector<Aws::String> messages;
+                while (!m_queue.empty())
+                {
+                    messages.push_back(m_queue.front());
+                    m_queue.pop();
+                }
+                done = m_stop;
+                locker.unlock();
+                for (auto& message : messages)
+                {
+                    (*m_log) << message;
+                }
+                m_log->flush();
+            }
+        });
+    }
+
+    ~MutexQueueLogSystem()
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_mutex);
+            m_stop = true;
+        }
+        m_signal.notify_one();
+        m_thread.join();
+    }
+
+protected:
+    void ProcessFormattedStatement(Aws::String&& statement) override
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_mutex);
+            m_queue.push(std::move(statement));
+        }
+        m_signal.notify_one();
+    }
+
+private:
+    std::shared_ptr<Aws::OStream> m_log;
+    std::mutex m_mutex;
+    std::condition_variable m_signal;
+    Aws::Queue<Aws::String> m_queue;
+    bool m_stop;
+    std::thread m_thread;
+};
+
+static std::chrono::steady_clock::duration LogConcurrently(LogSystemInterface& logSystem, int threadCount, int statements)
+{
+    auto start = std::chrono::steady_clock::now();
+    Aws::Vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.push_back(std::thread([&logSystem, statements]()
+        {
+            for (int i = 0; i < statements; ++i)
+            {
+                logSystem.Log(LogLevel::Debug, "LoggingBenchmark", "request %d took %d ms", i, 42);
+            }
+        }));
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    return std::chrono::steady_clock::now() - start;
+}
+
+//Not a pass/fail test: prints logging throughput of the old and new queues, 8 threads logging into a discarding stream.
+TEST(LoggingTest, DISABLED_ConcurrentLoggingBenchmark)
+{
+    static const int THREADS = 8;
+    static const int STATEMENTS = 20000;
+    GatedStreamBuf streamBuf(true, true);
+    auto stream = Aws::MakeShared<Aws::OStream>(AllocationTag, &streamBuf);
+
+    std::chrono::steady_clock::duration mutexTime, ringTime;
+    {
+        MutexQueueLogSystem logSystem(LogLevel::Debug, stream);
+        mutexTime = LogConcurrently(logSystem, THREADS, STATEMENTS);
+    }
+    uint64_t dropped = 0;
+    {
+        DefaultLogSystem logSystem(LogLevel::Debug, stream);
+        ringTime = LogConcurrently(logSystem, THREADS, STATEMENTS);
+        dropped = logSystem.GetDroppedStatementCount();
+    }
+
+    double statements = static_cast<double>(THREADS) * STATEMENTS;
+    std::cout << THREADS << " threads, " << STATEMENTS << " statements each:" << std::endl
+        << "  mutex queue: " << statements / std::chrono::duration_cast<std::chrono::duration<double>>(mutexTime).count() << " statements/s" << std::endl
+        << "  ring buffer: " << statements / std::chrono::duration_cast<std::chrono::duration<double>>(ringTime).count() << " statements/s, "
+        << dropped << " dropped" << std::endl;
+}
+
+//keeps the statements handed to it so tests can look at exactly what FormattedLogSystem produced.
+class CapturingLogSystem : public FormattedLogSystem
+{
+public:
+    CapturingLogSystem() : FormattedLogSystem(LogLevel::Trace) {}
+
+    Aws::Vector<Aws::String> m_statements;
+
+protected:
+    void ProcessFormattedStatement(Aws::String&& statement) override
+    {
+        m_statements.push_back(std::move(statement));
+    }
+};
+
+TEST(LoggingTest, testFormattedStatementLayout)
+{
+    CapturingLogSystem logSystem;
+    Aws::String longArgument(1000, 'x');
+    logSystem.Log(LogLevel::Warn, "LayoutTag", "short %d", 7);
+    logSystem.Log(LogLevel::Error, "LayoutTag", "long %s end", longArgument.c_str());
+    Aws::OStringStream messageStream;
+    messageStream << "streamed " << 9;
+    logSystem.LogStream(LogLevel::Info, "LayoutTag", messageStream);
+
+    Aws::OStringStream threadId;
+    threadId << std::this_thread::get_id();
+    Aws::String threadPart = " LayoutTag [" + threadId.str() + "] ";
+
+    ASSERT_EQ(3u, logSystem.m_statements.size());
+    //[LEVEL] yyyy-mm-dd hh:mm:ss tag [thread] message\n
+    const Aws::String& shortStatement = logSystem.m_statements[0];
+    ASSERT_EQ(0u, shortStatement.find("[WARN] "));
+    ASSERT_EQ(7u + 19u, shortStatement.find(threadPart));
+    ASSERT_EQ("short 7\n", shortStatement.substr(7 + 19 + threadPart.size()));
+
+    const Aws::String& longStatement = logSystem.m_statements[1];
+    ASSERT_EQ(0u, longStatement.find("[ERROR] "));
+    ASSERT_EQ("long " + longArgument + " end\n", longStatement.substr(8 + 19 + threadPart.size()));
+
+    const Aws::String& streamedStatement = logSystem.m_statements[2];
+    ASSERT_EQ(0u, streamedStatement.find("[INFO] "));
+    ASSERT_EQ("streamed 9\n", streamedStatement.substr(7 + 19 + threadPart.size()));
+}
+
+//drops everything it's given, so the benchmark only measures formatting.
+class DiscardingLogSystem : public FormattedLogSystem
+{
+public:
+    DiscardingLogSystem() : FormattedLogSystem(LogLevel::Trace) {}
+
+protected:
+    void ProcessFormattedStatement(Aws::String&& statement) override
+    {
+        AWS_UNREFERENCED_PARAM(statement);
+    }
+};
+
+//the formatting path as it was before: two string streams, a locked localtime per line and vsnprintf twice.
+class LegacyFormattingLogSystem : public DiscardingLogSystem
+{
+public:
+    void Log(LogLevel logLevel, const char* tag, const char* formatStr, ...) override
+    {
+        Aws::StringStream prefix;
+        prefix << "[DEBUG] " << DateTime::CalculateLocalTimestampAsString("%Y-%m-%d %H:%M:%S") << " " << tag << " [" << std::this_thread::get_id() << "] ";
+        AWS_UNREFERENCED_PARAM(logLevel);
+
+        Aws::StringStream ss;
+        ss << prefix.str();
+
+        va_list args;
+        va_start(args, formatStr);
+        va_list tmp_args;
+        va_copy(tmp_args, args);
+        const int requiredLength = vsnprintf(nullptr, 0, formatStr, tmp_args) + 1;
+        va_end(tmp_args);
+        Array<char> outputBuff(requiredLength);
+        vsnprintf(outputBuff.GetUnderlyingData(), requiredLength, formatStr, args);
+        va_end(args);
+
+        ss << outputBuff.GetUnderlyingData() << std::endl;
+        ProcessFormattedStatement(std::move(ss.str()));
+    }
+};
+
+static double FormatLinesPerSecondPerThread(LogSystemInterface& logSystem, int threadCount, int statements)
+{
+    auto start = std::chrono::steady_clock::now();
+    Aws::Vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.push_back(std::thread([&logSystem, statements]()
+        {
+            for (int i = 0; i < statements; ++i)
+            {
+                logSystem.Log(LogLevel::Debug, "FormattingBenchmark", "request %d to %s took %d ms", i, "dynamodb.us-east-1.amazonaws.com", 42);
+            }
+        }));
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    double seconds = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start).count();
+    return statements / seconds;
+}
+
+//Not a pass/fail test: prints lines formatted per second per thread by the old and the new formatting paths.
+TEST(LoggingTest, DISABLED_LogFormattingBenchmark)
+{
+    static const int STATEMENTS = 100000;
+    for (int threadCount : { 1, 4 })
+    {
+        LegacyFormattingLogSystem legacy;
+        DiscardingLogSystem current;
+        double legacyRate = FormatLinesPerSecondPerThread(legacy, threadCount, STATEMENTS);
+        double currentRate = FormatLinesPerSecondPerThread(current, threadCount, STATEMENTS);
+        std::cout << threadCount << " thread(s), lines/s per thread:" << std::endl
+            << "  string streams: " << legacyRate << std::endl
+            << "  cached prefix:  " << currentRate << std::endl;
+    }
+}
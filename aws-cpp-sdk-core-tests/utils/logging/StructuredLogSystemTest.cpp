@@ -0,0 +1,222 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/logging/StructuredLogSystem.h>
+#include <aws/core/utils/logging/DefaultLogSystem.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/StringUtils.h>
+
+#include <chrono>
+#include <cstdarg>
+#include <cstring>
+#include <iostream>
+#include <stdio.h>
+#include <streambuf>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+using namespace Aws::Utils::Logging;
+
+static const char* AllocationTag = "StructuredLogSystemTest";
+static const char* LogTag = "StructuredTag";
+
+//everything the log statements below write, as printf itself formats it.
+static Aws::String ExpectedMessage(const char* formatStr, ...)
+{
+    char buffer[512];
+    va_list args;
+    va_start(args, formatStr);
+    vsnprintf(buffer, sizeof(buffer), formatStr, args);
+    va_end(args);
+    return buffer;
+}
+
+static Aws::Vector<Aws::String> LogThroughMacros(LogRecordFormat recordFormat)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    InitializeAWSLogging(Aws::MakeShared<StructuredLogSystem>(AllocationTag, LogLevel::Trace, ss, recordFormat));
+
+    //the record must hold its own copy of string arguments.
+    char scratch[32];
+    strcpy(scratch, "transient");
+    AWS_LOG_INFO(LogTag, "int %d, padded %-5d|, hex %#x, long %ld, size %zu, unsigned %llu", -42, 7, 255u, 1234567890L, static_cast<size_t>(99), 18446744073709551615ULL);
+    AWS_LOG_WARN(LogTag, "double %.3f, exp %e, general %g, star %*d, precision %.*s, char %c, percent %%", 3.14159, 12345.678, 0.5, 6, 42, 3, "abcdef", 'z');
+    AWS_LOG_DEBUG(LogTag, "string %s, quoted \"%s\"", scratch, "tab\there");
+    strcpy(scratch, "overwritten");
+    AWS_LOGSTREAM_ERROR(LogTag, "streamed " << 5 << " items");
+
+    ShutdownAWSLogging();
+    return StringUtils::SplitOnLine(ss->str());
+}
+
+TEST(StructuredLogSystemTest, TestTextRecordsMatchPrintf)
+{
+    Aws::Vector<Aws::String> lines = LogThroughMacros(LogRecordFormat::TEXT);
+    ASSERT_EQ(4u, lines.size());
+
+    Aws::String expected[] = {
+        "[INFO] " + ExpectedMessage("int %d, padded %-5d|, hex %#x, long %ld, size %zu, unsigned %llu", -42, 7, 255u, 1234567890L, static_cast<size_t>(99), 18446744073709551615ULL),
+        "[WARN] " + ExpectedMessage("double %.3f, exp %e, general %g, star %*d, precision %.*s, char %c, percent %%", 3.14159, 12345.678, 0.5, 6, 42, 3, "abcdef", 'z'),
+        "[DEBUG] " + ExpectedMessage("string %s, quoted \"%s\"", "transient", "tab\there"),
+        "[ERROR] streamed 5 items"
+    };
+
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        //[LEVEL] yyyy-mm-dd hh:mm:ss tag [thread] message
+        const Aws::String& line = lines[i];
+        size_t levelEnd = line.find(' ') + 1;
+        ASSERT_EQ(expected[i].substr(0, levelEnd), line.substr(0, levelEnd));
+        ASSERT_EQ(Aws::String(" ") + LogTag + " [", line.substr(levelEnd + 19, strlen(LogTag) + 3));
+        size_t messageStart = line.find("] ", levelEnd) + 2;
+        ASSERT_EQ(expected[i].substr(levelEnd), line.substr(messageStart));
+    }
+}
+
+TEST(StructuredLogSystemTest, TestJsonLinesRecords)
+{
+    Aws::Vector<Aws::String> lines = LogThroughMacros(LogRecordFormat::JSON_LINES);
+    ASSERT_EQ(4u, lines.size());
+
+    JsonValue first(lines[0]);
+    ASSERT_TRUE(first.WasParseSuccessful());
+    ASSERT_EQ("INFO", first.GetString("level"));
+    ASSERT_EQ(LogTag, first.GetString("tag"));
+    ASSERT_FALSE(first.GetString("thread").empty());
+    //yyyy-mm-ddThh:mm:ss.mmmZ
+    ASSERT_EQ(24u, first.GetString("time").size());
+    ASSERT_EQ("int %d, padded %-5d|, hex %#x, long %ld, size %zu, unsigned %llu", first.GetString("format"));
+    Array<JsonValue> firstArguments = first.GetArray("args");
+    ASSERT_EQ(6u, firstArguments.GetLength());
+    ASSERT_EQ(-42, firstArguments[0].AsInteger());
+    ASSERT_EQ(255, firstArguments[2].AsInteger());
+    ASSERT_EQ(1234567890LL, firstArguments[3].AsInt64());
+    ASSERT_EQ(ExpectedMessage("int %d, padded %-5d|, hex %#x, long %ld, size %zu, unsigned %llu", -42, 7, 255u, 1234567890L, static_cast<size_t>(99), 18446744073709551615ULL),
+        first.GetString("message"));
+
+    JsonValue second(lines[1]);
+    ASSERT_TRUE(second.WasParseSuccessful());
+    Array<JsonValue> secondArguments = second.GetArray("args");
+    //star width and precision are part of their conversion, not arguments of their own.
+    ASSERT_EQ(6u, secondArguments.GetLength());
+    ASSERT_DOUBLE_EQ(3.14159, secondArguments[0].AsDouble());
+    ASSERT_EQ(42, secondArguments[3].AsInteger());
+    ASSERT_EQ("abcdef", secondArguments[4].AsString());
+    ASSERT_EQ("z", secondArguments[5].AsString());
+
+    JsonValue third(lines[2]);
+    ASSERT_TRUE(third.WasParseSuccessful());
+    ASSERT_EQ("DEBUG", third.GetString("level"));
+    ASSERT_EQ("transient", third.GetArray("args")[0].AsString());
+    ASSERT_EQ("string transient, quoted \"tab\there\"", third.GetString("message"));
+
+    JsonValue fourth(lines[3]);
+    ASSERT_TRUE(fourth.WasParseSuccessful());
+    ASSERT_EQ("ERROR", fourth.GetString("level"));
+    ASSERT_FALSE(fourth.ValueExists("format"));
+    ASSERT_EQ("streamed 5 items", fourth.GetString("message"));
+}
+
+TEST(StructuredLogSystemTest, TestDropPolicyNeverBlocksTheCaller)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    static const int RECORDS = 10000;
+    uint64_t dropped = 0;
+    {
+        StructuredLogSystem logSystem(LogLevel::Trace, ss, LogRecordFormat::TEXT, 2, LogOverflowPolicy::DROP);
+        for (int i = 0; i < RECORDS; ++i)
+        {
+            logSystem.Log(LogLevel::Info, LogTag, "record %d", i);
+        }
+        dropped = logSystem.GetDroppedRecordCount();
+    }
+    ASSERT_EQ(static_cast<size_t>(RECORDS), StringUtils::SplitOnLine(ss->str()).size() + dropped);
+}
+
+TEST(StructuredLogSystemTest, TestTemporaryTagAndFormatString)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    {
+        StructuredLogSystem logSystem(LogLevel::Trace, ss);
+        //both buffers are reused before the writer gets to the records that point into them.
+        for (int i = 0; i < 3; ++i)
+        {
+            Aws::String tag = "tag" + StringUtils::to_string(i);
+            Aws::String formatStr = "built on the fly " + StringUtils::to_string(i) + " %d";
+            logSystem.Log(LogLevel::Info, tag.c_str(), formatStr.c_str(), i * 10);
+            tag.assign("clobbered");
+            formatStr.assign("clobbered %s %s %s");
+        }
+    }
+
+    Aws::Vector<Aws::String> lines = StringUtils::SplitOnLine(ss->str());
+    ASSERT_EQ(3u, lines.size());
+    for (int i = 0; i < 3; ++i)
+    {
+        const Aws::String& line = lines[i];
+        Aws::String index = StringUtils::to_string(i);
+        ASSERT_NE(Aws::String::npos, line.find(" tag" + index + " ["));
+        ASSERT_EQ("built on the fly " + index + " " + StringUtils::to_string(i * 10), line.substr(line.find("] ", 7) + 2));
+    }
+}
+
+class DiscardingStreamBuf : public std::streambuf
+{
+protected:
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+    int_type overflow(int_type c) override { return c; }
+};
+
+static double NanosecondsPerCall(LogSystemInterface& logSystem, int calls)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; ++i)
+    {
+        logSystem.Log(LogLevel::Debug, LogTag, "request %d to %s took %.2f ms", i, "dynamodb.us-east-1.amazonaws.com", 4.2);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    return static_cast<double>(elapsed.count()) / calls;
+}
+
+//Not a pass/fail test: prints how long a log call takes on the calling thread with formatting done there and deferred.
+TEST(StructuredLogSystemTest, DISABLED_CallerLatencyBenchmark)
+{
+    static const int CALLS = 200000;
+    DiscardingStreamBuf streamBuf;
+    auto stream = Aws::MakeShared<Aws::OStream>(AllocationTag, &streamBuf);
+
+    double formatted = 0, deferredText = 0, deferredJson = 0;
+    {
+        DefaultLogSystem logSystem(LogLevel::Debug, stream, CALLS);
+        formatted = NanosecondsPerCall(logSystem, CALLS);
+    }
+    {
+        StructuredLogSystem logSystem(LogLevel::Debug, stream, LogRecordFormat::TEXT, CALLS);
+        deferredText = NanosecondsPerCall(logSystem, CALLS);
+    }
+    {
+        StructuredLogSystem logSystem(LogLevel::Debug, stream, LogRecordFormat::JSON_LINES, CALLS);
+        deferredJson = NanosecondsPerCall(logSystem, CALLS);
+    }
+
+    std::cout << "ns per log call on the calling thread:" << std::endl
+        << "  formatted on caller (DefaultLogSystem): " << formatted << std::endl
+        << "  deferred, text:                         " << deferredText << std::endl
+        << "  deferred, json lines:                   " << deferredJson << std::endl;
+}
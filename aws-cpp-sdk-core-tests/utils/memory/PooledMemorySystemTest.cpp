@@ -0,0 +1,307 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/PooledMemorySystem.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+using namespace Aws::Utils::Memory;
+
+static const char* FIRST_TAG = "PooledMemorySystemTest::First";
+static const char* SECOND_TAG = "PooledMemorySystemTest::Second";
+
+static const AllocationTagStatistics* FindStatistics(const std::vector<AllocationTagStatistics>& statistics, const char* tag)
+{
+    for (auto& entry : statistics)
+    {
+        if (entry.tag == tag || (entry.tag && tag && strcmp(entry.tag, tag) == 0))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+TEST(PooledMemorySystemTest, TestSizeClassRounding)
+{
+    ASSERT_EQ(16u, PooledMemorySystem::GetAllocationSize(0));
+    ASSERT_EQ(16u, PooledMemorySystem::GetAllocationSize(1));
+    ASSERT_EQ(16u, PooledMemorySystem::GetAllocationSize(16));
+    ASSERT_EQ(32u, PooledMemorySystem::GetAllocationSize(17));
+    ASSERT_EQ(128u, PooledMemorySystem::GetAllocationSize(128));
+    ASSERT_EQ(160u, PooledMemorySystem::GetAllocationSize(129));
+    ASSERT_EQ(256u, PooledMemorySystem::GetAllocationSize(256));
+    ASSERT_EQ(320u, PooledMemorySystem::GetAllocationSize(257));
+    ASSERT_EQ(1280u, PooledMemorySystem::GetAllocationSize(1025));
+    ASSERT_EQ(32768u, PooledMemorySystem::GetAllocationSize(32768));
+    ASSERT_EQ(32769u, PooledMemorySystem::GetAllocationSize(32769));
+
+    //rounding never wastes more than a quarter of the block above the 16 byte steps.
+    for (size_t size = 129; size <= PooledMemorySystem::MAX_POOLED_SIZE; size += 7)
+    {
+        size_t rounded = PooledMemorySystem::GetAllocationSize(size);
+        ASSERT_GE(rounded, size);
+        ASSERT_LE(rounded - size, size / 4);
+    }
+}
+
+TEST(PooledMemorySystemTest, TestBlocksAreDistinctAlignedAndReused)
+{
+    PooledMemorySystem memorySystem;
+    static const size_t sizes[] = { 1, 24, 100, 700, 5000, 32768, 100000 };
+
+    Aws::Vector<void*> blocks;
+    for (size_t round = 0; round < 50; ++round)
+    {
+        for (size_t size : sizes)
+        {
+            void* memory = memorySystem.AllocateMemory(size, 1, FIRST_TAG);
+            ASSERT_NE(nullptr, memory);
+            ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(memory) % 16);
+            memset(memory, static_cast<int>(blocks.size() & 0xFF), size);
+            blocks.push_back(memory);
+        }
+    }
+
+    //every block still holds its own pattern, so none of them overlap.
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        size_t size = sizes[i % (sizeof(sizes) / sizeof(sizes[0]))];
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(blocks[i]);
+        ASSERT_EQ(static_cast<unsigned char>(i & 0xFF), bytes[0]);
+        ASSERT_EQ(static_cast<unsigned char>(i & 0xFF), bytes[size - 1]);
+    }
+
+    for (void* memory : blocks)
+    {
+        memorySystem.FreeMemory(memory);
+    }
+    memorySystem.FreeMemory(nullptr);
+
+    uint64_t reserved = memorySystem.GetReservedSlabBytes();
+    ASSERT_GT(reserved, 0u);
+
+    //a second round of the same allocations is served from the free lists without reserving more slabs.
+    blocks.clear();
+    for (size_t round = 0; round < 50; ++round)
+    {
+        for (size_t size : sizes)
+        {
+            blocks.push_back(memorySystem.AllocateMemory(size, 1, FIRST_TAG));
+        }
+    }
+    ASSERT_EQ(reserved, memorySystem.GetReservedSlabBytes());
+    for (void* memory : blocks)
+    {
+        memorySystem.FreeMemory(memory);
+    }
+}
+
+TEST(PooledMemorySystemTest, TestTagStatistics)
+{
+    PooledMemorySystem memorySystem;
+
+    void* first = memorySystem.AllocateMemory(100, 1, FIRST_TAG);
+    void* second = memorySystem.AllocateMemory(50000, 1, FIRST_TAG);
+    void* third = memorySystem.AllocateMemory(10, 1, SECOND_TAG);
+    void* untagged = memorySystem.AllocateMemory(30, 1);
+    memorySystem.FreeMemory(first);
+
+    auto statistics = memorySystem.GetTagStatistics();
+    ASSERT_EQ(3u, statistics.size());
+
+    auto firstStatistics = FindStatistics(statistics, FIRST_TAG);
+    ASSERT_NE(nullptr, firstStatistics);
+    ASSERT_EQ(2u, firstStatistics->allocationCount);
+    ASSERT_EQ(1u, firstStatistics->freeCount);
+    ASSERT_EQ(50000u, firstStatistics->currentBytes);
+    ASSERT_EQ(50100u, firstStatistics->totalBytes);
+
+    auto secondStatistics = FindStatistics(statistics, SECOND_TAG);
+    ASSERT_NE(nullptr, secondStatistics);
+    ASSERT_EQ(1u, secondStatistics->allocationCount);
+    ASSERT_EQ(10u, secondStatistics->currentBytes);
+
+    auto untaggedStatistics = FindStatistics(statistics, nullptr);
+    ASSERT_NE(nullptr, untaggedStatistics);
+    ASSERT_EQ(30u, untaggedStatistics->currentBytes);
+
+    //a copy of a tag's text at another address is reported under the same entry.
+    char copiedTag[64];
+    strcpy(copiedTag, SECOND_TAG);
+    memorySystem.FreeMemory(memorySystem.AllocateMemory(20, 1, copiedTag));
+    statistics = memorySystem.GetTagStatistics();
+    ASSERT_EQ(3u, statistics.size());
+    ASSERT_EQ(2u, FindStatistics(statistics, SECOND_TAG)->allocationCount);
+
+    memorySystem.FreeMemory(second);
+    memorySystem.FreeMemory(third);
+    memorySystem.FreeMemory(untagged);
+    for (auto& entry : memorySystem.GetTagStatistics())
+    {
+        ASSERT_EQ(0u, entry.currentBytes);
+        ASSERT_EQ(entry.allocationCount, entry.freeCount);
+    }
+}
+
+TEST(PooledMemorySystemTest, TestBlocksFreedOnOtherThreads)
+{
+    PooledMemorySystem memorySystem(false);
+    static const size_t THREAD_COUNT = 4;
+    static const size_t ALLOCATIONS_PER_THREAD = 20000;
+
+    //each thread allocates blocks and frees the ones its neighbour allocated, so blocks keep migrating between caches.
+    std::vector<std::vector<void*>> produced(THREAD_COUNT);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREAD_COUNT; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (size_t i = 0; i < ALLOCATIONS_PER_THREAD; ++i)
+            {
+                size_t size = 8 + (i * 37 + t * 101) % 3000;
+                unsigned char* memory = reinterpret_cast<unsigned char*>(memorySystem.AllocateMemory(size, 1));
+                memory[0] = static_cast<unsigned char>(t);
+                memory[size - 1] = static_cast<unsigned char>(t);
+                produced[t].push_back(memory);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    threads.clear();
+
+    for (size_t t = 0; t < THREAD_COUNT; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            auto& blocks = produced[(t + 1) % THREAD_COUNT];
+            for (size_t i = 0; i < blocks.size(); ++i)
+            {
+                size_t size = 8 + (i * 37 + ((t + 1) % THREAD_COUNT) * 101) % 3000;
+                unsigned char* memory = reinterpret_cast<unsigned char*>(blocks[i]);
+                EXPECT_EQ((t + 1) % THREAD_COUNT, memory[0]);
+                EXPECT_EQ((t + 1) % THREAD_COUNT, memory[size - 1]);
+                memorySystem.FreeMemory(memory);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+#ifdef AWS_CUSTOM_MEMORY_MANAGEMENT
+
+static const char* BENCHMARK_TAG = "PooledMemorySystemBenchmark";
+
+//One DynamoDB GetItem worth of client side work: serialize the request body, sign it, and parse a response.
+static size_t RunDynamoDbRequestCycle(const Aws::Client::AWSAuthSigner& signer)
+{
+    Aws::Utils::Json::JsonValue key;
+    key.WithObject("id", Aws::Utils::Json::JsonValue().WithString("S", "customer-00042"));
+    key.WithObject("sort", Aws::Utils::Json::JsonValue().WithString("N", "1459382400"));
+    Aws::Utils::Json::JsonValue payload;
+    payload.WithString("TableName", "Customers");
+    payload.WithObject("Key", key);
+    payload.WithBool("ConsistentRead", true);
+    payload.WithString("ProjectionExpression", "id, sort, #n, email, address, orders");
+
+    auto request = Aws::MakeShared<Aws::Http::Standard::StandardHttpRequest>(BENCHMARK_TAG,
+        Aws::Http::URI("https://dynamodb.us-east-1.amazonaws.com/"), Aws::Http::HttpMethod::HTTP_POST);
+    request->SetHeaderValue(Aws::Http::HOST_HEADER, "dynamodb.us-east-1.amazonaws.com");
+    request->SetHeaderValue("x-amz-target", "DynamoDB_20120810.GetItem");
+    request->SetHeaderValue(Aws::Http::CONTENT_TYPE_HEADER, "application/x-amz-json-1.0");
+    auto body = Aws::MakeShared<Aws::StringStream>(BENCHMARK_TAG);
+    *body << payload.WriteCompact();
+    request->AddContentBody(body);
+    if (!signer.SignRequest(*request))
+    {
+        return 0;
+    }
+
+    Aws::Utils::Json::JsonValue response(Aws::String(
+        "{\"Item\":{\"id\":{\"S\":\"customer-00042\"},\"sort\":{\"N\":\"1459382400\"},\"name\":{\"S\":\"Jane Doe\"},"
+        "\"email\":{\"S\":\"jane@example.com\"},\"address\":{\"M\":{\"street\":{\"S\":\"1 Main St\"},\"city\":{\"S\":\"Seattle\"}}},"
+        "\"orders\":{\"L\":[{\"S\":\"o-1\"},{\"S\":\"o-2\"},{\"S\":\"o-3\"},{\"S\":\"o-4\"}]}}}"));
+    size_t parsed = 0;
+    for (auto& attribute : response.GetObject("Item").GetAllObjects())
+    {
+        parsed += attribute.first.size() + attribute.second.WriteCompact().size();
+    }
+    return parsed + request->GetAwsAuthorization().size();
+}
+
+static double MeasureRequestCycles(size_t cycles)
+{
+    auto credentialsProvider = Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(BENCHMARK_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    Aws::Client::AWSAuthV4Signer signer(credentialsProvider, "dynamodb", Aws::Region::US_EAST_1);
+
+    size_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < cycles; ++i)
+    {
+        checksum += RunDynamoDbRequestCycle(signer);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_GT(checksum, 0u);
+    return static_cast<double>(elapsed) / cycles / 1000.0;
+}
+
+//Not a pass/fail test: reports the cost of a serialize, sign and parse cycle with the SDK allocating from plain
+//malloc versus from the pooled memory system.
+TEST(PooledMemorySystemTest, DISABLED_DynamoDbRequestCycleBenchmark)
+{
+    static const size_t CYCLES = 5000;
+
+    //warm up with malloc so lazily created statics don't end up owned by the pooled memory system.
+    MeasureRequestCycles(CYCLES / 10);
+    double mallocMicros = MeasureRequestCycles(CYCLES);
+
+    PooledMemorySystem memorySystem;
+    InitializeAWSMemorySystem(memorySystem);
+    double pooledMicros = MeasureRequestCycles(CYCLES);
+    ShutdownAWSMemorySystem();
+
+    //everything the cycles allocated was handed back before the memory system was uninstalled.
+    uint64_t allocations = 0;
+    for (auto& entry : memorySystem.GetTagStatistics())
+    {
+        ASSERT_EQ(0u, entry.currentBytes);
+        allocations += entry.allocationCount;
+    }
+
+    std::cout << "Request cycle with malloc: " << mallocMicros << " us, pooled: " << pooledMicros << " us, "
+              << allocations / CYCLES << " allocations per cycle, " << memorySystem.GetReservedSlabBytes() / 1024
+              << " KB of slabs" << std::endl;
+}
+
+#endif // AWS_CUSTOM_MEMORY_MANAGEMENT
@@ -0,0 +1,247 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/RequestArena.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace Aws::Utils::Memory;
+
+#ifdef AWS_CUSTOM_MEMORY_MANAGEMENT
+
+static const char* ALLOCATION_TAG = "RequestArenaTest";
+
+TEST(RequestArenaTest, TestAllocationsComeFromArenaAndAreReturned)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    uint64_t allocationsBefore = memorySystem.GetTotalAllocationCount();
+    {
+        RequestArena arena;
+        ASSERT_TRUE(arena.IsActive());
+
+        Aws::Vector<Aws::String> strings;
+        Aws::Map<Aws::String, Aws::String> headers;
+        for (int i = 0; i < 200; ++i)
+        {
+            strings.push_back(Aws::String(64, 'x') + std::to_string(i).c_str());
+            headers[strings.back()] = "value";
+        }
+
+        ASSERT_GE(arena.GetAllocationCount(), 600u);
+        ASSERT_GT(arena.GetChunkCount(), 1u);
+        //the memory system only saw the chunks.
+        ASSERT_EQ(arena.GetChunkCount(), memorySystem.GetTotalAllocationCount() - allocationsBefore);
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(RequestArenaTest, TestSurvivorsOutliveTheArena)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::String* survivor = nullptr;
+    {
+        RequestArena arena;
+        Aws::String temporary(100, 't');
+        survivor = Aws::New<Aws::String>(ALLOCATION_TAG, 100, 's');
+        ASSERT_EQ(3u, arena.GetAllocationCount());
+    }
+
+    //the survivor's chunk is still held, and goes back once the survivor is freed.
+    ASSERT_GT(memorySystem.GetCurrentBytesAllocated(), 0u);
+    ASSERT_EQ(Aws::String(100, 's'), *survivor);
+    Aws::Delete(survivor);
+    ASSERT_EQ(0u, memorySystem.GetCurrentBytesAllocated());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(RequestArenaTest, TestMemoryFreedOnAnotherThread)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::Vector<void*> blocks;
+    blocks.reserve(1000);
+    {
+        RequestArena arena;
+        for (int i = 0; i < 1000; ++i)
+        {
+            blocks.push_back(Aws::Malloc(ALLOCATION_TAG, 100));
+        }
+        ASSERT_EQ(1000u, arena.GetAllocationCount());
+    }
+
+    std::thread freeingThread([&blocks]()
+    {
+        for (void* block : blocks)
+        {
+            Aws::Free(block);
+        }
+    });
+    freeingThread.join();
+    blocks.clear();
+    blocks.shrink_to_fit();
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(RequestArenaTest, TestOtherThreadsAndLargeAllocationsBypassTheArena)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    RequestArena arena;
+    void* otherThreadMemory = nullptr;
+    std::thread otherThread([&otherThreadMemory]()
+    {
+        otherThreadMemory = Aws::Malloc(ALLOCATION_TAG, 100);
+    });
+    otherThread.join();
+    void* largeMemory = Aws::Malloc(ALLOCATION_TAG, RequestArena::MAX_ARENA_ALLOCATION + 1);
+    ASSERT_EQ(0u, arena.GetAllocationCount());
+
+    void* arenaMemory = Aws::Malloc(ALLOCATION_TAG, 100);
+    ASSERT_EQ(1u, arena.GetAllocationCount());
+
+    Aws::Free(otherThreadMemory);
+    Aws::Free(largeMemory);
+    Aws::Free(arenaMemory);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(RequestArenaTest, TestNestedArenas)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    RequestArena outer;
+    void* first = Aws::Malloc(ALLOCATION_TAG, 10);
+    {
+        RequestArena inner;
+        ASSERT_TRUE(inner.IsActive());
+        void* second = Aws::Malloc(ALLOCATION_TAG, 10);
+        ASSERT_EQ(1u, inner.GetAllocationCount());
+        ASSERT_EQ(1u, outer.GetAllocationCount());
+        Aws::Free(second);
+    }
+    void* third = Aws::Malloc(ALLOCATION_TAG, 10);
+    ASSERT_EQ(2u, outer.GetAllocationCount());
+
+    Aws::Free(first);
+    Aws::Free(third);
+
+    AWS_END_MEMORY_TEST
+}
+
+//Serializes, signs and parses one DynamoDB GetItem worth of data, keeping the result the way a result model would.
+static size_t RunDynamoDbRequestCycle(const Aws::Client::AWSAuthSigner& signer)
+{
+    Aws::Utils::Json::JsonValue key;
+    key.WithObject("id", Aws::Utils::Json::JsonValue().WithString("S", "customer-00042"));
+    Aws::Utils::Json::JsonValue payload;
+    payload.WithString("TableName", "Customers");
+    payload.WithObject("Key", key);
+    payload.WithBool("ConsistentRead", true);
+
+    auto request = Aws::MakeShared<Aws::Http::Standard::StandardHttpRequest>(ALLOCATION_TAG,
+        Aws::Http::URI("https://dynamodb.us-east-1.amazonaws.com/"), Aws::Http::HttpMethod::HTTP_POST);
+    request->SetHeaderValue(Aws::Http::HOST_HEADER, "dynamodb.us-east-1.amazonaws.com");
+    request->SetHeaderValue("x-amz-target", "DynamoDB_20120810.GetItem");
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *body << payload.WriteCompact();
+    request->AddContentBody(body);
+    if (!signer.SignRequest(*request))
+    {
+        return 0;
+    }
+
+    Aws::Utils::Json::JsonValue response(Aws::String(
+        "{\"Item\":{\"id\":{\"S\":\"customer-00042\"},\"name\":{\"S\":\"Jane Doe\"},\"email\":{\"S\":\"jane@example.com\"},"
+        "\"orders\":{\"L\":[{\"S\":\"o-1\"},{\"S\":\"o-2\"},{\"S\":\"o-3\"}]}}}"));
+    Aws::Map<Aws::String, Aws::String> item;
+    for (auto& attribute : response.GetObject("Item").GetAllObjects())
+    {
+        item[attribute.first] = attribute.second.WriteCompact();
+    }
+    return item.size() + request->GetAwsAuthorization().size();
+}
+
+//Not a pass/fail test: reports how many allocations reach the memory system per request cycle, and the time per
+//cycle, with and without an arena around each cycle.
+TEST(RequestArenaTest, DISABLED_RequestCycleAllocationBenchmark)
+{
+    static const size_t CYCLES = 5000;
+
+    BaseTestMemorySystem memorySystem;
+    InitializeAWSMemorySystem(memorySystem);
+    {
+        auto credentialsProvider = Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+        Aws::Client::AWSAuthV4Signer signer(credentialsProvider, "dynamodb", Aws::Region::US_EAST_1);
+        RunDynamoDbRequestCycle(signer);
+
+        size_t checksum = 0;
+        uint64_t allocationsBefore = memorySystem.GetTotalAllocationCount();
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < CYCLES; ++i)
+        {
+            checksum += RunDynamoDbRequestCycle(signer);
+        }
+        auto plainNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        uint64_t plainAllocations = memorySystem.GetTotalAllocationCount() - allocationsBefore;
+
+        allocationsBefore = memorySystem.GetTotalAllocationCount();
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < CYCLES; ++i)
+        {
+            RequestArena arena;
+            checksum += RunDynamoDbRequestCycle(signer);
+        }
+        auto arenaNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        uint64_t arenaAllocations = memorySystem.GetTotalAllocationCount() - allocationsBefore;
+
+        ASSERT_GT(checksum, 0u);
+        ASSERT_LT(arenaAllocations, plainAllocations);
+        std::cout << "Memory system allocations per request cycle: " << static_cast<double>(plainAllocations) / CYCLES
+                  << " without an arena (" << plainNanos / CYCLES / 1000.0 << " us), "
+                  << static_cast<double>(arenaAllocations) / CYCLES << " with one (" << arenaNanos / CYCLES / 1000.0 << " us)" << std::endl;
+    }
+    ShutdownAWSMemorySystem();
+    ASSERT_EQ(0u, memorySystem.GetCurrentOutstandingAllocations());
+}
+
+#else
+
+TEST(RequestArenaTest, TestInactiveWithoutCustomMemoryManagement)
+{
+    Aws::Utils::Memory::RequestArena arena;
+    ASSERT_FALSE(arena.IsActive());
+}
+
+#endif // AWS_CUSTOM_MEMORY_MANAGEMENT
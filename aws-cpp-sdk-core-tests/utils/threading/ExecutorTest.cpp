@@ -0,0 +1,176 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+class Gate
+{
+    public:
+        Gate() : m_open(false) {}
+
+        void Open()
+        {
+            {
+                std::lock_guard<std::mutex> locker(m_mutex);
+                m_open = true;
+            }
+            m_signal.notify_all();
+        }
+
+        void Wait()
+        {
+            std::unique_lock<std::mutex> locker(m_mutex);
+            m_signal.wait(locker, [this](){ return m_open; });
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_signal;
+        bool m_open;
+};
+
+TEST(PooledThreadExecutorTest, RunsAllTasksBeforeShutdown)
+{
+    std::atomic<int> counter(0);
+    {
+        PooledThreadExecutor executor(4);
+        for(int i = 0; i < 1000; ++i)
+        {
+            ASSERT_TRUE(executor.Submit([&counter](){ ++counter; }));
+        }
+    }
+
+    ASSERT_EQ(1000, counter.load());
+}
+
+TEST(PooledThreadExecutorTest, UsesOnlyPoolThreads)
+{
+    std::mutex idMutex;
+    Aws::Vector<std::thread::id> seenIds;
+    {
+        PooledThreadExecutor executor(2);
+        for(int i = 0; i < 200; ++i)
+        {
+            executor.Submit([&](){
+                std::lock_guard<std::mutex> locker(idMutex);
+                if(std::find(seenIds.begin(), seenIds.end(), std::this_thread::get_id()) == seenIds.end())
+                {
+                    seenIds.push_back(std::this_thread::get_id());
+                }
+            });
+        }
+    }
+
+    ASSERT_TRUE(seenIds.size() <= 2u);
+    ASSERT_TRUE(std::find(seenIds.begin(), seenIds.end(), std::this_thread::get_id()) == seenIds.end());
+}
+
+TEST(PooledThreadExecutorTest, RejectsWhenQueueIsFull)
+{
+    Gate gate;
+    Gate started;
+    std::atomic<int> counter(0);
+    {
+        PooledThreadExecutor executor(1, 2, OverflowPolicy::REJECT);
+        ASSERT_TRUE(executor.Submit([&](){ started.Open(); gate.Wait(); ++counter; }));
+        started.Wait();
+
+        ASSERT_TRUE(executor.Submit([&](){ ++counter; }));
+        ASSERT_TRUE(executor.Submit([&](){ ++counter; }));
+        ASSERT_FALSE(executor.Submit([&](){ ++counter; }));
+        ASSERT_EQ(2u, executor.GetQueuedTaskCount());
+
+        gate.Open();
+    }
+
+    ASSERT_EQ(3, counter.load());
+}
+
+TEST(PooledThreadExecutorTest, RunsInCallerWhenQueueIsFull)
+{
+    Gate gate;
+    Gate started;
+    std::thread::id overflowThread;
+    {
+        PooledThreadExecutor executor(1, 1, OverflowPolicy::RUN_IN_CALLER);
+        executor.Submit([&](){ started.Open(); gate.Wait(); });
+        started.Wait();
+
+        executor.Submit([](){});
+        ASSERT_TRUE(executor.Submit([&](){ overflowThread = std::this_thread::get_id(); }));
+        ASSERT_EQ(std::this_thread::get_id(), overflowThread);
+
+        gate.Open();
+    }
+}
+
+TEST(PooledThreadExecutorTest, BlocksWhenQueueIsFull)
+{
+    Gate gate;
+    Gate started;
+    std::atomic<bool> submitted(false);
+    std::atomic<int> counter(0);
+    {
+        PooledThreadExecutor executor(1, 1, OverflowPolicy::BLOCK);
+        executor.Submit([&](){ started.Open(); gate.Wait(); ++counter; });
+        started.Wait();
+        executor.Submit([&](){ ++counter; });
+
+        std::thread submitter([&](){
+            executor.Submit([&](){ ++counter; });
+            submitted = true;
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ASSERT_FALSE(submitted.load());
+
+        gate.Open();
+        submitter.join();
+        ASSERT_TRUE(submitted.load());
+    }
+
+    ASSERT_EQ(3, counter.load());
+}
+
+TEST(PooledThreadExecutorTest, WorkerResubmissionDoesNotDeadlock)
+{
+    std::atomic<int> counter(0);
+    {
+        PooledThreadExecutor executor(2, 1, OverflowPolicy::BLOCK);
+        for(int i = 0; i < 10; ++i)
+        {
+            executor.Submit([&](){
+                for(int j = 0; j < 10; ++j)
+                {
+                    executor.Submit([&](){ ++counter; });
+                }
+            });
+        }
+    }
+
+    ASSERT_EQ(100, counter.load());
+}
@@ -0,0 +1,371 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <chrono>
+#include <iostream>
+
+using namespace Aws::Utils::Xml;
+using namespace Aws::Utils;
+
+TEST(XmlReaderTest, TestTokenSequence)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::StringStream xml;
+    xml << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<Root xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">\n"
+        << "  <Name>bucket</Name>\n  <Empty/>\n  <Nested><Inner>value</Inner></Nested>\n</Root>\n";
+    XmlReader reader(xml);
+
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ("Root", reader.GetName());
+    ASSERT_EQ(1u, reader.GetDepth());
+    ASSERT_EQ("http://s3.amazonaws.com/doc/2006-03-01/", reader.GetAttributeValue("xmlns"));
+    ASSERT_EQ("", reader.GetAttributeValue("missing"));
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ("Name", reader.GetName());
+    ASSERT_EQ(2u, reader.GetDepth());
+    ASSERT_EQ(XmlToken::TEXT, reader.Next());
+    ASSERT_EQ("bucket", reader.GetText());
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_EQ("Name", reader.GetName());
+    ASSERT_EQ(1u, reader.GetDepth());
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ("Empty", reader.GetName());
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_EQ("Empty", reader.GetName());
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ("Nested", reader.GetName());
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ("Inner", reader.GetName());
+    ASSERT_EQ(3u, reader.GetDepth());
+    ASSERT_EQ(XmlToken::TEXT, reader.Next());
+    ASSERT_EQ("value", reader.GetText());
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_EQ("Nested", reader.GetName());
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_EQ("Root", reader.GetName());
+    ASSERT_EQ(0u, reader.GetDepth());
+    ASSERT_EQ(XmlToken::END_DOCUMENT, reader.Next());
+    ASSERT_EQ(XmlToken::END_DOCUMENT, reader.Next());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(XmlReaderTest, TestEntitiesCdataAndSkippedMarkup)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::StringStream xml;
+    xml << "<!DOCTYPE Root>\n<!-- leading comment --><Root a='1 &amp; 2' b=\"&quot;x&quot;\">"
+        << "<Key>a&amp;b &lt;c&gt; &apos;d&apos; &#65;&#x42;&#xe9;&#x20AC;</Key>"
+        << "<?processing instruction?><!-- a > comment --><Data><![CDATA[<raw> & ]]></Data></Root><!-- trailing -->";
+    XmlReader reader(xml);
+
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ("1 & 2", reader.GetAttributeValue("a"));
+    ASSERT_EQ("\"x\"", reader.GetAttributeValue("b"));
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ(XmlToken::TEXT, reader.Next());
+    ASSERT_EQ("a&b <c> 'd' AB\xC3\xA9\xE2\x82\xAC", reader.GetText());
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ("Data", reader.GetName());
+    ASSERT_EQ(XmlToken::TEXT, reader.Next());
+    ASSERT_EQ("<raw> & ", reader.GetText());
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_EQ(XmlToken::END_DOCUMENT, reader.Next());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(XmlReaderTest, TestTokensSpanningBufferBoundaries)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    //long names, attribute values and text straddle the 8 KB read blocks at every offset of the pattern.
+    Aws::String longText(9000, 't');
+    Aws::StringStream xml;
+    xml << "<Root>";
+    for (int i = 0; i < 40; ++i)
+    {
+        xml << "<Element" << i << " attribute=\"" << Aws::String(i * 37, 'a') << "\">" << longText.substr(0, i * 311)
+            << "&amp;</Element" << i << ">";
+    }
+    xml << "</Root>";
+    XmlReader reader(xml);
+
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    for (int i = 0; i < 40; ++i)
+    {
+        ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+        ASSERT_EQ("Element" + StringUtils::to_string(i), reader.GetName());
+        ASSERT_EQ(Aws::String(i * 37, 'a'), reader.GetAttributeValue("attribute"));
+        ASSERT_EQ(longText.substr(0, i * 311) + "&", reader.ReadElementText());
+    }
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_EQ(XmlToken::END_DOCUMENT, reader.Next());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(XmlReaderTest, TestReadElementTextAndSkipElement)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::StringStream xml;
+    xml << "<Root><Skipped><A><B>x</B></A><C/></Skipped><Text>\n   padded value \n</Text>"
+        << "<Mixed>one<Child>two</Child>three</Mixed><None></None><Last>end</Last></Root>";
+    XmlReader reader(xml);
+
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    reader.SkipElement();
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.GetCurrentToken());
+    ASSERT_EQ("Skipped", reader.GetName());
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ("Text", reader.GetName());
+    ASSERT_EQ("padded value", reader.ReadElementText());
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ("onetwothree", reader.ReadElementText());
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ("", reader.ReadElementText());
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_EQ("end", reader.ReadElementText());
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_EQ("Root", reader.GetName());
+    ASSERT_EQ(XmlToken::END_DOCUMENT, reader.Next());
+
+    AWS_END_MEMORY_TEST
+}
+
+static XmlToken ReadToEnd(const char* document)
+{
+    Aws::StringStream xml;
+    xml << document;
+    XmlReader reader(xml);
+    XmlToken token = reader.Next();
+    while (token != XmlToken::END_DOCUMENT && token != XmlToken::PARSE_ERROR)
+    {
+        token = reader.Next();
+    }
+    if (token == XmlToken::PARSE_ERROR)
+    {
+        EXPECT_FALSE(reader.WasParseSuccessful());
+        EXPECT_FALSE(reader.GetErrorMessage().empty());
+    }
+    return token;
+}
+
+TEST(XmlReaderTest, TestMalformedDocuments)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    ASSERT_EQ(XmlToken::END_DOCUMENT, ReadToEnd("<Root><A>1</A></Root>"));
+    ASSERT_EQ(XmlToken::PARSE_ERROR, ReadToEnd(""));
+    ASSERT_EQ(XmlToken::PARSE_ERROR, ReadToEnd("<Root><A>1</B></Root>"));
+    ASSERT_EQ(XmlToken::PARSE_ERROR, ReadToEnd("<Root><A>1</A>"));
+    ASSERT_EQ(XmlToken::PARSE_ERROR, ReadToEnd("<Root></Root><Second/>"));
+    ASSERT_EQ(XmlToken::PARSE_ERROR, ReadToEnd("text<Root/>"));
+    ASSERT_EQ(XmlToken::PARSE_ERROR, ReadToEnd("<Root a=1></Root>"));
+    ASSERT_EQ(XmlToken::PARSE_ERROR, ReadToEnd("<Root>&bogus;</Root>"));
+    ASSERT_EQ(XmlToken::PARSE_ERROR, ReadToEnd("<Root><!-- unterminated </Root>"));
+    ASSERT_EQ(XmlToken::PARSE_ERROR, ReadToEnd("<Root><![CDATA[unterminated</Root>"));
+
+    AWS_END_MEMORY_TEST
+}
+
+//a ListObjects page with keyCount keys.
+static Aws::String MakeListObjectsPage(int keyCount)
+{
+    Aws::StringStream page;
+    page << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\"><Name>bucket</Name><Prefix></Prefix>"
+        << "<Marker></Marker><MaxKeys>1000</MaxKeys><IsTruncated>true</IsTruncated>";
+    for (int i = 0; i < keyCount; ++i)
+    {
+        page << "<Contents><Key>logs/2015/10/01/host-" << i << ".log.gz</Key><LastModified>2015-10-01T12:00:00.000Z</LastModified>"
+            << "<ETag>&quot;" << Aws::String(32, 'e') << "&quot;</ETag><Size>" << i * 1024 << "</Size>"
+            << "<Owner><ID>" << Aws::String(64, 'o') << "</ID><DisplayName>owner</DisplayName></Owner>"
+            << "<StorageClass>STANDARD</StorageClass></Contents>";
+    }
+    page << "</ListBucketResult>";
+    return page.str();
+}
+
+struct ListedObject
+{
+    Aws::String key;
+    Aws::String eTag;
+    long long size;
+    Aws::String ownerId;
+};
+
+typedef Aws::Vector<ListedObject> ListedObjects;
+
+//walks the DOM the way generated result classes do today.
+static size_t ParseListObjectsWithXmlDocument(Aws::IOStream& body, ListedObjects& objects)
+{
+    XmlDocument document = XmlDocument::CreateFromXmlStream(body);
+    if (!document.WasParseSuccessful())
+    {
+        return 0;
+    }
+    XmlNode contentsNode = document.GetRootElement().FirstChild("Contents");
+    while (!contentsNode.IsNull())
+    {
+        ListedObject object;
+        object.key = StringUtils::Trim(contentsNode.FirstChild("Key").GetText().c_str());
+        object.eTag = StringUtils::Trim(contentsNode.FirstChild("ETag").GetText().c_str());
+        object.size = StringUtils::ConvertToInt64(StringUtils::Trim(contentsNode.FirstChild("Size").GetText().c_str()).c_str());
+        object.ownerId = StringUtils::Trim(contentsNode.FirstChild("Owner").FirstChild("ID").GetText().c_str());
+        objects.push_back(std::move(object));
+        contentsNode = contentsNode.NextNode("Contents");
+    }
+    return objects.size();
+}
+
+static size_t ParseListObjectsWithXmlReader(Aws::IOStream& body, ListedObjects& objects)
+{
+    XmlReader reader(body);
+    if (reader.Next() != XmlToken::START_ELEMENT)
+    {
+        return 0;
+    }
+    while (reader.Next() == XmlToken::START_ELEMENT)
+    {
+        if (reader.GetName() != "Contents")
+        {
+            reader.SkipElement();
+            continue;
+        }
+        ListedObject object;
+        while (reader.Next() == XmlToken::START_ELEMENT)
+        {
+            if (reader.GetName() == "Key")
+            {
+                object.key = reader.ReadElementText();
+            }
+            else if (reader.GetName() == "ETag")
+            {
+                object.eTag = reader.ReadElementText();
+            }
+            else if (reader.GetName() == "Size")
+            {
+                object.size = StringUtils::ConvertToInt64(reader.ReadElementText().c_str());
+            }
+            else if (reader.GetName() == "Owner")
+            {
+                while (reader.Next() == XmlToken::START_ELEMENT)
+                {
+                    if (reader.GetName() == "ID")
+                    {
+                        object.ownerId = reader.ReadElementText();
+                    }
+                    else
+                    {
+                        reader.SkipElement();
+                    }
+                }
+            }
+            else
+            {
+                reader.SkipElement();
+            }
+        }
+        objects.push_back(std::move(object));
+    }
+    return reader.WasParseSuccessful() ? objects.size() : 0;
+}
+
+TEST(XmlReaderTest, TestListObjectsPageMatchesXmlDocument)
+{
+    Aws::String page = MakeListObjectsPage(50);
+    Aws::StringStream domBody(page), readerBody(page);
+    ListedObjects domObjects, readerObjects;
+    ASSERT_EQ(50u, ParseListObjectsWithXmlDocument(domBody, domObjects));
+    ASSERT_EQ(50u, ParseListObjectsWithXmlReader(readerBody, readerObjects));
+    for (size_t i = 0; i < domObjects.size(); ++i)
+    {
+        ASSERT_EQ(domObjects[i].key, readerObjects[i].key);
+        ASSERT_EQ(domObjects[i].size, readerObjects[i].size);
+        ASSERT_EQ(domObjects[i].ownerId, readerObjects[i].ownerId);
+    }
+    //XmlNode::GetText() hands back re-escaped text; the reader decodes it.
+    ASSERT_EQ("\"" + Aws::String(32, 'e') + "\"", readerObjects[0].eTag);
+}
+
+#ifdef AWS_CUSTOM_MEMORY_MANAGEMENT
+
+//Not a pass/fail test: prints allocations, peak memory and time of the DOM and pull parsers on a 1000 key ListObjects page.
+TEST(XmlReaderTest, DISABLED_ListObjectsPageParseBenchmark)
+{
+    static const int ITERATIONS = 10;
+    uint64_t domAllocations = 0, readerAllocations = 0, domPeak = 0, readerPeak = 0;
+    std::chrono::steady_clock::duration domTime, readerTime;
+
+    {
+        AWS_BEGIN_MEMORY_TEST(1024, 10)
+        Aws::String page = MakeListObjectsPage(1000);
+        uint64_t baselineAllocations = memorySystem.GetTotalAllocationCount();
+        uint64_t baseline = memorySystem.GetCurrentBytesAllocated();
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            Aws::StringStream body(page);
+            ListedObjects objects;
+            ParseListObjectsWithXmlDocument(body, objects);
+        }
+        domTime = std::chrono::steady_clock::now() - start;
+        domAllocations = memorySystem.GetTotalAllocationCount() - baselineAllocations;
+        domPeak = memorySystem.GetMaxBytesAllocated() - baseline;
+        AWS_END_MEMORY_TEST
+    }
+
+    {
+        AWS_BEGIN_MEMORY_TEST(1024, 10)
+        Aws::String page = MakeListObjectsPage(1000);
+        uint64_t baselineAllocations = memorySystem.GetTotalAllocationCount();
+        uint64_t baseline = memorySystem.GetCurrentBytesAllocated();
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            Aws::StringStream body(page);
+            ListedObjects objects;
+            ParseListObjectsWithXmlReader(body, objects);
+        }
+        readerTime = std::chrono::steady_clock::now() - start;
+        readerAllocations = memorySystem.GetTotalAllocationCount() - baselineAllocations;
+        readerPeak = memorySystem.GetMaxBytesAllocated() - baseline;
+        AWS_END_MEMORY_TEST
+    }
+
+    std::cout << "1000 key ListObjects page (peak bytes includes the copy of the page in the body stream):" << std::endl
+        << "  XmlDocument DOM: " << domAllocations / ITERATIONS << " allocations, peak " << domPeak / 1024 << " KB, "
+        << std::chrono::duration_cast<std::chrono::microseconds>(domTime).count() / ITERATIONS << " us per page" << std::endl
+        << "  XmlReader:       " << readerAllocations / ITERATIONS << " allocations, peak " << readerPeak / 1024 << " KB, "
+        << std::chrono::duration_cast<std::chrono::microseconds>(readerTime).count() / ITERATIONS << " us per page" << std::endl;
+}
+
+#endif // AWS_CUSTOM_MEMORY_MANAGEMENT
@@ -44,6 +44,10 @@ public:
     {
         auto headers = GetRequestSpecificHeaders();
         headers.insert(Aws::Http::HeaderValuePair(Aws::Http::CONTENT_TYPE_HEADER, GetContentType()));
+        if (!m_contentSHA256.empty())
+        {
+            headers.insert(Aws::Http::HeaderValuePair("x-amz-content-sha256", m_contentSHA256));
+        }
 
         return std::move(headers);
     }
@@ -51,12 +55,20 @@ public:
     const Aws::String& GetContentType() const { return m_contentType; }
     void SetContentType(const Aws::String& contentType) { m_contentType = contentType; }
 
+    /**
+    * Hex encoded SHA-256 of the body, for callers that already hashed it (e.g. with MultiHash). It is sent as
+    * x-amz-content-sha256 and the SigV4 signer uses it instead of reading the body again.
+    */
+    const Aws::String& GetContentSHA256() const { return m_contentSHA256; }
+    void SetContentSHA256(const Aws::String& contentSHA256) { m_contentSHA256 = contentSHA256; }
+
 protected:
     virtual Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const  { return Aws::Http::HeaderValueCollection(); };
 
 private:
     std::shared_ptr<Aws::IOStream> m_bodyStream;
     Aws::String m_contentType;
+    Aws::String m_contentSHA256;
 };
 
 } // namespace Aws
@@ -43,6 +43,11 @@ public:
     virtual Aws::Http::HeaderValueCollection GetHeaders() const = 0;
     virtual void AddQueryStringParameters(Aws::Http::URI& uri) const { AWS_UNREFERENCED_PARAM(uri); }
 
+    /**
+     * The name of the operation this request is for, e.g. "GetObject". Request metrics are grouped by it.
+     */
+    virtual const char* GetServiceRequestName() const { return nullptr; }
+
     const Aws::IOStreamFactory& GetResponseStreamFactory() const { return m_responseStreamFactory; }
     void SetResponseStreamFactory(const Aws::IOStreamFactory& factory) { m_responseStreamFactory = AWS_BUILD_FUNCTION(factory); }
 
@@ -18,9 +18,12 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <aws/core/Region.h>
+#include <aws/core/utils/Array.h>
 #include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
 
 #include <memory>
+#include <mutex>
 
 namespace Aws
 {
@@ -48,6 +51,26 @@ namespace Aws
     namespace Client
     {
         struct ClientConfiguration;
+
+        /**
+        * How AWSAuthV4Signer covers the request body.
+        */
+        enum class PayloadSigningPolicy
+        {
+            /**
+            * Hash the whole body before sending and sign the hash. The body is read twice.
+            */
+            ALWAYS,
+            /**
+            * Send UNSIGNED-PAYLOAD for https requests, where TLS already protects the body; http requests are hashed as with ALWAYS.
+            */
+            UNSIGNED_OVER_TLS,
+            /**
+            * Send non-empty bodies with aws-chunked encoding (STREAMING-AWS4-HMAC-SHA256-PAYLOAD), hashing and signing each chunk
+            * as the http client reads it. Only S3 accepts this encoding.
+            */
+            STREAMING
+        };
     
 
         class AWS_CORE_API AWSAuthSigner
@@ -57,6 +80,11 @@ namespace Aws
 
             virtual bool SignRequest(Aws::Http::HttpRequest& request) const = 0;
             virtual bool PresignRequest(Aws::Http::HttpRequest& request, long long expirationInSeconds) const = 0;
+
+            /**
+            * Name of the service requests are signed for, used to label request metrics.
+            */
+            virtual const char* GetServiceName() const { return ""; }
         };
 
     
@@ -69,24 +97,42 @@ namespace Aws
             * Take credentials provider and uses it for authentication. This constructor
             * is ideal for special credentials providers such as odin or other encryption helpers.
             */
-            AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider, const char* serviceName, Region region);
+            AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider, const char* serviceName, Region region,
+                PayloadSigningPolicy payloadSigningPolicy = PayloadSigningPolicy::ALWAYS);
 
             virtual ~AWSAuthV4Signer();
 
             bool SignRequest(Aws::Http::HttpRequest& request) const override;
             bool PresignRequest(Aws::Http::HttpRequest& request, long long expirationInSeconds = 0) const override;
 
+            const char* GetServiceName() const override { return m_serviceName.c_str(); }
+
         private:
 
             AWSAuthV4Signer &operator =(const AWSAuthV4Signer &rhs);
             Aws::String GenerateSignature(const Aws::Auth::AWSCredentials& credentials, const Aws::String& stringToSign, const Aws::String& simpleDate, const Aws::String& regionName) const;
+            Aws::String GenerateSignature(const Aws::String& stringToSign, const Aws::Utils::ByteBuffer& signingKey) const;
+            Aws::Utils::ByteBuffer GetSigningKey(const Aws::Auth::AWSCredentials& credentials, const Aws::String& simpleDate, const Aws::String& regionName) const;
+            Aws::Utils::ByteBuffer ComputeSigningKey(const Aws::String& secretKey, const Aws::String& simpleDate, const Aws::String& regionName) const;
             Aws::String ComputePayloadHash(Aws::Http::HttpRequest&) const;
-            Aws::String GenerateStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate, const Aws::String& regionName, const Aws::String& canonicalRequestHash) const;
+            void AppendStringToSign(Aws::String& out, const Aws::String& dateValue, const Aws::String& simpleDate, const Aws::String& regionName, const Aws::Utils::ByteBuffer& canonicalRequestHash) const;
             std::shared_ptr<Auth::AWSCredentialsProvider> m_credentialsProvider;
             Aws::String m_serviceName;
             Region m_region;
+            PayloadSigningPolicy m_payloadSigningPolicy;
             Aws::UniquePtr<Aws::Utils::Crypto::Sha256> m_hash;
             Aws::UniquePtr<Aws::Utils::Crypto::Sha256HMAC> m_HMAC;
+
+            /**
+             * The derived signing key only depends on the secret key, the date, the region and the service. Region and
+             * service are fixed for a signer, so the last key is kept along with the credentials and date it was derived
+             * for; it is rederived when the day rolls over or the credentials rotate.
+             */
+            mutable std::mutex m_signingKeyLock;
+            mutable Aws::String m_signingKeyAccessKeyId;
+            mutable Aws::String m_signingKeySecretKey;
+            mutable Aws::String m_signingKeyDate;
+            mutable Aws::Utils::ByteBuffer m_signingKey;
         };       
 
     } // namespace Client
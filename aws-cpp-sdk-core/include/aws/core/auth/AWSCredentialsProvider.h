@@ -22,8 +22,11 @@
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <thread>
 
 namespace Aws
 {
@@ -152,6 +155,64 @@ namespace Aws
             Aws::String m_sessionToken;
         };
 
+/**
+* Base for providers whose credentials have to be loaded from somewhere and reloaded periodically. The current
+* credentials are kept in an immutable snapshot that GetAWSCredentials() copies without taking a lock. The first call
+* loads them synchronously and starts a background thread that reloads them every refreshRateMs, a tenth of that
+* interval ahead of time, so signing threads never wait on a reload. If a reload fails, the previous credentials are
+* kept until the next attempt.
+*
+* Derived classes must call StopRefreshing() from their destructor, before anything LoadCredentials() uses is destroyed.
+*/
+        class AWS_CORE_API RefreshingAWSCredentialsProvider : public AWSCredentialsProvider
+        {
+        public:
+            RefreshingAWSCredentialsProvider(long refreshRateMs);
+
+            virtual ~RefreshingAWSCredentialsProvider();
+
+            /**
+            * Returns the current credentials, loading them first if this is the first call.
+            */
+            AWSCredentials GetAWSCredentials() override;
+
+        protected:
+            /**
+            * Loads the credentials. Returns false if they could not be loaded, in which case credentials is only
+            * published if nothing has been loaded yet. Calls are serialized.
+            */
+            virtual bool LoadCredentials(AWSCredentials& credentials) = 0;
+
+            /**
+            * Stops and joins the background refresh thread.
+            */
+            void StopRefreshing();
+
+        private:
+            void Publish(const AWSCredentials& credentials);
+            void RefreshLoop();
+            size_t GetReaderStripe() const;
+
+            //readers announce themselves on one of two counter sets, picked by the epoch; a publisher flips the epoch and
+            //waits for each set to drain before freeing the snapshot it replaced. Counters are striped and padded so
+            //concurrent readers don't all hit one cache line.
+            struct ReaderCount
+            {
+                std::atomic<long> count;
+                char padding[64 - sizeof(std::atomic<long>)];
+            };
+            static const size_t READER_STRIPES = 8;
+
+            std::atomic<AWSCredentials*> m_credentials;
+            std::atomic<unsigned> m_epoch;
+            ReaderCount m_readers[2][READER_STRIPES];
+            std::mutex m_reloadMutex;
+            std::condition_variable m_refreshSignal;
+            std::thread m_refreshThread;
+            bool m_stopRefreshing;
+            long m_loadFrequencyMs;
+        };
+
 /**
 * Reads AWS credentials from the Environment variables AWS_ACCESS_KEY_ID and AWS_SECRET_KEY_ID if they exist. If they
 * are not found, empty credentials are returned.
@@ -175,7 +236,7 @@ namespace Aws
 * to ~/.aws/credentials and default. Optionally a user can specify the profile and it will override the environment variable
 * and defaults. To alter the file this pulls from, then the user should alter the AWS_CREDENTIAL_PROFILES_FILE variable.
 */
-        class AWS_CORE_API ProfileConfigFileAWSCredentialsProvider : public AWSCredentialsProvider
+        class AWS_CORE_API ProfileConfigFileAWSCredentialsProvider : public RefreshingAWSCredentialsProvider
         {
         public:
 
@@ -190,10 +251,7 @@ namespace Aws
             */
             ProfileConfigFileAWSCredentialsProvider(const char* profile, long refreshRateMs = REFRESH_THRESHOLD);
 
-            /**
-            * Retrieves the credentials if found, otherwise returns empty credential set.
-            */
-            AWSCredentials GetAWSCredentials() override;
+            ~ProfileConfigFileAWSCredentialsProvider();
 
             //TODO: move these back to private member functions as soon as IAM is implemented.
             static Aws::String GetProfileFilename();
@@ -210,42 +268,39 @@ namespace Aws
 
             static Aws::String GetAccountIdForProfile(const Aws::String& profileName);
 
-        private:
+        protected:
             /**
-            * Checks to see if the refresh interval has expired and reparses the file if it has.
+            * Parses the file and takes the credentials of the profile, empty if they aren't found.
             */
-            void RefreshIfExpired();
+            bool LoadCredentials(AWSCredentials& credentials) override;
 
+        private:
             Aws::String m_fileName;
             Aws::String m_profileToUse;
-            std::shared_ptr<AWSCredentials> m_credentials;
-            mutable std::mutex m_reloadMutex;
-            long m_loadFrequencyMs;
         };
 
 /**
 * Credentials provider implementation that loads credentials from the Amazon
 * EC2 Instance Metadata Service.
 */
-        class AWS_CORE_API InstanceProfileCredentialsProvider : public AWSCredentialsProvider
+        class AWS_CORE_API InstanceProfileCredentialsProvider : public RefreshingAWSCredentialsProvider
         {
         public:
             InstanceProfileCredentialsProvider(long refreshRateMs = REFRESH_THRESHOLD);
 
             InstanceProfileCredentialsProvider(std::shared_ptr<Internal::EC2MetadataClient>, long refreshRateMs = REFRESH_THRESHOLD);
 
+            ~InstanceProfileCredentialsProvider();
+
+        protected:
             /**
-            * Retrieves the credentials if found, otherwise returns empty credential set.
+            * Pulls the credentials from the metadata service. Returns false, keeping the previous credentials, if the
+            * service could not be reached or its response could not be parsed.
             */
-            AWSCredentials GetAWSCredentials() override;
+            bool LoadCredentials(AWSCredentials& credentials) override;
 
         private:
-            void RefreshIfExpired();
-
             std::shared_ptr<Internal::EC2MetadataClient> m_metadataClient;
-            std::shared_ptr<AWSCredentials> m_credentials;
-            long m_loadFrequencyMs;
-            mutable std::mutex m_reloadMutex;
         };
     } // namespace Auth
 } // namespace Aws
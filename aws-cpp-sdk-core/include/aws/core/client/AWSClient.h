@@ -16,10 +16,14 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/AWSError.h>
 #include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/RequestMetrics.h>
 #include <aws/core/http/HttpTypes.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/AmazonWebServiceResult.h>
+#include <chrono>
+#include <functional>
 #include <memory>
 
 namespace Aws
@@ -43,6 +47,11 @@ namespace Aws
         {
             class RateLimiterInterface;
         } // namespace RateLimits
+
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
     } // namespace Utils
 
     namespace Http
@@ -61,16 +70,18 @@ namespace Aws
     namespace Client
     {
 
-        template<typename ERROR_TYPE>
-        class AWSError;
         class AWSErrorMarshaller;
         class AWSRestfulJsonErrorMarshaller;
         class AWSAuthSigner;
         struct ClientConfiguration;
         class RetryStrategy;
+        class RequestMetricsCollector;
 
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
+        typedef std::function<void(const HttpResponseOutcome&)> HttpResponseOutcomeHandler;
+        typedef std::function<void(HttpResponseOutcome&, RequestMetrics&)> HttpResponseMetricsHandler;
+        typedef std::function<void(StreamOutcome&)> StreamOutcomeHandler;
 
         class AWS_CORE_API AWSClient
         {
@@ -94,7 +105,28 @@ namespace Aws
                 const Aws::AmazonWebServiceRequest& request,
                 Http::HttpMethod httpMethod) const;
 
-            HttpResponseOutcome AttemptExhaustively(const Aws::String& uri, Http::HttpMethod httpMethod) const;
+            /**
+             * Calls without a request object pass the name of their operation for the request metrics.
+             */
+            HttpResponseOutcome AttemptExhaustively(const Aws::String& uri, Http::HttpMethod httpMethod, const char* requestName = nullptr) const;
+
+            /**
+             * Like the overloads above, but hands the call's metrics back instead of reporting them, so that callers
+             * which go on to parse the response can add RequestPhase::RESPONSE_PARSE and report them with
+             * ReportRequestMetrics.
+             */
+            HttpResponseOutcome AttemptExhaustively(const Aws::String& uri,
+                const Aws::AmazonWebServiceRequest& request,
+                Http::HttpMethod httpMethod,
+                RequestMetrics& metrics) const;
+
+            HttpResponseOutcome AttemptExhaustively(const Aws::String& uri, Http::HttpMethod httpMethod, RequestMetrics& metrics,
+                const char* requestName = nullptr) const;
+
+            /**
+             * Completes metrics with the call's total time and passes them to the configured collector, if there is one.
+             */
+            void ReportRequestMetrics(RequestMetrics& metrics) const;
 
             HttpResponseOutcome AttemptOneRequest(const Aws::String& uri,
                 const Aws::AmazonWebServiceRequest& request,
@@ -102,12 +134,48 @@ namespace Aws
 
             HttpResponseOutcome AttemptOneRequest(const Aws::String& uri, Http::HttpMethod httpMethod) const;
 
+            /**
+             * Asynchronous counterpart of AttemptExhaustively. The call is started on the configured executor and each attempt
+             * is handed to HttpClient::MakeRequestAsync, with the retry backoff passed along as the next attempt's start delay,
+             * so on an event loop http client no thread sleeps or waits while the call is in progress. Responses that arrive on
+             * the http client's own thread are handed back to the executor before errors are parsed, retries are signed or
+             * handler runs. handler receives the final outcome. The request and this client must stay alive until then.
+             */
+            void AttemptExhaustivelyAsync(const Aws::String& uri,
+                const Aws::AmazonWebServiceRequest& request,
+                Http::HttpMethod httpMethod,
+                const HttpResponseOutcomeHandler& handler) const;
+
+            void AttemptExhaustivelyAsync(const Aws::String& uri, Http::HttpMethod httpMethod, const HttpResponseOutcomeHandler& handler,
+                const char* requestName = nullptr) const;
+
+            /**
+             * Like the overloads above, but hands the call's metrics to handler instead of reporting them, for callers that
+             * go on to parse the response.
+             */
+            void AttemptExhaustivelyAsync(const Aws::String& uri,
+                const Aws::AmazonWebServiceRequest& request,
+                Http::HttpMethod httpMethod,
+                const HttpResponseMetricsHandler& handler) const;
+
+            void AttemptExhaustivelyAsync(const Aws::String& uri, Http::HttpMethod httpMethod, const HttpResponseMetricsHandler& handler,
+                const char* requestName = nullptr) const;
+
             StreamOutcome MakeRequestWithUnparsedResponse(const Aws::String& uri,
                 const Aws::AmazonWebServiceRequest& request,
                 Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
 
+            void MakeRequestWithUnparsedResponseAsync(const Aws::String& uri,
+                const Aws::AmazonWebServiceRequest& request,
+                Http::HttpMethod method,
+                const StreamOutcomeHandler& handler) const;
+
             virtual AWSError<CoreErrors> BuildAWSError(const std::shared_ptr<Aws::Http::HttpResponse>& response) const = 0;
 
+            /**
+             * Fills httpRequest in from request. If httpRequest already carries a body, it is the call's serialized payload
+             * and is used instead of serializing request again.
+             */
             virtual void BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
                 const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest) const;               
 
@@ -117,6 +185,39 @@ namespace Aws
             }
 
         private:
+            /**
+             * The serialized payload of a call and its hash. They are produced once per call so that retries do not serialize
+             * and hash the payload again; everything else is rebuilt by BuildHttpRequest on every attempt.
+             */
+            struct SerializedRequest
+            {
+                /**
+                * requestName names the operation of calls without a request object.
+                */
+                SerializedRequest(const Aws::AmazonWebServiceRequest* request, const char* requestName = nullptr);
+
+                const Aws::AmazonWebServiceRequest* m_request;
+                std::shared_ptr<Aws::IOStream> m_body;
+                //filled in by the first attempt's signing
+                Aws::String m_payloadHash;
+                RequestMetrics m_metrics;
+                //what the retry strategy was last asked to retry, so a success can be credited with what it was charged
+                AWSError<CoreErrors> m_lastRetriedError;
+            };
+
+            std::shared_ptr<Aws::Http::HttpRequest> CreateSignedHttpRequest(const Aws::String& uri, Http::HttpMethod httpMethod,
+                SerializedRequest& serializedRequest) const;
+            HttpResponseOutcome AttemptOneRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest) const;
+            HttpResponseOutcome AttemptOneRequest(const Aws::String& uri, Http::HttpMethod httpMethod, SerializedRequest& serializedRequest) const;
+            HttpResponseOutcome AttemptExhaustively(const Aws::String& uri, Http::HttpMethod httpMethod, SerializedRequest& serializedRequest) const;
+            void StartAsync(const Aws::String& uri, Http::HttpMethod httpMethod, const Aws::AmazonWebServiceRequest* request,
+                const char* requestName, const HttpResponseMetricsHandler& handler) const;
+            void AttemptAsync(const Aws::String& uri, Http::HttpMethod httpMethod, const std::shared_ptr<SerializedRequest>& serializedRequest,
+                const HttpResponseMetricsHandler& handler, long retries, std::chrono::milliseconds startDelay) const;
+            void HandleAsyncResponse(const Aws::String& uri, Http::HttpMethod httpMethod, const std::shared_ptr<SerializedRequest>& serializedRequest,
+                const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const std::shared_ptr<Aws::Http::HttpResponse>& httpResponse,
+                const HttpResponseMetricsHandler& handler, long retries) const;
+            void RunOnExecutor(const std::function<void()>& task) const;
             void AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const Http::HeaderValueCollection& headerValues) const;
             void AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const std::shared_ptr<Aws::IOStream>& body) const;
             void AddCommonHeaders(Aws::Http::HttpRequest& httpRequest) const;
@@ -126,13 +227,16 @@ namespace Aws
             std::shared_ptr<Aws::Client::AWSAuthSigner> m_signer;
             std::shared_ptr<AWSErrorMarshaller> m_errorMarshaller;
             std::shared_ptr<RetryStrategy> m_retryStrategy;
+            std::shared_ptr<RequestMetricsCollector> m_metricsCollector;
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> m_writeRateLimiter;
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> m_readRateLimiter;
+            std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
             Aws::String m_userAgent;
             const char* m_hostHeaderOverride;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Json::JsonValue>, AWSError<CoreErrors>> JsonOutcome;
+        typedef std::function<void(JsonOutcome&)> JsonOutcomeHandler;
 
         class AWS_CORE_API AWSJsonClient : public AWSClient
         {
@@ -155,11 +259,24 @@ namespace Aws
                 Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
 
             JsonOutcome MakeRequest(const Aws::String& uri,
-                Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* requestName = nullptr) const;
+
+            /**
+             * Asynchronous counterpart of MakeRequest. The response is parsed on the executor and handed to handler; the
+             * request and this client must stay alive until then.
+             */
+            void MakeRequestAsync(const Aws::String& uri,
+                const Aws::AmazonWebServiceRequest& request,
+                Http::HttpMethod method,
+                const JsonOutcomeHandler& handler) const;
 
+        private:
+            JsonOutcome ParseResponse(const HttpResponseOutcome& httpOutcome, RequestMetrics& metrics) const;
         };       
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Xml::XmlDocument>, AWSError<CoreErrors>> XmlOutcome;
+        typedef std::function<void(XmlOutcome&)> XmlOutcomeHandler;
 
         class AWS_CORE_API AWSXMLClient : public AWSClient
         {
@@ -185,7 +302,23 @@ namespace Aws
 
 
             XmlOutcome MakeRequest(const Aws::String& uri,
-                Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* requestName = nullptr) const;
+
+            /**
+             * Asynchronous counterparts of MakeRequest. The response is parsed on the executor and handed to handler; the
+             * request and this client must stay alive until then.
+             */
+            void MakeRequestAsync(const Aws::String& uri,
+                const Aws::AmazonWebServiceRequest& request,
+                Http::HttpMethod method,
+                const XmlOutcomeHandler& handler) const;
+
+            void MakeRequestAsync(const Aws::String& uri, Http::HttpMethod method, const XmlOutcomeHandler& handler,
+                const char* requestName = nullptr) const;
+
+        private:
+            XmlOutcome ParseResponse(const HttpResponseOutcome& httpOutcome, RequestMetrics& metrics) const;
         };       
 
     } // namespace Client
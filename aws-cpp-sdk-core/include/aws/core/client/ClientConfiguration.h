@@ -46,6 +46,7 @@ namespace Client
 
 
 class RetryStrategy; // forward declare
+class RequestMetricsCollector;
 
 
 /**
@@ -74,6 +75,10 @@ struct AWS_CORE_API ClientConfiguration
     std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> readRateLimiter;
     Aws::Http::TransferLibType httpLibOverride;
     bool followRedirects;
+    /**
+     * Receives a breakdown of where the time went for every call the client makes. Null by default.
+     */
+    std::shared_ptr<RequestMetricsCollector> metricsCollector;
 };
 
 
@@ -0,0 +1,75 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/RequestMetrics.h>
+#include <aws/core/utils/HdrHistogram.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace Aws
+{
+namespace Client
+{
+
+/**
+ * Keeps a latency histogram, in microseconds, of every phase of every service and operation it sees, so tail latency
+ * can be broken down by where it came from. Recording into a histogram takes no lock; the lock is only held to find
+ * the histograms for an operation, once per call.
+ */
+class AWS_CORE_API HistogramRequestMetricsCollector : public RequestMetricsCollector
+{
+public:
+    struct OperationHistograms
+    {
+        OperationHistograms() : failures(0) {}
+
+        inline const Aws::Utils::HdrHistogram& GetPhase(RequestPhase phase) const { return phases[static_cast<size_t>(phase)]; }
+
+        Aws::Utils::HdrHistogram phases[REQUEST_PHASE_COUNT];
+        //calls that still failed after their last attempt; their phases are recorded all the same
+        std::atomic<uint64_t> failures;
+        Aws::Utils::HdrHistogram attempts;
+    };
+
+    void OnRequestCompleted(const RequestMetrics& metrics) override;
+
+    /**
+     * The histograms for one operation, or null if it hasn't been called yet.
+     */
+    std::shared_ptr<const OperationHistograms> GetHistograms(const Aws::String& serviceName, const Aws::String& operationName) const;
+
+    /**
+     * Every service and operation pair recorded so far.
+     */
+    Aws::Vector<std::pair<Aws::String, Aws::String>> GetOperations() const;
+
+private:
+    typedef std::pair<Aws::String, Aws::String> OperationKey;
+
+    mutable std::mutex m_operationsMutex;
+    Aws::Map<OperationKey, std::shared_ptr<OperationHistograms>> m_operations;
+};
+
+} // namespace Client
+} // namespace Aws
@@ -0,0 +1,69 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/RetryStrategy.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace Aws
+{
+namespace Client
+{
+
+/**
+ * How JitteredRetryStrategy spreads out its delays.
+ * FULL picks uniformly between 0 and base * 2^retries.
+ * DECORRELATED picks uniformly between base and base * 3^retries. That follows the growth of decorrelated jitter,
+ * but without per-request state; the strategy is shared by every request of a client.
+ * Both are capped at the max delay.
+ */
+enum class JitterMode
+{
+    FULL,
+    DECORRELATED
+};
+
+/**
+ * Exponential backoff with randomized delays, so clients that fail together don't all retry at the same moment.
+ * Retries retryable errors up to maxRetries times.
+ */
+class AWS_CORE_API JitteredRetryStrategy : public RetryStrategy
+{
+public:
+    JitteredRetryStrategy(JitterMode mode = JitterMode::FULL, long maxRetries = 3, long baseDelayMs = 25, long maxDelayMs = 20000);
+
+    bool ShouldRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const override;
+
+    long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const override;
+
+private:
+    /**
+     * Uniform in [lowerBound, upperBound]. Lock free, so concurrent requests don't serialize on a generator.
+     */
+    long NextRandom(long lowerBound, long upperBound) const;
+
+    JitterMode m_mode;
+    long m_maxRetries;
+    long m_baseDelayMs;
+    long m_maxDelayMs;
+    mutable std::atomic<uint64_t> m_randomState;
+};
+
+} // namespace Client
+} // namespace Aws
@@ -0,0 +1,108 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+namespace Http
+{
+    struct TransferTimings;
+} // namespace Http
+
+namespace Client
+{
+
+/**
+ * The steps a call through AWSClient goes through. Phases that happen once per attempt add up over retries.
+ * SERIALIZE: building the http request from the request object, including computing its body and headers.
+ * SIGN: signing the http request.
+ * CONNECTION_POOL_WAIT: waiting for the http client to hand out a connection.
+ * DNS_LOOKUP, CONNECT, TLS_HANDSHAKE: setting up a new connection; 0 when one was reused.
+ * TIME_TO_FIRST_BYTE: from the request being sent to the first byte of the response.
+ * BODY_DOWNLOAD: from the first byte to the last byte of the response.
+ * RESPONSE_PARSE: turning the response body into a JSON or XML document.
+ * RETRY_SLEEP: backing off between attempts.
+ * TOTAL: the whole call, as seen by the caller.
+ */
+enum class RequestPhase
+{
+    SERIALIZE,
+    SIGN,
+    CONNECTION_POOL_WAIT,
+    DNS_LOOKUP,
+    CONNECT,
+    TLS_HANDSHAKE,
+    TIME_TO_FIRST_BYTE,
+    BODY_DOWNLOAD,
+    RESPONSE_PARSE,
+    RETRY_SLEEP,
+    TOTAL
+};
+
+static const size_t REQUEST_PHASE_COUNT = static_cast<size_t>(RequestPhase::TOTAL) + 1;
+
+AWS_CORE_API const char* GetRequestPhaseName(RequestPhase phase);
+
+/**
+ * Where the time went in one call through AWSClient. Phases that weren't measured, e.g. because the http client
+ * doesn't report them, are -1.
+ */
+struct AWS_CORE_API RequestMetrics
+{
+    RequestMetrics();
+
+    /**
+     * Adds microseconds to phase, treating a phase that hasn't been measured yet as 0.
+     */
+    void AddPhase(RequestPhase phase, int64_t microseconds);
+    void AddPhase(RequestPhase phase, std::chrono::steady_clock::duration duration);
+    /**
+     * Adds what the http client measured about one attempt.
+     */
+    void AddTransferTimings(const Aws::Http::TransferTimings& timings);
+    inline int64_t GetPhase(RequestPhase phase) const { return phaseMicroseconds[static_cast<size_t>(phase)]; }
+
+    //the signing name of the service, e.g. "dynamodb"
+    const char* serviceName;
+    //the request's GetServiceRequestName, e.g. "GetObject"; empty for requests that don't name their operation
+    Aws::String operationName;
+    long attempts;
+    bool succeeded;
+    std::chrono::steady_clock::time_point startTime;
+    int64_t phaseMicroseconds[REQUEST_PHASE_COUNT];
+};
+
+/**
+ * Receives the metrics for every call an AWSClient makes. Set ClientConfiguration::metricsCollector to install one.
+ * Called on whatever thread completes the call, so implementations must be thread safe and should be quick.
+ */
+class AWS_CORE_API RequestMetricsCollector
+{
+public:
+    virtual ~RequestMetricsCollector() {}
+
+    virtual void OnRequestCompleted(const RequestMetrics& metrics) = 0;
+};
+
+} // namespace Client
+} // namespace Aws
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 namespace Aws
 {
@@ -34,6 +35,17 @@ public:
 
     virtual long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const = 0;
 
+    /**
+     * Called when a request succeeds after attemptedRetries retries. Strategies that budget their retries across
+     * requests use this to earn retries back. lastRetriedError is the error that ShouldRetry allowed the final retry
+     * for; it is only meaningful when attemptedRetries is greater than zero.
+     */
+    virtual void OnRequestSucceeded(long attemptedRetries, const AWSError<CoreErrors>& lastRetriedError) const
+    {
+        AWS_UNREFERENCED_PARAM(attemptedRetries);
+        AWS_UNREFERENCED_PARAM(lastRetriedError);
+    }
+
 };
 
 } // namespace Client
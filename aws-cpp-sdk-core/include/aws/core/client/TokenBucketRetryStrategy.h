@@ -0,0 +1,74 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/RetryStrategy.h>
+
+#include <atomic>
+#include <memory>
+
+namespace Aws
+{
+namespace Client
+{
+
+/**
+ * Puts a budget on the retries of another strategy. Every retry takes tokens out of a bucket shared by all requests
+ * made with this strategy, connection errors costing more than other errors. Successful requests put tokens back.
+ * When errors spike the bucket runs dry and requests fail on their first error instead of multiplying the load on a
+ * struggling service; retries come back as requests start succeeding again.
+ *
+ * Share one instance through ClientConfiguration::retryStrategy to give a client, or several, a common budget.
+ */
+class AWS_CORE_API TokenBucketRetryStrategy : public RetryStrategy
+{
+public:
+    /**
+     * Budgets the retries of a JitteredRetryStrategy with full jitter.
+     */
+    TokenBucketRetryStrategy(long capacity = 500);
+
+    TokenBucketRetryStrategy(const std::shared_ptr<RetryStrategy>& retryStrategy, long capacity = 500,
+        long retryCost = 5, long connectionErrorRetryCost = 10);
+
+    /**
+     * Retries if the wrapped strategy would and the bucket holds enough tokens, taking them out.
+     */
+    bool ShouldRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const override;
+
+    long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const override;
+
+    /**
+     * Gives back what the retry that paid off was charged, or a single token for a request that succeeded first time.
+     */
+    void OnRequestSucceeded(long attemptedRetries, const AWSError<CoreErrors>& lastRetriedError) const override;
+
+    inline long GetAvailableTokens() const { return m_tokens; }
+
+private:
+    long GetRetryCost(const AWSError<CoreErrors>& error) const;
+    void AddTokens(long amount) const;
+
+    std::shared_ptr<RetryStrategy> m_retryStrategy;
+    long m_capacity;
+    long m_retryCost;
+    long m_connectionErrorRetryCost;
+    mutable std::atomic<long> m_tokens;
+};
+
+} // namespace Client
+} // namespace Aws
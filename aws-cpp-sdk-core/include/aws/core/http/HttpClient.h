@@ -19,6 +19,8 @@
 
 #include <memory>
 #include <atomic>
+#include <chrono>
+#include <functional>
 #include <mutex>
 #include <condition_variable>
 
@@ -38,6 +40,11 @@ namespace Http
 class HttpRequest;
 class HttpResponse;
 
+/**
+  * Invoked when an asynchronous request completes. The response is null if the request could not be made at all.
+  */
+typedef std::function<void(const std::shared_ptr<HttpResponse>&)> HttpResponseCallback;
+
 /**
   * Abstract HttpClient. All it does is make HttpRequests and return their response.
   */
@@ -55,19 +62,31 @@ public:
                                                       Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr, 
                                                       Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const = 0;
 
+    /*
+    * Makes the request after startDelay has elapsed and hands the response to callback. Clients with a native event loop
+    * override this so that no thread is held while the request is in flight or waiting to start; the default
+    * implementation waits and calls MakeRequest on the calling thread. The callback may run on an internal thread,
+    * so it should not block.
+    */
+    virtual void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+                                  const HttpResponseCallback& callback,
+                                  Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+                                  Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr,
+                                  std::chrono::milliseconds startDelay = std::chrono::milliseconds(0)) const;
+
     void DisableRequestProcessing();
     void EnableRequestProcessing();
 
     bool IsRequestProcessingEnabled() const;
 
-    void RetryRequestSleep(std::chrono::milliseconds sleepTime);
+    void RetryRequestSleep(std::chrono::milliseconds sleepTime) const;
 
 private:
 
     std::atomic< bool > m_disableRequestProcessing;
 
-    std::mutex m_requestProcessingSignalLock;
-    std::condition_variable m_requestProcessingSignal;
+    mutable std::mutex m_requestProcessingSignalLock;
+    mutable std::condition_variable m_requestProcessingSignal;
 };
 
 } // namespace Http
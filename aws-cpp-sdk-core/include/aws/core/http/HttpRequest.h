@@ -52,6 +52,30 @@ class HttpResponse;
 
 typedef std::function<void(const HttpRequest*, HttpResponse*, long long)> DataReceivedEventHandler;
 typedef std::function<void(const HttpRequest*, long long)> DataSentEventHandler;
+typedef std::function<void(const Aws::String&, const Aws::String&)> HeaderVisitor;
+
+/**
+ * How long the http client spent on each step of its last attempt at a request, in microseconds. Steps the client
+ * doesn't measure are -1; on a reused connection, lookup, connect and handshake are 0.
+ */
+struct TransferTimings
+{
+    TransferTimings() :
+        connectionPoolWaitMicros(-1),
+        dnsLookupMicros(-1),
+        connectMicros(-1),
+        tlsHandshakeMicros(-1),
+        timeToFirstByteMicros(-1),
+        bodyDownloadMicros(-1)
+    {}
+
+    int64_t connectionPoolWaitMicros;
+    int64_t dnsLookupMicros;
+    int64_t connectMicros;
+    int64_t tlsHandshakeMicros;
+    int64_t timeToFirstByteMicros;
+    int64_t bodyDownloadMicros;
+};
 
 /**
   * Abstract class for representing an HttpRequest.
@@ -66,6 +90,17 @@ public:
     virtual ~HttpRequest() {}
 
     virtual HeaderValueCollection GetHeaders() const = 0;
+    /**
+     * Calls visitor with each header name and value, in the same order as GetHeaders(), without copying the collection.
+     * The default implementation goes through GetHeaders(); implementations that own their headers should override it.
+     */
+    virtual void ForEachHeader(const HeaderVisitor& visitor) const
+    {
+        for (const auto& header : GetHeaders())
+        {
+            visitor(header.first, header.second);
+        }
+    }
     virtual const Aws::String& GetHeaderValue(const char* headerName) const = 0;
     virtual void SetHeaderValue(const char* headerName, const Aws::String& headerValue) = 0;
     virtual void SetHeaderValue(const Aws::String& headerName, const Aws::String& headerValue) = 0;
@@ -212,11 +247,18 @@ public:
     inline const DataReceivedEventHandler& GetDataReceivedEventHandler() const { return onDataReceived; }
     inline const DataSentEventHandler& GetDataSentEventHandler() const { return onDataSent; }
 
+    /**
+     * Filled in by http clients that can break down where the time went.
+     */
+    inline const TransferTimings& GetTransferTimings() const { return m_transferTimings; }
+    inline void SetTransferTimings(const TransferTimings& transferTimings) { m_transferTimings = transferTimings; }
+
 private:
     URI m_uri;
     HttpMethod m_method;
     DataReceivedEventHandler onDataReceived;
     DataSentEventHandler onDataSent;
+    TransferTimings m_transferTimings;
 
 };
 
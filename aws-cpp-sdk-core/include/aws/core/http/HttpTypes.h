@@ -42,7 +42,8 @@ enum class AWS_CORE_API TransferLibType
     DEFAULT_CLIENT,
     CURL_CLIENT,
     WIN_INET_CLIENT,
-    WIN_HTTP_CLIENT
+    WIN_HTTP_CLIENT,
+    CURL_MULTI_CLIENT
 };
 
 namespace HttpMethodMapper
@@ -137,6 +137,11 @@ public:
 
     static Aws::String URLEncodePath(const Aws::String& path);
 
+    /**
+    * URL encodes path like URLEncodePath, appending the result to out.
+    */
+    static void URLEncodePath(const Aws::String& path, Aws::String& out);
+
 private:
     void ParseURIParts(const Aws::String& uri);
     void ExtractAndSetScheme(const Aws::String& uri);
@@ -15,9 +15,9 @@
 
 #pragma once
 
-#include <aws/core/utils/memory/stl/AWSStack.h>
+#include <aws/core/Core_EXPORTS.h>
 
-#include <utility>
+#include <atomic>
 #include <mutex>
 #include <condition_variable>
 #include <curl/curl.h>
@@ -32,8 +32,13 @@ namespace Http
   * can call into acquire a handle, then put it back when finished. It is assumed that reusing an already
   * initialized handle is preferable (especially for synchronous clients). The pool doubles in capacity as
   * needed up to the maximum amount of connections.
+  *
+  * Idle handles live in a fixed array of slots, one per possible handle, that are claimed and filled with atomic
+  * exchanges. Each thread starts looking at its own home slot, so a thread usually gets back the handle (and the warm
+  * connection and TLS session) it released last, and threads only touch each other's slots when their own is empty.
+  * Acquiring and releasing never lock; the mutex is only used by threads waiting because every handle is in use.
   */
-class CurlHandleContainer
+class AWS_CORE_API CurlHandleContainer
 {
 public:
     /**
@@ -59,15 +64,26 @@ private:
     CurlHandleContainer(const CurlHandleContainer&&) = delete;
     const CurlHandleContainer& operator = (const CurlHandleContainer&&) = delete;
 
-    bool CheckAndGrowPool();
+    CURL* CheckAndGrowPool(size_t homeSlot);
+    CURL* TryAcquireIdleHandle(size_t homeSlot);
+    void PutIdleHandle(CURL* handle, size_t homeSlot);
+    size_t GetHomeSlot() const;
 
-    Aws::Stack<CURL*> m_handleContainer;
+    //padded to a cache line so threads parking handles in neighbouring slots don't contend.
+    struct HandleSlot
+    {
+        std::atomic<CURL*> handle;
+        char padding[64 - sizeof(std::atomic<CURL*>)];
+    };
+
+    HandleSlot* m_slots;
     std::mutex m_handleContainerMutex;
     std::condition_variable m_conditionVariable;
+    std::atomic<unsigned> m_waitingThreads;
     unsigned m_maxPoolSize;
     unsigned long m_requestTimeout;
     unsigned long m_connectTimeout;
-    unsigned m_poolSize;
+    std::atomic<unsigned> m_poolSize;
     static bool isInit;
 };
 
@@ -17,10 +17,13 @@
 #pragma once
 
 #include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/curl/CurlHandleContainer.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
+#include <chrono>
+
 namespace Aws
 {
 namespace Http
@@ -39,6 +42,53 @@ public:
     std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
             Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const;
 
+protected:
+    struct CurlWriteCallbackContext
+    {
+        CurlWriteCallbackContext(const CurlHttpClient* client,
+                                 HttpRequest* request,
+                                 HttpResponse* response,
+                                 Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter,
+                                 bool deferRateLimiting = false) :
+            m_client(client),
+            m_request(request),
+            m_response(response),
+            m_rateLimiter(rateLimiter),
+            m_deferRateLimiting(deferRateLimiting),
+            m_pendingReadDelay(0)
+        {}
+
+        const CurlHttpClient* m_client;
+        HttpRequest* m_request;
+        HttpResponse* m_response;
+        Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+        //when set, WriteData never sleeps on the rate limiter; the delay it owes accumulates in m_pendingReadDelay instead
+        bool m_deferRateLimiting;
+        std::chrono::milliseconds m_pendingReadDelay;
+    };
+
+    struct CurlReadCallbackContext
+    {
+        CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request) :
+            m_client(client),
+            m_request(request)
+        {}
+
+        const CurlHttpClient* m_client;
+        HttpRequest* m_request;
+    };
+
+    //Builds the header list curl sends for this request. The caller frees it with curl_slist_free_all.
+    struct curl_slist* CreateHeaderList(const HttpRequest& request) const;
+    //Applies everything about this request and this client's configuration to the handle.
+    void ConfigureCurlHandle(CURL* connectionHandle, HttpRequest& request, const Aws::String& url, struct curl_slist* headers,
+            CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const;
+    //Copies the status code and content type of a completed transfer into the response.
+    static void ReadResponseInfo(CURL* connectionHandle, HttpResponse& response);
+    //Breaks the completed transfer's time down into lookup, connect, handshake, first byte and download. Leaves the
+    //connection pool wait alone, curl doesn't know about it.
+    static void ReadTransferTimings(CURL* connectionHandle, TransferTimings& timings);
+
 private:
     mutable CurlHandleContainer m_curlHandleContainer;
     bool m_isUsingProxy;
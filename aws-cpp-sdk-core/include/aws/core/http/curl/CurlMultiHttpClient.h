@@ -0,0 +1,95 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/utils/memory/stl/AWSList.h>
+#include <aws/core/utils/memory/stl/AWSMultiMap.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+namespace Http
+{
+
+/**
+  * Curl http client that drives every request through a single curl multi handle on one event loop thread.
+  * MakeRequestAsync never blocks the caller: thousands of requests can be in flight while only the event loop thread
+  * exists, and start delays (retry backoff) and rate limiting are handled with timers on the loop rather than by
+  * sleeping. At most maxConnections transfers run at once; the rest wait their turn in submission order.
+  * Completion callbacks run on the event loop thread and should hand long-running work off to an executor.
+  */
+class CurlMultiHttpClient : public CurlHttpClient
+{
+public:
+
+    using Base = CurlHttpClient;
+
+    CurlMultiHttpClient(const Aws::Client::ClientConfiguration& clientConfig);
+    ~CurlMultiHttpClient();
+
+    //Submits the request to the event loop and blocks the calling thread until it completes.
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+                          const HttpResponseCallback& callback,
+                          Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+                          Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr,
+                          std::chrono::milliseconds startDelay = std::chrono::milliseconds(0)) const override;
+
+private:
+    CurlMultiHttpClient(const CurlMultiHttpClient&) = delete;
+    CurlMultiHttpClient& operator =(const CurlMultiHttpClient&) = delete;
+
+    using Clock = std::chrono::steady_clock;
+    struct Transfer;
+
+    void Submit(Transfer* transfer) const;
+    void EventLoop();
+    void StartDueTransfers(Clock::time_point now);
+    void UpdatePausedTransfers(Clock::time_point now);
+    void CompleteFinishedTransfers();
+    int ComputeWaitTimeoutMs(Clock::time_point now) const;
+    CURL* AcquireHandle();
+    void ReleaseHandle(CURL* handle);
+    static void FinishTransfer(Transfer* transfer, const std::shared_ptr<HttpResponse>& response);
+
+    CURLM* m_multiHandle;
+    unsigned m_maxConnections;
+    long m_requestTimeout;
+    long m_connectTimeout;
+
+    //guarded by m_submitMutex; everything below it is only touched by the event loop thread
+    mutable std::mutex m_submitMutex;
+    mutable Aws::Vector<Transfer*> m_submitted;
+    mutable bool m_stopping;
+
+    Aws::MultiMap<Clock::time_point, Transfer*> m_scheduled;
+    Aws::List<Transfer*> m_active;
+    Aws::Vector<CURL*> m_idleHandles;
+
+    std::thread m_eventLoopThread;
+};
+
+} // namespace Http
+} // namespace Aws
+
@@ -35,6 +35,7 @@ public:
     StandardHttpRequest(const URI& uri, HttpMethod method);
 
     virtual HeaderValueCollection GetHeaders() const override;
+    virtual void ForEachHeader(const HeaderVisitor& visitor) const override;
     virtual const Aws::String& GetHeaderValue(const char* headerName) const override;
     virtual void SetHeaderValue(const char* headerName, const Aws::String& headerValue) override;
     virtual void SetHeaderValue(const Aws::String& headerName, const Aws::String& headerValue) override;
@@ -19,6 +19,7 @@
 
 #include <aws/core/utils/memory/stl/AWSString.h>
 
+#include <ctime>
 #include <mutex>
 
 namespace Aws
@@ -37,11 +38,21 @@ public:
     */
     static Aws::String CalculateLocalTimestampAsString(const char* formatStr);
 
+    /**
+    * Formats the given time as a local timestamp and returns it as a string
+    */
+    static Aws::String CalculateLocalTimestampAsString(std::time_t time, const char* formatStr);
+
     /**
     * Calculates the gmt timestamp, formats it, and returns it as a string
     */
     static Aws::String CalculateGmtTimestampAsString(const char* formatStr);
 
+    /**
+    * Formats the given time as a gmt timestamp and returns it as a string
+    */
+    static Aws::String CalculateGmtTimestampAsString(std::time_t time, const char* formatStr);
+
     /**
     * Calculates the current hour of the day in localtime.
     */
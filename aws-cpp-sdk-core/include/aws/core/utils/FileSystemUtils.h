@@ -16,6 +16,7 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
 namespace Aws
 {
@@ -27,6 +28,16 @@ namespace Aws
         static const char PATH_DELIM = '/';
 #endif
 
+        /**
+         * A regular file found by FileSystemUtils::ListFilesRecursively
+         */
+        struct DirectoryEntry
+        {
+            // Path below the listed directory, using the platform's path delimiter
+            Aws::String m_relativePath;
+            uint64_t m_fileSize;
+        };
+
         class AWS_CORE_API FileSystemUtils
         {
         public:
@@ -51,6 +62,12 @@ namespace Aws
              */
             static bool RelocateFileOrDirectory(const char* from, const char* to);
 
+            /**
+             * Appends every regular file below directory, including those in its subdirectories, to entries.
+             * Returns false if directory or one of its subdirectories could not be read.
+             */
+            static bool ListFilesRecursively(const char* directory, Aws::Vector<DirectoryEntry>& entries);
+
 	        static char GetPathDelimiter() { return PATH_DELIM; }
         };
     }
@@ -0,0 +1,85 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+namespace Utils
+{
+
+/**
+* High dynamic range histogram of non-negative integer values, e.g. latencies in microseconds.
+* Values below 128 are counted exactly; above that, every power of two is split into 64 buckets, so any value is
+* reported to within 1.6% of what was recorded. Values up to MAX_VALUE are tracked; larger ones are counted as MAX_VALUE.
+* Recording is a handful of relaxed atomic increments, so any number of threads can record while others read.
+*/
+class AWS_CORE_API HdrHistogram
+{
+public:
+    static const int64_t MAX_VALUE = (static_cast<int64_t>(1) << 36) - 1;
+
+    HdrHistogram();
+
+    /**
+    * Counts one occurrence of value. Negative values are ignored.
+    */
+    void Record(int64_t value);
+
+    uint64_t GetTotalCount() const { return m_totalCount.load(std::memory_order_relaxed); }
+    /**
+    * Smallest and largest values recorded, exactly. Both are 0 while the histogram is empty.
+    */
+    int64_t GetMin() const;
+    int64_t GetMax() const;
+    double GetMean() const;
+
+    /**
+    * Smallest bucket value that at least percentile percent of the recorded values are less than or equal to, e.g.
+    * GetValueAtPercentile(99.9) for the p999. Never larger than GetMax().
+    */
+    int64_t GetValueAtPercentile(double percentile) const;
+
+    /**
+    * Forgets everything recorded so far. Values recorded while a reset is in progress may or may not survive it.
+    */
+    void Reset();
+
+private:
+    HdrHistogram(const HdrHistogram&) = delete;
+    HdrHistogram& operator=(const HdrHistogram&) = delete;
+
+    static const size_t SUB_BUCKET_COUNT = 128;
+    static const size_t HALF_SUB_BUCKET_COUNT = 64;
+    static const size_t BUCKET_COUNT = SUB_BUCKET_COUNT + 29 * HALF_SUB_BUCKET_COUNT;
+
+    static size_t GetBucketIndex(uint64_t value);
+    static int64_t GetHighestEquivalentValue(size_t bucketIndex);
+
+    std::atomic<uint64_t> m_counts[BUCKET_COUNT];
+    std::atomic<uint64_t> m_totalCount;
+    std::atomic<int64_t> m_sum;
+    std::atomic<int64_t> m_min;
+    std::atomic<int64_t> m_max;
+};
+
+} // namespace Utils
+} // namespace Aws
@@ -0,0 +1,90 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+#pragma once
+#include <aws/core/Core_EXPORTS.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * A file read and written at explicit offsets (pread/pwrite, or ReadFile/WriteFile with an offset on Windows)
+         * instead of through a shared stream position, so several threads can work on different ranges of the
+         * same file through one handle.
+         */
+        class AWS_CORE_API RandomAccessFile
+        {
+        public:
+            RandomAccessFile();
+            ~RandomAccessFile();
+
+            RandomAccessFile(const RandomAccessFile&) = delete;
+            RandomAccessFile& operator=(const RandomAccessFile&) = delete;
+
+            /**
+             * Opens an existing file for reading. Returns false on failure.
+             */
+            bool OpenForRead(const char* path);
+
+            /**
+             * Creates or truncates the file, opened for reading and writing, and sizes it to size bytes up front so
+             * ranges can be written in any order. With truncate false an existing file keeps its contents (up to
+             * size bytes), for picking up a partly written file again. Returns false on failure.
+             */
+            bool OpenForWrite(const char* path, uint64_t size, bool truncate = true);
+
+            bool IsOpen() const;
+
+            /**
+             * Closes the file. Also done by the destructor.
+             */
+            void Close();
+
+            /**
+             * Size of the file when it was opened.
+             */
+            uint64_t GetSize() const { return m_size; }
+
+            /**
+             * Last modification time of a file opened for reading, in platform units (seconds since the epoch on
+             * unix, FILETIME on Windows). Only meaningful compared with another value from the same platform.
+             */
+            uint64_t GetModifiedTime() const { return m_modifiedTime; }
+
+            /**
+             * Reads up to length bytes starting at offset. Returns the number of bytes read, which is less than length
+             * only at the end of the file, or -1 on error.
+             */
+            int64_t ReadAt(uint64_t offset, void* buffer, size_t length) const;
+
+            /**
+             * Writes all length bytes starting at offset. Returns false on error.
+             */
+            bool WriteAt(uint64_t offset, const void* data, size_t length) const;
+
+        private:
+#ifdef _WIN32
+            void* m_handle;
+#else
+            int m_fd;
+#endif
+            uint64_t m_size;
+            uint64_t m_modifiedTime;
+        };
+    }
+}
@@ -53,6 +53,11 @@ public:
     * URL encodes a string (uses %20 not + for spaces).
     */
     static Aws::String URLEncode(const char* unsafe);
+
+    /**
+    * URL encodes the first length characters of unsafe like URLEncode, appending the result to out.
+    */
+    static void URLEncode(const char* unsafe, size_t length, Aws::String& out);
 
     /**
     * Decodes a URL encoded string (will handle both encoding schemes for spaces).
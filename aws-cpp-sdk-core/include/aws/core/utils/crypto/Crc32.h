@@ -0,0 +1,45 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Crypto
+{
+
+/**
+* CRC-32 as used by zlib, gzip and PNG (reflected polynomial 0xEDB88320).
+*/
+class AWS_CORE_API Crc32
+{
+public:
+    /**
+    * Checksum of length bytes at data. Pass the result of a previous call as previousCrc to continue a checksum over
+    * data that arrives in pieces.
+    */
+    static uint32_t Calculate(const unsigned char* data, size_t length, uint32_t previousCrc = 0);
+};
+
+} // namespace Crypto
+} // namespace Utils
+} // namespace Aws
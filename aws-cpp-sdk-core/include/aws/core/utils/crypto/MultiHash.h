@@ -0,0 +1,109 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <cstdint>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Crypto
+{
+
+/**
+* Computes several digests (MD5, SHA-256 and CRC-32 in any combination) over a single read of a payload. S3 uploads
+* need an MD5 for Content-MD5 and the ETag check and a SHA-256 for the SigV4 payload hash; computing them separately
+* reads every part two or three times.
+*
+* A MultiHash is single use: feed it with Update() and call Finish() once, or call one of the Calculate() overloads.
+*/
+class AWS_CORE_API MultiHash
+{
+    public:
+        static const int MD5_DIGEST = 1;
+        static const int SHA256_DIGEST = 2;
+        static const int CRC32_DIGEST = 4;
+
+        /**
+        * digests is a combination of MD5_DIGEST, SHA256_DIGEST and CRC32_DIGEST.
+        */
+        MultiHash(int digests);
+        ~MultiHash();
+
+        MultiHash(const MultiHash&) = delete;
+        MultiHash& operator=(const MultiHash&) = delete;
+
+        /**
+        * Feeds the next length bytes of the payload to every requested digest.
+        */
+        void Update(const unsigned char* data, size_t length);
+
+        /**
+        * Completes the digests. Returns false if any of them failed.
+        */
+        bool Finish();
+
+        /**
+        * Hashes length bytes at data and finishes.
+        */
+        bool Calculate(const unsigned char* data, size_t length);
+
+        /**
+        * Hashes the entire stream and finishes. The stream position is restored afterwards.
+        */
+        bool Calculate(Aws::IStream& stream);
+
+        bool IsSuccess() const { return m_success; }
+
+        /**
+        * Raw digests, empty if the digest was not requested or hashing failed.
+        */
+        const ByteBuffer& GetMD5() const { return m_md5; }
+        const ByteBuffer& GetSHA256() const { return m_sha256; }
+        uint32_t GetCRC32() const { return m_crc32; }
+
+        /**
+        * Number of payload bytes fed through the digests.
+        */
+        uint64_t GetBytesHashed() const { return m_bytesHashed; }
+
+    private:
+        //implemented per platform next to the other hash implementations.
+        struct MultiHashContext;
+
+        void UpdateDigests(const unsigned char* data, size_t length);
+        bool FinishDigests();
+
+        int m_digests;
+        Aws::UniquePtr<MultiHashContext> m_context;
+        ByteBuffer m_md5;
+        ByteBuffer m_sha256;
+        uint32_t m_crc32;
+        uint64_t m_bytesHashed;
+        bool m_finished;
+        bool m_success;
+};
+
+} // namespace Crypto
+} // namespace Utils
+} // namespace Aws
@@ -0,0 +1,167 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <functional>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Json
+{
+
+class JsonValue;
+
+enum class JsonToken
+{
+    BEGIN_OBJECT,
+    END_OBJECT,
+    BEGIN_ARRAY,
+    END_ARRAY,
+    NAME,
+    STRING,
+    NUMBER,
+    BOOL,
+    NULL_VALUE,
+    END_DOCUMENT,
+    PARSE_ERROR
+};
+
+/**
+* Pull parser over a json stream. Tokens are read one at a time straight off the stream, so a response can be
+* deserialized into its result type without first building a JsonValue tree for the whole document.
+*
+* Typical use for an object:
+*
+*    if (reader.Next() == JsonToken::BEGIN_OBJECT)
+*    {
+*        while (reader.Next() == JsonToken::NAME)
+*        {
+*            if (reader.GetString() == "Count") { reader.Next(); count = reader.GetInteger(); }
+*            else { reader.Next(); reader.SkipValue(); }
+*        }
+*    }
+*/
+class AWS_CORE_API JsonReader
+{
+public:
+    /**
+    * Reads json from istream. The stream is read in blocks as tokens are requested.
+    */
+    JsonReader(Aws::IStream& istream);
+
+    /**
+    * Advances to the next token and returns it. Once the document ends or is found to be malformed,
+    * END_DOCUMENT or PARSE_ERROR is returned from then on.
+    */
+    JsonToken Next();
+
+    /**
+    * The token most recently returned by Next().
+    */
+    inline JsonToken GetCurrentToken() const { return m_token; }
+
+    /**
+    * The member name for NAME, the unescaped value for STRING, or the literal text for NUMBER.
+    * Only valid until the next call to Next().
+    */
+    inline const Aws::String& GetString() const { return m_string; }
+
+    /**
+    * The value of the current BOOL token.
+    */
+    inline bool GetBool() const { return m_bool; }
+
+    /**
+    * The value of the current NUMBER token.
+    */
+    int GetInteger() const;
+    long long GetInt64() const;
+    double GetDouble() const;
+
+    /**
+    * Skips the value whose first token is the current one. If that is BEGIN_OBJECT or BEGIN_ARRAY, everything up to and
+    * including the matching end token is consumed.
+    */
+    void SkipValue();
+
+    /**
+    * Calls readMember with the name of each member of the object whose first token is the current one, with the reader on
+    * the first token of that member's value. Whatever part of the value readMember leaves unread is skipped, so it only
+    * needs to look at the tokens it expects. A value that is not an object at all, such as null, is skipped without
+    * calling readMember.
+    */
+    void ReadObject(const std::function<void(const Aws::String& name)>& readMember);
+
+    /**
+    * Calls readElement with the reader on the first token of each element of the array whose first token is the current
+    * one. As with ReadObject, unread parts of an element are skipped and a value that is not an array is skipped whole.
+    */
+    void ReadArray(const std::function<void()>& readElement);
+
+    /**
+    * Reads the value whose first token is the current one into a JsonValue. Meant for small nested structures where
+    * building a tree is simpler than walking the tokens.
+    */
+    JsonValue ReadValue();
+
+    inline bool WasParseSuccessful() const { return m_token != JsonToken::PARSE_ERROR; }
+    inline const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+private:
+    JsonReader(const JsonReader&) = delete;
+    JsonReader& operator=(const JsonReader&) = delete;
+
+    int Peek();
+    int SkipWhitespace();
+    bool Fill();
+    JsonToken ReadValueToken(int c);
+    bool ReadString();
+    bool ReadUnicodeEscape(unsigned& codePoint);
+    bool ReadNumber();
+    bool ReadLiteral(const char* literal, size_t length);
+    JsonToken Fail(const char* message);
+    void SkipToDepth(size_t depth);
+
+    static const size_t BUFFER_SIZE = 8192;
+
+    Aws::IStream& m_stream;
+    char m_buffer[BUFFER_SIZE];
+    size_t m_position;
+    size_t m_length;
+    size_t m_offset;
+
+    //'{' or '[' for each container we are inside of.
+    Aws::Vector<char> m_containers;
+    bool m_afterName;
+    bool m_afterValue;
+    bool m_afterComma;
+
+    JsonToken m_token;
+    Aws::String m_string;
+    bool m_bool;
+    Aws::String m_errorMessage;
+};
+
+} // namespace Json
+} // namespace Utils
+} // namespace Aws
@@ -279,7 +279,7 @@ public:
 
     /**
     * Writes the entire json object tree without whitespace characters starting at the current level to a string and
-    * returns it.
+    * returns it. The output has no trailing line feed and matches the stream overload byte for byte.
     */
     Aws::String WriteCompact(bool treatAsObject = true) const;
 
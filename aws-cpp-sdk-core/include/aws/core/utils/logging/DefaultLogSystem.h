@@ -19,15 +19,13 @@
 
 #include <aws/core/utils/logging/FormattedLogSystem.h>
 #include <aws/core/utils/logging/LogLevel.h>
-#include <aws/core/utils/memory/stl/AWSQueue.h>
+#include <aws/core/utils/logging/LogQueue.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 
 #include <thread>
 #include <memory>
-#include <mutex>
-#include <atomic>
-#include <condition_variable>
+#include <cstdint>
 
 namespace Aws
 {
@@ -36,30 +34,34 @@ namespace Utils
 namespace Logging
 {
 
+/**
+ * Log system that hands statements to a background thread which writes them to a file or stream.
+ * Statements go through a LogQueue, a bounded ring buffer that logging threads claim slots in without taking a lock.
+ * The writer drains it in batches, writes each batch with a single call and flushes when it runs out of work, or at least every
+ * FLUSH_INTERVAL_MS while it is kept busy.
+ */
 class AWS_CORE_API DefaultLogSystem : public FormattedLogSystem
 {
     public:
         
         using Base = FormattedLogSystem;
 
-        DefaultLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile);
-        DefaultLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix);
-        virtual ~DefaultLogSystem();
-
-        struct LogSynchronizationData
-        {
-            public:
-                LogSynchronizationData() : m_stopLogging(false) {}
+        static const size_t DEFAULT_QUEUE_CAPACITY = 8192;
+        static const long FLUSH_INTERVAL_MS = 100;
 
-                std::mutex m_logQueueMutex;
-                std::condition_variable m_queueSignal;
-                Aws::Queue<Aws::String> m_queuedLogMessages;
-                std::atomic<bool> m_stopLogging;
+        /**
+        * queueCapacity is rounded up to a power of two.
+        */
+        DefaultLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile,
+            size_t queueCapacity = DEFAULT_QUEUE_CAPACITY, LogOverflowPolicy overflowPolicy = LogOverflowPolicy::BLOCK);
+        DefaultLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix,
+            size_t queueCapacity = DEFAULT_QUEUE_CAPACITY, LogOverflowPolicy overflowPolicy = LogOverflowPolicy::BLOCK);
+        virtual ~DefaultLogSystem();
 
-            private:
-                LogSynchronizationData(const LogSynchronizationData& rhs) = delete;
-                LogSynchronizationData& operator =(const LogSynchronizationData& rhs) = delete;
-        };
+        /**
+        * Number of statements discarded because the queue was full, with LogOverflowPolicy::DROP.
+        */
+        inline uint64_t GetDroppedStatementCount() const { return m_queue.GetDroppedRecordCount(); }
 
     protected:
 	
@@ -70,7 +72,7 @@ class AWS_CORE_API DefaultLogSystem : public FormattedLogSystem
         DefaultLogSystem(const DefaultLogSystem& rhs) = delete;
         DefaultLogSystem& operator =(const DefaultLogSystem& rhs) = delete;
 
-        LogSynchronizationData m_syncData;
+        LogQueue<Aws::String> m_queue;
 
         std::thread m_loggingThread;
 };
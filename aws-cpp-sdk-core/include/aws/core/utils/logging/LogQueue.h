@@ -0,0 +1,275 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Logging
+{
+
+/**
+ * What a logging thread does when the log queue is full.
+ * BLOCK waits for the writer to make room, so nothing is lost.
+ * DROP discards the record and counts it, so logging never holds up the caller.
+ */
+enum class LogOverflowPolicy
+{
+    BLOCK,
+    DROP
+};
+
+/**
+ * Bounded multi-producer, single-consumer queue between the logging threads and the writer thread of the log systems
+ * that write in the background. Each slot carries a sequence number that tells logging threads when it is free and the
+ * writer when it has been filled; claiming one takes no lock. Records keep their buffers from lap to lap, so once the
+ * queue has warmed up, queueing a record doesn't allocate.
+ */
+template<typename RecordType>
+class LogQueue
+{
+    public:
+
+        /**
+        * capacity is rounded up to a power of two. allocationTag is used for the slot array.
+        */
+        LogQueue(size_t capacity, LogOverflowPolicy overflowPolicy, const char* allocationTag) :
+            m_slots(nullptr),
+            m_mask(RoundUpToPowerOfTwo(capacity) - 1),
+            m_overflowPolicy(overflowPolicy),
+            m_enqueuePosition(0),
+            m_dequeuePosition(0),
+            m_droppedRecords(0),
+            m_writerSleeping(false),
+            m_stopLogging(false)
+        {
+            m_slots = Aws::NewArray<Slot>(m_mask + 1, allocationTag);
+            for (size_t i = 0; i <= m_mask; ++i)
+            {
+                m_slots[i].m_sequence.store(i);
+            }
+        }
+
+        ~LogQueue()
+        {
+            Aws::DeleteArray(m_slots);
+        }
+
+        /**
+        * Claims the next free record, lets fillRecord fill it in on the calling thread and hands it to the writer. When
+        * the queue is full, waits for the writer or, with LogOverflowPolicy::DROP, counts the record as dropped and
+        * doesn't call fillRecord at all.
+        */
+        template<typename FillRecord>
+        void Push(const FillRecord& fillRecord)
+        {
+            size_t position = 0;
+            Slot* slot = Claim(position);
+            if (!slot)
+            {
+                return;
+            }
+
+            fillRecord(slot->m_record);
+            slot->m_sequence.store(position + 1);
+            if (m_writerSleeping)
+            {
+                WakeWriter();
+            }
+        }
+
+        /**
+        * The writer thread's loop. Drains records in batches of up to MAX_BATCH_RECORDS, with appendRecord(record, batch)
+        * turning each one into text, and hands every batch to writeBatch(batch) in one piece. flush() is called whenever
+        * the queue runs dry, and at least every flushInterval while the writer is kept busy. Returns once Stop has been
+        * called and everything queued before it has been written.
+        */
+        template<typename AppendRecord, typename WriteBatch, typename Flush>
+        void RunWriter(std::chrono::milliseconds flushInterval, const AppendRecord& appendRecord, const WriteBatch& writeBatch, const Flush& flush)
+        {
+            using namespace std::chrono;
+
+            steady_clock::time_point lastFlush = steady_clock::now();
+            bool unflushed = false;
+            Aws::String batch;
+
+            for (;;)
+            {
+                batch.clear();
+                size_t records = 0;
+                while (records < MAX_BATCH_RECORDS && !IsEmpty())
+                {
+                    Slot& slot = m_slots[m_dequeuePosition & m_mask];
+                    appendRecord(slot.m_record, batch);
+                    slot.m_sequence.store(m_dequeuePosition + m_mask + 1, std::memory_order_release);
+                    ++m_dequeuePosition;
+                    ++records;
+                }
+
+                if (records > 0)
+                {
+                    writeBatch(batch);
+                    unflushed = true;
+
+                    if (steady_clock::now() - lastFlush >= flushInterval)
+                    {
+                        flush();
+                        lastFlush = steady_clock::now();
+                        unflushed = false;
+                    }
+                    continue;
+                }
+
+                //out of work: get what we have to disk, then sleep until a logging thread wakes us.
+                if (unflushed)
+                {
+                    flush();
+                    lastFlush = steady_clock::now();
+                    unflushed = false;
+                }
+
+                if (m_stopLogging && IsEmpty())
+                {
+                    break;
+                }
+
+                std::unique_lock<std::mutex> locker(m_queueMutex);
+                //logging threads check m_writerSleeping after publishing a record, we check the queue after setting it,
+                //so one of us sees the other.
+                m_writerSleeping = true;
+                m_queueSignal.wait_for(locker, flushInterval, [this](){ return m_stopLogging.load() || !IsEmpty(); });
+                m_writerSleeping = false;
+            }
+        }
+
+        /**
+        * Tells RunWriter to return once it has drained the queue.
+        */
+        void Stop()
+        {
+            m_stopLogging.store(true);
+            WakeWriter();
+        }
+
+        /**
+        * Number of records discarded because the queue was full, with LogOverflowPolicy::DROP.
+        */
+        inline uint64_t GetDroppedRecordCount() const { return m_droppedRecords; }
+
+    private:
+
+        LogQueue(const LogQueue& rhs) = delete;
+        LogQueue& operator =(const LogQueue& rhs) = delete;
+
+        //upper bound on records written per batch, so the writer also gets around to flushing under sustained load.
+        static const size_t MAX_BATCH_RECORDS = 1024;
+
+        struct Slot
+        {
+            std::atomic<size_t> m_sequence;
+            RecordType m_record;
+        };
+
+        static size_t RoundUpToPowerOfTwo(size_t value)
+        {
+            size_t result = 2;
+            while (result < value)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        /**
+        * Claims the next free slot, or returns null if the queue is full and the policy is DROP.
+        */
+        Slot* Claim(size_t& position)
+        {
+            for (;;)
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+                Slot* slot = &m_slots[position & m_mask];
+                size_t sequence = slot->m_sequence.load(std::memory_order_acquire);
+                intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                if (difference == 0)
+                {
+                    if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        return slot;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    //the writer hasn't freed this slot since the last lap.
+                    if (m_overflowPolicy == LogOverflowPolicy::DROP)
+                    {
+                        ++m_droppedRecords;
+                        return nullptr;
+                    }
+
+                    if (m_writerSleeping)
+                    {
+                        WakeWriter();
+                    }
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        bool IsEmpty() const
+        {
+            return m_slots[m_dequeuePosition & m_mask].m_sequence.load() != m_dequeuePosition + 1;
+        }
+
+        void WakeWriter()
+        {
+            {
+                std::lock_guard<std::mutex> locker(m_queueMutex);
+            }
+            m_queueSignal.notify_one();
+        }
+
+        Slot* m_slots;
+        size_t m_mask;
+        LogOverflowPolicy m_overflowPolicy;
+        //logging threads and the writer each get their own cache line.
+        char m_padding0[64];
+        std::atomic<size_t> m_enqueuePosition;
+        char m_padding1[64];
+        size_t m_dequeuePosition;
+        char m_padding2[64];
+        std::atomic<uint64_t> m_droppedRecords;
+        std::atomic<bool> m_writerSleeping;
+        std::atomic<bool> m_stopLogging;
+        std::mutex m_queueMutex;
+        std::condition_variable m_queueSignal;
+};
+
+} // namespace Logging
+} // namespace Utils
+} // namespace Aws
@@ -0,0 +1,117 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/logging/LogSystemInterface.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/logging/LogQueue.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Logging
+{
+
+/**
+ * How StructuredLogSystem writes its records.
+ * TEXT produces the same lines as the other log systems.
+ * JSON_LINES produces one JSON object per line, with the level, time, tag, thread, format string, the individual
+ * arguments and the formatted message as separate fields.
+ */
+enum class LogRecordFormat
+{
+    TEXT,
+    JSON_LINES
+};
+
+/**
+ * Log system that defers all formatting to its writer thread.
+ * The logging thread only records the level, tag, time, thread, format string and a raw copy of the arguments into a
+ * preallocated record; turning that into text or JSON happens in the background. Works with the existing AWS_LOG_*
+ * and AWS_LOGSTREAM_* macros unchanged.
+ *
+ * The tag, the format string and string arguments (%s) are all copied into the record, since callers are free to build
+ * them on the fly.
+ */
+class AWS_CORE_API StructuredLogSystem : public LogSystemInterface
+{
+    public:
+
+        using Base = LogSystemInterface;
+
+        static const size_t DEFAULT_QUEUE_CAPACITY = 4096;
+
+        /**
+        * queueCapacity is rounded up to a power of two.
+        */
+        StructuredLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& log, LogRecordFormat recordFormat = LogRecordFormat::TEXT,
+            size_t queueCapacity = DEFAULT_QUEUE_CAPACITY, LogOverflowPolicy overflowPolicy = LogOverflowPolicy::BLOCK);
+        virtual ~StructuredLogSystem();
+
+        virtual LogLevel GetLogLevel(void) const override { return m_logLevel; }
+        void SetLogLevel(LogLevel logLevel) { m_logLevel.store(logLevel); }
+
+        virtual void Log(LogLevel logLevel, const char* tag, const char* formatStr, ...) override;
+
+        virtual void LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &messageStream) override;
+
+        /**
+        * Number of records discarded because the queue was full, with LogOverflowPolicy::DROP.
+        */
+        inline uint64_t GetDroppedRecordCount() const { return m_records.GetDroppedRecordCount(); }
+
+        /**
+        * One log call, as captured on the logging thread. LogStream records have no format; their message is kept in
+        * m_arguments as is.
+        */
+        struct LogRecord
+        {
+            LogLevel m_logLevel;
+            Aws::String m_tag;
+            bool m_hasFormat;
+            Aws::String m_format;
+            int64_t m_timestampMillis;
+            std::thread::id m_threadId;
+            Aws::String m_arguments;
+        };
+
+    private:
+
+        StructuredLogSystem(const StructuredLogSystem& rhs) = delete;
+        StructuredLogSystem& operator =(const StructuredLogSystem& rhs) = delete;
+
+        void WriterLoop();
+
+        std::atomic<LogLevel> m_logLevel;
+        std::shared_ptr<Aws::OStream> m_log;
+        LogRecordFormat m_recordFormat;
+        LogQueue<LogRecord> m_records;
+        std::thread m_writerThread;
+};
+
+} // namespace Logging
+} // namespace Utils
+} // namespace Aws
@@ -0,0 +1,178 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/MemorySystemInterface.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Memory
+{
+
+/**
+* Allocation counters for one allocation tag, as reported by PooledMemorySystem::GetTagStatistics().
+*/
+struct AWS_CORE_API AllocationTagStatistics
+{
+    AllocationTagStatistics() :
+        tag(nullptr), allocationCount(0), freeCount(0), currentBytes(0), totalBytes(0)
+    {}
+
+    //nullptr for allocations made without a tag
+    const char* tag;
+    uint64_t allocationCount;
+    uint64_t freeCount;
+    //bytes requested by the callers, not counting size class rounding
+    uint64_t currentBytes;
+    uint64_t totalBytes;
+};
+
+/**
+* Thread caching, size class pooled implementation of MemorySystemInterface, meant to be handed to
+* InitializeAWSMemorySystem() in builds with AWS_CUSTOM_MEMORY_MANAGEMENT.
+*
+* Requests up to MAX_POOLED_SIZE bytes are rounded up to one of SIZE_CLASS_COUNT size classes. Each thread
+* allocates from and frees to its own cache of free blocks per size class, taking no locks; an empty cache refills a
+* batch of blocks from a central free list, which in turn carves new blocks out of large slabs, and an overfull cache
+* hands half of its blocks back. Larger requests go straight to malloc. Up to THREAD_CACHE_COUNT threads get a cache;
+* a cache stays with its thread until another thread is given the same id, so beyond that many live threads, or
+* once many short lived threads have come and gone, threads share the central lists. Slabs are only returned to the
+* system when the memory system is destroyed, so it must outlive everything allocated through it.
+*
+* Every allocation also updates the counters of its allocation tag, which GetTagStatistics() reports. The counters
+* are kept per thread cache so that keeping them costs no atomic read-modify-write operations.
+* Alignment requests above 16 bytes are not honoured; the SDK itself only ever asks for byte alignment.
+*/
+class AWS_CORE_API PooledMemorySystem : public MemorySystemInterface
+{
+public:
+    static const size_t MAX_POOLED_SIZE = 32768;
+    static const size_t SIZE_CLASS_COUNT = 40;
+    static const size_t TAG_SLOT_COUNT = 512;
+
+    /**
+    * trackTagStatistics turns the per tag counters on.
+    */
+    PooledMemorySystem(bool trackTagStatistics = true);
+    virtual ~PooledMemorySystem();
+
+    void Begin() override {}
+    void End() override {}
+
+    void* AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag = nullptr) override;
+    void FreeMemory(void* memoryPtr) override;
+
+    /**
+    * Counters of every tag seen so far, one entry per distinct tag string. Once TAG_SLOT_COUNT - 1 tag addresses have
+    * been seen, allocations under new ones are counted as untagged. Taken while other threads allocate, the snapshot
+    * is only approximate.
+    * Uses std::vector so that taking a snapshot does not allocate through the memory system being inspected.
+    */
+    std::vector<AllocationTagStatistics> GetTagStatistics() const;
+
+    /**
+    * Total bytes obtained from malloc for slabs, i.e. the footprint of the pooled size classes.
+    */
+    uint64_t GetReservedSlabBytes() const { return m_reservedSlabBytes.load(std::memory_order_relaxed); }
+
+    /**
+    * Size that a request of blockSize bytes is rounded up to, or blockSize itself above MAX_POOLED_SIZE.
+    */
+    static size_t GetAllocationSize(size_t blockSize);
+
+private:
+    PooledMemorySystem(const PooledMemorySystem&) = delete;
+    PooledMemorySystem& operator=(const PooledMemorySystem&) = delete;
+
+    static const size_t THREAD_CACHE_COUNT = 64;
+    static const size_t THREAD_CACHE_PROBES = 4;
+
+    struct FreeBlock
+    {
+        FreeBlock* m_next;
+    };
+
+    struct FreeList
+    {
+        FreeBlock* m_head;
+        size_t m_count;
+    };
+
+    struct TagCounters
+    {
+        std::atomic<uint64_t> m_allocationCount;
+        std::atomic<uint64_t> m_freeCount;
+        std::atomic<uint64_t> m_allocatedBytes;
+        std::atomic<uint64_t> m_freedBytes;
+    };
+
+    struct ThreadCache
+    {
+        char m_padding0[64];
+        std::atomic<std::thread::id> m_owner;
+        FreeList m_lists[SIZE_CLASS_COUNT];
+        //TAG_SLOT_COUNT counters, allocated the first time the cache records anything; only the owner writes to them.
+        std::atomic<TagCounters*> m_tagCounters;
+    };
+
+    struct CentralList
+    {
+        char m_padding0[64];
+        std::mutex m_lock;
+        FreeList m_list;
+    };
+
+    static size_t GetSizeClass(size_t blockSize);
+    static ThreadCache* AcquireThreadCache(ThreadCache* caches);
+
+    FreeBlock* RefillFromCentral(size_t sizeClass, FreeList& cache, size_t batch);
+    void ReleaseToCentral(size_t sizeClass, FreeList& cache, size_t count);
+    FreeBlock* CarveSlab(size_t sizeClass, size_t& blockCount);
+
+    uint32_t FindTagSlot(const char* allocationTag);
+    TagCounters* GetTagCounters(ThreadCache& cache);
+    //cache is the cache owned by the calling thread, or nullptr to count in the shared counters.
+    void CountAllocation(ThreadCache* cache, uint32_t tagSlot, uint64_t bytes);
+    void CountFree(ThreadCache* cache, uint32_t tagSlot, uint64_t bytes);
+
+    bool m_trackTagStatistics;
+    size_t m_maxCachedBlocks[SIZE_CLASS_COUNT];
+    ThreadCache m_threadCaches[THREAD_CACHE_COUNT];
+    CentralList m_centralLists[SIZE_CLASS_COUNT];
+
+    std::mutex m_slabLock;
+    FreeBlock* m_slabs;
+    std::atomic<uint64_t> m_reservedSlabBytes;
+
+    std::atomic<const char*> m_tags[TAG_SLOT_COUNT];
+    //counters for allocations made by threads without a cache, and for those too large to pool.
+    TagCounters m_sharedTagCounters[TAG_SLOT_COUNT];
+};
+
+} // namespace Memory
+} // namespace Utils
+} // namespace Aws
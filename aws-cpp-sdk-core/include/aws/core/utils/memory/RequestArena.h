@@ -0,0 +1,118 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Memory
+{
+
+/**
+* Monotonic arena for the objects of one logical call: the request, its headers and URI, signer temporaries, the
+* response and its parsed document, and the result model. While a RequestArena is alive, Aws::Malloc on the thread
+* that created it hands out memory by bumping a pointer through CHUNK_SIZE chunks instead of going to the memory
+* system, and Aws::Free of that memory does nothing but count. This covers everything allocated through
+* Aws::New, Aws::MakeShared and the Aws::Allocator based containers (Aws::String, Aws::Vector, Aws::Map...).
+*
+* Typical use is to bracket a call and the handling of its outcome:
+*
+*     {
+*         Aws::Utils::Memory::RequestArena arena;
+*         auto outcome = client.GetItem(request);
+*         ...
+*     }
+*
+* Anything that outlives the arena, e.g. a string cached by a long lived object, stays valid: a chunk is returned to
+* the memory system once the arena is gone and every allocation made from it has been freed, wherever that happens.
+* Such survivors do keep their whole chunk alive, so arenas should only bracket code whose allocations mostly die with
+* it. Arenas on one thread nest; they must be destroyed on the thread that created them, in reverse order.
+*
+* Only takes effect in builds with AWS_CUSTOM_MEMORY_MANAGEMENT, where the containers allocate through Aws::Malloc;
+* elsewhere it does nothing.
+*/
+class AWS_CORE_API RequestArena
+{
+public:
+    static const size_t CHUNK_SIZE = 32 * 1024;
+    /**
+    * Larger requests bypass the arena, so a big response body does not strand a chunk.
+    */
+    static const size_t MAX_ARENA_ALLOCATION = CHUNK_SIZE / 4;
+
+    RequestArena();
+    ~RequestArena();
+
+    /**
+    * Whether allocations on this thread are being served by this arena. False outside AWS_CUSTOM_MEMORY_MANAGEMENT
+    * builds, or if too many threads have an arena open at once.
+    */
+    bool IsActive() const { return m_slot != nullptr; }
+
+    /**
+    * Number and total size of the allocations served so far, and the number of chunks they needed.
+    */
+    size_t GetAllocationCount() const { return m_allocationCount; }
+    size_t GetBytesAllocated() const { return m_bytesAllocated; }
+    size_t GetChunkCount() const { return m_chunkCount; }
+
+    /**
+    * Called by Aws::Malloc: memory from the arena open on the calling thread, or nullptr if there is none or the
+    * request is too large.
+    */
+    static void* Allocate(size_t allocationSize);
+
+    /**
+    * Called by Aws::Free: releases memoryPtr and returns true if it was handed out by an arena.
+    */
+    static bool Free(void* memoryPtr);
+
+private:
+    RequestArena(const RequestArena&) = delete;
+    RequestArena& operator=(const RequestArena&) = delete;
+
+    struct Chunk;
+    struct ThreadSlot;
+
+    static ThreadSlot* FindThreadSlot(bool claim);
+    static Chunk* CreateChunk();
+    static void ReleaseChunk(Chunk* chunk);
+    static Chunk* FindChunk(void* memoryPtr);
+
+    void* AllocateInChunk(size_t allocationSize);
+    void SealChunk();
+
+    ThreadSlot* m_slot;
+    RequestArena* m_previous;
+
+    Chunk* m_chunk;
+    size_t m_chunkUsed;
+    int64_t m_chunkAllocations;
+
+    size_t m_allocationCount;
+    size_t m_bytesAllocated;
+    size_t m_chunkCount;
+};
+
+} // namespace Memory
+} // namespace Utils
+} // namespace Aws
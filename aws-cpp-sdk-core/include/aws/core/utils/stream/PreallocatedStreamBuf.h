@@ -0,0 +1,78 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <istream>
+#include <streambuf>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Stream
+{
+
+/**
+* A seekable streambuf over memory owned by the caller, read and written in place instead of being copied into
+* a stringbuf. Reads see all length bytes; writes overwrite them from the start and stop at the end. The memory
+* must outlive the buffer.
+*/
+class AWS_CORE_API PreallocatedStreamBuf : public std::streambuf
+{
+    public:
+        PreallocatedStreamBuf(unsigned char* buffer, size_t length);
+
+        /**
+        * Exposes the first length bytes of buffer, or all of it if length is larger.
+        */
+        PreallocatedStreamBuf(Aws::Utils::Array<uint8_t>* buffer, size_t length);
+
+        PreallocatedStreamBuf(const PreallocatedStreamBuf&) = delete;
+        PreallocatedStreamBuf& operator=(const PreallocatedStreamBuf&) = delete;
+
+        unsigned char* GetBuffer() const { return m_buffer; }
+        size_t GetLength() const { return m_length; }
+
+    protected:
+        pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+        pos_type seekpos(pos_type position, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+    private:
+        unsigned char* m_buffer;
+        size_t m_length;
+};
+
+/**
+* An IOStream over caller owned memory, e.g. a request body backed by a buffer that was already filled, so the
+* http client reads it where it is.
+*/
+class AWS_CORE_API PreallocatedIOStream : public Aws::IOStream
+{
+    public:
+        PreallocatedIOStream(unsigned char* buffer, size_t length);
+        PreallocatedIOStream(Aws::Utils::Array<uint8_t>* buffer, size_t length);
+
+    private:
+        PreallocatedStreamBuf m_streamBuf;
+};
+
+} //namespace Stream
+} //namespace Utils
+} //namespace Aws
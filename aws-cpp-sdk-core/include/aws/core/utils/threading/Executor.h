@@ -18,7 +18,15 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <functional>
-#include <aws/core/utils/memory/stl/AWSFunction.h>
+#include <aws/core/utils/memory/stl/AWSFunction.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 namespace Aws
 {
 namespace Utils
@@ -58,6 +66,68 @@ namespace Threading
     protected:
         bool SubmitToThread(std::function<void()>&&);
     };
+
+    /**
+    * What a PooledThreadExecutor does with a submission when its task queue is already full.
+    * BLOCK waits for room, REJECT fails the submission (Submit returns false), and RUN_IN_CALLER
+    * executes the task synchronously on the submitting thread.
+    */
+    enum class OverflowPolicy
+    {
+        BLOCK,
+        REJECT,
+        RUN_IN_CALLER
+    };
+
+    /**
+    * Executor backed by a fixed number of worker threads. Each worker owns a task deque; submissions are spread
+    * across the deques round-robin and idle workers steal from their siblings. At most maxQueuedTasks tasks may be
+    * waiting at any time (0 means unbounded), after which overflowPolicy applies. A worker that overflows its own pool
+    * always runs the task inline, since blocking there could deadlock the pool.
+    * On destruction, submissions from outside the pool are refused, every queued task is run, and the workers are joined.
+    */
+    class AWS_CORE_API PooledThreadExecutor : public Executor
+    {
+    public:
+        PooledThreadExecutor(size_t poolSize, size_t maxQueuedTasks = 0, OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK);
+        ~PooledThreadExecutor();
+
+        /**
+        * Number of tasks submitted but not yet picked up by a worker.
+        */
+        size_t GetQueuedTaskCount() const { return m_queuedTasks.load(); }
+
+    protected:
+        bool SubmitToThread(std::function<void()>&&) override;
+
+    private:
+        PooledThreadExecutor(const PooledThreadExecutor&) = delete;
+        PooledThreadExecutor& operator =(const PooledThreadExecutor&) = delete;
+
+        struct WorkerQueue
+        {
+            std::mutex m_mutex;
+            Aws::Deque<std::function<void()>> m_tasks;
+        };
+
+        bool ReserveSlot(bool isWorkerThread);
+        bool TryPopTask(size_t workerIndex, std::function<void()>& task);
+        bool IsWorkerThread() const;
+        void WorkerLoop(size_t workerIndex);
+
+        size_t m_maxQueuedTasks;
+        OverflowPolicy m_overflowPolicy;
+        Aws::Vector<WorkerQueue*> m_queues;
+        Aws::Vector<std::thread> m_workers;
+        std::atomic<size_t> m_queuedTasks;
+        std::atomic<size_t> m_nextQueue;
+        std::atomic<bool> m_stopping;
+        std::mutex m_syncMutex;
+        std::condition_variable m_taskAvailable;
+        std::condition_variable m_slotAvailable;
+    };
+
+
 
 } // namespace Threading
 } // namespace Utils
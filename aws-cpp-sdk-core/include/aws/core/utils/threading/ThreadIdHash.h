@@ -0,0 +1,56 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Threading
+{
+    /**
+    * Spreads the entropy of value over all of its bits, so that its remainder by a table size can be used as an index even
+    * when value is an aligned address or otherwise has patterned low bits.
+    */
+    inline uint64_t MixHashBits(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        return value;
+    }
+
+    /**
+    * Returns a well mixed hash of the calling thread's id, for picking that thread's slot in a table of per thread state.
+    * There is no portable thread local storage the sdk can rely on, so state that would otherwise be thread local lives
+    * in such tables instead.
+    */
+    inline uint64_t HashCurrentThreadId()
+    {
+        //std::hash<std::thread::id> is an out of line call in some standard libraries, so mix the id's bytes directly.
+        //thread::id is trivially copyable and any bits of it will do.
+        std::thread::id self = std::this_thread::get_id();
+        uint64_t hash = 0;
+        memcpy(&hash, &self, sizeof(self) < sizeof(hash) ? sizeof(self) : sizeof(hash));
+        return MixHashBits(hash);
+    }
+} // namespace Threading
+} // namespace Utils
+} // namespace Aws
@@ -0,0 +1,146 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <utility>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Xml
+{
+
+enum class XmlToken
+{
+    START_ELEMENT,
+    END_ELEMENT,
+    TEXT,
+    END_DOCUMENT,
+    PARSE_ERROR
+};
+
+/**
+* Pull parser over an xml stream. The stream is read in blocks as tokens are requested, so XML-protocol results can be
+* deserialized without first loading the body into an XmlDocument.
+*
+* The xml declaration, comments, processing instructions and whitespace-only text between elements are skipped.
+* Entities and character references are decoded and CDATA sections are returned as text. A self-closing element
+* produces a START_ELEMENT followed by its END_ELEMENT.
+*/
+class AWS_CORE_API XmlReader
+{
+public:
+    /**
+    * Reads xml from istream.
+    */
+    XmlReader(Aws::IStream& istream);
+
+    /**
+    * Advances to the next token and returns it. Once the document ends or is found to be malformed,
+    * END_DOCUMENT or PARSE_ERROR is returned from then on.
+    */
+    XmlToken Next();
+
+    /**
+    * The token most recently returned by Next().
+    */
+    inline XmlToken GetCurrentToken() const { return m_token; }
+
+    /**
+    * The element name for START_ELEMENT and END_ELEMENT. Only valid until the next call to Next().
+    */
+    inline const Aws::String& GetName() const { return m_name; }
+
+    /**
+    * The decoded text for TEXT. Only valid until the next call to Next().
+    */
+    inline const Aws::String& GetText() const { return m_text; }
+
+    /**
+    * The value of an attribute on the current START_ELEMENT, or an empty string if it does not have one.
+    */
+    const Aws::String& GetAttributeValue(const char* name) const;
+
+    /**
+    * Number of elements currently open, counting the current START_ELEMENT.
+    */
+    inline size_t GetDepth() const { return m_depth; }
+
+    /**
+    * With the reader on a START_ELEMENT, reads through the matching END_ELEMENT and returns the element's text with
+    * leading and trailing whitespace removed. Text of nested elements is included. Valid until the next call to
+    * ReadElementText().
+    */
+    const Aws::String& ReadElementText();
+
+    /**
+    * With the reader on a START_ELEMENT, skips through the matching END_ELEMENT.
+    */
+    void SkipElement();
+
+    inline bool WasParseSuccessful() const { return m_token != XmlToken::PARSE_ERROR; }
+    inline const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+private:
+    XmlReader(const XmlReader&) = delete;
+    XmlReader& operator=(const XmlReader&) = delete;
+
+    int Peek();
+    bool Fill();
+    bool Consume(const char* expected);
+    bool SkipPast(const char* terminator, Aws::String* skipped);
+    void SkipWhitespace();
+    bool ReadName(Aws::String& name);
+    bool ReadAttributes();
+    bool ReadEntity(Aws::String& out);
+    XmlToken ReadMarkup(bool& emitted);
+    XmlToken ReadText(bool& emitted);
+    XmlToken Fail(const char* message);
+
+    static const size_t BUFFER_SIZE = 8192;
+
+    Aws::IStream& m_stream;
+    char m_buffer[BUFFER_SIZE];
+    size_t m_position;
+    size_t m_length;
+    size_t m_offset;
+
+    //names of the open elements and attributes of the current one; entries past m_depth/m_attributeCount are kept around
+    //so their string buffers get reused by the next element.
+    Aws::Vector<Aws::String> m_elements;
+    size_t m_depth;
+    Aws::Vector<std::pair<Aws::String, Aws::String>> m_attributes;
+    size_t m_attributeCount;
+    bool m_pendingEnd;
+    bool m_sawRoot;
+
+    XmlToken m_token;
+    Aws::String m_name;
+    Aws::String m_text;
+    Aws::String m_elementText;
+    Aws::String m_emptyString;
+    Aws::String m_errorMessage;
+};
+
+} // namespace Xml
+} // namespace Utils
+} // namespace Aws
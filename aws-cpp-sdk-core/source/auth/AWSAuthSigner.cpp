@@ -27,6 +27,7 @@
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/crypto/Sha256.h>
 #include <aws/core/utils/crypto/Sha256HMAC.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 
 #include <cstdio>
 #include <iomanip>
@@ -51,6 +52,15 @@ static const char* X_AMZ_SIGNED_HEADERS = "X-Amz-SignedHeaders";
 static const char* X_AMZ_ALGORITHM = "X-Amz-Algorithm";
 static const char* X_AMZ_CREDENTIAL = "X-Amz-Credential";
 static const char* UNSIGNED_PAYLOAD = "UNSIGNED-PAYLOAD";
+static const char* STREAMING_PAYLOAD = "STREAMING-AWS4-HMAC-SHA256-PAYLOAD";
+static const char* AWS_HMAC_SHA256_PAYLOAD = "AWS4-HMAC-SHA256-PAYLOAD";
+static const char* X_AMZ_CONTENT_SHA256 = "x-amz-content-sha256";
+static const char* X_AMZ_DECODED_CONTENT_LENGTH = "x-amz-decoded-content-length";
+static const char* CONTENT_ENCODING_HEADER = "content-encoding";
+static const char* AWS_CHUNKED = "aws-chunked";
+static const char* CHUNK_SIGNATURE = ";chunk-signature=";
+static const char* CHUNK_CRLF = "\r\n";
+static const char* EMPTY_STRING_SHA256 = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
 static const char* X_AMZ_SIGNATURE = "X-Amz-Signature";
 static const char* SIGNING_KEY = "AWS4";
 static const char* LONG_DATE_FORMAT_STR = "%Y%m%dT%H%M%SZ";
@@ -58,36 +68,283 @@ static const char* SIMPLE_DATE_FORMAT_STR = "%Y%m%d";
 
 static const char* v4LogTag = "AWSAuthV4Signer";
 
-Aws::String CanonicalizeRequestSigningString(HttpRequest& request)
+//room for the canonical request of a typical API call, so the buffer is allocated once per request.
+static const size_t CANONICAL_REQUEST_BUFFER_SIZE = 1024;
+static const size_t SIGNED_HEADERS_BUFFER_SIZE = 256;
+
+//Writes the method, path and query string lines of the canonical request.
+static void AppendCanonicalRequestPrefix(Aws::String& out, HttpRequest& request)
 {
     request.CanonicalizeRequest();
-    Aws::StringStream signingStringStream;
-    signingStringStream << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod());
-
-    signingStringStream << NEWLINE << request.GetUri().GetURLEncodedPath() << NEWLINE;
+    out.append(HttpMethodMapper::GetNameForHttpMethod(request.GetMethod()));
+    out.append(NEWLINE);
+    URI::URLEncodePath(request.GetUri().GetPath(), out);
+    out.append(NEWLINE);
 
-    if (request.GetQueryString().size() > 1 && request.GetQueryString().find("=") != std::string::npos)
+    const Aws::String& queryString = request.GetQueryString();
+    if (queryString.size() > 1)
     {
-        signingStringStream << request.GetQueryString().substr(1) << NEWLINE;
+        out.append(queryString, 1, Aws::String::npos);
+        if (queryString.find("=") == std::string::npos)
+        {
+            out.append(EQ);
+        }
     }
-    else if (request.GetQueryString().size() > 1)
+
+    out.append(NEWLINE);
+}
+
+static void AppendHexEncoded(Aws::String& out, const ByteBuffer& bytes)
+{
+    static const char* HEX_CHARS = "0123456789abcdef";
+    for (size_t i = 0; i < bytes.GetLength(); ++i)
     {
-        signingStringStream << request.GetQueryString().substr(1) << "=" << NEWLINE;
+        out.push_back(HEX_CHARS[bytes[i] >> 4]);
+        out.push_back(HEX_CHARS[bytes[i] & 0x0f]);
     }
-    else
+}
+
+//S3 requires at least 8KB per chunk; larger chunks mean fewer signatures per request.
+static const int64_t STREAMING_CHUNK_SIZE = 64 * 1024;
+static const size_t SIGNATURE_HEX_LENGTH = 64;
+
+static int64_t GetStreamLength(Aws::IOStream& stream)
+{
+    auto currentPos = stream.tellg();
+    stream.seekg(0, stream.end);
+    int64_t length = static_cast<int64_t>(stream.tellg());
+    stream.seekg(currentPos, stream.beg);
+    return length;
+}
+
+//size of one aws-chunked frame: hex length, chunk signature, CRLF, data, CRLF
+static int64_t GetChunkFrameLength(int64_t dataLength)
+{
+    int64_t hexDigits = 1;
+    for (int64_t remaining = dataLength; remaining >= 16; remaining /= 16)
     {
-        signingStringStream << NEWLINE;
+        ++hexDigits;
     }
 
-    return signingStringStream.str();
+    return hexDigits + static_cast<int64_t>(strlen(CHUNK_SIGNATURE) + SIGNATURE_HEX_LENGTH + 2 * strlen(CHUNK_CRLF)) + dataLength;
 }
 
+static int64_t GetChunkedContentLength(int64_t decodedLength)
+{
+    int64_t fullChunks = decodedLength / STREAMING_CHUNK_SIZE;
+    int64_t remainder = decodedLength % STREAMING_CHUNK_SIZE;
+
+    return fullChunks * GetChunkFrameLength(STREAMING_CHUNK_SIZE) + (remainder > 0 ? GetChunkFrameLength(remainder) : 0) + GetChunkFrameLength(0);
+}
+
+/**
+ * Read side of an aws-chunked body. Each chunk is read from the original body, hashed and signed (chained from the
+ * previous chunk's signature, starting with the request signature) only when the http client asks for it.
+ * Besides reading, it supports the seeks http clients make: rewinding to the start (which restarts the signature chain),
+ * asking for the length by seeking to the end, and returning to the current position.
+ */
+class AwsChunkedSigningStreamBuf : public std::streambuf
+{
+public:
+    AwsChunkedSigningStreamBuf(const std::shared_ptr<Aws::IOStream>& body, int64_t decodedLength, const ByteBuffer& signingKey,
+                               const Aws::String& dateValue, const Aws::String& scope, const Aws::String& seedSignature) :
+        m_body(body),
+        m_encodedLength(GetChunkedContentLength(decodedLength)),
+        m_signingKey(signingKey),
+        m_dateValue(dateValue),
+        m_scope(scope),
+        m_seedSignature(seedSignature),
+        m_previousSignature(seedSignature),
+        m_frameStart(0),
+        m_finished(false),
+        m_atEnd(false)
+    {
+        m_body->clear();
+        m_body->seekg(0, m_body->beg);
+        setg(nullptr, nullptr, nullptr);
+    }
+
+protected:
+    int_type underflow() override
+    {
+        if (m_atEnd)
+        {
+            return traits_type::eof();
+        }
+
+        if (gptr() < egptr())
+        {
+            return traits_type::to_int_type(*gptr());
+        }
+
+        if (!FillNextChunk())
+        {
+            return traits_type::eof();
+        }
+
+        return traits_type::to_int_type(*gptr());
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+    {
+        switch (dir)
+        {
+            case std::ios_base::beg:
+                return seekpos(pos_type(off), which);
+            case std::ios_base::end:
+                return seekpos(pos_type(m_encodedLength + off), which);
+            default:
+                return seekpos(pos_type(GetPosition() + off), which);
+        }
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode) override
+    {
+        int64_t target = static_cast<int64_t>(pos);
+        if (target == GetPosition())
+        {
+            return pos;
+        }
+
+        if (target == 0)
+        {
+            Restart();
+            return pos;
+        }
+
+        int64_t frameEnd = m_frameStart + static_cast<int64_t>(m_frame.length());
+        if (target >= m_frameStart && target <= frameEnd && !m_frame.empty())
+        {
+            m_atEnd = false;
+            SetFramePosition(target - m_frameStart);
+            return pos;
+        }
+
+        if (target == m_encodedLength)
+        {
+            m_atEnd = true;
+            return pos;
+        }
+
+        //anywhere else would require re-signing from the start
+        return pos_type(off_type(-1));
+    }
+
+private:
+    int64_t GetPosition() const
+    {
+        if (m_atEnd)
+        {
+            return m_encodedLength;
+        }
+
+        return m_frameStart + (eback() ? static_cast<int64_t>(gptr() - eback()) : 0);
+    }
+
+    void SetFramePosition(int64_t offset)
+    {
+        char* frame = &m_frame[0];
+        setg(frame, frame + offset, frame + m_frame.length());
+    }
+
+    void Restart()
+    {
+        m_body->clear();
+        m_body->seekg(0, m_body->beg);
+        m_previousSignature = m_seedSignature;
+        m_frame.clear();
+        m_frameStart = 0;
+        m_finished = false;
+        m_atEnd = false;
+        setg(nullptr, nullptr, nullptr);
+    }
+
+    bool FillNextChunk()
+    {
+        if (m_finished)
+        {
+            return false;
+        }
+
+        m_frameStart += static_cast<int64_t>(m_frame.length());
+
+        m_chunkData.resize(static_cast<size_t>(STREAMING_CHUNK_SIZE));
+        m_body->read(&m_chunkData[0], STREAMING_CHUNK_SIZE);
+        m_chunkData.resize(static_cast<size_t>(m_body->gcount()));
+        m_finished = m_chunkData.empty();
+
+        auto chunkHash = m_hash.Calculate(m_chunkData);
+        if (!chunkHash.IsSuccess())
+        {
+            AWS_LOG_ERROR(v4LogTag, "Unable to hash (sha256) payload chunk");
+            return false;
+        }
+
+        m_stringToSign.clear();
+        m_stringToSign.append(AWS_HMAC_SHA256_PAYLOAD).append(NEWLINE).append(m_dateValue).append(NEWLINE).append(m_scope).append(NEWLINE)
+            .append(m_previousSignature).append(NEWLINE).append(EMPTY_STRING_SHA256).append(NEWLINE)
+            .append(HashingUtils::HexEncode(chunkHash.GetResult()));
+
+        auto signatureResult = m_HMAC.Calculate(ByteBuffer((unsigned char*)m_stringToSign.c_str(), m_stringToSign.length()), m_signingKey);
+        if (!signatureResult.IsSuccess())
+        {
+            AWS_LOG_ERROR(v4LogTag, "Unable to hmac (sha256) payload chunk");
+            return false;
+        }
+
+        m_previousSignature = HashingUtils::HexEncode(signatureResult.GetResult());
+
+        Aws::StringStream chunkLength;
+        chunkLength << std::hex << m_chunkData.length();
+
+        m_frame.clear();
+        m_frame.append(chunkLength.str()).append(CHUNK_SIGNATURE).append(m_previousSignature).append(CHUNK_CRLF)
+            .append(m_chunkData).append(CHUNK_CRLF);
+        SetFramePosition(0);
+
+        return true;
+    }
+
+    std::shared_ptr<Aws::IOStream> m_body;
+    int64_t m_encodedLength;
+    ByteBuffer m_signingKey;
+    Aws::String m_dateValue;
+    Aws::String m_scope;
+    Aws::String m_seedSignature;
+    Aws::String m_previousSignature;
+    Aws::String m_chunkData;
+    Aws::String m_stringToSign;
+    Aws::String m_frame;
+    int64_t m_frameStart;
+    bool m_finished;
+    bool m_atEnd;
+    Aws::Utils::Crypto::Sha256 m_hash;
+    Aws::Utils::Crypto::Sha256HMAC m_HMAC;
+};
+
+class AwsChunkedSigningStream : public Aws::IOStream
+{
+public:
+    AwsChunkedSigningStream(const std::shared_ptr<Aws::IOStream>& body, int64_t decodedLength, const ByteBuffer& signingKey,
+                            const Aws::String& dateValue, const Aws::String& scope, const Aws::String& seedSignature) :
+        Aws::IOStream(nullptr),
+        m_streamBuf(body, decodedLength, signingKey, dateValue, scope, seedSignature)
+    {
+        rdbuf(&m_streamBuf);
+    }
+
+private:
+    AwsChunkedSigningStreamBuf m_streamBuf;
+};
+
 AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider,
     const char* serviceName,
-    Region region) :
+    Region region,
+    PayloadSigningPolicy payloadSigningPolicy) :
     m_credentialsProvider(credentialsProvider),
     m_serviceName(serviceName),
     m_region(region),
+    m_payloadSigningPolicy(payloadSigningPolicy),
     m_hash(Aws::MakeUnique<Aws::Utils::Crypto::Sha256>(v4LogTag)),
     m_HMAC(Aws::MakeUnique<Aws::Utils::Crypto::Sha256HMAC>(v4LogTag))
 {
@@ -117,67 +374,121 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
     Aws::String dateHeaderValue = DateTime::CalculateGmtTimestampAsString(LONG_DATE_FORMAT_STR);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::String payloadHash(ComputePayloadHash(request));
-    if (payloadHash.empty())
+    int64_t decodedContentLength = 0;
+    bool streamPayload = false;
+    if (m_payloadSigningPolicy == PayloadSigningPolicy::STREAMING && request.GetContentBody())
     {
-        return false;
+        decodedContentLength = GetStreamLength(*request.GetContentBody());
+        streamPayload = decodedContentLength > 0;
     }
 
-    request.SetHeaderValue("x-amz-content-sha256", payloadHash);
-
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-
-    for (const auto& header : request.GetHeaders())
+    Aws::String payloadHash;
+    if (streamPayload)
+    {
+        payloadHash = STREAMING_PAYLOAD;
+
+        //these are signed, so they have to be in place before the canonical request is built.
+        Aws::StringStream lengthStream;
+        lengthStream << decodedContentLength;
+        request.SetHeaderValue(X_AMZ_DECODED_CONTENT_LENGTH, lengthStream.str());
+        lengthStream.str("");
+        lengthStream << GetChunkedContentLength(decodedContentLength);
+        request.SetHeaderValue(CONTENT_LENGTH_HEADER, lengthStream.str());
+
+        Aws::String contentEncoding(AWS_CHUNKED);
+        if (request.HasHeader(CONTENT_ENCODING_HEADER))
+        {
+            contentEncoding.append(",").append(request.GetHeaderValue(CONTENT_ENCODING_HEADER));
+        }
+        request.SetHeaderValue(CONTENT_ENCODING_HEADER, contentEncoding);
+    }
+    else if (m_payloadSigningPolicy == PayloadSigningPolicy::UNSIGNED_OVER_TLS && request.GetUri().GetScheme() == Scheme::HTTPS)
+    {
+        payloadHash = UNSIGNED_PAYLOAD;
+    }
+    else if (request.HasHeader(X_AMZ_CONTENT_SHA256) && request.GetHeaderValue(X_AMZ_CONTENT_SHA256) != STREAMING_PAYLOAD)
     {
-        headersStream << header.first << ":" << header.second << NEWLINE;
-        signedHeadersStream << header.first << ";";
+        //the caller (or an earlier attempt at this same request) already hashed the body, don't read it again.
+        payloadHash = request.GetHeaderValue(X_AMZ_CONTENT_SHA256);
+    }
+    else
+    {
+        payloadHash = ComputePayloadHash(request);
+        if (payloadHash.empty())
+        {
+            return false;
+        }
     }
 
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
+    request.SetHeaderValue(X_AMZ_CONTENT_SHA256, payloadHash);
 
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
-    signedHeadersValue.erase(signedHeadersValue.length() - 1);
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
+    //the canonical request is written straight into one buffer: method, path, query, then the headers.
+    Aws::String buffer;
+    buffer.reserve(CANONICAL_REQUEST_BUFFER_SIZE);
+    Aws::String signedHeadersValue;
+    signedHeadersValue.reserve(SIGNED_HEADERS_BUFFER_SIZE);
 
-    //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request);
+    AppendCanonicalRequestPrefix(buffer, request);
+    request.ForEachHeader([&buffer, &signedHeadersValue](const Aws::String& name, const Aws::String& value)
+    {
+        buffer.append(name).append(":").append(value).append(NEWLINE);
+        if (!signedHeadersValue.empty())
+        {
+            signedHeadersValue.append(";");
+        }
+        signedHeadersValue.append(name);
+    });
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
 
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(payloadHash);
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
+    buffer.append(NEWLINE);
+    buffer.append(signedHeadersValue);
+    buffer.append(NEWLINE);
+    buffer.append(payloadHash);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << buffer);
 
     //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
+    auto hashResult = m_hash->Calculate(buffer);
     if (!hashResult.IsSuccess())
     {
-        AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string \"" << canonicalRequestString << "\"");
+        AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string \"" << buffer << "\"");
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    Aws::String cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
     Aws::String simpleDate = DateTime::CalculateGmtTimestampAsString(SIMPLE_DATE_FORMAT_STR);
-    Aws::String regionName = RegionMapper::GetRegionName(m_region);    
+    Aws::String regionName = RegionMapper::GetRegionName(m_region);
 
-    Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, regionName, cannonicalRequestHash);
-    auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate, regionName);
+    //the canonical request has been hashed, so its buffer is reused for the string to sign.
+    buffer.clear();
+    AppendStringToSign(buffer, dateHeaderValue, simpleDate, regionName, hashResult.GetResult());
+    ByteBuffer signingKey = GetSigningKey(credentials, simpleDate, regionName);
+    if (signingKey.GetLength() == 0)
+    {
+        return false;
+    }
 
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << regionName << "/" << m_serviceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << finalSignature;
+    auto finalSignature = GenerateSignature(buffer, signingKey);
+    if (finalSignature.empty())
+    {
+        return false;
+    }
 
-    auto awsAuthString = ss.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing request with: " << awsAuthString);
-    request.SetAwsAuthorization(awsAuthString);
+    if (streamPayload)
+    {
+        //the request signature seeds the chunk signature chain; chunks are signed as the body is read.
+        Aws::String scope(simpleDate);
+        scope.append("/").append(regionName).append("/").append(m_serviceName).append("/").append(AWS4_REQUEST);
+        request.AddContentBody(Aws::MakeShared<AwsChunkedSigningStream>(v4LogTag, request.GetContentBody(), decodedContentLength,
+            signingKey, dateHeaderValue, scope, finalSignature));
+    }
+
+    buffer.clear();
+    buffer.append(AWS_HMAC_SHA256).append(" ").append(CREDENTIAL).append(EQ).append(credentials.GetAWSAccessKeyId())
+        .append("/").append(simpleDate).append("/").append(regionName).append("/").append(m_serviceName).append("/")
+        .append(AWS4_REQUEST).append(", ").append(SIGNED_HEADERS).append(EQ).append(signedHeadersValue).append(", ")
+        .append(SIGNATURE).append(EQ).append(finalSignature);
+
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing request with: " << buffer);
+    request.SetAwsAuthorization(buffer);
 
     return true;
 }
@@ -229,29 +540,27 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long
     request.AddQueryStringParameter(X_AMZ_CREDENTIAL, ss.str());
     ss.str("");
 
-    //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request);
-
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(UNSIGNED_PAYLOAD);
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
+    Aws::String buffer;
+    buffer.reserve(CANONICAL_REQUEST_BUFFER_SIZE);
+    AppendCanonicalRequestPrefix(buffer, request);
+    buffer.append(canonicalHeadersString);
+    buffer.append(NEWLINE);
+    buffer.append(signedHeadersValue);
+    buffer.append(NEWLINE);
+    buffer.append(UNSIGNED_PAYLOAD);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << buffer);
 
     //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
+    auto hashResult = m_hash->Calculate(buffer);
     if (!hashResult.IsSuccess())
     {
-        AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string \"" << canonicalRequestString << "\"");
+        AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string \"" << buffer << "\"");
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    auto cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);   
-
-    auto stringToSign = GenerateStringToSign(dateQueryValue, simpleDate, regionName, cannonicalRequestHash);
+    Aws::String stringToSign;
+    stringToSign.reserve(CANONICAL_REQUEST_BUFFER_SIZE);
+    AppendStringToSign(stringToSign, dateQueryValue, simpleDate, regionName, hashResult.GetResult());
 
     auto finalSigningHash = GenerateSignature(credentials, stringToSign, simpleDate, regionName);
     if (finalSigningHash.empty())
@@ -266,14 +575,69 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long
 }
 
 Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials, const Aws::String& stringToSign, const Aws::String& simpleDate, const Aws::String& regionName) const
+{
+    ByteBuffer signingKey = GetSigningKey(credentials, simpleDate, regionName);
+    if (signingKey.GetLength() == 0)
+    {
+        return "";
+    }
+
+    return GenerateSignature(stringToSign, signingKey);
+}
+
+Aws::String AWSAuthV4Signer::GenerateSignature(const Aws::String& stringToSign, const ByteBuffer& signingKey) const
 {
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Final String to sign: " << stringToSign);
 
-    Aws::StringStream ss;
+    auto hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), signingKey);
+    if (!hashResult.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) final string \"" << stringToSign << "\"");
+        return "";
+    }
+
+    //now we finally sign our request string with our hex encoded derived hash.
+    const auto& finalSigningDigest = hashResult.GetResult();
 
+    auto finalSigningHash = HashingUtils::HexEncode(finalSigningDigest);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Final computed signing hash: " << finalSigningHash);
+
+    return finalSigningHash;
+}
+
+ByteBuffer AWSAuthV4Signer::GetSigningKey(const AWSCredentials& credentials, const Aws::String& simpleDate, const Aws::String& regionName) const
+{
+    {
+        std::lock_guard<std::mutex> locker(m_signingKeyLock);
+        if (m_signingKey.GetLength() > 0 && m_signingKeyDate == simpleDate &&
+            m_signingKeyAccessKeyId == credentials.GetAWSAccessKeyId() && m_signingKeySecretKey == credentials.GetAWSSecretKey())
+        {
+            return m_signingKey;
+        }
+    }
+
+    //derive outside the lock; if several threads miss at once they all compute the same key.
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Deriving signing key for date " << simpleDate);
+    ByteBuffer signingKey = ComputeSigningKey(credentials.GetAWSSecretKey(), simpleDate, regionName);
+    if (signingKey.GetLength() == 0)
+    {
+        return signingKey;
+    }
+
+    std::lock_guard<std::mutex> locker(m_signingKeyLock);
+    m_signingKeyAccessKeyId = credentials.GetAWSAccessKeyId();
+    m_signingKeySecretKey = credentials.GetAWSSecretKey();
+    m_signingKeyDate = simpleDate;
+    m_signingKey = signingKey;
+
+    return signingKey;
+}
+
+ByteBuffer AWSAuthV4Signer::ComputeSigningKey(const Aws::String& secretKey, const Aws::String& simpleDate, const Aws::String& regionName) const
+{
     //now we do the complicated part of deriving a signing key.
     Aws::String signingKey(SIGNING_KEY);
-    signingKey.append(credentials.GetAWSSecretKey());
+    signingKey.append(secretKey);
 
     //we use digest only for the derivation process.
     auto hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)simpleDate.c_str(), simpleDate.length()),
@@ -281,7 +645,7 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) date string \"" << simpleDate << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kDate = hashResult.GetResult();
@@ -289,7 +653,7 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) region string \"" << regionName << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kRegion = hashResult.GetResult();
@@ -297,7 +661,7 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) service string \"" << m_serviceName << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kService = hashResult.GetResult();
@@ -305,24 +669,10 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) request string \"" << AWS4_REQUEST << "\"");
-        return "";
-    }
-
-    auto kSigning = hashResult.GetResult();
-    hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), kSigning);
-    if (!hashResult.IsSuccess())
-    {
-        AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) final string \"" << stringToSign << "\"");
-        return "";
+        return ByteBuffer();
     }
 
-    //now we finally sign our request string with our hex encoded derived hash.
-    auto finalSigningDigest = hashResult.GetResult();
-
-    auto finalSigningHash = HashingUtils::HexEncode(finalSigningDigest);
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Final computed signing hash: " << finalSigningHash);
-
-    return finalSigningHash;
+    return hashResult.GetResult();
 }
 
 Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request) const
@@ -336,20 +686,17 @@ Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request)
         return "";
     }
 
-    auto sha256Digest = hashResult.GetResult();
+    const auto& sha256Digest = hashResult.GetResult();
 
     Aws::String payloadHash(HashingUtils::HexEncode(sha256Digest));
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Calculated sha256 " << payloadHash << " for payload.");
     return std::move(payloadHash);
 }
 
-Aws::String AWSAuthV4Signer::GenerateStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate, const Aws::String& regionName, const Aws::String& canonicalRequestHash) const
+void AWSAuthV4Signer::AppendStringToSign(Aws::String& out, const Aws::String& dateValue, const Aws::String& simpleDate, const Aws::String& regionName, const ByteBuffer& canonicalRequestHash) const
 {
     //generate the actual string we will use in signing the final request.
-    Aws::StringStream ss;
-
-    ss << AWS_HMAC_SHA256 << NEWLINE << dateValue << NEWLINE << simpleDate << "/" << regionName << "/"
-        << m_serviceName << "/" << AWS4_REQUEST << NEWLINE << canonicalRequestHash;
-
-    return ss.str();
+    out.append(AWS_HMAC_SHA256).append(NEWLINE).append(dateValue).append(NEWLINE).append(simpleDate).append("/")
+        .append(regionName).append("/").append(m_serviceName).append("/").append(AWS4_REQUEST).append(NEWLINE);
+    AppendHexEncoded(out, canonicalRequestHash);
 }
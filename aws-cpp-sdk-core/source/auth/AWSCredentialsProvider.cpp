@@ -22,10 +22,13 @@
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/internal/EC2MetadataClient.h>
 #include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/threading/ThreadIdHash.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <chrono>
 #include <fstream>
+#include <functional>
 #include <string.h>
 
 #ifdef _WIN32
@@ -78,6 +81,130 @@ bool AWSCredentialsProvider::IsTimeToRefresh(long reloadFrequency)
 }
 
 
+static const char* refreshingLogTag = "RefreshingAWSCredentialsProvider";
+
+
+RefreshingAWSCredentialsProvider::RefreshingAWSCredentialsProvider(long refreshRateMs) :
+        m_credentials(nullptr),
+        m_epoch(0),
+        m_stopRefreshing(false),
+        m_loadFrequencyMs(refreshRateMs)
+{
+    for (auto& readers : m_readers)
+    {
+        for (auto& reader : readers)
+        {
+            reader.count = 0;
+        }
+    }
+}
+
+
+RefreshingAWSCredentialsProvider::~RefreshingAWSCredentialsProvider()
+{
+    StopRefreshing();
+    Aws::Delete(m_credentials.load());
+}
+
+
+AWSCredentials RefreshingAWSCredentialsProvider::GetAWSCredentials()
+{
+    if (m_credentials == nullptr)
+    {
+        std::lock_guard<std::mutex> locker(m_reloadMutex);
+        if (m_credentials == nullptr)
+        {
+            AWS_LOG_DEBUG(refreshingLogTag, "Loading credentials for the first time.");
+            AWSCredentials credentials("", "");
+            LoadCredentials(credentials);
+            Publish(credentials);
+            if (!m_stopRefreshing)
+            {
+                m_refreshThread = std::thread(std::bind(&RefreshingAWSCredentialsProvider::RefreshLoop, this));
+            }
+        }
+    }
+
+    //once we've announced ourselves the snapshot we load can't be freed until we are done copying it.
+    ReaderCount& reader = m_readers[m_epoch & 1][GetReaderStripe()];
+    ++reader.count;
+    AWSCredentials credentials(*m_credentials);
+    --reader.count;
+
+    return credentials;
+}
+
+
+void RefreshingAWSCredentialsProvider::StopRefreshing()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_reloadMutex);
+        m_stopRefreshing = true;
+    }
+    m_refreshSignal.notify_all();
+
+    if (m_refreshThread.joinable())
+    {
+        m_refreshThread.join();
+    }
+}
+
+
+void RefreshingAWSCredentialsProvider::Publish(const AWSCredentials& credentials)
+{
+    AWSCredentials* previous = m_credentials.exchange(Aws::New<AWSCredentials>(refreshingLogTag, credentials));
+    if (previous == nullptr)
+    {
+        return;
+    }
+
+    //a reader may have picked its counter set from an epoch before the last publish, so flip twice and wait out
+    //both sets. Anyone announcing after a set drains loads the new snapshot.
+    for (int flip = 0; flip < 2; ++flip)
+    {
+        unsigned drainingEpoch = m_epoch++;
+        for (auto& reader : m_readers[drainingEpoch & 1])
+        {
+            while (reader.count != 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    Aws::Delete(previous);
+}
+
+
+void RefreshingAWSCredentialsProvider::RefreshLoop()
+{
+    using namespace std::chrono;
+    //reload a tenth of the interval early so the snapshot is never older than refreshRateMs.
+    milliseconds refreshInterval(std::max(1L, m_loadFrequencyMs - m_loadFrequencyMs / 10));
+
+    std::unique_lock<std::mutex> locker(m_reloadMutex);
+    while (!m_refreshSignal.wait_for(locker, refreshInterval, [this]() { return m_stopRefreshing; }))
+    {
+        AWS_LOG_DEBUG(refreshingLogTag, "Refreshing credentials in the background.");
+        AWSCredentials credentials("", "");
+        if (LoadCredentials(credentials))
+        {
+            Publish(credentials);
+        }
+        else
+        {
+            AWS_LOG_WARN(refreshingLogTag, "Failed to refresh credentials, keeping the previous ones until the next attempt.");
+        }
+    }
+}
+
+
+size_t RefreshingAWSCredentialsProvider::GetReaderStripe() const
+{
+    return static_cast<size_t>(Aws::Utils::Threading::HashCurrentThreadId() % READER_STRIPES);
+}
+
+
 static const char* environmentLogTag = "EnvironmentAWSCredentialsProvider";
 
 
@@ -163,9 +290,8 @@ static const char* profileLogTag = "ProfileConfigFileAWSCredentialsProvider";
 
 
 ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider(long refreshRateMs) :
-        m_fileName(GetProfileFilename()),
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        RefreshingAWSCredentialsProvider(refreshRateMs),
+        m_fileName(GetProfileFilename())
 {
     char* profileFromVar = std::getenv(AWS_PROFILE_ENVIRONMENT_VARIABLE);
     if (profileFromVar)
@@ -182,53 +308,48 @@ ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider
 }
 
 ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider(const char* profile, long refreshRateMs) :
+        RefreshingAWSCredentialsProvider(refreshRateMs),
         m_fileName(GetProfileFilename()),
-        m_profileToUse(profile),
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        m_profileToUse(profile)
 {
     AWS_LOG_INFO(profileLogTag, "Setting provider to read credentials from %s, for use with profile %s.", m_fileName.c_str(), m_profileToUse.c_str());
 }
 
-AWSCredentials ProfileConfigFileAWSCredentialsProvider::GetAWSCredentials()
+ProfileConfigFileAWSCredentialsProvider::~ProfileConfigFileAWSCredentialsProvider()
 {
-    RefreshIfExpired();
-    assert(m_credentials != nullptr);
-    return *m_credentials;
+    StopRefreshing();
 }
 
 
-void ProfileConfigFileAWSCredentialsProvider::RefreshIfExpired()
+bool ProfileConfigFileAWSCredentialsProvider::LoadCredentials(AWSCredentials& credentials)
 {
-    std::lock_guard<std::mutex> locker(m_reloadMutex);
-    if (!m_credentials || IsTimeToRefresh(m_loadFrequencyMs))
-    {
-        AWS_LOG_DEBUG(profileLogTag, "Refreshing credentials.");
+    AWS_LOG_DEBUG(profileLogTag, "Refreshing credentials.");
 
-        Aws::Map<Aws::String, Aws::String> propertyValueMap = ParseProfileConfigFile(m_fileName);
+    Aws::Map<Aws::String, Aws::String> propertyValueMap = ParseProfileConfigFile(m_fileName);
 
-        Aws::String accessKey, secretKey, sessionToken;
-        auto accessKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_ACCESS_KEY_ID);
-        auto secretKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SECRET_ACCESS_KEY);
-        auto sessionTokenIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SESSION_TOKEN);
+    Aws::String accessKey, secretKey, sessionToken;
+    auto accessKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_ACCESS_KEY_ID);
+    auto secretKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SECRET_ACCESS_KEY);
+    auto sessionTokenIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SESSION_TOKEN);
 
-        if (accessKeyIter != propertyValueMap.end())
-            accessKey = accessKeyIter->second;
-        else
-        AWS_LOG_INFO(profileLogTag, "Access key for profile not found.");
+    if (accessKeyIter != propertyValueMap.end())
+        accessKey = accessKeyIter->second;
+    else
+    AWS_LOG_INFO(profileLogTag, "Access key for profile not found.");
 
-        if (secretKeyIter != propertyValueMap.end())
-            secretKey = secretKeyIter->second;
-        else
-        AWS_LOG_INFO(profileLogTag, "Secret key for profile not found.");
+    if (secretKeyIter != propertyValueMap.end())
+        secretKey = secretKeyIter->second;
+    else
+    AWS_LOG_INFO(profileLogTag, "Secret key for profile not found.");
 
-        if (sessionTokenIter != propertyValueMap.end())
-            sessionToken = sessionTokenIter->second;
-        else
-        AWS_LOG_INFO(profileLogTag, "Optional session token for profile not found.");
+    if (sessionTokenIter != propertyValueMap.end())
+        sessionToken = sessionTokenIter->second;
+    else
+    AWS_LOG_INFO(profileLogTag, "Optional session token for profile not found.");
 
-        m_credentials = Aws::MakeShared<AWSCredentials>(profileLogTag, accessKey, secretKey, sessionToken);
-    }
+    credentials = AWSCredentials(accessKey, secretKey, sessionToken);
+
+    return true;
 }
 
 
@@ -297,8 +418,7 @@ static const char* instanceLogTag = "InstanceProfileCredentialsProvider";
 
 
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refreshRateMs) :
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        RefreshingAWSCredentialsProvider(refreshRateMs)
 {
     AWS_LOG_INFO(instanceLogTag, "Creating Instance with default EC2MetadataClient and refresh rate %d.", refreshRateMs);
 
@@ -308,60 +428,54 @@ InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refr
 
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(std::shared_ptr<EC2MetadataClient> mdClient,
                                                                        long refreshRateMs) :
-        m_metadataClient(mdClient),
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        RefreshingAWSCredentialsProvider(refreshRateMs),
+        m_metadataClient(mdClient)
 {
     AWS_LOG_INFO(instanceLogTag, "Creating Instance with injected EC2MetadataClient and refresh rate %d.", refreshRateMs);
 }
 
 
-AWSCredentials InstanceProfileCredentialsProvider::GetAWSCredentials()
+InstanceProfileCredentialsProvider::~InstanceProfileCredentialsProvider()
 {
-    RefreshIfExpired();
-    return *m_credentials;
+    StopRefreshing();
 }
 
 
-void InstanceProfileCredentialsProvider::RefreshIfExpired()
+bool InstanceProfileCredentialsProvider::LoadCredentials(AWSCredentials& credentials)
 {
-    AWS_LOG_DEBUG(instanceLogTag, "Checking if latest credential pull has expired.");
+    AWS_LOG_INFO(instanceLogTag, "Pulling credentials from EC2 Metadata Service.");
+    Aws::String mdRet = m_metadataClient->GetDefaultCredentials();
 
-    std::lock_guard<std::mutex> locker(m_reloadMutex);
-    if (!m_credentials || IsTimeToRefresh(m_loadFrequencyMs))
+    if (mdRet.empty())
     {
-        AWS_LOG_INFO(instanceLogTag, "Credentials have expired attempting to repull from EC2 Metadata Service.");
-        Aws::String mdRet = m_metadataClient->GetDefaultCredentials();
+        AWS_LOG_WARN(instanceLogTag, "Not able to pull credentials from the metadata service.");
+        return false;
+    }
 
-        if (mdRet.empty())
-        {
-            AWS_LOG_WARN(instanceLogTag, "Not able to pull credentials from the metadata service, returning empty credentials.");
-            m_credentials = Aws::MakeShared<AWSCredentials>(instanceLogTag, "", "");
-            return;
-        }
+    const char* accessKeyId = "AccessKeyId";
+    const char* secretAccessKey = "SecretAccessKey";
+    Aws::String accessKey, secretKey, token;
 
-        const char* accessKeyId = "AccessKeyId";
-        const char* secretAccessKey = "SecretAccessKey";
-        Aws::String accessKey, secretKey, token;
+    using namespace Aws::Utils::Json;
+    JsonValue jsonValue(mdRet);
 
-        using namespace Aws::Utils::Json;
-        JsonValue jsonValue(mdRet);
+    if (jsonValue.WasParseSuccessful())
+    {
+        accessKey = jsonValue.GetString(accessKeyId);
+        AWS_LOG_INFO(instanceLogTag, "Successfully pulled credentials from metadata service with access key %s", accessKey.c_str());
 
-        if (jsonValue.WasParseSuccessful())
-        {
-            accessKey = jsonValue.GetString(accessKeyId);
-            AWS_LOG_INFO(instanceLogTag, "Successfully pulled credentials from metadata service with access key %s", accessKey.c_str());
+        secretKey = jsonValue.GetString(secretAccessKey);
+        token = jsonValue.GetString("Token");
+    }
+    else
+    {
+        AWS_LOG_ERROR(instanceLogTag, "Failed to parse output from Ec2MetadataService with error %s.", jsonValue.GetErrorMessage().c_str());
+        return false;
+    }
 
-            secretKey = jsonValue.GetString(secretAccessKey);
-            token = jsonValue.GetString("Token");
-        }
-        else
-        {
-            AWS_LOG_ERROR(instanceLogTag, "Failed to parse output from Ec2MetadataService with error %s.", jsonValue.GetErrorMessage().c_str());
-        }
+    credentials = AWSCredentials(accessKey, secretKey, token);
 
-        m_credentials = Aws::MakeShared<AWSCredentials>(instanceLogTag, accessKey, secretKey, token);
-    }
+    return true;
 }
 
 
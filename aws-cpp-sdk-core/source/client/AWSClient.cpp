@@ -21,6 +21,7 @@
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/client/CoreErrors.h>
 #include <aws/core/client/RetryStrategy.h>
+#include <aws/core/client/RequestMetrics.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/HttpResponse.h>
@@ -31,6 +32,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/threading/Executor.h>
 
 #include <thread>
 
@@ -45,6 +47,7 @@ using namespace Aws::Utils::Xml;
 static const int SUCCESS_RESPONSE_MIN = 200;
 static const int SUCCESS_RESPONSE_MAX = 299;
 static const char* LOG_TAG = "AWSClient";
+static const char* X_AMZ_CONTENT_SHA256_HEADER = "x-amz-content-sha256";
 
 AWSClient::AWSClient(const std::shared_ptr<Aws::Http::HttpClientFactory const>& clientFactory,
     const Aws::Client::ClientConfiguration& configuration,
@@ -55,8 +58,10 @@ AWSClient::AWSClient(const std::shared_ptr<Aws::Http::HttpClientFactory const>&
     m_signer(signer),
     m_errorMarshaller(errorMarshaller),
     m_retryStrategy(configuration.retryStrategy),
+    m_metricsCollector(configuration.metricsCollector),
     m_writeRateLimiter(configuration.writeRateLimiter),
     m_readRateLimiter(configuration.readRateLimiter),
+    m_executor(configuration.executor),
     m_userAgent(configuration.userAgent),
     m_hostHeaderOverride(hostHeaderOverride)
 {
@@ -76,99 +81,329 @@ void AWSClient::EnableRequestProcessing()
     m_httpClient->EnableRequestProcessing();
 }
 
+static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& response)
+{
+    if (!response) return true;
+
+    int responseCode = static_cast<int>(response->GetResponseCode());
+    return response == nullptr || responseCode < SUCCESS_RESPONSE_MIN || responseCode > SUCCESS_RESPONSE_MAX;
+
+}
+
+AWSClient::SerializedRequest::SerializedRequest(const Aws::AmazonWebServiceRequest* request, const char* requestName) :
+    m_request(request)
+{
+    if (request)
+    {
+        requestName = request->GetServiceRequestName();
+    }
+    if (requestName)
+    {
+        m_metrics.operationName = requestName;
+    }
+
+    if (request)
+    {
+        auto serializeStart = std::chrono::steady_clock::now();
+        m_body = request->GetBody();
+        m_metrics.AddPhase(RequestPhase::SERIALIZE, std::chrono::steady_clock::now() - serializeStart);
+    }
+}
+
 HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
     HttpMethod method) const
 {
+    SerializedRequest serializedRequest(&request);
+    HttpResponseOutcome outcome = AttemptExhaustively(uri, method, serializedRequest);
+    ReportRequestMetrics(serializedRequest.m_metrics);
+    return outcome;
+}
+
+HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri, HttpMethod method, const char* requestName) const
+{
+    SerializedRequest serializedRequest(nullptr, requestName);
+    HttpResponseOutcome outcome = AttemptExhaustively(uri, method, serializedRequest);
+    ReportRequestMetrics(serializedRequest.m_metrics);
+    return outcome;
+}
+
+HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    HttpMethod method,
+    RequestMetrics& metrics) const
+{
+    SerializedRequest serializedRequest(&request);
+    HttpResponseOutcome outcome = AttemptExhaustively(uri, method, serializedRequest);
+    metrics = serializedRequest.m_metrics;
+    return outcome;
+}
+
+HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri, HttpMethod method, RequestMetrics& metrics,
+    const char* requestName) const
+{
+    SerializedRequest serializedRequest(nullptr, requestName);
+    HttpResponseOutcome outcome = AttemptExhaustively(uri, method, serializedRequest);
+    metrics = serializedRequest.m_metrics;
+    return outcome;
+}
+
+void AWSClient::ReportRequestMetrics(RequestMetrics& metrics) const
+{
+    if (m_metricsCollector)
+    {
+        metrics.phaseMicroseconds[static_cast<size_t>(RequestPhase::TOTAL)] = -1;
+        metrics.AddPhase(RequestPhase::TOTAL, std::chrono::steady_clock::now() - metrics.startTime);
+        m_metricsCollector->OnRequestCompleted(metrics);
+    }
+}
+
+static void StartRequestMetrics(RequestMetrics& metrics, const char* serviceName)
+{
+    metrics.serviceName = serviceName;
+}
+
+HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri, HttpMethod method, SerializedRequest& serializedRequest) const
+{
+    RequestMetrics& metrics = serializedRequest.m_metrics;
+    StartRequestMetrics(metrics, m_signer->GetServiceName());
+
     for (long retries = 0;; retries++)
     {
-        HttpResponseOutcome outcome = AttemptOneRequest(uri, request, method);
-        if (outcome.IsSuccess() || !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
+        std::shared_ptr<HttpRequest> httpRequest(CreateSignedHttpRequest(uri, method, serializedRequest));
+        HttpResponseOutcome outcome = httpRequest ? AttemptOneRequest(httpRequest) : HttpResponseOutcome();
+        ++metrics.attempts;
+        if (httpRequest)
         {
-            AWS_LOG_TRACE(LOG_TAG, "Request was either successful, or we are now out of retries.");
+            metrics.AddTransferTimings(httpRequest->GetTransferTimings());
+        }
+
+        if (outcome.IsSuccess())
+        {
+            metrics.succeeded = true;
+            m_retryStrategy->OnRequestSucceeded(retries, serializedRequest.m_lastRetriedError);
+            AWS_LOG_TRACE(LOG_TAG, "Request was successful.");
             return outcome;
         }
+        //checked first, so that a cancelled request doesn't take anything out of a shared retry budget.
         else if(!m_httpClient->IsRequestProcessingEnabled())
         {
             AWS_LOG_TRACE(LOG_TAG, "Request was cancelled externally.");
             return outcome;
         }
+        else if (!m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
+        {
+            AWS_LOG_TRACE(LOG_TAG, "Request failed and we are now out of retries.");
+            return outcome;
+        }
         else
         {
+            serializedRequest.m_lastRetriedError = outcome.GetError();
             long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
-            AWS_LOG_WARN(LOG_TAG, "Request failed, now waiting %d ms before attempting again.", sleepMillis);
+            AWS_LOG_WARN(LOG_TAG, "Request failed, now waiting %ld ms before attempting again.", sleepMillis);
+            auto sleepStart = std::chrono::steady_clock::now();
             m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            metrics.AddPhase(RequestPhase::RETRY_SLEEP, std::chrono::steady_clock::now() - sleepStart);
         }
     }
 }
 
-HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri, HttpMethod method) const
+void AWSClient::AttemptExhaustivelyAsync(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    HttpMethod method,
+    const HttpResponseOutcomeHandler& handler) const
 {
-    for (long retries = 0;; retries++)
+    StartAsync(uri, method, &request, nullptr, [this, handler](HttpResponseOutcome& outcome, RequestMetrics& metrics)
     {
-        HttpResponseOutcome outcome = AttemptOneRequest(uri, method);
-        if (outcome.IsSuccess() || !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
-        {
-            return outcome;
-        }
-        else
-        {
-            long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
-            m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
-        }
-    }
+        ReportRequestMetrics(metrics);
+        handler(outcome);
+    });
 }
 
-static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& response)
+void AWSClient::AttemptExhaustivelyAsync(const Aws::String& uri, HttpMethod method, const HttpResponseOutcomeHandler& handler,
+    const char* requestName) const
 {
-    if (!response) return true;
+    StartAsync(uri, method, nullptr, requestName, [this, handler](HttpResponseOutcome& outcome, RequestMetrics& metrics)
+    {
+        ReportRequestMetrics(metrics);
+        handler(outcome);
+    });
+}
 
-    int responseCode = static_cast<int>(response->GetResponseCode());
-    return response == nullptr || responseCode < SUCCESS_RESPONSE_MIN || responseCode > SUCCESS_RESPONSE_MAX;
+void AWSClient::AttemptExhaustivelyAsync(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    HttpMethod method,
+    const HttpResponseMetricsHandler& handler) const
+{
+    StartAsync(uri, method, &request, nullptr, handler);
+}
 
+void AWSClient::AttemptExhaustivelyAsync(const Aws::String& uri, HttpMethod method, const HttpResponseMetricsHandler& handler,
+    const char* requestName) const
+{
+    StartAsync(uri, method, nullptr, requestName, handler);
 }
 
+void AWSClient::RunOnExecutor(const std::function<void()>& task) const
+{
+    //a call already under way has to reach its handler, so a task the executor refuses runs here instead.
+    if (!m_executor->Submit(task))
+    {
+        task();
+    }
+}
 
-HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    HttpMethod method) const
+void AWSClient::StartAsync(const Aws::String& uri, HttpMethod method, const Aws::AmazonWebServiceRequest* request,
+    const char* requestName, const HttpResponseMetricsHandler& handler) const
 {
-    std::shared_ptr<HttpRequest> httpRequest(m_clientFactory->CreateHttpRequest(uri, method, request.GetResponseStreamFactory()));
-    BuildHttpRequest(request, httpRequest);
+    //serializing and signing can take a while (and may fetch credentials), so even the first attempt is not made on the caller's thread.
+    RunOnExecutor([this, uri, method, request, requestName, handler]()
+    {
+        AttemptAsync(uri, method, Aws::MakeShared<SerializedRequest>(LOG_TAG, request, requestName), handler, 0, std::chrono::milliseconds(0));
+    });
+}
 
-    if (!m_signer->SignRequest(*httpRequest))
+void AWSClient::AttemptAsync(const Aws::String& uri,
+    HttpMethod method,
+    const std::shared_ptr<SerializedRequest>& serializedRequest,
+    const HttpResponseMetricsHandler& handler,
+    long retries,
+    std::chrono::milliseconds startDelay) const
+{
+    RequestMetrics& metrics = serializedRequest->m_metrics;
+    if (retries == 0)
     {
-        AWS_LOG_ERROR(LOG_TAG, "Request signing failed. Returning error.");
-        return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
+        StartRequestMetrics(metrics, m_signer->GetServiceName());
     }
 
-    AWS_LOG_DEBUG(LOG_TAG, "Request Successfully signed");
-    std::shared_ptr<HttpResponse> httpResponse(
-        m_httpClient->MakeRequest(*httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
-
-    if (DoesResponseGenerateError(httpResponse))
+    std::shared_ptr<HttpRequest> httpRequest(CreateSignedHttpRequest(uri, method, *serializedRequest));
+    if (!httpRequest)
     {
-        AWS_LOG_DEBUG(LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
-        return HttpResponseOutcome(BuildAWSError(httpResponse));
+        ++metrics.attempts;
+        HttpResponseOutcome outcome;
+        handler(outcome, metrics);
+        return;
     }
 
-    AWS_LOG_DEBUG(LOG_TAG, "Request returned successful response.");
+    std::thread::id attemptThread = std::this_thread::get_id();
+    m_httpClient->MakeRequestAsync(httpRequest, [=](const std::shared_ptr<HttpResponse>& httpResponse)
+    {
+        //blocking http clients call back on the thread that made the attempt. Anything else is an event loop thread, which
+        //must not be held up parsing errors, signing the next attempt or running the caller's handler.
+        if (std::this_thread::get_id() == attemptThread)
+        {
+            HandleAsyncResponse(uri, method, serializedRequest, httpRequest, httpResponse, handler, retries);
+        }
+        else
+        {
+            RunOnExecutor([=]()
+            {
+                HandleAsyncResponse(uri, method, serializedRequest, httpRequest, httpResponse, handler, retries);
+            });
+        }
+    }, m_readRateLimiter.get(), m_writeRateLimiter.get(), startDelay);
+}
 
-    return HttpResponseOutcome(httpResponse);
+void AWSClient::HandleAsyncResponse(const Aws::String& uri,
+    HttpMethod method,
+    const std::shared_ptr<SerializedRequest>& serializedRequest,
+    const std::shared_ptr<HttpRequest>& httpRequest,
+    const std::shared_ptr<HttpResponse>& httpResponse,
+    const HttpResponseMetricsHandler& handler,
+    long retries) const
+{
+    RequestMetrics& metrics = serializedRequest->m_metrics;
+    ++metrics.attempts;
+    metrics.AddTransferTimings(httpRequest->GetTransferTimings());
+
+    if (!DoesResponseGenerateError(httpResponse))
+    {
+        AWS_LOG_DEBUG(LOG_TAG, "Request returned successful response.");
+        m_retryStrategy->OnRequestSucceeded(retries, serializedRequest->m_lastRetriedError);
+        metrics.succeeded = true;
+        HttpResponseOutcome outcome(httpResponse);
+        handler(outcome, metrics);
+        return;
+    }
+
+    AWS_LOG_DEBUG(LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
+    HttpResponseOutcome outcome(BuildAWSError(httpResponse));
+    if (!m_httpClient->IsRequestProcessingEnabled())
+    {
+        AWS_LOG_TRACE(LOG_TAG, "Request was cancelled externally.");
+        handler(outcome, metrics);
+    }
+    else if (!m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
+    {
+        AWS_LOG_TRACE(LOG_TAG, "Request failed and we are now out of retries.");
+        handler(outcome, metrics);
+    }
+    else
+    {
+        serializedRequest->m_lastRetriedError = outcome.GetError();
+        long delayMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
+        AWS_LOG_WARN(LOG_TAG, "Request failed, scheduling another attempt in %ld ms.", delayMillis);
+        //no thread sleeps here; the delay is how long the next attempt is held back.
+        metrics.AddPhase(RequestPhase::RETRY_SLEEP, static_cast<int64_t>(delayMillis) * 1000);
+        AttemptAsync(uri, method, serializedRequest, handler, retries + 1, std::chrono::milliseconds(delayMillis));
+    }
 }
 
-HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri, HttpMethod method) const
+std::shared_ptr<HttpRequest> AWSClient::CreateSignedHttpRequest(const Aws::String& uri, HttpMethod method, SerializedRequest& serializedRequest) const
 {
-    std::shared_ptr<HttpRequest> httpRequest(m_clientFactory->CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod));
-    AddCommonHeaders(*httpRequest);
+    auto serializeStart = std::chrono::steady_clock::now();
+    std::shared_ptr<HttpRequest> httpRequest;
+    const Aws::AmazonWebServiceRequest* request = serializedRequest.m_request;
+    if (request)
+    {
+        httpRequest = m_clientFactory->CreateHttpRequest(uri, method, request->GetResponseStreamFactory());
+
+        //the body is shared by every attempt, and the previous one may have read it to the end.
+        if (serializedRequest.m_body)
+        {
+            serializedRequest.m_body->clear();
+            serializedRequest.m_body->seekg(0, serializedRequest.m_body->beg);
+            httpRequest->AddContentBody(serializedRequest.m_body);
+        }
 
-    if (!m_signer->SignRequest(*httpRequest))
+        BuildHttpRequest(*request, httpRequest);
+    }
+    else
+    {
+        httpRequest = m_clientFactory->CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        AddCommonHeaders(*httpRequest);
+    }
+
+    RequestMetrics& metrics = serializedRequest.m_metrics;
+
+    //a hash from an earlier attempt is still good for the same body, so the signer does not have to read it again.
+    bool sendsSerializedBody = httpRequest->GetContentBody() == serializedRequest.m_body;
+    if (sendsSerializedBody && !serializedRequest.m_payloadHash.empty())
+    {
+        httpRequest->SetHeaderValue(X_AMZ_CONTENT_SHA256_HEADER, serializedRequest.m_payloadHash);
+    }
+
+    auto signStart = std::chrono::steady_clock::now();
+    metrics.AddPhase(RequestPhase::SERIALIZE, signStart - serializeStart);
+    bool wasSigned = m_signer->SignRequest(*httpRequest);
+    metrics.AddPhase(RequestPhase::SIGN, std::chrono::steady_clock::now() - signStart);
+    if (!wasSigned)
     {
         AWS_LOG_ERROR(LOG_TAG, "Request signing failed. Returning error.");
-        return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
+        return nullptr; // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
     }
 
     AWS_LOG_DEBUG(LOG_TAG, "Request Successfully signed");
+    if (sendsSerializedBody && serializedRequest.m_payloadHash.empty() && httpRequest->HasHeader(X_AMZ_CONTENT_SHA256_HEADER))
+    {
+        serializedRequest.m_payloadHash = httpRequest->GetHeaderValue(X_AMZ_CONTENT_SHA256_HEADER);
+    }
+
+    return httpRequest;
+}
+
+HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest) const
+{
     std::shared_ptr<HttpResponse> httpResponse(
         m_httpClient->MakeRequest(*httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
 
@@ -183,11 +418,39 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri, HttpMet
     return HttpResponseOutcome(httpResponse);
 }
 
-StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::String& uri,
+HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method) const
+    HttpMethod method) const
+{
+    SerializedRequest serializedRequest(&request);
+    return AttemptOneRequest(uri, method, serializedRequest);
+}
+
+HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri, HttpMethod method) const
+{
+    SerializedRequest serializedRequest(nullptr);
+    return AttemptOneRequest(uri, method, serializedRequest);
+}
+
+HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri, HttpMethod method, SerializedRequest& serializedRequest) const
+{
+    RequestMetrics& metrics = serializedRequest.m_metrics;
+    StartRequestMetrics(metrics, m_signer->GetServiceName());
+
+    std::shared_ptr<HttpRequest> httpRequest(CreateSignedHttpRequest(uri, method, serializedRequest));
+    HttpResponseOutcome outcome = httpRequest ? AttemptOneRequest(httpRequest) : HttpResponseOutcome();
+    metrics.attempts = 1;
+    metrics.succeeded = outcome.IsSuccess();
+    if (httpRequest)
+    {
+        metrics.AddTransferTimings(httpRequest->GetTransferTimings());
+    }
+    ReportRequestMetrics(metrics);
+    return outcome;
+}
+
+static StreamOutcome ToStreamOutcome(const HttpResponseOutcome& httpResponseOutcome)
 {
-    HttpResponseOutcome httpResponseOutcome = AttemptExhaustively(uri, request, method);
     if (httpResponseOutcome.IsSuccess())
     {
         return StreamOutcome(AmazonWebServiceResult<Stream::ResponseStream>(
@@ -198,6 +461,25 @@ StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::String& uri,
     return StreamOutcome(httpResponseOutcome.GetError());
 }
 
+StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method) const
+{
+    return ToStreamOutcome(AttemptExhaustively(uri, request, method));
+}
+
+void AWSClient::MakeRequestWithUnparsedResponseAsync(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method,
+    const StreamOutcomeHandler& handler) const
+{
+    AttemptExhaustivelyAsync(uri, request, method, [handler](const HttpResponseOutcome& httpResponseOutcome)
+    {
+        StreamOutcome outcome(ToStreamOutcome(httpResponseOutcome));
+        handler(outcome);
+    });
+}
+
 void AWSClient::AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
     const Http::HeaderValueCollection& headerValues) const
 {
@@ -244,7 +526,8 @@ void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
 {
     //do headers first since the request likely will set content-length as it's own header.
     AddHeadersToRequest(httpRequest, request.GetHeaders());
-    AddContentBodyToRequest(httpRequest, request.GetBody());
+    std::shared_ptr<Aws::IOStream> body = httpRequest->GetContentBody();
+    AddContentBodyToRequest(httpRequest, body ? body : request.GetBody());
 
     // Pass along handlers for processing data sent/received in bytes
     httpRequest->SetDataReceivedEventHandler(request.GetDataReceivedEventHandler());
@@ -288,34 +571,66 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
     Http::HttpMethod method) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method));
+    RequestMetrics metrics;
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, metrics));
+    return ParseResponse(httpOutcome, metrics);
+}
+
+void AWSJsonClient::MakeRequestAsync(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method,
+    const JsonOutcomeHandler& handler) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, method, [this, handler](HttpResponseOutcome& httpOutcome, RequestMetrics& metrics)
+    {
+        JsonOutcome outcome(ParseResponse(httpOutcome, metrics));
+        handler(outcome);
+    });
+}
+
+JsonOutcome AWSJsonClient::ParseResponse(const HttpResponseOutcome& httpOutcome, RequestMetrics& metrics) const
+{
     if (!httpOutcome.IsSuccess())
     {
+        ReportRequestMetrics(metrics);
         return JsonOutcome(httpOutcome.GetError());
     }
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
+    {
+        auto parseStart = std::chrono::steady_clock::now();
+        JsonValue jsonValue(httpOutcome.GetResult()->GetResponseBody());
+        metrics.AddPhase(RequestPhase::RESPONSE_PARSE, std::chrono::steady_clock::now() - parseStart);
+        ReportRequestMetrics(metrics);
+
         //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(httpOutcome.GetResult()->GetResponseBody()),
+        return JsonOutcome(AmazonWebServiceResult<JsonValue>(std::move(jsonValue),
         httpOutcome.GetResult()->GetHeaders(),
         httpOutcome.GetResult()->GetResponseCode()));
+    }
 
-    else
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
+    ReportRequestMetrics(metrics);
+    return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
 }
 
 JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
-    Http::HttpMethod method) const
+    Http::HttpMethod method,
+    const char* requestName) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method));
+    RequestMetrics metrics;
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, metrics, requestName));
     if (!httpOutcome.IsSuccess())
     {
+        ReportRequestMetrics(metrics);
         return JsonOutcome(httpOutcome.GetError());
     }
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
+        auto parseStart = std::chrono::steady_clock::now();
         JsonValue jsonValue(httpOutcome.GetResult()->GetResponseBody());
+        metrics.AddPhase(RequestPhase::RESPONSE_PARSE, std::chrono::steady_clock::now() - parseStart);
+        ReportRequestMetrics(metrics);
         if (!jsonValue.WasParseSuccessful())
         {
             return JsonOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", jsonValue.GetErrorMessage(), false));
@@ -327,6 +642,7 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
             httpOutcome.GetResult()->GetResponseCode()));
     }
 
+    ReportRequestMetrics(metrics);
     return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
 }
 
@@ -347,7 +663,7 @@ AWSError<CoreErrors> AWSJsonClient::BuildAWSError(
     {
         Aws::StringStream ss;
         ss << "No response body.  Response code: " << httpResponse->GetResponseCode();
-        AWS_LOG_ERROR(LOG_TAG, ss.str().c_str());
+        AWS_LOG_ERROR(LOG_TAG, "%s", ss.str().c_str());
         return AWSError<CoreErrors>(CoreErrors::UNKNOWN, "", ss.str(), false);
     }
 
@@ -387,15 +703,47 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
     Http::HttpMethod method) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method));
+    RequestMetrics metrics;
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, metrics));
+    return ParseResponse(httpOutcome, metrics);
+}
+
+void AWSXMLClient::MakeRequestAsync(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method,
+    const XmlOutcomeHandler& handler) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, method, [this, handler](HttpResponseOutcome& httpOutcome, RequestMetrics& metrics)
+    {
+        XmlOutcome outcome(ParseResponse(httpOutcome, metrics));
+        handler(outcome);
+    });
+}
+
+void AWSXMLClient::MakeRequestAsync(const Aws::String& uri, Http::HttpMethod method, const XmlOutcomeHandler& handler,
+    const char* requestName) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, method, [this, handler](HttpResponseOutcome& httpOutcome, RequestMetrics& metrics)
+    {
+        XmlOutcome outcome(ParseResponse(httpOutcome, metrics));
+        handler(outcome);
+    }, requestName);
+}
+
+XmlOutcome AWSXMLClient::ParseResponse(const HttpResponseOutcome& httpOutcome, RequestMetrics& metrics) const
+{
     if (!httpOutcome.IsSuccess())
     {
+        ReportRequestMetrics(metrics);
         return XmlOutcome(httpOutcome.GetError());
     }
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
+        auto parseStart = std::chrono::steady_clock::now();
         XmlDocument xmlDoc = XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody());
+        metrics.AddPhase(RequestPhase::RESPONSE_PARSE, std::chrono::steady_clock::now() - parseStart);
+        ReportRequestMetrics(metrics);
 
         if (!xmlDoc.WasParseSuccessful())
         {
@@ -407,25 +755,34 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
             httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
     }
 
+    ReportRequestMetrics(metrics);
     return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
 }
 
 XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
-    Http::HttpMethod method) const
+    Http::HttpMethod method,
+    const char* requestName) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method));
+    RequestMetrics metrics;
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, metrics, requestName));
     if (!httpOutcome.IsSuccess())
     {
+        ReportRequestMetrics(metrics);
         return XmlOutcome(httpOutcome.GetError());
     }
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
-        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(
-            XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody()),
+        auto parseStart = std::chrono::steady_clock::now();
+        XmlDocument xmlDoc = XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody());
+        metrics.AddPhase(RequestPhase::RESPONSE_PARSE, std::chrono::steady_clock::now() - parseStart);
+        ReportRequestMetrics(metrics);
+
+        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(std::move(xmlDoc),
             httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
     }
 
+    ReportRequestMetrics(metrics);
     return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
 }
 
@@ -440,7 +797,7 @@ AWSError<CoreErrors> AWSXMLClient::BuildAWSError(const std::shared_ptr<Http::Htt
     {
         Aws::StringStream ss;
         ss << "No response body.  Response code: " << httpResponse->GetResponseCode();
-        AWS_LOG_ERROR(LOG_TAG, ss.str().c_str());
+        AWS_LOG_ERROR(LOG_TAG, "%s", ss.str().c_str());
         return AWSError<CoreErrors>(CoreErrors::UNKNOWN, "", ss.str(), false);
     }
 
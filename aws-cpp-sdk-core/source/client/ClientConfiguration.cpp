@@ -16,6 +16,7 @@
 #include <aws/core/client/ClientConfiguration.h>
 
 #include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/client/RequestMetrics.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -51,7 +52,8 @@ ClientConfiguration::ClientConfiguration() :
     writeRateLimiter(nullptr),
     readRateLimiter(nullptr),
     httpLibOverride(Aws::Http::TransferLibType::DEFAULT_CLIENT),
-    followRedirects(true)
+    followRedirects(true),
+    metricsCollector(nullptr)
 {
 }
 
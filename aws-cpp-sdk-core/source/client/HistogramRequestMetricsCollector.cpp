@@ -0,0 +1,69 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/HistogramRequestMetricsCollector.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws::Client;
+
+static const char* ALLOCATION_TAG = "HistogramRequestMetricsCollector";
+
+void HistogramRequestMetricsCollector::OnRequestCompleted(const RequestMetrics& metrics)
+{
+    std::shared_ptr<OperationHistograms> histograms;
+    {
+        std::lock_guard<std::mutex> locker(m_operationsMutex);
+        std::shared_ptr<OperationHistograms>& entry = m_operations[OperationKey(metrics.serviceName, metrics.operationName)];
+        if (!entry)
+        {
+            entry = Aws::MakeShared<OperationHistograms>(ALLOCATION_TAG);
+        }
+        histograms = entry;
+    }
+
+    for (size_t i = 0; i < REQUEST_PHASE_COUNT; ++i)
+    {
+        //Record ignores the -1 of phases that weren't measured.
+        histograms->phases[i].Record(metrics.phaseMicroseconds[i]);
+    }
+    histograms->attempts.Record(metrics.attempts);
+    if (!metrics.succeeded)
+    {
+        ++histograms->failures;
+    }
+}
+
+std::shared_ptr<const HistogramRequestMetricsCollector::OperationHistograms> HistogramRequestMetricsCollector::GetHistograms(
+    const Aws::String& serviceName, const Aws::String& operationName) const
+{
+    std::lock_guard<std::mutex> locker(m_operationsMutex);
+    auto iter = m_operations.find(OperationKey(serviceName, operationName));
+    if (iter == m_operations.end())
+    {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+Aws::Vector<std::pair<Aws::String, Aws::String>> HistogramRequestMetricsCollector::GetOperations() const
+{
+    std::lock_guard<std::mutex> locker(m_operationsMutex);
+    Aws::Vector<std::pair<Aws::String, Aws::String>> operations;
+    for (const auto& operation : m_operations)
+    {
+        operations.push_back(operation.first);
+    }
+    return operations;
+}
@@ -0,0 +1,77 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/JitteredRetryStrategy.h>
+
+#include <aws/core/client/AWSError.h>
+#include <aws/core/utils/UnreferencedParam.h>
+
+#include <chrono>
+#include <random>
+
+using namespace Aws;
+using namespace Aws::Client;
+
+JitteredRetryStrategy::JitteredRetryStrategy(JitterMode mode, long maxRetries, long baseDelayMs, long maxDelayMs) :
+    m_mode(mode), m_maxRetries(maxRetries), m_baseDelayMs(baseDelayMs), m_maxDelayMs(maxDelayMs)
+{
+    std::random_device device;
+    uint64_t seed = (static_cast<uint64_t>(device()) << 32) ^ device();
+    m_randomState = seed ^ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+bool JitteredRetryStrategy::ShouldRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const
+{
+    if (attemptedRetries >= m_maxRetries)
+        return false;
+
+    return error.ShouldRetry();
+}
+
+long JitteredRetryStrategy::CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const
+{
+    AWS_UNREFERENCED_PARAM(error);
+
+    //grow the ceiling step by step so large retry counts saturate at the cap instead of overflowing.
+    long multiplier = m_mode == JitterMode::FULL ? 2 : 3;
+    long ceiling = m_baseDelayMs;
+    for (long i = 0; i < attemptedRetries && ceiling < m_maxDelayMs; ++i)
+    {
+        ceiling *= multiplier;
+    }
+    if (ceiling > m_maxDelayMs)
+    {
+        ceiling = m_maxDelayMs;
+    }
+
+    if (m_mode == JitterMode::FULL)
+    {
+        return NextRandom(0, ceiling);
+    }
+
+    return NextRandom(ceiling < m_baseDelayMs ? ceiling : m_baseDelayMs, ceiling);
+}
+
+long JitteredRetryStrategy::NextRandom(long lowerBound, long upperBound) const
+{
+    //splitmix64 over an atomically advanced counter.
+    uint64_t value = m_randomState.fetch_add(0x9e3779b97f4a7c15ULL) + 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+
+    uint64_t range = static_cast<uint64_t>(upperBound - lowerBound) + 1;
+    return lowerBound + static_cast<long>(value % range);
+}
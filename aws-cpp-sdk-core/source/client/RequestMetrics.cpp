@@ -0,0 +1,97 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/RequestMetrics.h>
+#include <aws/core/http/HttpRequest.h>
+
+using namespace Aws::Client;
+
+namespace Aws
+{
+namespace Client
+{
+
+const char* GetRequestPhaseName(RequestPhase phase)
+{
+    switch (phase)
+    {
+        case RequestPhase::SERIALIZE:
+            return "Serialize";
+        case RequestPhase::SIGN:
+            return "Sign";
+        case RequestPhase::CONNECTION_POOL_WAIT:
+            return "ConnectionPoolWait";
+        case RequestPhase::DNS_LOOKUP:
+            return "DnsLookup";
+        case RequestPhase::CONNECT:
+            return "Connect";
+        case RequestPhase::TLS_HANDSHAKE:
+            return "TlsHandshake";
+        case RequestPhase::TIME_TO_FIRST_BYTE:
+            return "TimeToFirstByte";
+        case RequestPhase::BODY_DOWNLOAD:
+            return "BodyDownload";
+        case RequestPhase::RESPONSE_PARSE:
+            return "ResponseParse";
+        case RequestPhase::RETRY_SLEEP:
+            return "RetrySleep";
+        case RequestPhase::TOTAL:
+            return "Total";
+        default:
+            return "";
+    }
+}
+
+} // namespace Client
+} // namespace Aws
+
+RequestMetrics::RequestMetrics() :
+    serviceName(""),
+    operationName(),
+    attempts(0),
+    succeeded(false),
+    startTime(std::chrono::steady_clock::now())
+{
+    for (auto& phase : phaseMicroseconds)
+    {
+        phase = -1;
+    }
+}
+
+void RequestMetrics::AddPhase(RequestPhase phase, int64_t microseconds)
+{
+    if (microseconds < 0)
+    {
+        return;
+    }
+
+    int64_t& total = phaseMicroseconds[static_cast<size_t>(phase)];
+    total = (total < 0 ? 0 : total) + microseconds;
+}
+
+void RequestMetrics::AddPhase(RequestPhase phase, std::chrono::steady_clock::duration duration)
+{
+    AddPhase(phase, static_cast<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count()));
+}
+
+void RequestMetrics::AddTransferTimings(const Aws::Http::TransferTimings& timings)
+{
+    AddPhase(RequestPhase::CONNECTION_POOL_WAIT, timings.connectionPoolWaitMicros);
+    AddPhase(RequestPhase::DNS_LOOKUP, timings.dnsLookupMicros);
+    AddPhase(RequestPhase::CONNECT, timings.connectMicros);
+    AddPhase(RequestPhase::TLS_HANDSHAKE, timings.tlsHandshakeMicros);
+    AddPhase(RequestPhase::TIME_TO_FIRST_BYTE, timings.timeToFirstByteMicros);
+    AddPhase(RequestPhase::BODY_DOWNLOAD, timings.bodyDownloadMicros);
+}
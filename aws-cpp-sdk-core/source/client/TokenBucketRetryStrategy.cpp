@@ -0,0 +1,85 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/TokenBucketRetryStrategy.h>
+
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/JitteredRetryStrategy.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws;
+using namespace Aws::Client;
+
+static const char* LOG_TAG = "TokenBucketRetryStrategy";
+
+TokenBucketRetryStrategy::TokenBucketRetryStrategy(long capacity) :
+    m_retryStrategy(Aws::MakeShared<JitteredRetryStrategy>(LOG_TAG)),
+    m_capacity(capacity), m_retryCost(5), m_connectionErrorRetryCost(10), m_tokens(capacity)
+{
+}
+
+TokenBucketRetryStrategy::TokenBucketRetryStrategy(const std::shared_ptr<RetryStrategy>& retryStrategy, long capacity,
+    long retryCost, long connectionErrorRetryCost) :
+    m_retryStrategy(retryStrategy), m_capacity(capacity), m_retryCost(retryCost),
+    m_connectionErrorRetryCost(connectionErrorRetryCost), m_tokens(capacity)
+{
+}
+
+bool TokenBucketRetryStrategy::ShouldRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const
+{
+    if (!m_retryStrategy->ShouldRetry(error, attemptedRetries))
+    {
+        return false;
+    }
+
+    long cost = GetRetryCost(error);
+    long tokens = m_tokens;
+    do
+    {
+        if (tokens < cost)
+        {
+            AWS_LOG_DEBUG(LOG_TAG, "Retry budget exhausted, not retrying.");
+            return false;
+        }
+    } while (!m_tokens.compare_exchange_weak(tokens, tokens - cost));
+
+    return true;
+}
+
+long TokenBucketRetryStrategy::CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const
+{
+    return m_retryStrategy->CalculateDelayBeforeNextRetry(error, attemptedRetries);
+}
+
+void TokenBucketRetryStrategy::OnRequestSucceeded(long attemptedRetries, const AWSError<CoreErrors>& lastRetriedError) const
+{
+    m_retryStrategy->OnRequestSucceeded(attemptedRetries, lastRetriedError);
+    AddTokens(attemptedRetries > 0 ? GetRetryCost(lastRetriedError) : 1);
+}
+
+long TokenBucketRetryStrategy::GetRetryCost(const AWSError<CoreErrors>& error) const
+{
+    return error.GetErrorType() == CoreErrors::NETWORK_CONNECTION ? m_connectionErrorRetryCost : m_retryCost;
+}
+
+void TokenBucketRetryStrategy::AddTokens(long amount) const
+{
+    long tokens = m_tokens;
+    while (tokens < m_capacity && !m_tokens.compare_exchange_weak(tokens, tokens + amount > m_capacity ? m_capacity : tokens + amount))
+    {
+    }
+}
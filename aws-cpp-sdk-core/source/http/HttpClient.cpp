@@ -14,6 +14,7 @@
   */
 
 #include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpResponse.h>
 
 using namespace Aws;
 using namespace Aws::Http;
@@ -41,7 +42,21 @@ bool HttpClient::IsRequestProcessingEnabled() const
     return m_disableRequestProcessing.load() == false; 
 }
 
-void HttpClient::RetryRequestSleep(std::chrono::milliseconds sleepTime) 
+void HttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+                                  const HttpResponseCallback& callback,
+                                  Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                                  Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter,
+                                  std::chrono::milliseconds startDelay) const
+{
+    if (startDelay.count() > 0)
+    {
+        RetryRequestSleep(startDelay);
+    }
+
+    callback(MakeRequest(*request, readLimiter, writeLimiter));
+}
+
+void HttpClient::RetryRequestSleep(std::chrono::milliseconds sleepTime) const
 {
     std::unique_lock< std::mutex > signalLocker(m_requestProcessingSignalLock);
     m_requestProcessingSignal.wait_for(signalLocker, sleepTime, [this](){ return m_disableRequestProcessing.load() == true; });
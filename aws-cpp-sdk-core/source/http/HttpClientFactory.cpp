@@ -17,6 +17,7 @@
 
 #if ENABLE_CURL_CLIENT
     #include <aws/core/http/curl/CurlHttpClient.h>
+    #include <aws/core/http/curl/CurlMultiHttpClient.h>
 #endif
 
 #ifdef ENABLE_WINDOWS_CLIENT
@@ -49,6 +50,14 @@ std::shared_ptr<HttpClient> HttpClientFactory::CreateHttpClient(const ClientConf
             AWS_LOG_WARN("HttpClientFactoryHttpClientFactory", "Curl client configuration selected but curl is not available.");
 	    return nullptr;
 #endif
+
+        case TransferLibType::CURL_MULTI_CLIENT:
+#if ENABLE_CURL_CLIENT
+            return Aws::MakeShared<CurlMultiHttpClient>(allocationTag, clientConfiguration);
+#else
+            AWS_LOG_WARN("HttpClientFactoryHttpClientFactory", "Curl multi client configuration selected but curl is not available.");
+	    return nullptr;
+#endif
  
         case TransferLibType::WIN_HTTP_CLIENT:
 #if ENABLE_WINDOWS_CLIENT
@@ -20,6 +20,7 @@
 
 #include <stdlib.h>
 #include <cctype>
+#include <cstring>
 #include <cassert>
 #include <algorithm>
 
@@ -110,21 +111,40 @@ void URI::SetScheme(Scheme value)
 
 Aws::String URI::URLEncodePath(const Aws::String& path)
 {
-    Aws::Vector<Aws::String> pathParts = StringUtils::Split(path, '/');
-    Aws::StringStream ss;
+    Aws::String encoded;
+    URLEncodePath(path, encoded);
+    return encoded;
+}
 
-    for (Aws::Vector<Aws::String>::iterator iter = pathParts.begin(); iter != pathParts.end(); ++iter)
+void URI::URLEncodePath(const Aws::String& path, Aws::String& out)
+{
+    //empty segments are dropped.
+    size_t segmentStart = 0;
+    while (segmentStart < path.length())
     {
-        ss << '/' << StringUtils::URLEncode(iter->c_str());
+        size_t segmentEnd = path.find('/', segmentStart);
+        if (segmentEnd == Aws::String::npos)
+        {
+            segmentEnd = path.length();
+        }
+
+        if (segmentEnd > segmentStart)
+        {
+            out.push_back('/');
+            //a segment ends at an embedded null, as it did when segments were encoded through their c_str().
+            const char* segment = path.c_str() + segmentStart;
+            const void* terminator = memchr(segment, '\0', segmentEnd - segmentStart);
+            StringUtils::URLEncode(segment, terminator ? static_cast<const char*>(terminator) - segment : segmentEnd - segmentStart, out);
+        }
+
+        segmentStart = segmentEnd + 1;
     }
 
     //if the last character was also a slash, then add that back here.
-    if (path[path.length() - 1] == '/')
+    if (!path.empty() && path[path.length() - 1] == '/')
     {
-        ss << '/';
+        out.push_back('/');
     }
-
-    return ss.str();
 }
 
 void URI::SetPath(const Aws::String& value)
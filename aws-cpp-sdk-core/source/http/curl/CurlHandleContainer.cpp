@@ -15,6 +15,8 @@
 
 #include <aws/core/http/curl/CurlHandleContainer.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/threading/ThreadIdHash.h>
 #include <algorithm>
 
 #undef min
@@ -27,8 +29,8 @@ static const char* CurlTag = "CurlHandleContainer";
 bool CurlHandleContainer::isInit = false;
 
 CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout, long connectTimeout) :
-                m_maxPoolSize(maxSize), m_requestTimeout(requestTimeout), m_connectTimeout(connectTimeout),
-                m_poolSize(0)
+                m_slots(nullptr), m_waitingThreads(0), m_maxPoolSize(maxSize > 0 ? maxSize : 1),
+                m_requestTimeout(requestTimeout), m_connectTimeout(connectTimeout), m_poolSize(0)
 {
     AWS_LOGSTREAM_INFO(CurlTag, "Intializing CurlHandleContainer with size " << maxSize);
     if (!isInit)
@@ -37,38 +39,57 @@ CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout,
         isInit = true;
         curl_global_init(CURL_GLOBAL_ALL);
     }
+
+    m_slots = Aws::NewArray<HandleSlot>(m_maxPoolSize, CurlTag);
+    for (unsigned i = 0; i < m_maxPoolSize; ++i)
+    {
+        m_slots[i].handle.store(nullptr);
+    }
 }
 
 CurlHandleContainer::~CurlHandleContainer()
 {
     AWS_LOG_INFO(CurlTag, "Cleaning up CurlHandleContainer.");
-    while (m_handleContainer.size() > 0)
+    for (unsigned i = 0; i < m_maxPoolSize; ++i)
     {
-        AWS_LOG_DEBUG(CurlTag, "Cleaning up %p.", m_handleContainer.top());
-        curl_easy_cleanup(m_handleContainer.top());
-        m_handleContainer.pop();
+        CURL* handle = m_slots[i].handle.exchange(nullptr);
+        if (handle)
+        {
+            AWS_LOG_DEBUG(CurlTag, "Cleaning up %p.", handle);
+            curl_easy_cleanup(handle);
+        }
     }
+    Aws::DeleteArray(m_slots);
 }
 
 CURL* CurlHandleContainer::AcquireCurlHandle()
 {
-    AWS_LOG_DEBUG(CurlTag, "Attempting to acquire curl connection.");
-    std::unique_lock<std::mutex> locker(m_handleContainerMutex);
+    size_t homeSlot = GetHomeSlot();
+    CURL* handle = TryAcquireIdleHandle(homeSlot);
+    if (handle)
+    {
+        return handle;
+    }
 
-    while (m_handleContainer.size() == 0)
+    AWS_LOG_DEBUG(CurlTag, "No current connections available in pool. Attempting to create new connections.");
+    handle = CheckAndGrowPool(homeSlot);
+    if (handle)
     {
-        AWS_LOG_DEBUG(CurlTag, "No current connections available in pool. Attempting to create new connections.");
-        if (!CheckAndGrowPool())
-        {
-            AWS_LOG_INFO(CurlTag, "Connection pool has reached its max size. Waiting on connection to be freed.");
-            m_conditionVariable.wait(locker);
-            AWS_LOG_INFO(CurlTag, "Connection has been released. Continuing.");
-        }
+        return handle;
+    }
+
+    AWS_LOG_INFO(CurlTag, "Connection pool has reached its max size. Waiting on connection to be freed.");
+    std::unique_lock<std::mutex> locker(m_handleContainerMutex);
+    //a releasing thread puts its handle back before it checks for waiters, and we check the slots after registering,
+    //so either we find the handle here or the releasing thread sees us and notifies.
+    ++m_waitingThreads;
+    while ((handle = TryAcquireIdleHandle(homeSlot)) == nullptr && (handle = CheckAndGrowPool(homeSlot)) == nullptr)
+    {
+        m_conditionVariable.wait(locker);
     }
+    --m_waitingThreads;
+    AWS_LOG_INFO(CurlTag, "Connection has been released. Continuing.");
 
-    CURL* handle = m_handleContainer.top();
-    AWS_LOGSTREAM_DEBUG(CurlTag, "Returning connection handle " << handle);
-    m_handleContainer.pop();
     return handle;
 }
 
@@ -76,53 +97,107 @@ void CurlHandleContainer::ReleaseCurlHandle(CURL* handle)
 {
     if (handle != NULL)
     {
-        AWS_LOGSTREAM_DEBUG(CurlTag, "Releasing curl handle " << handle);
-        std::unique_lock<std::mutex> locker(m_handleContainerMutex);
-        m_handleContainer.push(handle);
-        locker.unlock();
-        AWS_LOG_DEBUG(CurlTag, "Notifying waiting threads.");
-        m_conditionVariable.notify_one();
+        PutIdleHandle(handle, GetHomeSlot());
+        if (m_waitingThreads > 0)
+        {
+            AWS_LOG_DEBUG(CurlTag, "Notifying waiting threads.");
+            {
+                std::lock_guard<std::mutex> locker(m_handleContainerMutex);
+            }
+            m_conditionVariable.notify_one();
+        }
     }
 }
 
-bool CurlHandleContainer::CheckAndGrowPool()
+CURL* CurlHandleContainer::CheckAndGrowPool(size_t homeSlot)
 {
-    if (m_poolSize < m_maxPoolSize)
+    //reserve room for the new handles first so concurrent growers can't overshoot the max size.
+    unsigned poolSize = m_poolSize;
+    unsigned amountToAdd = 0;
+    do
     {
-        unsigned multiplier = m_poolSize > 0 ? m_poolSize : 1;
-        unsigned amountToAdd = std::min(multiplier * 2, m_maxPoolSize - m_poolSize);
-        AWS_LOGSTREAM_DEBUG(CurlTag, "attempting to grow pool size by " << amountToAdd);
-
-        unsigned actuallyAdded = 0;
-        for (unsigned i = 0; i < amountToAdd; ++i)
+        if (poolSize >= m_maxPoolSize)
         {
-            CURL* curlHandle = curl_easy_init();
+            AWS_LOG_INFO(CurlTag, "Pool cannot be grown any further, already at max size.");
+            return nullptr;
+        }
+
+        unsigned multiplier = poolSize > 0 ? poolSize : 1;
+        amountToAdd = std::min(multiplier * 2, m_maxPoolSize - poolSize);
+    } while (!m_poolSize.compare_exchange_weak(poolSize, poolSize + amountToAdd));
+
+    AWS_LOGSTREAM_DEBUG(CurlTag, "attempting to grow pool size by " << amountToAdd);
 
-            if (curlHandle)
+    CURL* acquiredHandle = nullptr;
+    unsigned actuallyAdded = 0;
+    for (unsigned i = 0; i < amountToAdd; ++i)
+    {
+        CURL* curlHandle = curl_easy_init();
+
+        if (curlHandle)
+        {
+            //for timeouts to work in a multi-threaded context,
+            //always turn signals off. This also forces dns queries to
+            //not be included in the timeout calculations.
+            curl_easy_setopt(curlHandle, CURLOPT_NOSIGNAL, 1L);
+            curl_easy_setopt(curlHandle, CURLOPT_TIMEOUT_MS, m_requestTimeout);
+            curl_easy_setopt(curlHandle, CURLOPT_CONNECTTIMEOUT_MS, m_connectTimeout);
+            if (acquiredHandle)
             {
-                //for timeouts to work in a multi-threaded context,
-                //always turn signals off. This also forces dns queries to
-                //not be included in the timeout calculations.
-                curl_easy_setopt(curlHandle, CURLOPT_NOSIGNAL, 1L);
-                curl_easy_setopt(curlHandle, CURLOPT_TIMEOUT_MS, m_requestTimeout);
-                curl_easy_setopt(curlHandle, CURLOPT_CONNECTTIMEOUT_MS, m_connectTimeout);
-                m_handleContainer.push(curlHandle);
-                ++actuallyAdded;
+                //leave the home slot free for the handle this thread hands back.
+                PutIdleHandle(curlHandle, (homeSlot + 1) % m_maxPoolSize);
             }
             else
             {
-                AWS_LOG_ERROR(CurlTag, "curl_easy_init failed to allocate. Will continue retrying until amount to add has exhausted.");
+                acquiredHandle = curlHandle;
             }
+            ++actuallyAdded;
         }
+        else
+        {
+            AWS_LOG_ERROR(CurlTag, "curl_easy_init failed to allocate. Will continue retrying until amount to add has exhausted.");
+        }
+    }
 
-        AWS_LOGSTREAM_INFO(CurlTag, "Pool successfully grown by " << actuallyAdded);
-        m_poolSize += actuallyAdded;
+    AWS_LOGSTREAM_INFO(CurlTag, "Pool successfully grown by " << actuallyAdded);
+    m_poolSize -= amountToAdd - actuallyAdded;
 
-        return actuallyAdded > 0;
+    return acquiredHandle;
+}
+
+CURL* CurlHandleContainer::TryAcquireIdleHandle(size_t homeSlot)
+{
+    for (unsigned i = 0; i < m_maxPoolSize; ++i)
+    {
+        std::atomic<CURL*>& slot = m_slots[(homeSlot + i) % m_maxPoolSize].handle;
+        //only write to the slot's cache line when there's something to take.
+        if (slot.load() != nullptr)
+        {
+            CURL* handle = slot.exchange(nullptr);
+            if (handle)
+            {
+                return handle;
+            }
+        }
     }
 
-    AWS_LOG_INFO(CurlTag, "Pool cannot be grown any further, already at max size.");
+    return nullptr;
+}
 
-    return false;
+void CurlHandleContainer::PutIdleHandle(CURL* handle, size_t homeSlot)
+{
+    //there are never more handles than slots, so some slot is always empty; keep going around until we get one.
+    for (size_t i = homeSlot;; i = (i + 1) % m_maxPoolSize)
+    {
+        CURL* expected = nullptr;
+        if (m_slots[i].handle.compare_exchange_strong(expected, handle))
+        {
+            return;
+        }
+    }
 }
 
+size_t CurlHandleContainer::GetHomeSlot() const
+{
+    return static_cast<size_t>(Aws::Utils::Threading::HashCurrentThreadId() % m_maxPoolSize);
+}
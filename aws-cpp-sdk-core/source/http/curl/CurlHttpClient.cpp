@@ -23,6 +23,8 @@
 #include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
 
 
 using namespace Aws::Client;
@@ -32,35 +34,6 @@ using namespace Aws::Utils;
 using namespace Aws::Utils::Logging;
 
 
-struct CurlWriteCallbackContext
-{
-    CurlWriteCallbackContext(const CurlHttpClient* client,
-                             HttpRequest* request, 
-                             HttpResponse* response, 
-                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
-        m_client(client),
-        m_request(request),
-        m_response(response),
-        m_rateLimiter(rateLimiter)
-    {}
-
-    const CurlHttpClient* m_client;
-    HttpRequest* m_request;
-    HttpResponse* m_response;
-    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
-};
-
-struct CurlReadCallbackContext
-{
-    CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request) :
-        m_client(client),
-        m_request(request)
-    {}
-
-    const CurlHttpClient* m_client;
-    HttpRequest* m_request;
-};
-
 static const char* CurlTag = "CurlHttpClient";
 
 void SetOptCodeForHttpMethod(CURL* requestHandle, const HttpRequest& request)
@@ -111,18 +84,10 @@ CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
 }
 
 
-std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
-                                                          Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+struct curl_slist* CurlHttpClient::CreateHeaderList(const HttpRequest& request) const
 {
-    Aws::String url = request.GetURIString();
-    AWS_LOGSTREAM_TRACE(CurlTag, "Making request to " << url);
     struct curl_slist* headers = NULL;
 
-    if (writeLimiter != nullptr)
-    {
-        writeLimiter->ApplyAndPayForCost(request.GetSize());
-    }
-
     Aws::StringStream headerStream;
     HeaderValueCollection requestHeaders = request.GetHeaders();
 
@@ -147,76 +112,159 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request,
         headers = curl_slist_append(headers, "content-type:");
     }
 
-    std::shared_ptr<HttpResponse> response(nullptr);
-    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
+    return headers;
+}
 
-    if (connectionHandle)
+void CurlHttpClient::ConfigureCurlHandle(CURL* connectionHandle, HttpRequest& request, const Aws::String& url, struct curl_slist* headers,
+                                         CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const
+{
+    if (headers)
     {
-        AWS_LOGSTREAM_DEBUG(CurlTag, "Obtained connection handle " << connectionHandle);
-
-        if (headers)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
-        }
-
-        response = Aws::MakeShared<StandardHttpResponse>(CurlTag, request);
-        CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
-        CurlReadCallbackContext readContext(this, &request);
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
+    }
 
-        SetOptCodeForHttpMethod(connectionHandle, request);
-        curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, &CurlHttpClient::WriteData);
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, &CurlHttpClient::WriteHeader);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, response.get());
+    SetOptCodeForHttpMethod(connectionHandle, request);
+    curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, &CurlHttpClient::WriteData);
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, &CurlHttpClient::WriteHeader);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, writeContext.m_response);
 
 	// only set by android test builds because the emulator is missing a cert needed for aws services
 #ifdef TEST_CERT_PATH
 	curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
 #endif // TEST_CERT_PATH
 
-        if (m_verifySSL)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
+    if (m_verifySSL)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
 
 #if LIBCURL_VERSION_MAJOR >= 7
 #if LIBCURL_VERSION_MINOR >= 34
-            curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
 #endif //LIBCURL_VERSION_MINOR
 #endif //LIBCURL_VERSION_MAJOR
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
-        }
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
 
-        if (m_allowRedirects)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
-        }
-        //curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
+    if (m_allowRedirects)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
+    }
+    //curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
 
-        if (m_isUsingProxy)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, m_proxyHost.c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
-        }
+    if (m_isUsingProxy)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, m_proxyHost.c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
+    }
 
-        if (request.GetContentBody())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, &CurlHttpClient::ReadBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
-        }
+    if (request.GetContentBody())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, &CurlHttpClient::ReadBody);
+        curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
+    }
+}
+
+void CurlHttpClient::ReadResponseInfo(CURL* connectionHandle, HttpResponse& response)
+{
+    long responseCode;
+    curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+    response.SetResponseCode(static_cast<HttpResponseCode>(responseCode));
+    AWS_LOGSTREAM_DEBUG(CurlTag, "Returned http response code " << responseCode);
+
+    char* contentType = nullptr;
+    curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
+    if (contentType)
+    {
+        response.SetContentType(contentType);
+        AWS_LOGSTREAM_DEBUG(CurlTag, "Returned content type " << contentType);
+    }
+}
+
+//how far into the transfer curl was when it reached a step, in microseconds.
+static int64_t GetTransferMicros(CURL* connectionHandle, CURLINFO info)
+{
+#if LIBCURL_VERSION_NUM >= 0x073d00
+    curl_off_t micros = 0;
+    curl_easy_getinfo(connectionHandle, info, &micros);
+    return static_cast<int64_t>(micros);
+#else
+    double seconds = 0;
+    curl_easy_getinfo(connectionHandle, info, &seconds);
+    return static_cast<int64_t>(seconds * 1000000);
+#endif
+}
+
+void CurlHttpClient::ReadTransferTimings(CURL* connectionHandle, TransferTimings& timings)
+{
+#if LIBCURL_VERSION_NUM >= 0x073d00
+    int64_t nameLookup = GetTransferMicros(connectionHandle, CURLINFO_NAMELOOKUP_TIME_T);
+    int64_t connect = GetTransferMicros(connectionHandle, CURLINFO_CONNECT_TIME_T);
+    int64_t appConnect = GetTransferMicros(connectionHandle, CURLINFO_APPCONNECT_TIME_T);
+    int64_t preTransfer = GetTransferMicros(connectionHandle, CURLINFO_PRETRANSFER_TIME_T);
+    int64_t startTransfer = GetTransferMicros(connectionHandle, CURLINFO_STARTTRANSFER_TIME_T);
+    int64_t total = GetTransferMicros(connectionHandle, CURLINFO_TOTAL_TIME_T);
+#else
+    int64_t nameLookup = GetTransferMicros(connectionHandle, CURLINFO_NAMELOOKUP_TIME);
+    int64_t connect = GetTransferMicros(connectionHandle, CURLINFO_CONNECT_TIME);
+    int64_t appConnect = GetTransferMicros(connectionHandle, CURLINFO_APPCONNECT_TIME);
+    int64_t preTransfer = GetTransferMicros(connectionHandle, CURLINFO_PRETRANSFER_TIME);
+    int64_t startTransfer = GetTransferMicros(connectionHandle, CURLINFO_STARTTRANSFER_TIME);
+    int64_t total = GetTransferMicros(connectionHandle, CURLINFO_TOTAL_TIME);
+#endif
+
+    //every step is reported as time since the transfer started, so each phase is the gap to the step before it.
+    timings.dnsLookupMicros = nameLookup;
+    timings.connectMicros = connect > nameLookup ? connect - nameLookup : 0;
+    //appconnect stays 0 for plain http
+    timings.tlsHandshakeMicros = appConnect > connect ? appConnect - connect : 0;
+    timings.timeToFirstByteMicros = startTransfer > preTransfer ? startTransfer - preTransfer : 0;
+    timings.bodyDownloadMicros = total > startTransfer ? total - startTransfer : 0;
+}
+
+std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                                                          Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    Aws::String url = request.GetURIString();
+    AWS_LOGSTREAM_TRACE(CurlTag, "Making request to " << url);
+
+    if (writeLimiter != nullptr)
+    {
+        writeLimiter->ApplyAndPayForCost(request.GetSize());
+    }
+
+    struct curl_slist* headers = CreateHeaderList(request);
+
+    std::shared_ptr<HttpResponse> response(nullptr);
+    TransferTimings timings;
+    auto poolWaitStart = std::chrono::steady_clock::now();
+    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
+    timings.connectionPoolWaitMicros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - poolWaitStart).count();
+
+    if (connectionHandle)
+    {
+        AWS_LOGSTREAM_DEBUG(CurlTag, "Obtained connection handle " << connectionHandle);
+
+        response = Aws::MakeShared<StandardHttpResponse>(CurlTag, request);
+        CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
+        CurlReadCallbackContext readContext(this, &request);
+
+        ConfigureCurlHandle(connectionHandle, request, url, headers, writeContext, readContext);
 
         CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
+        ReadTransferTimings(connectionHandle, timings);
         if (curlResponseCode != CURLE_OK)
         {
             response = nullptr;
@@ -224,18 +272,7 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request,
         }
         else
         {
-            long responseCode;
-            curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
-            response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
-            AWS_LOGSTREAM_DEBUG(CurlTag, "Returned http response code " << responseCode);
-
-            char* contentType = nullptr;
-            curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
-            if (contentType)
-            {
-                response->SetContentType(contentType);
-                AWS_LOGSTREAM_DEBUG(CurlTag, "Returned content type " << contentType);
-            }
+            ReadResponseInfo(connectionHandle, *response);
             curl_easy_reset(connectionHandle);
             AWS_LOGSTREAM_DEBUG(CurlTag, "Releasing curl handle " << connectionHandle);
         }
@@ -243,6 +280,8 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request,
         m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
     }
 
+    request.SetTransferTimings(timings);
+
     if (headers)
     {
         curl_slist_free_all(headers);
@@ -268,7 +307,14 @@ size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* use
         size_t sizeToWrite = size * nmemb;
         if (context->m_rateLimiter)
         {
-            context->m_rateLimiter->ApplyAndPayForCost(static_cast<int64_t>(sizeToWrite));
+            if (context->m_deferRateLimiting)
+            {
+                context->m_pendingReadDelay += context->m_rateLimiter->ApplyCost(static_cast<int64_t>(sizeToWrite));
+            }
+            else
+            {
+                context->m_rateLimiter->ApplyAndPayForCost(static_cast<int64_t>(sizeToWrite));
+            }
         }
 
         response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
@@ -291,6 +337,18 @@ size_t CurlHttpClient::WriteHeader(char* ptr, size_t size, size_t nmemb, void* u
         AWS_LOGSTREAM_TRACE(CurlTag, ptr);
         HttpResponse* response = (HttpResponse*) userdata;
         Aws::String headerLine(ptr);
+
+        //the status line arrives before the body, so the response code is known while the body is being written.
+        if (headerLine.compare(0, 5, "HTTP/") == 0)
+        {
+            size_t codeStart = headerLine.find(' ');
+            if (codeStart != Aws::String::npos)
+            {
+                response->SetResponseCode(static_cast<HttpResponseCode>(atoi(headerLine.c_str() + codeStart + 1)));
+            }
+            return size * nmemb;
+        }
+
         Aws::Vector<Aws::String> keyValuePair = StringUtils::Split(headerLine, ':');
 
 
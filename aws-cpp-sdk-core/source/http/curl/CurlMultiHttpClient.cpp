@@ -0,0 +1,407 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+
+#include <algorithm>
+#include <condition_variable>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils::Logging;
+
+static const char* CurlMultiTag = "CurlMultiHttpClient";
+
+#if LIBCURL_VERSION_NUM >= 0x074400
+//curl_multi_wakeup interrupts the poll as soon as a request is submitted, so the loop can sleep for a long time
+static const int MAX_POLL_TIMEOUT_MS = 1000;
+#else
+//without curl_multi_wakeup, this bounds how long a newly submitted request can wait before the loop notices it
+static const int MAX_POLL_TIMEOUT_MS = 10;
+#endif
+
+struct CurlMultiHttpClient::Transfer
+{
+    Transfer(const CurlMultiHttpClient* client, HttpRequest* request, const HttpResponseCallback& callback,
+             Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, Clock::time_point startTime) :
+        m_request(request),
+        m_response(Aws::MakeShared<StandardHttpResponse>(CurlMultiTag, *request)),
+        m_callback(callback),
+        m_url(request->GetURIString()),
+        m_headers(nullptr),
+        m_handle(nullptr),
+        m_writeContext(client, request, m_response.get(), readLimiter, true),
+        m_readContext(client, request),
+        m_startTime(startTime),
+        m_resumeTime(),
+        m_paused(false)
+    {}
+
+    //keeps an asynchronous request alive until it completes; empty for requests made through MakeRequest
+    std::shared_ptr<HttpRequest> m_requestOwner;
+    HttpRequest* m_request;
+    std::shared_ptr<HttpResponse> m_response;
+    HttpResponseCallback m_callback;
+    Aws::String m_url;
+    struct curl_slist* m_headers;
+    CURL* m_handle;
+    CurlWriteCallbackContext m_writeContext;
+    CurlReadCallbackContext m_readContext;
+    Clock::time_point m_startTime;
+    Clock::time_point m_resumeTime;
+    bool m_paused;
+};
+
+CurlMultiHttpClient::CurlMultiHttpClient(const ClientConfiguration& clientConfig) :
+    Base(clientConfig),
+    m_multiHandle(curl_multi_init()),
+    m_maxConnections(std::max(clientConfig.maxConnections, 1u)),
+    m_requestTimeout(clientConfig.requestTimeoutMs),
+    m_connectTimeout(clientConfig.connectTimeoutMs),
+    m_submitMutex(),
+    m_submitted(),
+    m_stopping(false),
+    m_scheduled(),
+    m_active(),
+    m_idleHandles(),
+    m_eventLoopThread()
+{
+    AWS_LOGSTREAM_INFO(CurlMultiTag, "Initializing CurlMultiHttpClient with " << m_maxConnections << " connections");
+    curl_multi_setopt(m_multiHandle, CURLMOPT_MAXCONNECTS, static_cast<long>(m_maxConnections));
+    m_eventLoopThread = std::thread(&CurlMultiHttpClient::EventLoop, this);
+}
+
+CurlMultiHttpClient::~CurlMultiHttpClient()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_submitMutex);
+        m_stopping = true;
+    }
+#if LIBCURL_VERSION_NUM >= 0x074400
+    curl_multi_wakeup(m_multiHandle);
+#endif
+    m_eventLoopThread.join();
+
+    //anything still outstanding is failed; the loop thread is gone so this is the only thread touching the multi handle
+    for (auto transfer : m_active)
+    {
+        curl_multi_remove_handle(m_multiHandle, transfer->m_handle);
+        curl_easy_cleanup(transfer->m_handle);
+        FinishTransfer(transfer, nullptr);
+    }
+
+    for (auto& scheduled : m_scheduled)
+    {
+        FinishTransfer(scheduled.second, nullptr);
+    }
+
+    for (auto transfer : m_submitted)
+    {
+        FinishTransfer(transfer, nullptr);
+    }
+
+    for (auto handle : m_idleHandles)
+    {
+        curl_easy_cleanup(handle);
+    }
+
+    curl_multi_cleanup(m_multiHandle);
+}
+
+std::shared_ptr<HttpResponse> CurlMultiHttpClient::MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                                                               Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    //a completion callback making a synchronous call would wait on the loop it is running on
+    if (std::this_thread::get_id() == m_eventLoopThread.get_id())
+    {
+        return Base::MakeRequest(request, readLimiter, writeLimiter);
+    }
+
+    std::mutex completionMutex;
+    std::condition_variable completionSignal;
+    bool completed = false;
+    std::shared_ptr<HttpResponse> response;
+
+    auto onComplete = [&](const std::shared_ptr<HttpResponse>& result)
+    {
+        std::lock_guard<std::mutex> locker(completionMutex);
+        response = result;
+        completed = true;
+        completionSignal.notify_one();
+    };
+
+    Clock::time_point startTime = Clock::now();
+    if (writeLimiter != nullptr)
+    {
+        startTime += writeLimiter->ApplyCost(request.GetSize());
+    }
+
+    Submit(Aws::New<Transfer>(CurlMultiTag, this, &request, onComplete, readLimiter, startTime));
+
+    std::unique_lock<std::mutex> locker(completionMutex);
+    completionSignal.wait(locker, [&](){ return completed; });
+
+    return response;
+}
+
+void CurlMultiHttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+                                           const HttpResponseCallback& callback,
+                                           Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                                           Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter,
+                                           std::chrono::milliseconds startDelay) const
+{
+    Clock::time_point startTime = Clock::now() + startDelay;
+    if (writeLimiter != nullptr)
+    {
+        startTime += writeLimiter->ApplyCost(request->GetSize());
+    }
+
+    Transfer* transfer = Aws::New<Transfer>(CurlMultiTag, this, request.get(), callback, readLimiter, startTime);
+    transfer->m_requestOwner = request;
+    Submit(transfer);
+}
+
+void CurlMultiHttpClient::Submit(Transfer* transfer) const
+{
+    AWS_LOGSTREAM_TRACE(CurlMultiTag, "Queueing request to " << transfer->m_url);
+    {
+        std::lock_guard<std::mutex> locker(m_submitMutex);
+        if (!m_stopping)
+        {
+            m_submitted.push_back(transfer);
+            transfer = nullptr;
+        }
+    }
+
+    if (transfer)
+    {
+        AWS_LOG_WARN(CurlMultiTag, "Client is shutting down, failing request.");
+        FinishTransfer(transfer, nullptr);
+        return;
+    }
+
+#if LIBCURL_VERSION_NUM >= 0x074400
+    curl_multi_wakeup(m_multiHandle);
+#endif
+}
+
+void CurlMultiHttpClient::EventLoop()
+{
+    Aws::Vector<Transfer*> submitted;
+    for (;;)
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_submitMutex);
+            if (m_stopping)
+            {
+                return;
+            }
+            submitted.swap(m_submitted);
+        }
+
+        for (auto transfer : submitted)
+        {
+            m_scheduled.emplace(transfer->m_startTime, transfer);
+        }
+        submitted.clear();
+
+        StartDueTransfers(Clock::now());
+
+        int runningHandles = 0;
+        curl_multi_perform(m_multiHandle, &runningHandles);
+
+        UpdatePausedTransfers(Clock::now());
+        CompleteFinishedTransfers();
+
+        int timeoutMs = ComputeWaitTimeoutMs(Clock::now());
+#if LIBCURL_VERSION_NUM >= 0x074400
+        curl_multi_poll(m_multiHandle, nullptr, 0, timeoutMs, nullptr);
+#else
+        curl_multi_wait(m_multiHandle, nullptr, 0, timeoutMs, nullptr);
+#endif
+    }
+}
+
+void CurlMultiHttpClient::StartDueTransfers(Clock::time_point now)
+{
+    while (!m_scheduled.empty() && m_scheduled.begin()->first <= now && m_active.size() < m_maxConnections)
+    {
+        Transfer* transfer = m_scheduled.begin()->second;
+        m_scheduled.erase(m_scheduled.begin());
+
+        CURL* handle = AcquireHandle();
+        if (!handle)
+        {
+            AWS_LOG_ERROR(CurlMultiTag, "Unable to create a curl handle, failing request.");
+            FinishTransfer(transfer, nullptr);
+            continue;
+        }
+
+        //how long the transfer was due but waiting for one of the m_maxConnections slots
+        TransferTimings timings;
+        timings.connectionPoolWaitMicros = std::chrono::duration_cast<std::chrono::microseconds>(now - transfer->m_startTime).count();
+        transfer->m_request->SetTransferTimings(timings);
+
+        transfer->m_handle = handle;
+        transfer->m_headers = CreateHeaderList(*transfer->m_request);
+        ConfigureCurlHandle(handle, *transfer->m_request, transfer->m_url, transfer->m_headers, transfer->m_writeContext, transfer->m_readContext);
+        curl_easy_setopt(handle, CURLOPT_PRIVATE, transfer);
+
+        AWS_LOGSTREAM_DEBUG(CurlMultiTag, "Starting request to " << transfer->m_url << " on handle " << handle);
+        curl_multi_add_handle(m_multiHandle, handle);
+        m_active.push_back(transfer);
+    }
+}
+
+void CurlMultiHttpClient::UpdatePausedTransfers(Clock::time_point now)
+{
+    for (auto transfer : m_active)
+    {
+        if (transfer->m_paused && transfer->m_resumeTime <= now)
+        {
+            transfer->m_paused = false;
+            curl_easy_pause(transfer->m_handle, CURLPAUSE_CONT);
+        }
+
+        //the read rate limiter charged for data we already accepted; hold off receiving more until that debt is paid
+        if (!transfer->m_paused && transfer->m_writeContext.m_pendingReadDelay.count() > 0)
+        {
+            transfer->m_paused = true;
+            transfer->m_resumeTime = now + transfer->m_writeContext.m_pendingReadDelay;
+            transfer->m_writeContext.m_pendingReadDelay = std::chrono::milliseconds(0);
+            curl_easy_pause(transfer->m_handle, CURLPAUSE_RECV);
+        }
+    }
+}
+
+void CurlMultiHttpClient::CompleteFinishedTransfers()
+{
+    CURLMsg* message = nullptr;
+    int messagesLeft = 0;
+    while ((message = curl_multi_info_read(m_multiHandle, &messagesLeft)) != nullptr)
+    {
+        if (message->msg != CURLMSG_DONE)
+        {
+            continue;
+        }
+
+        CURL* handle = message->easy_handle;
+        CURLcode curlResponseCode = message->data.result;
+
+        char* privateData = nullptr;
+        curl_easy_getinfo(handle, CURLINFO_PRIVATE, &privateData);
+        Transfer* transfer = reinterpret_cast<Transfer*>(privateData);
+
+        curl_multi_remove_handle(m_multiHandle, handle);
+        m_active.remove(transfer);
+
+        TransferTimings timings = transfer->m_request->GetTransferTimings();
+        ReadTransferTimings(handle, timings);
+        transfer->m_request->SetTransferTimings(timings);
+
+        std::shared_ptr<HttpResponse> response(transfer->m_response);
+        if (curlResponseCode != CURLE_OK)
+        {
+            response = nullptr;
+            AWS_LOGSTREAM_ERROR(CurlMultiTag, "Curl returned error code " << curlResponseCode);
+        }
+        else
+        {
+            ReadResponseInfo(handle, *response);
+        }
+
+        ReleaseHandle(handle);
+        transfer->m_handle = nullptr;
+        FinishTransfer(transfer, response);
+    }
+}
+
+int CurlMultiHttpClient::ComputeWaitTimeoutMs(Clock::time_point now) const
+{
+    Clock::time_point wakeTime = now + std::chrono::milliseconds(MAX_POLL_TIMEOUT_MS);
+
+    if (!m_scheduled.empty() && m_active.size() < m_maxConnections)
+    {
+        wakeTime = std::min(wakeTime, m_scheduled.begin()->first);
+    }
+
+    for (auto transfer : m_active)
+    {
+        if (transfer->m_paused)
+        {
+            wakeTime = std::min(wakeTime, transfer->m_resumeTime);
+        }
+    }
+
+    if (wakeTime <= now)
+    {
+        return 0;
+    }
+
+    //round up so we never wake just before a deadline and spin
+    return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(wakeTime - now + std::chrono::milliseconds(1)).count());
+}
+
+CURL* CurlMultiHttpClient::AcquireHandle()
+{
+    if (!m_idleHandles.empty())
+    {
+        CURL* handle = m_idleHandles.back();
+        m_idleHandles.pop_back();
+        return handle;
+    }
+
+    CURL* handle = curl_easy_init();
+    if (handle)
+    {
+        curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, m_requestTimeout);
+        curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT_MS, m_connectTimeout);
+    }
+
+    return handle;
+}
+
+void CurlMultiHttpClient::ReleaseHandle(CURL* handle)
+{
+    //curl_easy_reset drops the per-handle defaults too, so put them back before the handle is reused
+    curl_easy_reset(handle);
+    curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, m_requestTimeout);
+    curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT_MS, m_connectTimeout);
+    m_idleHandles.push_back(handle);
+}
+
+void CurlMultiHttpClient::FinishTransfer(Transfer* transfer, const std::shared_ptr<HttpResponse>& response)
+{
+    if (transfer->m_headers)
+    {
+        curl_slist_free_all(transfer->m_headers);
+    }
+
+    //the response refers back to its request, so the request is kept alive until the callback is done with it
+    if (transfer->m_callback)
+    {
+        transfer->m_callback(response);
+    }
+
+    Aws::Delete(transfer);
+}
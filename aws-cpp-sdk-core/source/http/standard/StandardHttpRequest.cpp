@@ -44,6 +44,14 @@ HeaderValueCollection StandardHttpRequest::GetHeaders() const
     return headers;
 }
 
+void StandardHttpRequest::ForEachHeader(const HeaderVisitor& visitor) const
+{
+    for (const auto& header : headerMap)
+    {
+        visitor(header.first, header.second);
+    }
+}
+
 const Aws::String& StandardHttpRequest::GetHeaderValue(const char* headerName) const
 {
     return headerMap.find(headerName)->second;
@@ -31,9 +31,13 @@ using namespace Aws::Utils;
 std::mutex DateTime::timeMutex;
 
 Aws::String DateTime::CalculateLocalTimestampAsString(const char* formatStr)
+{
+    return CalculateLocalTimestampAsString(std::time(nullptr), formatStr);
+}
+
+Aws::String DateTime::CalculateLocalTimestampAsString(std::time_t time, const char* formatStr)
 {
     std::lock_guard<std::mutex> locker(timeMutex);
-    std::time_t time = std::time(nullptr);
     struct tm* timestamp = std::localtime(&time);
 
     if (timestamp)
@@ -47,9 +51,13 @@ Aws::String DateTime::CalculateLocalTimestampAsString(const char* formatStr)
 }
 
 Aws::String DateTime::CalculateGmtTimestampAsString(const char* formatStr)
+{
+    return CalculateGmtTimestampAsString(std::time(nullptr), formatStr);
+}
+
+Aws::String DateTime::CalculateGmtTimestampAsString(std::time_t time, const char* formatStr)
 {
     std::lock_guard<std::mutex> locker(timeMutex);
-    std::time_t time = std::time(nullptr);
     struct tm* timestamp = std::gmtime(&time);
 
     if(timestamp)
@@ -59,15 +59,16 @@ ByteBuffer HashingUtils::CalculateSHA256(Aws::IOStream& stream)
 
 Aws::String HashingUtils::HexEncode(const ByteBuffer& message)
 {
-    Aws::StringStream ss;
+    static const char* HEX_CHARS = "0123456789abcdef";
 
+    Aws::String encoded(message.GetLength() * 2, '0');
     for (unsigned i = 0; i < message.GetLength(); ++i)
     {
-        ss << std::hex << std::setw(2) << std::setfill('0')
-            << (unsigned int) message[i];
+        encoded[i * 2] = HEX_CHARS[message[i] >> 4];
+        encoded[i * 2 + 1] = HEX_CHARS[message[i] & 0x0f];
     }
 
-    return ss.str();
+    return encoded;
 }
 
 ByteBuffer HashingUtils::CalculateMD5(const Aws::String& str)
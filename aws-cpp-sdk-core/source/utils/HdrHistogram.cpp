@@ -0,0 +1,151 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/HdrHistogram.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace Aws::Utils;
+
+const int64_t HdrHistogram::MAX_VALUE;
+const size_t HdrHistogram::SUB_BUCKET_COUNT;
+const size_t HdrHistogram::HALF_SUB_BUCKET_COUNT;
+const size_t HdrHistogram::BUCKET_COUNT;
+
+HdrHistogram::HdrHistogram() :
+    m_totalCount(0),
+    m_sum(0),
+    m_min(std::numeric_limits<int64_t>::max()),
+    m_max(0)
+{
+    for (auto& count : m_counts)
+    {
+        count.store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t HdrHistogram::GetBucketIndex(uint64_t value)
+{
+    if (value < SUB_BUCKET_COUNT)
+    {
+        return static_cast<size_t>(value);
+    }
+
+    //shift the value down until it lands in the top half of a sub bucket range; each shift is its own set of buckets.
+    size_t shift = 1;
+    while ((value >> shift) >= SUB_BUCKET_COUNT)
+    {
+        ++shift;
+    }
+    return SUB_BUCKET_COUNT + (shift - 1) * HALF_SUB_BUCKET_COUNT + static_cast<size_t>((value >> shift) - HALF_SUB_BUCKET_COUNT);
+}
+
+int64_t HdrHistogram::GetHighestEquivalentValue(size_t bucketIndex)
+{
+    if (bucketIndex < SUB_BUCKET_COUNT)
+    {
+        return static_cast<int64_t>(bucketIndex);
+    }
+
+    size_t relativeIndex = bucketIndex - SUB_BUCKET_COUNT;
+    size_t shift = relativeIndex / HALF_SUB_BUCKET_COUNT + 1;
+    int64_t lowest = static_cast<int64_t>(relativeIndex % HALF_SUB_BUCKET_COUNT + HALF_SUB_BUCKET_COUNT) << shift;
+    return lowest + (static_cast<int64_t>(1) << shift) - 1;
+}
+
+void HdrHistogram::Record(int64_t value)
+{
+    if (value < 0)
+    {
+        return;
+    }
+    if (value > MAX_VALUE)
+    {
+        value = MAX_VALUE;
+    }
+
+    m_counts[GetBucketIndex(static_cast<uint64_t>(value))].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    int64_t currentMin = m_min.load(std::memory_order_relaxed);
+    while (value < currentMin && !m_min.compare_exchange_weak(currentMin, value, std::memory_order_relaxed))
+    {
+    }
+    int64_t currentMax = m_max.load(std::memory_order_relaxed);
+    while (value > currentMax && !m_max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed))
+    {
+    }
+
+    //counted last, so a reader that sees the count also sees the bucket it went into.
+    m_totalCount.fetch_add(1, std::memory_order_release);
+}
+
+int64_t HdrHistogram::GetMin() const
+{
+    return GetTotalCount() == 0 ? 0 : m_min.load(std::memory_order_relaxed);
+}
+
+int64_t HdrHistogram::GetMax() const
+{
+    return m_max.load(std::memory_order_relaxed);
+}
+
+double HdrHistogram::GetMean() const
+{
+    uint64_t totalCount = GetTotalCount();
+    return totalCount == 0 ? 0.0 : static_cast<double>(m_sum.load(std::memory_order_relaxed)) / totalCount;
+}
+
+int64_t HdrHistogram::GetValueAtPercentile(double percentile) const
+{
+    uint64_t totalCount = m_totalCount.load(std::memory_order_acquire);
+    if (totalCount == 0)
+    {
+        return 0;
+    }
+
+    percentile = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+    uint64_t target = static_cast<uint64_t>(std::ceil(percentile / 100.0 * totalCount));
+    if (target == 0)
+    {
+        target = 1;
+    }
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        seen += m_counts[i].load(std::memory_order_relaxed);
+        if (seen >= target)
+        {
+            int64_t value = GetHighestEquivalentValue(i);
+            int64_t max = GetMax();
+            return value < max ? value : max;
+        }
+    }
+    return GetMax();
+}
+
+void HdrHistogram::Reset()
+{
+    m_totalCount.store(0, std::memory_order_relaxed);
+    for (auto& count : m_counts)
+    {
+        count.store(0, std::memory_order_relaxed);
+    }
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
@@ -116,25 +116,34 @@ Aws::Vector<Aws::String> StringUtils::SplitOnLine(const Aws::String& toSplit)
 
 Aws::String StringUtils::URLEncode(const char* unsafe)
 {
-    Aws::StringStream escaped;
-    escaped.fill('0');
-    escaped << std::hex << std::uppercase;
+    Aws::String escaped;
+    URLEncode(unsafe, strlen(unsafe), escaped);
+    return escaped;
+}
+
+void StringUtils::URLEncode(const char* unsafe, size_t length, Aws::String& out)
+{
+    static const char* hexChars = "0123456789ABCDEF";
 
-    size_t unsafeLength = strlen(unsafe);
-    for (auto i = unsafe, n = unsafe + unsafeLength; i != n; ++i)
+    for (auto i = unsafe, n = unsafe + length; i != n; ++i)
     {
         char c = *i;
         if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~')
         {
-            escaped << c;
+            out.push_back(c);
         }
         else
         {
-            escaped << '%' << std::setw(2) << ((int) c) << std::setw(0);
+            out.push_back('%');
+            //bytes above 0x7f have always been written as a sign extended int, and signatures depend on the exact bytes.
+            if (c < 0)
+            {
+                out.append("FFFFFF");
+            }
+            out.push_back(hexChars[(static_cast<unsigned char>(c) >> 4) & 0x0f]);
+            out.push_back(hexChars[static_cast<unsigned char>(c) & 0x0f]);
         }
     }
-
-    return escaped.str();
 }
 
 
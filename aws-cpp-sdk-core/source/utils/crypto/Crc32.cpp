@@ -0,0 +1,82 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/Crc32.h>
+
+using namespace Aws::Utils::Crypto;
+
+namespace
+{
+    //Slicing by 8: table k holds the crc of a byte followed by k zero bytes, so eight input bytes are folded in with
+    //eight independent lookups instead of eight dependent ones.
+    struct Crc32Tables
+    {
+        Crc32Tables()
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+                }
+                m_tables[0][i] = crc;
+            }
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                for (int table = 1; table < 8; ++table)
+                {
+                    m_tables[table][i] = (m_tables[table - 1][i] >> 8) ^ m_tables[0][m_tables[table - 1][i] & 0xFF];
+                }
+            }
+        }
+
+        uint32_t m_tables[8][256];
+    };
+
+    const Crc32Tables& GetTables()
+    {
+        static const Crc32Tables tables;
+        return tables;
+    }
+}
+
+uint32_t Crc32::Calculate(const unsigned char* data, size_t length, uint32_t previousCrc)
+{
+    const uint32_t (&table)[8][256] = GetTables().m_tables;
+    uint32_t crc = ~previousCrc;
+
+    while (length >= 8)
+    {
+        //assemble the words byte by byte so this works regardless of alignment and endianness.
+        uint32_t low = crc ^ (static_cast<uint32_t>(data[0]) | static_cast<uint32_t>(data[1]) << 8 |
+            static_cast<uint32_t>(data[2]) << 16 | static_cast<uint32_t>(data[3]) << 24);
+        uint32_t high = static_cast<uint32_t>(data[4]) | static_cast<uint32_t>(data[5]) << 8 |
+            static_cast<uint32_t>(data[6]) << 16 | static_cast<uint32_t>(data[7]) << 24;
+
+        crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+              table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF] ^ table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
+
+        data += 8;
+        length -= 8;
+    }
+
+    while (length-- > 0)
+    {
+        crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xFF];
+    }
+
+    return ~crc;
+}
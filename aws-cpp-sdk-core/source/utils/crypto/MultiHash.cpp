@@ -0,0 +1,83 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/MultiHash.h>
+
+#include <aws/core/utils/crypto/Crc32.h>
+#include <aws/core/utils/crypto/Hash.h>
+
+#include <istream>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+const int MultiHash::MD5_DIGEST;
+const int MultiHash::SHA256_DIGEST;
+const int MultiHash::CRC32_DIGEST;
+
+void MultiHash::Update(const unsigned char* data, size_t length)
+{
+    if (m_finished || length == 0)
+    {
+        return;
+    }
+
+    UpdateDigests(data, length);
+    if (m_digests & CRC32_DIGEST)
+    {
+        m_crc32 = Crc32::Calculate(data, length, m_crc32);
+    }
+    m_bytesHashed += length;
+}
+
+bool MultiHash::Finish()
+{
+    if (!m_finished)
+    {
+        m_finished = true;
+        m_success = FinishDigests();
+    }
+
+    return m_success;
+}
+
+bool MultiHash::Calculate(const unsigned char* data, size_t length)
+{
+    Update(data, length);
+    return Finish();
+}
+
+bool MultiHash::Calculate(Aws::IStream& stream)
+{
+    auto currentPos = stream.tellg();
+    stream.seekg(0, stream.beg);
+
+    unsigned char streamBuffer[Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE];
+    while (stream.good())
+    {
+        stream.read(reinterpret_cast<char*>(streamBuffer), Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
+        auto bytesRead = stream.gcount();
+
+        if (bytesRead > 0)
+        {
+            Update(streamBuffer, static_cast<size_t>(bytesRead));
+        }
+    }
+
+    stream.clear();
+    stream.seekg(currentPos, stream.beg);
+
+    return Finish();
+}
@@ -0,0 +1,82 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/MultiHash.h>
+
+#include <openssl/md5.h>
+#include <openssl/sha.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char* MULTI_HASH_TAG = "MultiHash";
+
+struct MultiHash::MultiHashContext
+{
+    MD5_CTX m_md5;
+    SHA256_CTX m_sha256;
+};
+
+MultiHash::MultiHash(int digests) :
+    m_digests(digests),
+    m_context(Aws::MakeUnique<MultiHashContext>(MULTI_HASH_TAG)),
+    m_crc32(0),
+    m_bytesHashed(0),
+    m_finished(false),
+    m_success(false)
+{
+    if (m_digests & MD5_DIGEST)
+    {
+        MD5_Init(&m_context->m_md5);
+    }
+    if (m_digests & SHA256_DIGEST)
+    {
+        SHA256_Init(&m_context->m_sha256);
+    }
+}
+
+MultiHash::~MultiHash()
+{
+}
+
+void MultiHash::UpdateDigests(const unsigned char* data, size_t length)
+{
+    if (m_digests & MD5_DIGEST)
+    {
+        MD5_Update(&m_context->m_md5, data, length);
+    }
+    if (m_digests & SHA256_DIGEST)
+    {
+        SHA256_Update(&m_context->m_sha256, data, length);
+    }
+}
+
+bool MultiHash::FinishDigests()
+{
+    if (m_digests & MD5_DIGEST)
+    {
+        ByteBuffer hash(MD5_DIGEST_LENGTH);
+        MD5_Final(hash.GetUnderlyingData(), &m_context->m_md5);
+        m_md5 = std::move(hash);
+    }
+    if (m_digests & SHA256_DIGEST)
+    {
+        ByteBuffer hash(SHA256_DIGEST_LENGTH);
+        SHA256_Final(hash.GetUnderlyingData(), &m_context->m_sha256);
+        m_sha256 = std::move(hash);
+    }
+
+    return true;
+}
@@ -0,0 +1,182 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/MultiHash.h>
+
+#include <aws/core/utils/logging/LogMacros.h>
+
+#define WIN32_NO_STATUS 
+#include <windows.h> 
+#undef WIN32_NO_STATUS 
+
+#include <bcrypt.h> 
+#include <winternl.h> 
+#include <winerror.h> 
+
+#include <algorithm>
+#include <limits>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char* MULTI_HASH_TAG = "MultiHash";
+
+namespace
+{
+    // One BCrypt hash in progress. The hash object memory is left to BCrypt (Windows 7 and later), so nothing needs
+    // to be sized up front.
+    class BCryptDigest
+    {
+        public:
+
+            BCryptDigest() : m_algorithmHandle(nullptr), m_hashHandle(nullptr), m_isValid(false) {}
+
+            ~BCryptDigest()
+            {
+                if (m_hashHandle)
+                {
+                    BCryptDestroyHash(m_hashHandle);
+                }
+                if (m_algorithmHandle)
+                {
+                    BCryptCloseAlgorithmProvider(m_algorithmHandle, 0);
+                }
+            }
+
+            void Init(LPCWSTR algorithmName)
+            {
+                NTSTATUS status = BCryptOpenAlgorithmProvider(&m_algorithmHandle, algorithmName, MS_PRIMITIVE_PROVIDER, 0);
+                if (!NT_SUCCESS(status))
+                {
+                    AWS_LOG_ERROR(MULTI_HASH_TAG, "Failed initializing BCryptOpenAlgorithmProvider for ", algorithmName);
+                    return;
+                }
+
+                status = BCryptCreateHash(m_algorithmHandle, &m_hashHandle, nullptr, 0, nullptr, 0, 0);
+                if (!NT_SUCCESS(status))
+                {
+                    AWS_LOG_ERROR(MULTI_HASH_TAG, "Error creating hash handle.");
+                    return;
+                }
+
+                m_isValid = true;
+            }
+
+            void Update(const unsigned char* data, size_t length)
+            {
+                while (m_isValid && length > 0)
+                {
+                    ULONG chunk = static_cast<ULONG>((std::min)(length, static_cast<size_t>((std::numeric_limits<ULONG>::max)())));
+                    NTSTATUS status = BCryptHashData(m_hashHandle, const_cast<PUCHAR>(data), chunk, 0);
+                    if (!NT_SUCCESS(status))
+                    {
+                        AWS_LOG_ERROR(MULTI_HASH_TAG, "Error computing hash.");
+                        m_isValid = false;
+                    }
+                    data += chunk;
+                    length -= chunk;
+                }
+            }
+
+            bool Finish(ByteBuffer& digest)
+            {
+                if (!m_isValid)
+                {
+                    return false;
+                }
+
+                DWORD hashLength = 0;
+                DWORD resultLength = 0;
+                NTSTATUS status = BCryptGetProperty(m_algorithmHandle, BCRYPT_HASH_LENGTH, (PBYTE)&hashLength, sizeof(hashLength), &resultLength, 0);
+                if (!NT_SUCCESS(status) || hashLength == 0)
+                {
+                    AWS_LOG_ERROR(MULTI_HASH_TAG, "Error computing hash buffer length.");
+                    return false;
+                }
+
+                ByteBuffer hash(hashLength);
+                status = BCryptFinishHash(m_hashHandle, hash.GetUnderlyingData(), hashLength, 0);
+                if (!NT_SUCCESS(status))
+                {
+                    AWS_LOG_ERROR(MULTI_HASH_TAG, "Error obtaining computed hash");
+                    return false;
+                }
+
+                digest = std::move(hash);
+                return true;
+            }
+
+        private:
+
+            BCRYPT_ALG_HANDLE m_algorithmHandle;
+            BCRYPT_HASH_HANDLE m_hashHandle;
+            bool m_isValid;
+    };
+}
+
+struct MultiHash::MultiHashContext
+{
+    BCryptDigest m_md5;
+    BCryptDigest m_sha256;
+};
+
+MultiHash::MultiHash(int digests) :
+    m_digests(digests),
+    m_context(Aws::MakeUnique<MultiHashContext>(MULTI_HASH_TAG)),
+    m_crc32(0),
+    m_bytesHashed(0),
+    m_finished(false),
+    m_success(false)
+{
+    if (m_digests & MD5_DIGEST)
+    {
+        m_context->m_md5.Init(BCRYPT_MD5_ALGORITHM);
+    }
+    if (m_digests & SHA256_DIGEST)
+    {
+        m_context->m_sha256.Init(BCRYPT_SHA256_ALGORITHM);
+    }
+}
+
+MultiHash::~MultiHash()
+{
+}
+
+void MultiHash::UpdateDigests(const unsigned char* data, size_t length)
+{
+    if (m_digests & MD5_DIGEST)
+    {
+        m_context->m_md5.Update(data, length);
+    }
+    if (m_digests & SHA256_DIGEST)
+    {
+        m_context->m_sha256.Update(data, length);
+    }
+}
+
+bool MultiHash::FinishDigests()
+{
+    bool success = true;
+    if (m_digests & MD5_DIGEST)
+    {
+        success = m_context->m_md5.Finish(m_md5) && success;
+    }
+    if (m_digests & SHA256_DIGEST)
+    {
+        success = m_context->m_sha256.Finish(m_sha256) && success;
+    }
+
+    return success;
+}
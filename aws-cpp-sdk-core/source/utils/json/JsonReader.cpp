@@ -0,0 +1,544 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <cstdlib>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+
+static const int END_OF_STREAM = -1;
+
+JsonReader::JsonReader(Aws::IStream& istream) :
+    m_stream(istream),
+    m_position(0),
+    m_length(0),
+    m_offset(0),
+    m_afterName(false),
+    m_afterValue(false),
+    m_afterComma(false),
+    m_token(JsonToken::END_DOCUMENT),
+    m_bool(false)
+{
+}
+
+bool JsonReader::Fill()
+{
+    m_offset += m_length;
+    m_position = 0;
+    m_length = 0;
+    if (m_stream.good())
+    {
+        m_stream.read(m_buffer, BUFFER_SIZE);
+        m_length = static_cast<size_t>(m_stream.gcount());
+    }
+
+    return m_length > 0;
+}
+
+int JsonReader::Peek()
+{
+    if (m_position == m_length && !Fill())
+    {
+        return END_OF_STREAM;
+    }
+
+    return static_cast<unsigned char>(m_buffer[m_position]);
+}
+
+int JsonReader::SkipWhitespace()
+{
+    for (;;)
+    {
+        int c = Peek();
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+        {
+            return c;
+        }
+        ++m_position;
+    }
+}
+
+JsonToken JsonReader::Fail(const char* message)
+{
+    Aws::StringStream ss;
+    ss << message << " at offset " << (m_offset + m_position);
+    m_errorMessage = ss.str();
+    m_token = JsonToken::PARSE_ERROR;
+    return m_token;
+}
+
+JsonToken JsonReader::Next()
+{
+    if (m_token == JsonToken::PARSE_ERROR)
+    {
+        return m_token;
+    }
+
+    int c = SkipWhitespace();
+    if (m_containers.empty())
+    {
+        if (m_afterValue || c == END_OF_STREAM)
+        {
+            if (c != END_OF_STREAM)
+            {
+                return Fail("Unexpected data after the end of the document");
+            }
+            m_token = JsonToken::END_DOCUMENT;
+            return m_token;
+        }
+        return ReadValueToken(c);
+    }
+
+    if (c == END_OF_STREAM)
+    {
+        return Fail("Unexpected end of document");
+    }
+
+    if (m_containers.back() == '{')
+    {
+        if (m_afterName)
+        {
+            if (c != ':')
+            {
+                return Fail("Expected ':' after member name");
+            }
+            ++m_position;
+            return ReadValueToken(SkipWhitespace());
+        }
+
+        if (c == '}' && !m_afterComma)
+        {
+            ++m_position;
+            m_containers.pop_back();
+            m_afterValue = true;
+            m_token = JsonToken::END_OBJECT;
+            return m_token;
+        }
+
+        if (m_afterValue)
+        {
+            if (c != ',')
+            {
+                return Fail("Expected ',' or '}' after object member");
+            }
+            ++m_position;
+            m_afterValue = false;
+            m_afterComma = true;
+            c = SkipWhitespace();
+        }
+
+        if (c != '"')
+        {
+            return Fail("Expected member name");
+        }
+        ++m_position;
+        if (!ReadString())
+        {
+            return m_token;
+        }
+        m_afterName = true;
+        m_afterComma = false;
+        m_token = JsonToken::NAME;
+        return m_token;
+    }
+
+    if (c == ']' && !m_afterComma)
+    {
+        ++m_position;
+        m_containers.pop_back();
+        m_afterValue = true;
+        m_token = JsonToken::END_ARRAY;
+        return m_token;
+    }
+
+    if (m_afterValue)
+    {
+        if (c != ',')
+        {
+            return Fail("Expected ',' or ']' after array element");
+        }
+        ++m_position;
+        m_afterValue = false;
+        c = SkipWhitespace();
+    }
+
+    return ReadValueToken(c);
+}
+
+JsonToken JsonReader::ReadValueToken(int c)
+{
+    m_afterName = false;
+    m_afterComma = false;
+    switch (c)
+    {
+    case '{':
+    case '[':
+        ++m_position;
+        m_containers.push_back(static_cast<char>(c));
+        m_afterValue = false;
+        m_token = c == '{' ? JsonToken::BEGIN_OBJECT : JsonToken::BEGIN_ARRAY;
+        return m_token;
+    case '"':
+        ++m_position;
+        if (!ReadString())
+        {
+            return m_token;
+        }
+        m_token = JsonToken::STRING;
+        break;
+    case 't':
+        if (!ReadLiteral("true", 4))
+        {
+            return m_token;
+        }
+        m_bool = true;
+        m_token = JsonToken::BOOL;
+        break;
+    case 'f':
+        if (!ReadLiteral("false", 5))
+        {
+            return m_token;
+        }
+        m_bool = false;
+        m_token = JsonToken::BOOL;
+        break;
+    case 'n':
+        if (!ReadLiteral("null", 4))
+        {
+            return m_token;
+        }
+        m_token = JsonToken::NULL_VALUE;
+        break;
+    default:
+        if (c != '-' && (c < '0' || c > '9'))
+        {
+            return Fail(c == END_OF_STREAM ? "Unexpected end of document" : "Expected a value");
+        }
+        if (!ReadNumber())
+        {
+            return m_token;
+        }
+        m_token = JsonToken::NUMBER;
+        break;
+    }
+
+    m_afterValue = true;
+    return m_token;
+}
+
+bool JsonReader::ReadLiteral(const char* literal, size_t length)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (Peek() != literal[i])
+        {
+            Fail("Invalid literal");
+            return false;
+        }
+        ++m_position;
+    }
+
+    return true;
+}
+
+bool JsonReader::ReadNumber()
+{
+    m_string.clear();
+    for (;;)
+    {
+        int c = Peek();
+        if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')
+        {
+            m_string.push_back(static_cast<char>(c));
+            ++m_position;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    //let strtod be the judge of anything like "1-2" or "1e" that slipped through the character filter.
+    char* end = nullptr;
+    strtod(m_string.c_str(), &end);
+    if (end != m_string.c_str() + m_string.length())
+    {
+        Fail("Invalid number");
+        return false;
+    }
+
+    return true;
+}
+
+static int HexValue(int c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool JsonReader::ReadUnicodeEscape(unsigned& codePoint)
+{
+    codePoint = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        int digit = HexValue(Peek());
+        if (digit < 0)
+        {
+            Fail("Invalid unicode escape");
+            return false;
+        }
+        codePoint = (codePoint << 4) | static_cast<unsigned>(digit);
+        ++m_position;
+    }
+
+    return true;
+}
+
+static void AppendUtf8(Aws::String& out, unsigned codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        out.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+//the opening quote has already been consumed.
+bool JsonReader::ReadString()
+{
+    m_string.clear();
+    for (;;)
+    {
+        if (m_position == m_length && !Fill())
+        {
+            Fail("Unterminated string");
+            return false;
+        }
+
+        //copy the run of plain characters in the buffer in one go.
+        size_t runStart = m_position;
+        while (m_position < m_length && m_buffer[m_position] != '"' && m_buffer[m_position] != '\\')
+        {
+            ++m_position;
+        }
+        m_string.append(m_buffer + runStart, m_position - runStart);
+        if (m_position == m_length)
+        {
+            continue;
+        }
+
+        char c = m_buffer[m_position++];
+        if (c == '"')
+        {
+            return true;
+        }
+
+        int escaped = Peek();
+        ++m_position;
+        switch (escaped)
+        {
+        case '"': m_string.push_back('"'); break;
+        case '\\': m_string.push_back('\\'); break;
+        case '/': m_string.push_back('/'); break;
+        case 'b': m_string.push_back('\b'); break;
+        case 'f': m_string.push_back('\f'); break;
+        case 'n': m_string.push_back('\n'); break;
+        case 'r': m_string.push_back('\r'); break;
+        case 't': m_string.push_back('\t'); break;
+        case 'u':
+        {
+            unsigned codePoint;
+            if (!ReadUnicodeEscape(codePoint))
+            {
+                return false;
+            }
+            //a high surrogate has to be followed by the escaped low half of the pair.
+            if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+            {
+                unsigned lowSurrogate;
+                if (Peek() != '\\' || (++m_position, Peek() != 'u') || (++m_position, !ReadUnicodeEscape(lowSurrogate)) ||
+                    lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+                {
+                    if (m_token != JsonToken::PARSE_ERROR)
+                    {
+                        Fail("Invalid surrogate pair");
+                    }
+                    return false;
+                }
+                codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+            }
+            AppendUtf8(m_string, codePoint);
+            break;
+        }
+        default:
+            Fail("Invalid escape sequence");
+            return false;
+        }
+    }
+}
+
+int JsonReader::GetInteger() const
+{
+    return static_cast<int>(StringUtils::ConvertToInt32(m_string.c_str()));
+}
+
+long long JsonReader::GetInt64() const
+{
+    return StringUtils::ConvertToInt64(m_string.c_str());
+}
+
+double JsonReader::GetDouble() const
+{
+    return StringUtils::ConvertToDouble(m_string.c_str());
+}
+
+void JsonReader::SkipValue()
+{
+    if (m_token != JsonToken::BEGIN_OBJECT && m_token != JsonToken::BEGIN_ARRAY)
+    {
+        return;
+    }
+
+    size_t depth = m_containers.size();
+    while (m_containers.size() >= depth)
+    {
+        JsonToken token = Next();
+        if (token == JsonToken::PARSE_ERROR || token == JsonToken::END_DOCUMENT)
+        {
+            return;
+        }
+    }
+}
+
+void JsonReader::ReadObject(const std::function<void(const Aws::String& name)>& readMember)
+{
+    if (m_token != JsonToken::BEGIN_OBJECT)
+    {
+        SkipValue();
+        return;
+    }
+
+    size_t depth = m_containers.size();
+    while (Next() == JsonToken::NAME)
+    {
+        Aws::String name(m_string);
+        if (Next() == JsonToken::PARSE_ERROR)
+        {
+            return;
+        }
+        readMember(name);
+        SkipToDepth(depth);
+    }
+}
+
+void JsonReader::ReadArray(const std::function<void()>& readElement)
+{
+    if (m_token != JsonToken::BEGIN_ARRAY)
+    {
+        SkipValue();
+        return;
+    }
+
+    size_t depth = m_containers.size();
+    while (Next() != JsonToken::END_ARRAY && m_token != JsonToken::PARSE_ERROR && m_token != JsonToken::END_DOCUMENT)
+    {
+        readElement();
+        SkipToDepth(depth);
+    }
+}
+
+//consumes tokens until the reader is back inside the container at depth, i.e. on the last token of one of its values.
+void JsonReader::SkipToDepth(size_t depth)
+{
+    while (m_containers.size() > depth && m_token != JsonToken::PARSE_ERROR && m_token != JsonToken::END_DOCUMENT)
+    {
+        Next();
+    }
+}
+
+JsonValue JsonReader::ReadValue()
+{
+    JsonValue value;
+    switch (m_token)
+    {
+    case JsonToken::BEGIN_OBJECT:
+        while (Next() == JsonToken::NAME)
+        {
+            Aws::String name(m_string);
+            Next();
+            value.WithObject(name, ReadValue());
+        }
+        break;
+    case JsonToken::BEGIN_ARRAY:
+    {
+        Aws::Vector<JsonValue> elements;
+        while (Next() != JsonToken::END_ARRAY && m_token != JsonToken::PARSE_ERROR)
+        {
+            elements.push_back(ReadValue());
+        }
+        Array<JsonValue> array(elements.size());
+        for (size_t i = 0; i < elements.size(); ++i)
+        {
+            array[i] = std::move(elements[i]);
+        }
+        value.AsArray(std::move(array));
+        break;
+    }
+    case JsonToken::STRING:
+        value.AsString(m_string);
+        break;
+    case JsonToken::NUMBER:
+        if (m_string.find_first_of(".eE") == Aws::String::npos)
+        {
+            value.AsInt64(GetInt64());
+        }
+        else
+        {
+            value.AsDouble(GetDouble());
+        }
+        break;
+    case JsonToken::BOOL:
+        value.AsBool(m_bool);
+        break;
+    default:
+        break;
+    }
+
+    return value;
+}
@@ -15,9 +15,133 @@
 
 #include <aws/core/utils/json/JsonSerializer.h>
 
+#include <cstdio>
+#include <cstring>
+
 using namespace Aws::Utils;
 using namespace Aws::Utils::Json;
 
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+//lets the compact writer below append to a string with the same calls it makes on a stream.
+class StringSink
+{
+public:
+    StringSink(Aws::String& out) : m_out(out) {}
+
+    void put(char c) { m_out.push_back(c); }
+    void write(const char* data, size_t length) { m_out.append(data, length); }
+
+private:
+    Aws::String& m_out;
+};
+
+//same escaping as the json-cpp writers, but copies runs of plain characters straight into the output.
+template<typename Output>
+static void WriteQuotedString(Output& output, const char* value)
+{
+    output.put('"');
+    const char* run = value;
+    for (const char* c = value; *c != 0; ++c)
+    {
+        const char* escape = nullptr;
+        switch (*c)
+        {
+        case '"':  escape = "\\\""; break;
+        case '\\': escape = "\\\\"; break;
+        case '\b': escape = "\\b"; break;
+        case '\f': escape = "\\f"; break;
+        case '\n': escape = "\\n"; break;
+        case '\r': escape = "\\r"; break;
+        case '\t': escape = "\\t"; break;
+        default:
+            if (*c > 0 && *c <= 0x1F)
+            {
+                output.write(run, c - run);
+                char unicodeEscape[6] = { '\\', 'u', '0', '0', HEX_DIGITS[(*c >> 4) & 0xF], HEX_DIGITS[*c & 0xF] };
+                output.write(unicodeEscape, sizeof(unicodeEscape));
+                run = c + 1;
+            }
+            continue;
+        }
+
+        output.write(run, c - run);
+        output.write(escape, 2);
+        run = c + 1;
+    }
+    output.write(run, strlen(run));
+    output.put('"');
+}
+
+template<typename Output>
+static void WriteCompactValue(Output& output, const Aws::External::Json::Value& value)
+{
+    char numberBuffer[32];
+    switch (value.type())
+    {
+    case Aws::External::Json::nullValue:
+        output.write("null", 4);
+        break;
+    case Aws::External::Json::intValue:
+        output.write(numberBuffer, snprintf(numberBuffer, sizeof(numberBuffer), "%lld", static_cast<long long>(value.asLargestInt())));
+        break;
+    case Aws::External::Json::uintValue:
+        output.write(numberBuffer, snprintf(numberBuffer, sizeof(numberBuffer), "%llu", static_cast<unsigned long long>(value.asLargestUInt())));
+        break;
+    case Aws::External::Json::realValue:
+    {
+        //doubles go through json-cpp so they round trip exactly the way the rest of the sdk reads them.
+        Aws::String real = Aws::External::Json::valueToString(value.asDouble());
+        output.write(real.c_str(), real.length());
+        break;
+    }
+    case Aws::External::Json::stringValue:
+        WriteQuotedString(output, value.asCString());
+        break;
+    case Aws::External::Json::booleanValue:
+        if (value.asBool())
+        {
+            output.write("true", 4);
+        }
+        else
+        {
+            output.write("false", 5);
+        }
+        break;
+    case Aws::External::Json::arrayValue:
+    {
+        output.put('[');
+        Aws::External::Json::ArrayIndex size = value.size();
+        for (Aws::External::Json::ArrayIndex index = 0; index < size; ++index)
+        {
+            if (index > 0)
+            {
+                output.put(',');
+            }
+            WriteCompactValue(output, value[index]);
+        }
+        output.put(']');
+        break;
+    }
+    case Aws::External::Json::objectValue:
+    {
+        output.put('{');
+        for (auto member = value.begin(); member != value.end(); ++member)
+        {
+            if (member != value.begin())
+            {
+                output.put(',');
+            }
+            WriteQuotedString(output, member.memberName());
+            output.put(':');
+            WriteCompactValue(output, *member);
+        }
+        output.put('}');
+        break;
+    }
+    }
+}
+
 JsonValue::JsonValue() : m_wasParseSuccessful(true)
 {
 }
@@ -459,8 +583,10 @@ Aws::String JsonValue::WriteCompact(bool treatAsObject) const
         return "{}";
     }
 
-    Aws::External::Json::FastWriter fastWriter;
-    return fastWriter.write(m_value);
+    Aws::String compact;
+    StringSink sink(compact);
+    WriteCompactValue(sink, m_value);
+    return compact;
 }
 
 void JsonValue::WriteCompact(Aws::OStream& ostream, bool treatAsObject) const
@@ -471,8 +597,7 @@ void JsonValue::WriteCompact(Aws::OStream& ostream, bool treatAsObject) const
         return;
     }
 
-    Aws::String compactString = WriteCompact();
-    ostream.write(compactString.c_str(), compactString.length());
+    WriteCompactValue(ostream, m_value);
 }
 
 Aws::String JsonValue::WriteReadable(bool treatAsObject) const
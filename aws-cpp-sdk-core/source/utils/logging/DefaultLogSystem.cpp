@@ -17,8 +17,9 @@
 #include <aws/core/utils/logging/DefaultLogSystem.h>
 
 #include <aws/core/utils/DateTime.h>
-#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/AWSMemory.h>
 
+#include <chrono>
 #include <fstream>
 
 using namespace Aws::Utils;
@@ -26,85 +27,75 @@ using namespace Aws::Utils::Logging;
 
 static const char* AllocationTag = "DefaultLogSystem";
 
+const size_t DefaultLogSystem::DEFAULT_QUEUE_CAPACITY;
+const long DefaultLogSystem::FLUSH_INTERVAL_MS;
+
 static std::shared_ptr<Aws::OFStream> MakeDefaultLogFile(const Aws::String filenamePrefix)
 {
     Aws::String newFileName = filenamePrefix + DateTime::CalculateLocalTimestampAsString("%Y-%m-%d-%H") + ".log";
     return Aws::MakeShared<Aws::OFStream>(AllocationTag, newFileName.c_str(), Aws::OFStream::out | Aws::OFStream::app);
 }
 
-static void LogThread(DefaultLogSystem::LogSynchronizationData* syncData, const std::shared_ptr<Aws::OStream>& logFile, const Aws::String& filenamePrefix, bool rollLog)
+static void LogThread(LogQueue<Aws::String>* queue, const std::shared_ptr<Aws::OStream>& logFile, const Aws::String& filenamePrefix, bool rollLog)
 {
-    bool done = false;
     int32_t lastRolledHour = DateTime::CalculateCurrentHour();
     std::shared_ptr<Aws::OStream> log = logFile;
 
-    while(!done)
-    {
-        std::unique_lock<std::mutex> locker(syncData->m_logQueueMutex);
-        syncData->m_queueSignal.wait(locker, [&](){ return syncData->m_stopLogging.load() == true || syncData->m_queuedLogMessages.size() > 0; } );
-
-        Aws::Vector<Aws::String> messages;
-        while(!syncData->m_queuedLogMessages.empty())
+    queue->RunWriter(std::chrono::milliseconds(DefaultLogSystem::FLUSH_INTERVAL_MS),
+        [](const Aws::String& statement, Aws::String& batch)
         {
-            messages.push_back(syncData->m_queuedLogMessages.front());
-            syncData->m_queuedLogMessages.pop();
-        }
-
-        done = syncData->m_stopLogging.load() && syncData->m_queuedLogMessages.size() == 0;
-        locker.unlock();
-
-        if(messages.size() > 0)
+            batch.append(statement);
+        },
+        [&](const Aws::String& batch)
         {
             if (rollLog)
             {
                 int32_t currentHour = DateTime::CalculateCurrentHour();
                 if (currentHour != lastRolledHour)
                 {
+                    log->flush();
                     log = MakeDefaultLogFile(filenamePrefix);
                     lastRolledHour = currentHour;
                 }
             }
 
-            for (uint32_t i = 0; i < messages.size(); ++i)
-            {
-                (*log) << messages[i];
-            }
+            log->write(batch.c_str(), batch.size());
+        },
+        [&]()
+        {
             log->flush();
-        }
-    }
+        });
 }
 
-DefaultLogSystem::DefaultLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile) :
+DefaultLogSystem::DefaultLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile, size_t queueCapacity,
+    LogOverflowPolicy overflowPolicy) :
     Base(logLevel),
-    m_syncData(),
+    m_queue(queueCapacity, overflowPolicy, AllocationTag),
     m_loggingThread()
 {
-    m_loggingThread = std::thread(LogThread, &m_syncData, logFile, "", false);
+    m_loggingThread = std::thread(LogThread, &m_queue, logFile, "", false);
 }
 
-DefaultLogSystem::DefaultLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix) :
+DefaultLogSystem::DefaultLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix, size_t queueCapacity,
+    LogOverflowPolicy overflowPolicy) :
     Base(logLevel),
-    m_syncData(),
+    m_queue(queueCapacity, overflowPolicy, AllocationTag),
     m_loggingThread()
 {
-    m_loggingThread = std::thread(LogThread, &m_syncData, MakeDefaultLogFile(filenamePrefix), filenamePrefix, true);
+    m_loggingThread = std::thread(LogThread, &m_queue, MakeDefaultLogFile(filenamePrefix), filenamePrefix, true);
 }
 
 DefaultLogSystem::~DefaultLogSystem()
 {
-    m_syncData.m_stopLogging.store(true);
-    m_syncData.m_queueSignal.notify_one();
-
+    m_queue.Stop();
     m_loggingThread.join();
 }
 
 void DefaultLogSystem::ProcessFormattedStatement(Aws::String&& statement)
 {
+    m_queue.Push([&statement](Aws::String& slotStatement)
     {
-        std::lock_guard<std::mutex> locker(m_syncData.m_logQueueMutex);
-        m_syncData.m_queuedLogMessages.push(std::move(statement));
-    }
-
-    m_syncData.m_queueSignal.notify_one();
+        //assign rather than move so the slot keeps its buffer for the next lap.
+        slotStatement.assign(statement);
+    });
 }
-
@@ -18,53 +18,148 @@
 
 #include <aws/core/utils/DateTime.h>
 #include <aws/core/utils/Array.h>
+#include <aws/core/utils/threading/ThreadIdHash.h>
 
-#include <fstream>
+#include <algorithm>
+#include <atomic>
 #include <cstdarg>
+#include <cstring>
+#include <ctime>
 #include <stdio.h>
 #include <thread>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Logging;
 
-static Aws::String CreateLogPrefixLine(LogLevel logLevel, const char* tag)
+namespace
 {
-    Aws::StringStream ss;
+    //Formatting the timestamp takes DateTime's global lock and calls localtime/strftime, and the thread id can only be
+    //formatted through a stream, so both are remembered per thread and only redone when the second or the thread changes.
+    //Threads hash into a small table of slots (see HashCurrentThreadId); a thread that finds its slot busy just formats
+    //its prefix from scratch.
+    static const size_t PREFIX_CACHE_SLOTS = 32;
+    static const size_t PREFIX_TEXT_SIZE = 32;
+    static const size_t INITIAL_MESSAGE_RESERVE = 256;
+
+    struct PrefixCacheSlot
+    {
+        std::atomic<bool> m_busy;
+        std::time_t m_second;
+        std::thread::id m_threadId;
+        char m_timestamp[PREFIX_TEXT_SIZE];
+        size_t m_timestampLength;
+        char m_threadIdText[PREFIX_TEXT_SIZE];
+        size_t m_threadIdLength;
+        char m_padding[64];
+    };
+
+    static PrefixCacheSlot prefixCache[PREFIX_CACHE_SLOTS];
+
+    PrefixCacheSlot& GetPrefixCacheSlot()
+    {
+        return prefixCache[Threading::HashCurrentThreadId() % PREFIX_CACHE_SLOTS];
+    }
 
-    switch(logLevel)
+    const char* GetLevelText(LogLevel logLevel)
     {
-        case LogLevel::Error:
-            ss << "[ERROR] ";
-            break;
+        switch(logLevel)
+        {
+            case LogLevel::Error:
+                return "[ERROR] ";
+            case LogLevel::Fatal:
+                return "[FATAL] ";
+            case LogLevel::Warn:
+                return "[WARN] ";
+            case LogLevel::Info:
+                return "[INFO] ";
+            case LogLevel::Debug:
+                return "[DEBUG] ";
+            case LogLevel::Trace:
+                return "[TRACE] ";
+            default:
+                return "[UNKOWN] ";
+        }
+    }
 
-        case LogLevel::Fatal:
-            ss << "[FATAL] ";
-            break;
+    size_t FormatTimestamp(std::time_t second, char* buffer)
+    {
+        Aws::String timestamp = DateTime::CalculateLocalTimestampAsString(second, "%Y-%m-%d %H:%M:%S");
+        size_t length = (std::min)(timestamp.size(), PREFIX_TEXT_SIZE - 1);
+        memcpy(buffer, timestamp.c_str(), length);
+        return length;
+    }
 
-        case LogLevel::Warn:
-            ss << "[WARN] ";
-            break;
+    size_t FormatThreadId(char* buffer)
+    {
+        Aws::StringStream ss;
+        ss << std::this_thread::get_id();
+        Aws::String threadId = ss.str();
+        size_t length = (std::min)(threadId.size(), PREFIX_TEXT_SIZE - 1);
+        memcpy(buffer, threadId.c_str(), length);
+        return length;
+    }
 
-        case LogLevel::Info:
-            ss << "[INFO] ";
-            break;
+    void AppendPrefixParts(Aws::String& statement, LogLevel logLevel, const char* tag, const char* timestamp, size_t timestampLength,
+                           const char* threadId, size_t threadIdLength)
+    {
+        statement.append(GetLevelText(logLevel));
+        statement.append(timestamp, timestampLength);
+        statement.append(" ");
+        statement.append(tag);
+        statement.append(" [");
+        statement.append(threadId, threadIdLength);
+        statement.append("] ");
+    }
+
+    //returns the length of the fully formatted message, even when it did not fit in the buffer.
+    int PrintMessage(char* buffer, size_t size, const char* formatStr, va_list args)
+    {
+    #ifdef WIN32
+        va_list countArgs;
+        va_copy(countArgs, args);
+        int length = _vsnprintf_s(buffer, size, _TRUNCATE, formatStr, args);
+        if (length < 0)
+        {
+            length = _vscprintf(formatStr, countArgs);
+        }
+        va_end(countArgs);
+        return length;
+    #else
+        return vsnprintf(buffer, size, formatStr, args);
+    #endif // WIN32
+    }
+}
 
-        case LogLevel::Debug:
-            ss << "[DEBUG] ";
-            break;
+static void AppendLogPrefix(Aws::String& statement, LogLevel logLevel, const char* tag)
+{
+    std::time_t now = std::time(nullptr);
+    PrefixCacheSlot& slot = GetPrefixCacheSlot();
 
-        case LogLevel::Trace:
-            ss << "[TRACE] ";
-            break;
+    bool expected = false;
+    if (!slot.m_busy.compare_exchange_strong(expected, true, std::memory_order_acquire))
+    {
+        char timestamp[PREFIX_TEXT_SIZE];
+        char threadId[PREFIX_TEXT_SIZE];
+        size_t timestampLength = FormatTimestamp(now, timestamp);
+        size_t threadIdLength = FormatThreadId(threadId);
+        AppendPrefixParts(statement, logLevel, tag, timestamp, timestampLength, threadId, threadIdLength);
+        return;
+    }
 
-        default:
-            ss << "[UNKOWN] ";
-            break;
+    if (slot.m_threadId != std::this_thread::get_id())
+    {
+        slot.m_threadId = std::this_thread::get_id();
+        slot.m_threadIdLength = FormatThreadId(slot.m_threadIdText);
     }
 
-    ss << DateTime::CalculateLocalTimestampAsString("%Y-%m-%d %H:%M:%S") << " " << tag << " [" << std::this_thread::get_id() << "] ";
+    if (slot.m_second != now)
+    {
+        slot.m_second = now;
+        slot.m_timestampLength = FormatTimestamp(now, slot.m_timestamp);
+    }
 
-    return ss.str();
+    AppendPrefixParts(statement, logLevel, tag, slot.m_timestamp, slot.m_timestampLength, slot.m_threadIdText, slot.m_threadIdLength);
+    slot.m_busy.store(false, std::memory_order_release);
 }
 
 FormattedLogSystem::FormattedLogSystem(LogLevel logLevel) :
@@ -74,39 +169,44 @@ FormattedLogSystem::FormattedLogSystem(LogLevel logLevel) :
 
 void FormattedLogSystem::Log(LogLevel logLevel, const char* tag, const char* formatStr, ...)
 {
-    Aws::StringStream ss;
-    ss << CreateLogPrefixLine(logLevel, tag);
+    Aws::String statement;
+    statement.reserve(INITIAL_MESSAGE_RESERVE);
+    AppendLogPrefix(statement, logLevel, tag);
+    size_t prefixLength = statement.size();
 
     std::va_list args;
     va_start(args, formatStr);
 
+    //format straight into the statement, and only go around a second time for messages that didn't fit.
+    size_t available = (std::max)(statement.capacity(), prefixLength + INITIAL_MESSAGE_RESERVE) - prefixLength;
+    statement.resize(prefixLength + available);
+
     va_list tmp_args; //unfortunately you cannot consume a va_list twice
     va_copy(tmp_args, args); //so we have to copy it
-    #ifdef WIN32
-        const int requiredLength = _vscprintf(formatStr, tmp_args) + 1;
-    #else
-        const int requiredLength = vsnprintf(nullptr, 0, formatStr, tmp_args) + 1;
-    #endif
+    int messageLength = PrintMessage(&statement[prefixLength], available, formatStr, tmp_args);
     va_end(tmp_args);
 
-    Array<char> outputBuff(requiredLength);
-    #ifdef WIN32
-        vsnprintf_s(outputBuff.GetUnderlyingData(), requiredLength, _TRUNCATE, formatStr, args);
-    #else
-        vsnprintf(outputBuff.GetUnderlyingData(), requiredLength, formatStr, args);
-    #endif // WIN32
+    if (messageLength >= 0 && static_cast<size_t>(messageLength) >= available)
+    {
+        statement.resize(prefixLength + messageLength + 1);
+        PrintMessage(&statement[prefixLength], messageLength + 1, formatStr, args);
+    }
+    va_end(args);
 
-    ss << outputBuff.GetUnderlyingData() << std::endl;  
-  
-    ProcessFormattedStatement(std::move(ss.str()));
+    statement.resize(prefixLength + (std::max)(messageLength, 0));
+    statement.push_back('\n');
 
-    va_end(args);
+    ProcessFormattedStatement(std::move(statement));
 }
 
 void FormattedLogSystem::LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &message_stream)
 {
-    Aws::StringStream ss;
-    ss << CreateLogPrefixLine(logLevel, tag) << message_stream.rdbuf()->str() << std::endl;
-
-    ProcessFormattedStatement(std::move(ss.str()));
+    Aws::String message = message_stream.rdbuf()->str();
+    Aws::String statement;
+    statement.reserve(INITIAL_MESSAGE_RESERVE + message.size());
+    AppendLogPrefix(statement, logLevel, tag);
+    statement.append(message);
+    statement.push_back('\n');
+
+    ProcessFormattedStatement(std::move(statement));
 }
@@ -0,0 +1,761 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/logging/StructuredLogSystem.h>
+
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/logging/DefaultLogSystem.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstddef>
+#include <cstring>
+#include <stdio.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+
+static const char* AllocationTag = "StructuredLogSystem";
+
+const size_t StructuredLogSystem::DEFAULT_QUEUE_CAPACITY;
+
+namespace
+{
+    enum class ArgumentType
+    {
+        NONE,
+        SIGNED_INTEGER,
+        UNSIGNED_INTEGER,
+        FLOATING_POINT,
+        LONG_FLOATING_POINT,
+        CHARACTER,
+        STRING,
+        POINTER,
+        COUNT,
+        UNSUPPORTED
+    };
+
+    /**
+    * One printf conversion. Both the logging thread and the writer walk the format string with ParseConversion, so
+    * they agree on how many arguments there are and what types they have without storing any of that in the record.
+    */
+    struct Conversion
+    {
+        const char* m_begin;
+        const char* m_end;
+        //flags, width and precision as written, e.g. "-08.3" or "*.*"
+        const char* m_specBegin;
+        const char* m_specEnd;
+        bool m_starWidth;
+        bool m_starPrecision;
+        char m_lengthModifier[3];
+        char m_conversion;
+        ArgumentType m_type;
+    };
+
+    ArgumentType ClassifyConversion(char conversion, const char* lengthModifier)
+    {
+        switch (conversion)
+        {
+            case 'd':
+            case 'i':
+                return ArgumentType::SIGNED_INTEGER;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                return ArgumentType::UNSIGNED_INTEGER;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                return strcmp(lengthModifier, "L") == 0 ? ArgumentType::LONG_FLOATING_POINT : ArgumentType::FLOATING_POINT;
+            case 'c':
+                //wide characters and strings aren't used by the SDK and would need converting.
+                return lengthModifier[0] == '\0' ? ArgumentType::CHARACTER : ArgumentType::UNSUPPORTED;
+            case 's':
+                return lengthModifier[0] == '\0' ? ArgumentType::STRING : ArgumentType::UNSUPPORTED;
+            case 'p':
+                return ArgumentType::POINTER;
+            case 'n':
+                return ArgumentType::COUNT;
+            default:
+                return ArgumentType::UNSUPPORTED;
+        }
+    }
+
+    /**
+    * Finds the next conversion at or after cursor. Returns false at the end of the format string. "%%" comes back as
+    * a conversion of type NONE.
+    */
+    bool ParseConversion(const char*& cursor, Conversion& conversion)
+    {
+        const char* percent = strchr(cursor, '%');
+        if (!percent)
+        {
+            cursor += strlen(cursor);
+            return false;
+        }
+
+        conversion.m_begin = percent;
+        conversion.m_starWidth = false;
+        conversion.m_starPrecision = false;
+        conversion.m_type = ArgumentType::NONE;
+        conversion.m_lengthModifier[0] = '\0';
+
+        const char* current = percent + 1;
+        conversion.m_specBegin = current;
+        while (*current && strchr("-+ #0", *current))
+        {
+            ++current;
+        }
+        if (*current == '*')
+        {
+            conversion.m_starWidth = true;
+            ++current;
+        }
+        while (*current >= '0' && *current <= '9')
+        {
+            ++current;
+        }
+        if (*current == '.')
+        {
+            ++current;
+            if (*current == '*')
+            {
+                conversion.m_starPrecision = true;
+                ++current;
+            }
+            while (*current >= '0' && *current <= '9')
+            {
+                ++current;
+            }
+        }
+        conversion.m_specEnd = current;
+
+        size_t modifierLength = 0;
+        while (*current && strchr("hlLqjzt", *current) && modifierLength < 2)
+        {
+            conversion.m_lengthModifier[modifierLength++] = *current++;
+        }
+        conversion.m_lengthModifier[modifierLength] = '\0';
+
+        conversion.m_conversion = *current;
+        if (*current)
+        {
+            ++current;
+        }
+        conversion.m_end = current;
+        cursor = current;
+
+        if (conversion.m_conversion != '%')
+        {
+            conversion.m_type = ClassifyConversion(conversion.m_conversion, conversion.m_lengthModifier);
+        }
+        return true;
+    }
+
+    template<typename T>
+    void AppendValue(Aws::String& arguments, T value)
+    {
+        arguments.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    T ReadValue(const Aws::String& arguments, size_t& offset)
+    {
+        T value;
+        memcpy(&value, arguments.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return value;
+    }
+
+    //integers are widened so the writer only has to deal with one size of each.
+    long long ReadSignedArgument(const char* lengthModifier, va_list& args)
+    {
+        if (strcmp(lengthModifier, "l") == 0) return va_arg(args, long);
+        if (strcmp(lengthModifier, "ll") == 0 || strcmp(lengthModifier, "q") == 0) return va_arg(args, long long);
+        if (strcmp(lengthModifier, "j") == 0) return va_arg(args, intmax_t);
+        if (strcmp(lengthModifier, "z") == 0) return static_cast<long long>(va_arg(args, size_t));
+        if (strcmp(lengthModifier, "t") == 0) return va_arg(args, ptrdiff_t);
+        int value = va_arg(args, int);
+        if (strcmp(lengthModifier, "hh") == 0) return static_cast<signed char>(value);
+        if (strcmp(lengthModifier, "h") == 0) return static_cast<short>(value);
+        return value;
+    }
+
+    unsigned long long ReadUnsignedArgument(const char* lengthModifier, va_list& args)
+    {
+        if (strcmp(lengthModifier, "l") == 0) return va_arg(args, unsigned long);
+        if (strcmp(lengthModifier, "ll") == 0 || strcmp(lengthModifier, "q") == 0) return va_arg(args, unsigned long long);
+        if (strcmp(lengthModifier, "j") == 0) return va_arg(args, uintmax_t);
+        if (strcmp(lengthModifier, "z") == 0) return va_arg(args, size_t);
+        if (strcmp(lengthModifier, "t") == 0) return static_cast<unsigned long long>(va_arg(args, ptrdiff_t));
+        unsigned value = va_arg(args, unsigned);
+        if (strcmp(lengthModifier, "hh") == 0) return static_cast<unsigned char>(value);
+        if (strcmp(lengthModifier, "h") == 0) return static_cast<unsigned short>(value);
+        return value;
+    }
+
+    //copies the raw arguments a format string consumes; strings are stored as a length followed by their bytes.
+    void CaptureArguments(const char* formatStr, va_list& args, Aws::String& arguments)
+    {
+        Conversion conversion;
+        const char* cursor = formatStr;
+        while (ParseConversion(cursor, conversion))
+        {
+            if (conversion.m_type == ArgumentType::NONE)
+            {
+                continue;
+            }
+            if (conversion.m_starWidth)
+            {
+                AppendValue(arguments, va_arg(args, int));
+            }
+            if (conversion.m_starPrecision)
+            {
+                AppendValue(arguments, va_arg(args, int));
+            }
+
+            switch (conversion.m_type)
+            {
+                case ArgumentType::SIGNED_INTEGER:
+                    AppendValue(arguments, ReadSignedArgument(conversion.m_lengthModifier, args));
+                    break;
+                case ArgumentType::UNSIGNED_INTEGER:
+                    AppendValue(arguments, ReadUnsignedArgument(conversion.m_lengthModifier, args));
+                    break;
+                case ArgumentType::FLOATING_POINT:
+                    AppendValue(arguments, va_arg(args, double));
+                    break;
+                case ArgumentType::LONG_FLOATING_POINT:
+                    AppendValue(arguments, va_arg(args, long double));
+                    break;
+                case ArgumentType::CHARACTER:
+                    AppendValue(arguments, va_arg(args, int));
+                    break;
+                case ArgumentType::STRING:
+                {
+                    const char* value = va_arg(args, const char*);
+                    if (!value)
+                    {
+                        value = "(null)";
+                    }
+                    size_t length = strlen(value);
+                    AppendValue(arguments, length);
+                    arguments.append(value, length + 1);
+                    break;
+                }
+                case ArgumentType::POINTER:
+                    AppendValue(arguments, va_arg(args, void*));
+                    break;
+                case ArgumentType::COUNT:
+                    va_arg(args, void*);
+                    break;
+                case ArgumentType::UNSUPPORTED:
+                    //nothing useful can be captured; skip the argument, it's rendered as the conversion text.
+                    if (conversion.m_conversion == 'c')
+                    {
+                        va_arg(args, int);
+                    }
+                    else
+                    {
+                        va_arg(args, void*);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    void PrintArguments(char* buffer, size_t size, int& length, const char* spec, ...)
+    {
+        va_list args;
+        va_start(args, spec);
+    #ifdef WIN32
+        va_list countArgs;
+        va_copy(countArgs, args);
+        length = _vsnprintf_s(buffer, size, _TRUNCATE, spec, args);
+        if (length < 0)
+        {
+            length = _vscprintf(spec, countArgs);
+        }
+        va_end(countArgs);
+    #else
+        length = vsnprintf(buffer, size, spec, args);
+    #endif // WIN32
+        va_end(args);
+    }
+
+    /**
+    * Formats one argument onto the end of output with snprintf, passing along any '*' width and precision.
+    */
+    template<typename T>
+    void AppendFormattedArgument(Aws::String& output, const char* spec, const int* starArguments, size_t starCount, T value)
+    {
+        static const size_t INITIAL_ROOM = 64;
+        size_t start = output.size();
+        size_t room = INITIAL_ROOM;
+        for (;;)
+        {
+            output.resize(start + room);
+            int length = 0;
+            switch (starCount)
+            {
+                case 0:
+                    PrintArguments(&output[start], room, length, spec, value);
+                    break;
+                case 1:
+                    PrintArguments(&output[start], room, length, spec, starArguments[0], value);
+                    break;
+                default:
+                    PrintArguments(&output[start], room, length, spec, starArguments[0], starArguments[1], value);
+                    break;
+            }
+
+            if (length < 0)
+            {
+                output.resize(start);
+                return;
+            }
+            if (static_cast<size_t>(length) < room)
+            {
+                output.resize(start + length);
+                return;
+            }
+            room = length + 1;
+        }
+    }
+
+    void AppendJsonString(Aws::String& output, const char* value, size_t length)
+    {
+        static const char* HEX_DIGITS = "0123456789abcdef";
+        output.push_back('"');
+        for (size_t i = 0; i < length; ++i)
+        {
+            unsigned char character = static_cast<unsigned char>(value[i]);
+            switch (character)
+            {
+                case '"':
+                    output.append("\\\"");
+                    break;
+                case '\\':
+                    output.append("\\\\");
+                    break;
+                case '\n':
+                    output.append("\\n");
+                    break;
+                case '\r':
+                    output.append("\\r");
+                    break;
+                case '\t':
+                    output.append("\\t");
+                    break;
+                default:
+                    if (character < 0x20)
+                    {
+                        output.append("\\u00");
+                        output.push_back(HEX_DIGITS[character >> 4]);
+                        output.push_back(HEX_DIGITS[character & 0xf]);
+                    }
+                    else
+                    {
+                        output.push_back(static_cast<char>(character));
+                    }
+                    break;
+            }
+        }
+        output.push_back('"');
+    }
+
+    inline void AppendJsonString(Aws::String& output, const Aws::String& value)
+    {
+        AppendJsonString(output, value.c_str(), value.size());
+    }
+
+    /**
+    * Turns records back into text on the writer thread. Timestamps are only reformatted when the second changes and
+    * thread ids only the first time a thread is seen.
+    */
+    class RecordFormatter
+    {
+    public:
+        RecordFormatter() : m_localSecond(-1), m_gmtSecond(-1) {}
+
+        void AppendText(const StructuredLogSystem::LogRecord& record, Aws::String& output)
+        {
+            output.push_back('[');
+            output.append(GetLevelName(record.m_logLevel));
+            output.append("] ");
+            output.append(GetLocalTimestamp(record.m_timestampMillis));
+            output.push_back(' ');
+            output.append(record.m_tag);
+            output.append(" [");
+            output.append(GetThreadId(record.m_threadId));
+            output.append("] ");
+            AppendMessage(record, output, nullptr);
+            output.push_back('\n');
+        }
+
+        void AppendJsonLine(const StructuredLogSystem::LogRecord& record, Aws::String& output)
+        {
+            m_message.clear();
+            m_jsonArguments.clear();
+            AppendMessage(record, m_message, &m_jsonArguments);
+
+            output.append("{\"level\":");
+            AppendJsonString(output, GetLevelName(record.m_logLevel));
+            output.append(",\"time\":");
+            AppendJsonString(output, GetGmtTimestamp(record.m_timestampMillis));
+            output.append(",\"tag\":");
+            AppendJsonString(output, record.m_tag);
+            output.append(",\"thread\":");
+            AppendJsonString(output, GetThreadId(record.m_threadId));
+            if (record.m_hasFormat)
+            {
+                output.append(",\"format\":");
+                AppendJsonString(output, record.m_format);
+                output.append(",\"args\":[");
+                output.append(m_jsonArguments);
+                output.push_back(']');
+            }
+            output.append(",\"message\":");
+            AppendJsonString(output, m_message);
+            output.append("}\n");
+        }
+
+    private:
+        const Aws::String& GetLevelName(LogLevel logLevel)
+        {
+            auto iter = m_levelNames.find(logLevel);
+            if (iter == m_levelNames.end())
+            {
+                Aws::String name = Aws::Utils::Logging::GetLogLevelName(logLevel);
+                iter = m_levelNames.emplace(logLevel, name.empty() ? "UNKOWN" : name).first;
+            }
+            return iter->second;
+        }
+
+        const Aws::String& GetLocalTimestamp(int64_t timestampMillis)
+        {
+            std::time_t second = static_cast<std::time_t>(timestampMillis / 1000);
+            if (second != m_localSecond)
+            {
+                m_localSecond = second;
+                m_localTimestamp = DateTime::CalculateLocalTimestampAsString(second, "%Y-%m-%d %H:%M:%S");
+            }
+            return m_localTimestamp;
+        }
+
+        const Aws::String& GetGmtTimestamp(int64_t timestampMillis)
+        {
+            std::time_t second = static_cast<std::time_t>(timestampMillis / 1000);
+            if (second != m_gmtSecond)
+            {
+                m_gmtSecond = second;
+                m_gmtTimestamp = DateTime::CalculateGmtTimestampAsString(second, "%Y-%m-%dT%H:%M:%S");
+            }
+            char millis[8];
+            int remainder = static_cast<int>(timestampMillis % 1000);
+            millis[0] = '.';
+            millis[1] = static_cast<char>('0' + remainder / 100);
+            millis[2] = static_cast<char>('0' + remainder / 10 % 10);
+            millis[3] = static_cast<char>('0' + remainder % 10);
+            millis[4] = 'Z';
+            millis[5] = '\0';
+            m_gmtTimestampWithMillis.assign(m_gmtTimestamp);
+            m_gmtTimestampWithMillis.append(millis);
+            return m_gmtTimestampWithMillis;
+        }
+
+        const Aws::String& GetThreadId(std::thread::id threadId)
+        {
+            auto iter = m_threadIds.find(threadId);
+            if (iter == m_threadIds.end())
+            {
+                //threads come and go in long running processes; don't let the cache grow without bound.
+                if (m_threadIds.size() >= 1024)
+                {
+                    m_threadIds.clear();
+                }
+                Aws::StringStream ss;
+                ss << threadId;
+                iter = m_threadIds.emplace(threadId, ss.str()).first;
+            }
+            return iter->second;
+        }
+
+        /**
+        * Formats the record's message onto output. When jsonArguments is given, each argument is also appended to it
+        * as a JSON value.
+        */
+        void AppendMessage(const StructuredLogSystem::LogRecord& record, Aws::String& output, Aws::String* jsonArguments)
+        {
+            if (!record.m_hasFormat)
+            {
+                output.append(record.m_arguments);
+                return;
+            }
+
+            size_t offset = 0;
+            Conversion conversion;
+            const char* cursor = record.m_format.c_str();
+            const char* literalBegin = cursor;
+            while (ParseConversion(cursor, conversion))
+            {
+                output.append(literalBegin, conversion.m_begin - literalBegin);
+                literalBegin = conversion.m_end;
+
+                if (conversion.m_type == ArgumentType::NONE)
+                {
+                    if (conversion.m_conversion == '%')
+                    {
+                        output.push_back('%');
+                    }
+                    continue;
+                }
+
+                int starArguments[2];
+                size_t starCount = 0;
+                if (conversion.m_starWidth)
+                {
+                    starArguments[starCount++] = ReadValue<int>(record.m_arguments, offset);
+                }
+                if (conversion.m_starPrecision)
+                {
+                    starArguments[starCount++] = ReadValue<int>(record.m_arguments, offset);
+                }
+
+                m_spec.assign("%");
+                m_spec.append(conversion.m_specBegin, conversion.m_specEnd - conversion.m_specBegin);
+                size_t argumentStart = output.size();
+
+                switch (conversion.m_type)
+                {
+                    case ArgumentType::SIGNED_INTEGER:
+                    {
+                        long long value = ReadValue<long long>(record.m_arguments, offset);
+                        m_spec.append("ll");
+                        m_spec.push_back(conversion.m_conversion);
+                        AppendFormattedArgument(output, m_spec.c_str(), starArguments, starCount, value);
+                        if (jsonArguments)
+                        {
+                            AppendJsonSeparator(*jsonArguments);
+                            AppendFormattedArgument(*jsonArguments, "%lld", starArguments, 0, value);
+                        }
+                        break;
+                    }
+                    case ArgumentType::UNSIGNED_INTEGER:
+                    {
+                        unsigned long long value = ReadValue<unsigned long long>(record.m_arguments, offset);
+                        m_spec.append("ll");
+                        m_spec.push_back(conversion.m_conversion);
+                        AppendFormattedArgument(output, m_spec.c_str(), starArguments, starCount, value);
+                        if (jsonArguments)
+                        {
+                            AppendJsonSeparator(*jsonArguments);
+                            AppendFormattedArgument(*jsonArguments, "%llu", starArguments, 0, value);
+                        }
+                        break;
+                    }
+                    case ArgumentType::FLOATING_POINT:
+                    {
+                        double value = ReadValue<double>(record.m_arguments, offset);
+                        m_spec.push_back(conversion.m_conversion);
+                        AppendFormattedArgument(output, m_spec.c_str(), starArguments, starCount, value);
+                        if (jsonArguments)
+                        {
+                            AppendJsonSeparator(*jsonArguments);
+                            AppendJsonNumber(*jsonArguments, value);
+                        }
+                        break;
+                    }
+                    case ArgumentType::LONG_FLOATING_POINT:
+                    {
+                        long double value = ReadValue<long double>(record.m_arguments, offset);
+                        m_spec.push_back('L');
+                        m_spec.push_back(conversion.m_conversion);
+                        AppendFormattedArgument(output, m_spec.c_str(), starArguments, starCount, value);
+                        if (jsonArguments)
+                        {
+                            AppendJsonSeparator(*jsonArguments);
+                            AppendJsonNumber(*jsonArguments, static_cast<double>(value));
+                        }
+                        break;
+                    }
+                    case ArgumentType::CHARACTER:
+                    case ArgumentType::POINTER:
+                    {
+                        m_spec.push_back(conversion.m_conversion);
+                        if (conversion.m_type == ArgumentType::CHARACTER)
+                        {
+                            AppendFormattedArgument(output, m_spec.c_str(), starArguments, starCount, ReadValue<int>(record.m_arguments, offset));
+                        }
+                        else
+                        {
+                            AppendFormattedArgument(output, m_spec.c_str(), starArguments, starCount, ReadValue<void*>(record.m_arguments, offset));
+                        }
+                        if (jsonArguments)
+                        {
+                            AppendJsonSeparator(*jsonArguments);
+                            AppendJsonString(*jsonArguments, output.c_str() + argumentStart, output.size() - argumentStart);
+                        }
+                        break;
+                    }
+                    case ArgumentType::STRING:
+                    {
+                        size_t length = ReadValue<size_t>(record.m_arguments, offset);
+                        const char* value = record.m_arguments.c_str() + offset;
+                        offset += length + 1;
+                        m_spec.push_back('s');
+                        AppendFormattedArgument(output, m_spec.c_str(), starArguments, starCount, value);
+                        if (jsonArguments)
+                        {
+                            AppendJsonSeparator(*jsonArguments);
+                            AppendJsonString(*jsonArguments, value, length);
+                        }
+                        break;
+                    }
+                    case ArgumentType::COUNT:
+                        break;
+                    default:
+                        //conversions we can't capture are written out as is.
+                        output.append(conversion.m_begin, conversion.m_end - conversion.m_begin);
+                        if (jsonArguments)
+                        {
+                            AppendJsonSeparator(*jsonArguments);
+                            jsonArguments->append("null");
+                        }
+                        break;
+                }
+            }
+            output.append(literalBegin, cursor - literalBegin);
+        }
+
+        static void AppendJsonSeparator(Aws::String& jsonArguments)
+        {
+            if (!jsonArguments.empty())
+            {
+                jsonArguments.push_back(',');
+            }
+        }
+
+        static void AppendJsonNumber(Aws::String& jsonArguments, double value)
+        {
+            //JSON has no representation for infinities and NaN.
+            if (value != value || value - value != 0)
+            {
+                jsonArguments.append("null");
+                return;
+            }
+            AppendFormattedArgument(jsonArguments, "%.17g", nullptr, 0, value);
+        }
+
+        Aws::Map<LogLevel, Aws::String> m_levelNames;
+        Aws::Map<std::thread::id, Aws::String> m_threadIds;
+        std::time_t m_localSecond;
+        Aws::String m_localTimestamp;
+        std::time_t m_gmtSecond;
+        Aws::String m_gmtTimestamp;
+        Aws::String m_gmtTimestampWithMillis;
+        Aws::String m_spec;
+        Aws::String m_message;
+        Aws::String m_jsonArguments;
+    };
+}
+
+StructuredLogSystem::StructuredLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& log, LogRecordFormat recordFormat,
+    size_t queueCapacity, LogOverflowPolicy overflowPolicy) :
+    m_logLevel(logLevel),
+    m_log(log),
+    m_recordFormat(recordFormat),
+    m_records(queueCapacity, overflowPolicy, AllocationTag),
+    m_writerThread()
+{
+    m_writerThread = std::thread(&StructuredLogSystem::WriterLoop, this);
+}
+
+StructuredLogSystem::~StructuredLogSystem()
+{
+    m_records.Stop();
+    m_writerThread.join();
+}
+
+void StructuredLogSystem::Log(LogLevel logLevel, const char* tag, const char* formatStr, ...)
+{
+    va_list args;
+    va_start(args, formatStr);
+    m_records.Push([&](LogRecord& record)
+    {
+        record.m_logLevel = logLevel;
+        //assign rather than point: callers may pass a temporary. The record keeps its buffers for the next lap.
+        record.m_tag.assign(tag);
+        record.m_hasFormat = true;
+        record.m_format.assign(formatStr);
+        record.m_timestampMillis = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        record.m_threadId = std::this_thread::get_id();
+        //clear rather than reassign for the same reason.
+        record.m_arguments.clear();
+        CaptureArguments(formatStr, args, record.m_arguments);
+    });
+    va_end(args);
+}
+
+void StructuredLogSystem::LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &messageStream)
+{
+    m_records.Push([&](LogRecord& record)
+    {
+        record.m_logLevel = logLevel;
+        record.m_tag.assign(tag);
+        record.m_hasFormat = false;
+        record.m_timestampMillis = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        record.m_threadId = std::this_thread::get_id();
+        record.m_arguments.assign(messageStream.rdbuf()->str());
+    });
+}
+
+void StructuredLogSystem::WriterLoop()
+{
+    RecordFormatter formatter;
+    m_records.RunWriter(std::chrono::milliseconds(DefaultLogSystem::FLUSH_INTERVAL_MS),
+        [&](const LogRecord& record, Aws::String& batch)
+        {
+            if (m_recordFormat == LogRecordFormat::JSON_LINES)
+            {
+                formatter.AppendJsonLine(record, batch);
+            }
+            else
+            {
+                formatter.AppendText(record, batch);
+            }
+        },
+        [this](const Aws::String& batch)
+        {
+            m_log->write(batch.c_str(), batch.size());
+        },
+        [this]()
+        {
+            m_log->flush();
+        });
+}
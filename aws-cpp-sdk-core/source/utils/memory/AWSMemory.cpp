@@ -16,6 +16,7 @@
 #include <aws/core/utils/memory/AWSMemory.h>
 
 #include <aws/core/utils/memory/MemorySystemInterface.h>
+#include <aws/core/utils/memory/RequestArena.h>
 
 #include <atomic>
 
@@ -73,6 +74,14 @@ MemorySystemInterface* GetMemorySystem()
 
 void* Malloc(const char* allocationTag, size_t allocationSize)
 {
+    #ifdef AWS_CUSTOM_MEMORY_MANAGEMENT
+        void* arenaMemory = Aws::Utils::Memory::RequestArena::Allocate(allocationSize);
+        if(arenaMemory != nullptr)
+        {
+            return arenaMemory;
+        }
+    #endif // AWS_CUSTOM_MEMORY_MANAGEMENT
+
     Aws::Utils::Memory::MemorySystemInterface* memorySystem = Aws::Utils::Memory::GetMemorySystem();
 
     void* rawMemory = nullptr;
@@ -96,6 +105,13 @@ void Free(void* memoryPtr)
         return;
     }
 
+    #ifdef AWS_CUSTOM_MEMORY_MANAGEMENT
+        if(Aws::Utils::Memory::RequestArena::Free(memoryPtr))
+        {
+            return;
+        }
+    #endif // AWS_CUSTOM_MEMORY_MANAGEMENT
+
     Aws::Utils::Memory::MemorySystemInterface* memorySystem = Aws::Utils::Memory::GetMemorySystem();
     if(memorySystem != nullptr)
     {
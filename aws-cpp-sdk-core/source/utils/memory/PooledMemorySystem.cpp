@@ -0,0 +1,538 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/memory/PooledMemorySystem.h>
+
+#include <aws/core/utils/UnreferencedParam.h>
+#include <aws/core/utils/threading/ThreadIdHash.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <thread>
+
+using namespace Aws::Utils::Memory;
+
+const size_t PooledMemorySystem::MAX_POOLED_SIZE;
+const size_t PooledMemorySystem::SIZE_CLASS_COUNT;
+const size_t PooledMemorySystem::TAG_SLOT_COUNT;
+const size_t PooledMemorySystem::THREAD_CACHE_COUNT;
+const size_t PooledMemorySystem::THREAD_CACHE_PROBES;
+
+namespace
+{
+    //Sits in front of every block handed out, keeping the returned memory 16 byte aligned.
+    struct BlockHeader
+    {
+        uint32_t m_sizeClass;
+        uint32_t m_tagSlot;
+        uint64_t m_requestedSize;
+    };
+
+    static const size_t HEADER_SIZE = 16;
+    static const uint32_t LARGE_SIZE_CLASS = 0xFFFFFFFF;
+    static const size_t SMALL_CLASS_COUNT = 8;
+    static const size_t SMALL_CLASS_STEP = 16;
+    static const size_t SLAB_SIZE = 64 * 1024;
+    static const size_t CACHE_BYTES_PER_CLASS = 64 * 1024;
+    static const size_t MIN_CACHED_BLOCKS = 4;
+    static const size_t MAX_CACHED_BLOCKS = 256;
+
+    //Sizes go up in steps of 16 bytes to 128, then in four steps per power of two, keeping rounding waste under 25%.
+    size_t GetClassSize(size_t sizeClass)
+    {
+        if (sizeClass < SMALL_CLASS_COUNT)
+        {
+            return (sizeClass + 1) * SMALL_CLASS_STEP;
+        }
+
+        size_t base = (SMALL_CLASS_COUNT * SMALL_CLASS_STEP) << ((sizeClass - SMALL_CLASS_COUNT) / 4);
+        return base + ((sizeClass - SMALL_CLASS_COUNT) % 4 + 1) * (base / 4);
+    }
+
+    BlockHeader* GetHeader(void* memoryPtr)
+    {
+        return reinterpret_cast<BlockHeader*>(reinterpret_cast<char*>(memoryPtr) - HEADER_SIZE);
+    }
+
+    void* GetUserMemory(void* block)
+    {
+        return reinterpret_cast<char*>(block) + HEADER_SIZE;
+    }
+
+    //Per cache counters are only written by the cache's owner, so a plain load and store is enough to bump them.
+    inline void Bump(std::atomic<uint64_t>& counter, uint64_t amount)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+}
+
+PooledMemorySystem::PooledMemorySystem(bool trackTagStatistics) :
+    m_trackTagStatistics(trackTagStatistics),
+    m_slabs(nullptr),
+    m_reservedSlabBytes(0)
+{
+    static_assert(sizeof(BlockHeader) == HEADER_SIZE, "block header must keep user memory 16 byte aligned");
+
+    for (size_t i = 0; i < THREAD_CACHE_COUNT; ++i)
+    {
+        m_threadCaches[i].m_owner.store(std::thread::id());
+        memset(m_threadCaches[i].m_lists, 0, sizeof(m_threadCaches[i].m_lists));
+        m_threadCaches[i].m_tagCounters.store(nullptr);
+    }
+
+    for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+    {
+        m_centralLists[i].m_list.m_head = nullptr;
+        m_centralLists[i].m_list.m_count = 0;
+
+        size_t blocks = CACHE_BYTES_PER_CLASS / GetClassSize(i);
+        m_maxCachedBlocks[i] = blocks < MIN_CACHED_BLOCKS ? MIN_CACHED_BLOCKS : (blocks > MAX_CACHED_BLOCKS ? MAX_CACHED_BLOCKS : blocks);
+    }
+
+    for (size_t i = 0; i < TAG_SLOT_COUNT; ++i)
+    {
+        m_tags[i].store(nullptr);
+        m_sharedTagCounters[i].m_allocationCount.store(0);
+        m_sharedTagCounters[i].m_freeCount.store(0);
+        m_sharedTagCounters[i].m_allocatedBytes.store(0);
+        m_sharedTagCounters[i].m_freedBytes.store(0);
+    }
+}
+
+PooledMemorySystem::~PooledMemorySystem()
+{
+    for (size_t i = 0; i < THREAD_CACHE_COUNT; ++i)
+    {
+        free(m_threadCaches[i].m_tagCounters.load());
+    }
+
+    while (m_slabs)
+    {
+        FreeBlock* next = m_slabs->m_next;
+        free(m_slabs);
+        m_slabs = next;
+    }
+}
+
+inline size_t PooledMemorySystem::GetSizeClass(size_t blockSize)
+{
+    if (blockSize <= SMALL_CLASS_COUNT * SMALL_CLASS_STEP)
+    {
+        return blockSize == 0 ? 0 : (blockSize - 1) / SMALL_CLASS_STEP;
+    }
+
+    //find the power of two range (base, 2 * base] the size falls in, then which quarter of it.
+    size_t shift = 7;
+    while (((blockSize - 1) >> (shift + 1)) != 0)
+    {
+        ++shift;
+    }
+    size_t base = static_cast<size_t>(1) << shift;
+    return SMALL_CLASS_COUNT + (shift - 7) * 4 + (blockSize - 1 - base) / (base / 4);
+}
+
+size_t PooledMemorySystem::GetAllocationSize(size_t blockSize)
+{
+    return blockSize > MAX_POOLED_SIZE ? blockSize : GetClassSize(GetSizeClass(blockSize));
+}
+
+inline PooledMemorySystem::ThreadCache* PooledMemorySystem::AcquireThreadCache(ThreadCache* caches)
+{
+    //A thread claims a cache in a table indexed by a hash of its id, and keeps it: only the owner ever touches a cache's
+    //free lists, so using it takes no locks or atomic read-modify-write operations. An id is only reused once its
+    //previous thread has exited, which lets the new thread take over the cache. A thread that finds all its candidate
+    //caches owned goes to the central lists.
+    std::thread::id self = std::this_thread::get_id();
+    uint64_t hash = Aws::Utils::Threading::HashCurrentThreadId();
+
+    for (size_t probe = 0; probe < THREAD_CACHE_PROBES; ++probe)
+    {
+        ThreadCache* cache = &caches[(hash + probe) % THREAD_CACHE_COUNT];
+        std::thread::id owner = cache->m_owner.load(std::memory_order_acquire);
+        if (owner == self)
+        {
+            return cache;
+        }
+        if (owner == std::thread::id() && cache->m_owner.compare_exchange_strong(owner, self, std::memory_order_acq_rel))
+        {
+            return cache;
+        }
+    }
+    return nullptr;
+}
+
+inline PooledMemorySystem::TagCounters* PooledMemorySystem::GetTagCounters(ThreadCache& cache)
+{
+    TagCounters* counters = cache.m_tagCounters.load(std::memory_order_relaxed);
+    if (counters)
+    {
+        return counters;
+    }
+
+    counters = reinterpret_cast<TagCounters*>(malloc(sizeof(TagCounters) * TAG_SLOT_COUNT));
+    if (!counters)
+    {
+        return nullptr;
+    }
+    for (size_t i = 0; i < TAG_SLOT_COUNT; ++i)
+    {
+        new (&counters[i]) TagCounters();
+        counters[i].m_allocationCount.store(0, std::memory_order_relaxed);
+        counters[i].m_freeCount.store(0, std::memory_order_relaxed);
+        counters[i].m_allocatedBytes.store(0, std::memory_order_relaxed);
+        counters[i].m_freedBytes.store(0, std::memory_order_relaxed);
+    }
+    cache.m_tagCounters.store(counters, std::memory_order_release);
+    return counters;
+}
+
+inline void PooledMemorySystem::CountAllocation(ThreadCache* cache, uint32_t tagSlot, uint64_t bytes)
+{
+    TagCounters* counters = cache ? GetTagCounters(*cache) : nullptr;
+    if (counters)
+    {
+        Bump(counters[tagSlot].m_allocationCount, 1);
+        Bump(counters[tagSlot].m_allocatedBytes, bytes);
+    }
+    else
+    {
+        m_sharedTagCounters[tagSlot].m_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        m_sharedTagCounters[tagSlot].m_allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+inline void PooledMemorySystem::CountFree(ThreadCache* cache, uint32_t tagSlot, uint64_t bytes)
+{
+    TagCounters* counters = cache ? GetTagCounters(*cache) : nullptr;
+    if (counters)
+    {
+        Bump(counters[tagSlot].m_freeCount, 1);
+        Bump(counters[tagSlot].m_freedBytes, bytes);
+    }
+    else
+    {
+        m_sharedTagCounters[tagSlot].m_freeCount.fetch_add(1, std::memory_order_relaxed);
+        m_sharedTagCounters[tagSlot].m_freedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+void* PooledMemorySystem::AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+{
+    AWS_UNREFERENCED_PARAM(alignment);
+
+    uint32_t tagSlot = m_trackTagStatistics ? FindTagSlot(allocationTag) : 0;
+    BlockHeader* header = nullptr;
+
+    if (blockSize > MAX_POOLED_SIZE)
+    {
+        header = reinterpret_cast<BlockHeader*>(malloc(blockSize + HEADER_SIZE));
+        if (!header)
+        {
+            return nullptr;
+        }
+        header->m_sizeClass = LARGE_SIZE_CLASS;
+        if (m_trackTagStatistics)
+        {
+            CountAllocation(nullptr, tagSlot, blockSize);
+        }
+    }
+    else
+    {
+        size_t sizeClass = GetSizeClass(blockSize);
+        FreeBlock* block = nullptr;
+
+        ThreadCache* cache = AcquireThreadCache(m_threadCaches);
+        if (cache)
+        {
+            FreeList& list = cache->m_lists[sizeClass];
+            if (list.m_head)
+            {
+                block = list.m_head;
+                list.m_head = block->m_next;
+                --list.m_count;
+            }
+            else
+            {
+                block = RefillFromCentral(sizeClass, list, m_maxCachedBlocks[sizeClass] / 2);
+            }
+
+            if (block && m_trackTagStatistics)
+            {
+                CountAllocation(cache, tagSlot, blockSize);
+            }
+        }
+        else
+        {
+            FreeList unused = { nullptr, 0 };
+            block = RefillFromCentral(sizeClass, unused, 0);
+            if (block && m_trackTagStatistics)
+            {
+                CountAllocation(nullptr, tagSlot, blockSize);
+            }
+        }
+
+        if (!block)
+        {
+            return nullptr;
+        }
+        header = reinterpret_cast<BlockHeader*>(block);
+        header->m_sizeClass = static_cast<uint32_t>(sizeClass);
+    }
+
+    header->m_tagSlot = tagSlot;
+    header->m_requestedSize = blockSize;
+    return GetUserMemory(header);
+}
+
+void PooledMemorySystem::FreeMemory(void* memoryPtr)
+{
+    if (!memoryPtr)
+    {
+        return;
+    }
+
+    BlockHeader* header = GetHeader(memoryPtr);
+    uint32_t tagSlot = header->m_tagSlot;
+    uint64_t requestedSize = header->m_requestedSize;
+
+    if (header->m_sizeClass == LARGE_SIZE_CLASS)
+    {
+        if (m_trackTagStatistics)
+        {
+            CountFree(nullptr, tagSlot, requestedSize);
+        }
+        free(header);
+        return;
+    }
+
+    size_t sizeClass = header->m_sizeClass;
+    FreeBlock* block = reinterpret_cast<FreeBlock*>(header);
+
+    ThreadCache* cache = AcquireThreadCache(m_threadCaches);
+    if (cache)
+    {
+        if (m_trackTagStatistics)
+        {
+            CountFree(cache, tagSlot, requestedSize);
+        }
+
+        FreeList& list = cache->m_lists[sizeClass];
+        block->m_next = list.m_head;
+        list.m_head = block;
+        if (++list.m_count > m_maxCachedBlocks[sizeClass])
+        {
+            ReleaseToCentral(sizeClass, list, list.m_count / 2);
+        }
+    }
+    else
+    {
+        if (m_trackTagStatistics)
+        {
+            CountFree(nullptr, tagSlot, requestedSize);
+        }
+
+        FreeList single = { block, 1 };
+        block->m_next = nullptr;
+        ReleaseToCentral(sizeClass, single, 1);
+    }
+}
+
+PooledMemorySystem::FreeBlock* PooledMemorySystem::RefillFromCentral(size_t sizeClass, FreeList& cache, size_t batch)
+{
+    //hand back one block and move up to batch more into the caller's list, so the next few allocations of this size
+    //class don't come back here.
+    CentralList& central = m_centralLists[sizeClass];
+    std::lock_guard<std::mutex> locker(central.m_lock);
+
+    if (!central.m_list.m_head)
+    {
+        size_t blockCount = 0;
+        central.m_list.m_head = CarveSlab(sizeClass, blockCount);
+        central.m_list.m_count = blockCount;
+        if (!central.m_list.m_head)
+        {
+            return nullptr;
+        }
+    }
+
+    FreeBlock* block = central.m_list.m_head;
+    central.m_list.m_head = block->m_next;
+    --central.m_list.m_count;
+
+    for (size_t i = 0; i < batch && central.m_list.m_head; ++i)
+    {
+        FreeBlock* cached = central.m_list.m_head;
+        central.m_list.m_head = cached->m_next;
+        --central.m_list.m_count;
+        cached->m_next = cache.m_head;
+        cache.m_head = cached;
+        ++cache.m_count;
+    }
+
+    return block;
+}
+
+void PooledMemorySystem::ReleaseToCentral(size_t sizeClass, FreeList& cache, size_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    //detach the first count blocks of the cache as a chain, then splice the whole chain in under one lock.
+    FreeBlock* first = cache.m_head;
+    FreeBlock* last = first;
+    for (size_t i = 1; i < count; ++i)
+    {
+        last = last->m_next;
+    }
+    cache.m_head = last->m_next;
+    cache.m_count -= count;
+
+    CentralList& central = m_centralLists[sizeClass];
+    std::lock_guard<std::mutex> locker(central.m_lock);
+    last->m_next = central.m_list.m_head;
+    central.m_list.m_head = first;
+    central.m_list.m_count += count;
+}
+
+PooledMemorySystem::FreeBlock* PooledMemorySystem::CarveSlab(size_t sizeClass, size_t& blockCount)
+{
+    size_t stride = GetClassSize(sizeClass) + HEADER_SIZE;
+    size_t slabSize = SLAB_SIZE;
+    if (slabSize < HEADER_SIZE + stride * MIN_CACHED_BLOCKS)
+    {
+        slabSize = HEADER_SIZE + stride * MIN_CACHED_BLOCKS;
+    }
+
+    char* slab = reinterpret_cast<char*>(malloc(slabSize));
+    if (!slab)
+    {
+        blockCount = 0;
+        return nullptr;
+    }
+    m_reservedSlabBytes.fetch_add(slabSize, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> locker(m_slabLock);
+        reinterpret_cast<FreeBlock*>(slab)->m_next = m_slabs;
+        m_slabs = reinterpret_cast<FreeBlock*>(slab);
+    }
+
+    //the first 16 bytes link the slab into m_slabs; the rest is cut into blocks, chained in address order.
+    blockCount = (slabSize - HEADER_SIZE) / stride;
+    char* firstBlock = slab + HEADER_SIZE;
+    for (size_t i = 0; i < blockCount; ++i)
+    {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(firstBlock + i * stride);
+        block->m_next = i + 1 < blockCount ? reinterpret_cast<FreeBlock*>(firstBlock + (i + 1) * stride) : nullptr;
+    }
+    return reinterpret_cast<FreeBlock*>(firstBlock);
+}
+
+inline uint32_t PooledMemorySystem::FindTagSlot(const char* allocationTag)
+{
+    //Slot 0 counts untagged allocations, and those of any tag arriving after the table filled up. Tags are nearly
+    //always string literals, so slots are keyed by pointer and a tag is found on the first probe in the common case.
+    if (!allocationTag)
+    {
+        return 0;
+    }
+
+    uint64_t hash = Aws::Utils::Threading::MixHashBits(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(allocationTag)));
+
+    for (size_t probe = 0; probe < TAG_SLOT_COUNT; ++probe)
+    {
+        size_t slot = static_cast<size_t>(hash + probe) % TAG_SLOT_COUNT;
+        if (slot == 0)
+        {
+            continue;
+        }
+        const char* current = m_tags[slot].load(std::memory_order_acquire);
+        if (current == allocationTag)
+        {
+            return static_cast<uint32_t>(slot);
+        }
+        if (!current)
+        {
+            if (m_tags[slot].compare_exchange_strong(current, allocationTag, std::memory_order_acq_rel) ||
+                current == allocationTag)
+            {
+                return static_cast<uint32_t>(slot);
+            }
+        }
+    }
+    return 0;
+}
+
+std::vector<AllocationTagStatistics> PooledMemorySystem::GetTagStatistics() const
+{
+    std::vector<AllocationTagStatistics> statistics;
+
+    for (size_t i = 0; i < TAG_SLOT_COUNT; ++i)
+    {
+        const char* tag = m_tags[i].load(std::memory_order_acquire);
+        if (i != 0 && !tag)
+        {
+            continue;
+        }
+
+        uint64_t allocationCount = m_sharedTagCounters[i].m_allocationCount.load(std::memory_order_relaxed);
+        uint64_t freeCount = m_sharedTagCounters[i].m_freeCount.load(std::memory_order_relaxed);
+        uint64_t allocatedBytes = m_sharedTagCounters[i].m_allocatedBytes.load(std::memory_order_relaxed);
+        uint64_t freedBytes = m_sharedTagCounters[i].m_freedBytes.load(std::memory_order_relaxed);
+        for (size_t c = 0; c < THREAD_CACHE_COUNT; ++c)
+        {
+            const TagCounters* counters = m_threadCaches[c].m_tagCounters.load(std::memory_order_acquire);
+            if (counters)
+            {
+                allocationCount += counters[i].m_allocationCount.load(std::memory_order_relaxed);
+                freeCount += counters[i].m_freeCount.load(std::memory_order_relaxed);
+                allocatedBytes += counters[i].m_allocatedBytes.load(std::memory_order_relaxed);
+                freedBytes += counters[i].m_freedBytes.load(std::memory_order_relaxed);
+            }
+        }
+        if (allocationCount == 0)
+        {
+            continue;
+        }
+
+        //the same tag text can live at several addresses, e.g. one copy per translation unit; report it once.
+        AllocationTagStatistics* entry = nullptr;
+        for (auto& existing : statistics)
+        {
+            if (existing.tag == tag || (existing.tag && tag && strcmp(existing.tag, tag) == 0))
+            {
+                entry = &existing;
+                break;
+            }
+        }
+        if (!entry)
+        {
+            statistics.push_back(AllocationTagStatistics());
+            entry = &statistics.back();
+            entry->tag = tag;
+        }
+
+        //a free can be counted before the allocation it matches when the snapshot races with other threads.
+        entry->allocationCount += allocationCount;
+        entry->freeCount += freeCount;
+        entry->currentBytes += allocatedBytes > freedBytes ? allocatedBytes - freedBytes : 0;
+        entry->totalBytes += allocatedBytes;
+    }
+
+    return statistics;
+}
@@ -0,0 +1,286 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/memory/RequestArena.h>
+
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/MemorySystemInterface.h>
+#include <aws/core/utils/threading/ThreadIdHash.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+using namespace Aws::Utils::Memory;
+
+const size_t RequestArena::CHUNK_SIZE;
+const size_t RequestArena::MAX_ARENA_ALLOCATION;
+
+static const char* ALLOCATION_TAG = "RequestArena";
+
+namespace
+{
+    static const size_t ALIGNMENT = 16;
+    static const size_t CHUNK_HEADER_SIZE = 64;
+    static const size_t THREAD_SLOT_COUNT = 64;
+    static const size_t THREAD_SLOT_PROBES = 8;
+    static const size_t REGISTRY_BUCKET_COUNT = 1024;
+    static const size_t REGISTRY_BUCKET_SIZE = 4;
+
+    //arenas currently open on any thread, and chunks not yet returned; while these are 0, Aws::Malloc and Aws::Free
+    //pay no more than a load for arena support.
+    std::atomic<int64_t> activeArenaCount(0);
+    std::atomic<int64_t> liveChunkCount(0);
+
+    //Chunks are CHUNK_SIZE aligned, so the chunk a pointer belongs to is found by masking off the low bits and looking
+    //the result up here; a chunk that can't be registered because its bucket is full is not used.
+    std::atomic<uintptr_t> chunkRegistry[REGISTRY_BUCKET_COUNT][REGISTRY_BUCKET_SIZE];
+
+    std::atomic<uintptr_t>* GetRegistryBucket(uintptr_t chunkAddress)
+    {
+        return chunkRegistry[(chunkAddress / RequestArena::CHUNK_SIZE) % REGISTRY_BUCKET_COUNT];
+    }
+
+    void* AllocateRaw(size_t size)
+    {
+        MemorySystemInterface* memorySystem = GetMemorySystem();
+        return memorySystem ? memorySystem->AllocateMemory(size, 1, ALLOCATION_TAG) : malloc(size);
+    }
+
+    void FreeRaw(void* memoryPtr)
+    {
+        MemorySystemInterface* memorySystem = GetMemorySystem();
+        if (memorySystem)
+        {
+            memorySystem->FreeMemory(memoryPtr);
+        }
+        else
+        {
+            free(memoryPtr);
+        }
+    }
+}
+
+struct RequestArena::Chunk
+{
+    void* m_rawMemory;
+    //allocations not yet freed, minus those of the arena still carving the chunk: negative or zero until the arena
+    //seals the chunk by adding its allocation count, after which whoever brings it to zero returns the chunk.
+    std::atomic<int64_t> m_outstanding;
+};
+
+//A static array of these is zero initialized, which is the representation of a default constructed thread::id in the
+//standard libraries we build with; were it not, no slot could be claimed and arenas would simply stay inactive.
+struct RequestArena::ThreadSlot
+{
+    std::atomic<std::thread::id> m_owner;
+    //only read and written by the owner
+    RequestArena* m_arena;
+};
+
+RequestArena::RequestArena() :
+    m_slot(nullptr),
+    m_previous(nullptr),
+    m_chunk(nullptr),
+    m_chunkUsed(0),
+    m_chunkAllocations(0),
+    m_allocationCount(0),
+    m_bytesAllocated(0),
+    m_chunkCount(0)
+{
+#ifdef AWS_CUSTOM_MEMORY_MANAGEMENT
+    ThreadSlot* slot = FindThreadSlot(false);
+    if (!slot)
+    {
+        slot = FindThreadSlot(true);
+    }
+    if (slot)
+    {
+        m_previous = slot->m_arena;
+        slot->m_arena = this;
+        m_slot = slot;
+        activeArenaCount.fetch_add(1, std::memory_order_relaxed);
+    }
+#endif // AWS_CUSTOM_MEMORY_MANAGEMENT
+}
+
+RequestArena::~RequestArena()
+{
+    if (!m_slot)
+    {
+        return;
+    }
+
+    SealChunk();
+    m_slot->m_arena = m_previous;
+    if (!m_previous)
+    {
+        m_slot->m_owner.store(std::thread::id(), std::memory_order_release);
+    }
+    activeArenaCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+RequestArena::ThreadSlot* RequestArena::FindThreadSlot(bool claim)
+{
+    //a thread registers its arenas in a table indexed by a hash of its id.
+    static ThreadSlot threadSlots[THREAD_SLOT_COUNT];
+
+    std::thread::id self = std::this_thread::get_id();
+    uint64_t hash = Aws::Utils::Threading::HashCurrentThreadId();
+
+    for (size_t probe = 0; probe < THREAD_SLOT_PROBES; ++probe)
+    {
+        ThreadSlot* slot = &threadSlots[(hash + probe) % THREAD_SLOT_COUNT];
+        std::thread::id owner = slot->m_owner.load(std::memory_order_acquire);
+        if (owner == self)
+        {
+            return slot;
+        }
+        if (claim && owner == std::thread::id() && slot->m_owner.compare_exchange_strong(owner, self, std::memory_order_acq_rel))
+        {
+            return slot;
+        }
+    }
+    return nullptr;
+}
+
+RequestArena::Chunk* RequestArena::CreateChunk()
+{
+    //over allocate so that an aligned chunk fits; the slack is address space the chunk never touches.
+    void* rawMemory = AllocateRaw(2 * CHUNK_SIZE - ALIGNMENT);
+    if (!rawMemory)
+    {
+        return nullptr;
+    }
+
+    uintptr_t chunkAddress = (reinterpret_cast<uintptr_t>(rawMemory) + CHUNK_SIZE - 1) & ~static_cast<uintptr_t>(CHUNK_SIZE - 1);
+    std::atomic<uintptr_t>* bucket = GetRegistryBucket(chunkAddress);
+    for (size_t i = 0; i < REGISTRY_BUCKET_SIZE; ++i)
+    {
+        uintptr_t expected = 0;
+        if (bucket[i].compare_exchange_strong(expected, chunkAddress, std::memory_order_acq_rel))
+        {
+            Chunk* chunk = new (reinterpret_cast<void*>(chunkAddress)) Chunk();
+            chunk->m_rawMemory = rawMemory;
+            chunk->m_outstanding.store(0, std::memory_order_relaxed);
+            liveChunkCount.fetch_add(1, std::memory_order_relaxed);
+            return chunk;
+        }
+    }
+
+    FreeRaw(rawMemory);
+    return nullptr;
+}
+
+void RequestArena::ReleaseChunk(Chunk* chunk)
+{
+    uintptr_t chunkAddress = reinterpret_cast<uintptr_t>(chunk);
+    std::atomic<uintptr_t>* bucket = GetRegistryBucket(chunkAddress);
+    for (size_t i = 0; i < REGISTRY_BUCKET_SIZE; ++i)
+    {
+        if (bucket[i].load(std::memory_order_relaxed) == chunkAddress)
+        {
+            bucket[i].store(0, std::memory_order_release);
+            break;
+        }
+    }
+
+    liveChunkCount.fetch_sub(1, std::memory_order_relaxed);
+    FreeRaw(chunk->m_rawMemory);
+}
+
+RequestArena::Chunk* RequestArena::FindChunk(void* memoryPtr)
+{
+    uintptr_t chunkAddress = reinterpret_cast<uintptr_t>(memoryPtr) & ~static_cast<uintptr_t>(CHUNK_SIZE - 1);
+    std::atomic<uintptr_t>* bucket = GetRegistryBucket(chunkAddress);
+    for (size_t i = 0; i < REGISTRY_BUCKET_SIZE; ++i)
+    {
+        if (bucket[i].load(std::memory_order_acquire) == chunkAddress)
+        {
+            return reinterpret_cast<Chunk*>(chunkAddress);
+        }
+    }
+    return nullptr;
+}
+
+void* RequestArena::Allocate(size_t allocationSize)
+{
+    if (activeArenaCount.load(std::memory_order_relaxed) == 0 || allocationSize > MAX_ARENA_ALLOCATION)
+    {
+        return nullptr;
+    }
+
+    ThreadSlot* slot = FindThreadSlot(false);
+    return slot ? slot->m_arena->AllocateInChunk(allocationSize) : nullptr;
+}
+
+bool RequestArena::Free(void* memoryPtr)
+{
+    if (liveChunkCount.load(std::memory_order_relaxed) == 0)
+    {
+        return false;
+    }
+
+    Chunk* chunk = FindChunk(memoryPtr);
+    if (!chunk)
+    {
+        return false;
+    }
+
+    if (chunk->m_outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        ReleaseChunk(chunk);
+    }
+    return true;
+}
+
+void* RequestArena::AllocateInChunk(size_t allocationSize)
+{
+    size_t roundedSize = allocationSize == 0 ? ALIGNMENT : (allocationSize + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    if (!m_chunk || m_chunkUsed + roundedSize > CHUNK_SIZE)
+    {
+        SealChunk();
+        m_chunk = CreateChunk();
+        if (!m_chunk)
+        {
+            return nullptr;
+        }
+        m_chunkUsed = CHUNK_HEADER_SIZE;
+        m_chunkAllocations = 0;
+        ++m_chunkCount;
+    }
+
+    void* memory = reinterpret_cast<char*>(m_chunk) + m_chunkUsed;
+    m_chunkUsed += roundedSize;
+    ++m_chunkAllocations;
+    ++m_allocationCount;
+    m_bytesAllocated += allocationSize;
+    return memory;
+}
+
+void RequestArena::SealChunk()
+{
+    if (!m_chunk)
+    {
+        return;
+    }
+
+    if (m_chunk->m_outstanding.fetch_add(m_chunkAllocations, std::memory_order_acq_rel) + m_chunkAllocations == 0)
+    {
+        ReleaseChunk(m_chunk);
+    }
+    m_chunk = nullptr;
+}
@@ -0,0 +1,98 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace Aws::Utils::Stream;
+
+PreallocatedStreamBuf::PreallocatedStreamBuf(unsigned char* buffer, size_t length) :
+    m_buffer(buffer),
+    m_length(length)
+{
+    char* begin = reinterpret_cast<char*>(m_buffer);
+    setg(begin, begin, begin + m_length);
+    setp(begin, begin + m_length);
+}
+
+PreallocatedStreamBuf::PreallocatedStreamBuf(Aws::Utils::Array<uint8_t>* buffer, size_t length) :
+    PreallocatedStreamBuf(buffer->GetUnderlyingData(), std::min(length, buffer->GetLength()))
+{
+}
+
+PreallocatedStreamBuf::pos_type PreallocatedStreamBuf::seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which)
+{
+    if ((which & (std::ios_base::in | std::ios_base::out)) == 0)
+    {
+        return pos_type(off_type(-1));
+    }
+
+    char* begin = reinterpret_cast<char*>(m_buffer);
+    off_type base = 0;
+    if (direction == std::ios_base::cur)
+    {
+        //with both positions requested the read position is the reference, same as a stringbuf.
+        base = (which & std::ios_base::in) ? gptr() - begin : pptr() - begin;
+    }
+    else if (direction == std::ios_base::end)
+    {
+        base = static_cast<off_type>(m_length);
+    }
+
+    off_type target = base + offset;
+    if (target < 0 || target > static_cast<off_type>(m_length))
+    {
+        return pos_type(off_type(-1));
+    }
+
+    if (which & std::ios_base::in)
+    {
+        setg(begin, begin + target, begin + m_length);
+    }
+    if (which & std::ios_base::out)
+    {
+        setp(begin, begin + m_length);
+        //pbump takes an int, so large offsets go in steps.
+        for (off_type remaining = target; remaining > 0;)
+        {
+            int step = static_cast<int>(std::min<off_type>(remaining, std::numeric_limits<int>::max()));
+            pbump(step);
+            remaining -= step;
+        }
+    }
+
+    return pos_type(target);
+}
+
+PreallocatedStreamBuf::pos_type PreallocatedStreamBuf::seekpos(pos_type position, std::ios_base::openmode which)
+{
+    return seekoff(off_type(position), std::ios_base::beg, which);
+}
+
+PreallocatedIOStream::PreallocatedIOStream(unsigned char* buffer, size_t length) :
+    Aws::IOStream(nullptr),
+    m_streamBuf(buffer, length)
+{
+    rdbuf(&m_streamBuf);
+}
+
+PreallocatedIOStream::PreallocatedIOStream(Aws::Utils::Array<uint8_t>* buffer, size_t length) :
+    Aws::IOStream(nullptr),
+    m_streamBuf(buffer, length)
+{
+    rdbuf(&m_streamBuf);
+}
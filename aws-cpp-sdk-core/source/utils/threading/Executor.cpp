@@ -15,14 +15,200 @@
 
 #include <aws/core/utils/threading/Executor.h>
 
+#include <aws/core/utils/memory/AWSMemory.h>
 
 #include <thread>
 
 using namespace Aws::Utils::Threading;
 
+static const char* POOLED_EXECUTOR_TAG = "PooledThreadExecutor";
+
 bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
 {
     std::thread t(fx);
     t.detach();
     return true;
-}
\ No newline at end of file
+}
+
+PooledThreadExecutor::PooledThreadExecutor(size_t poolSize, size_t maxQueuedTasks, OverflowPolicy overflowPolicy) :
+    m_maxQueuedTasks(maxQueuedTasks),
+    m_overflowPolicy(overflowPolicy),
+    m_queues(),
+    m_workers(),
+    m_queuedTasks(0),
+    m_nextQueue(0),
+    m_stopping(false)
+{
+    if(poolSize == 0)
+    {
+        poolSize = 1;
+    }
+
+    m_queues.reserve(poolSize);
+    for(size_t i = 0; i < poolSize; ++i)
+    {
+        m_queues.push_back(Aws::New<WorkerQueue>(POOLED_EXECUTOR_TAG));
+    }
+
+    m_workers.reserve(poolSize);
+    for(size_t i = 0; i < poolSize; ++i)
+    {
+        m_workers.emplace_back(&PooledThreadExecutor::WorkerLoop, this, i);
+    }
+}
+
+PooledThreadExecutor::~PooledThreadExecutor()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_syncMutex);
+        m_stopping.store(true);
+    }
+    m_taskAvailable.notify_all();
+    m_slotAvailable.notify_all();
+
+    for(auto& worker : m_workers)
+    {
+        worker.join();
+    }
+
+    for(auto queue : m_queues)
+    {
+        Aws::Delete(queue);
+    }
+}
+
+bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fx)
+{
+    // tasks running on the pool may keep submitting while it drains; the workers outlive the queue
+    bool isWorkerThread = IsWorkerThread();
+    if(m_stopping.load() && !isWorkerThread)
+    {
+        return false;
+    }
+
+    if(!ReserveSlot(m_overflowPolicy == OverflowPolicy::BLOCK && !isWorkerThread))
+    {
+        if((m_stopping.load() && !isWorkerThread) || m_overflowPolicy == OverflowPolicy::REJECT)
+        {
+            return false;
+        }
+
+        fx();
+        return true;
+    }
+
+    WorkerQueue* queue = m_queues[m_nextQueue.fetch_add(1) % m_queues.size()];
+    {
+        std::lock_guard<std::mutex> locker(queue->m_mutex);
+        queue->m_tasks.push_back(std::move(fx));
+    }
+
+    // an idle worker checks m_queuedTasks under m_syncMutex before sleeping, so cycling the lock here
+    // guarantees it is either already awake or will see this notification
+    {
+        std::lock_guard<std::mutex> locker(m_syncMutex);
+    }
+    m_taskAvailable.notify_one();
+
+    return true;
+}
+
+bool PooledThreadExecutor::ReserveSlot(bool waitForSlot)
+{
+    size_t queued = m_queuedTasks.load();
+    for(;;)
+    {
+        if(m_maxQueuedTasks == 0 || queued < m_maxQueuedTasks)
+        {
+            if(m_queuedTasks.compare_exchange_weak(queued, queued + 1))
+            {
+                return true;
+            }
+            continue;
+        }
+
+        if(!waitForSlot)
+        {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> locker(m_syncMutex);
+        m_slotAvailable.wait(locker, [&](){ return m_stopping.load() || m_queuedTasks.load() < m_maxQueuedTasks; });
+        if(m_stopping.load())
+        {
+            return false;
+        }
+        queued = m_queuedTasks.load();
+    }
+}
+
+bool PooledThreadExecutor::TryPopTask(size_t workerIndex, std::function<void()>& task)
+{
+    // drain our own deque first, then steal the oldest task from a sibling
+    for(size_t i = 0; i < m_queues.size(); ++i)
+    {
+        WorkerQueue* queue = m_queues[(workerIndex + i) % m_queues.size()];
+        std::lock_guard<std::mutex> locker(queue->m_mutex);
+        if(!queue->m_tasks.empty())
+        {
+            task = std::move(queue->m_tasks.front());
+            queue->m_tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool PooledThreadExecutor::IsWorkerThread() const
+{
+    auto currentThread = std::this_thread::get_id();
+    for(auto& worker : m_workers)
+    {
+        if(worker.get_id() == currentThread)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void PooledThreadExecutor::WorkerLoop(size_t workerIndex)
+{
+    std::function<void()> task;
+    for(;;)
+    {
+        if(TryPopTask(workerIndex, task))
+        {
+            m_queuedTasks.fetch_sub(1);
+            if(m_maxQueuedTasks > 0 && m_overflowPolicy == OverflowPolicy::BLOCK)
+            {
+                {
+                    std::lock_guard<std::mutex> locker(m_syncMutex);
+                }
+                m_slotAvailable.notify_one();
+            }
+
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> locker(m_syncMutex);
+        if(m_queuedTasks.load() > 0)
+        {
+            // a slot was reserved but the task has not landed in a deque yet
+            locker.unlock();
+            std::this_thread::yield();
+            continue;
+        }
+
+        if(m_stopping.load())
+        {
+            return;
+        }
+
+        m_taskAvailable.wait(locker, [&](){ return m_stopping.load() || m_queuedTasks.load() > 0; });
+    }
+}
@@ -19,6 +19,8 @@
 #include <unistd.h>
 #include <pwd.h>
 #include <sys/stat.h>
+#include <dirent.h>
+#include <cerrno>
 
 #if __ANDROID__
 #include <cerrno>
@@ -91,3 +93,65 @@ bool FileSystemUtils::RelocateFileOrDirectory(const char* from, const char* to)
     AWS_LOGSTREAM_DEBUG(LOG_TAG,  "The moving operation of file at " << from << " to " << to << " Returned error code of " << errno);
     return errorCode == 0;
 }
+
+static bool ListFilesBelow(const Aws::String& root, const Aws::String& relativeDirectory, Aws::Vector<DirectoryEntry>& entries)
+{
+    Aws::String directory = relativeDirectory.empty() ? root : root + PATH_DELIM + relativeDirectory;
+    DIR* dir = opendir(directory.c_str());
+    if (!dir)
+    {
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Unable to open directory " << directory << " error code: " << errno);
+        return false;
+    }
+
+    bool success = true;
+    while (struct dirent* entry = readdir(dir))
+    {
+        Aws::String name(entry->d_name);
+        if (name == "." || name == "..")
+        {
+            continue;
+        }
+
+        Aws::String relativePath = relativeDirectory.empty() ? name : relativeDirectory + PATH_DELIM + name;
+        Aws::String fullPath = root + PATH_DELIM + relativePath;
+
+        // Symbolic links to files are listed, links to directories are not followed so a link cycle can't recurse forever
+        struct stat entryStat;
+        if (lstat(fullPath.c_str(), &entryStat) != 0)
+        {
+            continue;
+        }
+        if (S_ISDIR(entryStat.st_mode))
+        {
+            success = ListFilesBelow(root, relativePath, entries) && success;
+            continue;
+        }
+        if (S_ISLNK(entryStat.st_mode) && stat(fullPath.c_str(), &entryStat) != 0)
+        {
+            continue;
+        }
+        if (S_ISREG(entryStat.st_mode))
+        {
+            DirectoryEntry file;
+            file.m_relativePath = relativePath;
+            file.m_fileSize = static_cast<uint64_t>(entryStat.st_size);
+            entries.push_back(file);
+        }
+    }
+
+    closedir(dir);
+    return success;
+}
+
+bool FileSystemUtils::ListFilesRecursively(const char* directory, Aws::Vector<DirectoryEntry>& entries)
+{
+    AWS_LOGSTREAM_INFO(LOG_TAG, "Listing files below " << directory);
+
+    Aws::String root(directory);
+    while (root.length() > 1 && root.back() == PATH_DELIM)
+    {
+        root.pop_back();
+    }
+    return ListFilesBelow(root, "", entries);
+}
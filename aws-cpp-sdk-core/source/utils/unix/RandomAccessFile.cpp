@@ -0,0 +1,148 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+#include <aws/core/utils/RandomAccessFile.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace Aws::Utils;
+
+static const char* LOG_TAG = "RandomAccessFile";
+
+RandomAccessFile::RandomAccessFile() :
+    m_fd(-1),
+    m_size(0),
+    m_modifiedTime(0)
+{
+}
+
+RandomAccessFile::~RandomAccessFile()
+{
+    Close();
+}
+
+bool RandomAccessFile::OpenForRead(const char* path)
+{
+    Close();
+
+    m_fd = open(path, O_RDONLY);
+    if (m_fd < 0)
+    {
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Unable to open " << path << " for reading, errno: " << errno);
+        return false;
+    }
+
+    struct stat fileInfo;
+    if (fstat(m_fd, &fileInfo) != 0)
+    {
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Unable to stat " << path << ", errno: " << errno);
+        Close();
+        return false;
+    }
+
+    m_size = static_cast<uint64_t>(fileInfo.st_size);
+    m_modifiedTime = static_cast<uint64_t>(fileInfo.st_mtime);
+    return true;
+}
+
+bool RandomAccessFile::OpenForWrite(const char* path, uint64_t size, bool truncate)
+{
+    Close();
+
+    m_fd = open(path, O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0), S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (m_fd < 0)
+    {
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Unable to open " << path << " for writing, errno: " << errno);
+        return false;
+    }
+
+    //ftruncate rather than posix_fallocate: it's available everywhere we build and the ranges get written right away anyway.
+    if (ftruncate(m_fd, static_cast<off_t>(size)) != 0)
+    {
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Unable to size " << path << " to " << size << " bytes, errno: " << errno);
+        Close();
+        return false;
+    }
+
+    m_size = size;
+    return true;
+}
+
+bool RandomAccessFile::IsOpen() const
+{
+    return m_fd >= 0;
+}
+
+void RandomAccessFile::Close()
+{
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+        m_fd = -1;
+    }
+    m_size = 0;
+    m_modifiedTime = 0;
+}
+
+int64_t RandomAccessFile::ReadAt(uint64_t offset, void* buffer, size_t length) const
+{
+    char* destination = static_cast<char*>(buffer);
+    size_t totalRead = 0;
+    while (totalRead < length)
+    {
+        ssize_t bytesRead = pread(m_fd, destination + totalRead, length - totalRead, static_cast<off_t>(offset + totalRead));
+        if (bytesRead < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            AWS_LOGSTREAM_ERROR(LOG_TAG, "Read of " << length << " bytes at offset " << offset << " failed, errno: " << errno);
+            return -1;
+        }
+        if (bytesRead == 0)
+        {
+            break;
+        }
+        totalRead += static_cast<size_t>(bytesRead);
+    }
+
+    return static_cast<int64_t>(totalRead);
+}
+
+bool RandomAccessFile::WriteAt(uint64_t offset, const void* data, size_t length) const
+{
+    const char* source = static_cast<const char*>(data);
+    size_t totalWritten = 0;
+    while (totalWritten < length)
+    {
+        ssize_t bytesWritten = pwrite(m_fd, source + totalWritten, length - totalWritten, static_cast<off_t>(offset + totalWritten));
+        if (bytesWritten < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            AWS_LOGSTREAM_ERROR(LOG_TAG, "Write of " << length << " bytes at offset " << offset << " failed, errno: " << errno);
+            return false;
+        }
+        totalWritten += static_cast<size_t>(bytesWritten);
+    }
+
+    return true;
+}
@@ -112,4 +112,60 @@ bool FileSystemUtils::RelocateFileOrDirectory(const char* from, const char* to)
         AWS_LOGSTREAM_DEBUG(LOG_TAG,  "The moving operation of file at " << from << " to " << to << " Returned error code of " << errorCode);
         return false;
     }
-}
\ No newline at end of file
+}
+
+static bool ListFilesBelow(const Aws::String& root, const Aws::String& relativeDirectory, Aws::Vector<DirectoryEntry>& entries)
+{
+    Aws::String directory = relativeDirectory.empty() ? root : root + PATH_DELIM + relativeDirectory;
+    Aws::String pattern = directory + PATH_DELIM + "*";
+
+    WIN32_FIND_DATAA findData;
+    HANDLE findHandle = FindFirstFileA(pattern.c_str(), &findData);
+    if (findHandle == INVALID_HANDLE_VALUE)
+    {
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Unable to open directory " << directory << " error code: " << GetLastError());
+        return false;
+    }
+
+    bool success = true;
+    do
+    {
+        Aws::String name(findData.cFileName);
+        if (name == "." || name == "..")
+        {
+            continue;
+        }
+
+        Aws::String relativePath = relativeDirectory.empty() ? name : relativeDirectory + PATH_DELIM + name;
+
+        if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+        {
+            // Junctions and directory links are not followed so a link cycle can't recurse forever
+            if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT))
+            {
+                success = ListFilesBelow(root, relativePath, entries) && success;
+            }
+            continue;
+        }
+
+        DirectoryEntry file;
+        file.m_relativePath = relativePath;
+        file.m_fileSize = (static_cast<uint64_t>(findData.nFileSizeHigh) << 32) | findData.nFileSizeLow;
+        entries.push_back(file);
+    } while (FindNextFileA(findHandle, &findData));
+
+    FindClose(findHandle);
+    return success;
+}
+
+bool FileSystemUtils::ListFilesRecursively(const char* directory, Aws::Vector<DirectoryEntry>& entries)
+{
+    AWS_LOGSTREAM_INFO(LOG_TAG, "Listing files below " << directory);
+
+    Aws::String root(directory);
+    while (root.length() > 1 && (root.back() == PATH_DELIM || root.back() == '/'))
+    {
+        root.pop_back();
+    }
+    return ListFilesBelow(root, "", entries);
+}
@@ -0,0 +1,165 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+#include <aws/core/utils/RandomAccessFile.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <windows.h>
+
+#include <algorithm>
+
+using namespace Aws::Utils;
+
+static const char* LOG_TAG = "RandomAccessFile";
+static const size_t MAX_IO_SIZE = 1024 * 1024 * 1024;
+
+static OVERLAPPED OffsetToOverlapped(uint64_t offset)
+{
+    OVERLAPPED overlapped = {};
+    overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFF);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    return overlapped;
+}
+
+RandomAccessFile::RandomAccessFile() :
+    m_handle(INVALID_HANDLE_VALUE),
+    m_size(0),
+    m_modifiedTime(0)
+{
+}
+
+RandomAccessFile::~RandomAccessFile()
+{
+    Close();
+}
+
+bool RandomAccessFile::OpenForRead(const char* path)
+{
+    Close();
+
+    m_handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (m_handle == INVALID_HANDLE_VALUE)
+    {
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Unable to open " << path << " for reading, error: " << GetLastError());
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(m_handle, &fileSize))
+    {
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Unable to get the size of " << path << ", error: " << GetLastError());
+        Close();
+        return false;
+    }
+
+    FILETIME lastWrite;
+    if (!GetFileTime(m_handle, nullptr, nullptr, &lastWrite))
+    {
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Unable to get the modification time of " << path << ", error: " << GetLastError());
+        Close();
+        return false;
+    }
+
+    m_size = static_cast<uint64_t>(fileSize.QuadPart);
+    m_modifiedTime = (static_cast<uint64_t>(lastWrite.dwHighDateTime) << 32) | lastWrite.dwLowDateTime;
+    return true;
+}
+
+bool RandomAccessFile::OpenForWrite(const char* path, uint64_t size, bool truncate)
+{
+    Close();
+
+    m_handle = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, truncate ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (m_handle == INVALID_HANDLE_VALUE)
+    {
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Unable to open " << path << " for writing, error: " << GetLastError());
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    fileSize.QuadPart = static_cast<LONGLONG>(size);
+    if (!SetFilePointerEx(m_handle, fileSize, nullptr, FILE_BEGIN) || !SetEndOfFile(m_handle))
+    {
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Unable to size " << path << " to " << size << " bytes, error: " << GetLastError());
+        Close();
+        return false;
+    }
+
+    m_size = size;
+    return true;
+}
+
+bool RandomAccessFile::IsOpen() const
+{
+    return m_handle != INVALID_HANDLE_VALUE;
+}
+
+void RandomAccessFile::Close()
+{
+    if (m_handle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_handle);
+        m_handle = INVALID_HANDLE_VALUE;
+    }
+    m_size = 0;
+    m_modifiedTime = 0;
+}
+
+int64_t RandomAccessFile::ReadAt(uint64_t offset, void* buffer, size_t length) const
+{
+    char* destination = static_cast<char*>(buffer);
+    size_t totalRead = 0;
+    while (totalRead < length)
+    {
+        OVERLAPPED overlapped = OffsetToOverlapped(offset + totalRead);
+        DWORD toRead = static_cast<DWORD>((std::min)(length - totalRead, MAX_IO_SIZE));
+        DWORD bytesRead = 0;
+        if (!ReadFile(m_handle, destination + totalRead, toRead, &bytesRead, &overlapped))
+        {
+            if (GetLastError() == ERROR_HANDLE_EOF)
+            {
+                break;
+            }
+            AWS_LOGSTREAM_ERROR(LOG_TAG, "Read of " << length << " bytes at offset " << offset << " failed, error: " << GetLastError());
+            return -1;
+        }
+        if (bytesRead == 0)
+        {
+            break;
+        }
+        totalRead += bytesRead;
+    }
+
+    return static_cast<int64_t>(totalRead);
+}
+
+bool RandomAccessFile::WriteAt(uint64_t offset, const void* data, size_t length) const
+{
+    const char* source = static_cast<const char*>(data);
+    size_t totalWritten = 0;
+    while (totalWritten < length)
+    {
+        OVERLAPPED overlapped = OffsetToOverlapped(offset + totalWritten);
+        DWORD toWrite = static_cast<DWORD>((std::min)(length - totalWritten, MAX_IO_SIZE));
+        DWORD bytesWritten = 0;
+        if (!WriteFile(m_handle, source + totalWritten, toWrite, &bytesWritten, &overlapped))
+        {
+            AWS_LOGSTREAM_ERROR(LOG_TAG, "Write of " << length << " bytes at offset " << offset << " failed, error: " << GetLastError());
+            return false;
+        }
+        totalWritten += bytesWritten;
+    }
+
+    return true;
+}
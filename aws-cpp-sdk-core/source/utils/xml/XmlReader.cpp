@@ -0,0 +1,588 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <cstdlib>
+#include <cstring>
+
+using namespace Aws::Utils::Xml;
+
+static const int END_OF_STREAM = -1;
+
+static bool IsWhitespace(int c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool IsNameTerminator(char c)
+{
+    return IsWhitespace(c) || c == '/' || c == '>' || c == '=' || c == '<';
+}
+
+static void AppendUtf8(Aws::String& out, unsigned long codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        out.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+XmlReader::XmlReader(Aws::IStream& istream) :
+    m_stream(istream),
+    m_position(0),
+    m_length(0),
+    m_offset(0),
+    m_depth(0),
+    m_attributeCount(0),
+    m_pendingEnd(false),
+    m_sawRoot(false),
+    m_token(XmlToken::END_ELEMENT)
+{
+}
+
+bool XmlReader::Fill()
+{
+    m_offset += m_length;
+    m_position = 0;
+    m_length = 0;
+    if (m_stream.good())
+    {
+        m_stream.read(m_buffer, BUFFER_SIZE);
+        m_length = static_cast<size_t>(m_stream.gcount());
+    }
+
+    return m_length > 0;
+}
+
+int XmlReader::Peek()
+{
+    if (m_position == m_length && !Fill())
+    {
+        return END_OF_STREAM;
+    }
+
+    return static_cast<unsigned char>(m_buffer[m_position]);
+}
+
+void XmlReader::SkipWhitespace()
+{
+    while (IsWhitespace(Peek()))
+    {
+        ++m_position;
+    }
+}
+
+bool XmlReader::Consume(const char* expected)
+{
+    for (const char* c = expected; *c != 0; ++c)
+    {
+        if (Peek() != static_cast<unsigned char>(*c))
+        {
+            Fail("Malformed markup");
+            return false;
+        }
+        ++m_position;
+    }
+
+    return true;
+}
+
+bool XmlReader::SkipPast(const char* terminator, Aws::String* skipped)
+{
+    size_t terminatorLength = strlen(terminator);
+    char window[4] = { 0, 0, 0, 0 };
+    for (;;)
+    {
+        int c = Peek();
+        if (c == END_OF_STREAM)
+        {
+            Fail("Unexpected end of document");
+            return false;
+        }
+        ++m_position;
+
+        memmove(window, window + 1, 2);
+        window[2] = static_cast<char>(c);
+        if (skipped)
+        {
+            skipped->push_back(static_cast<char>(c));
+        }
+
+        if (memcmp(window + 3 - terminatorLength, terminator, terminatorLength) == 0)
+        {
+            if (skipped)
+            {
+                skipped->resize(skipped->length() - terminatorLength);
+            }
+            return true;
+        }
+    }
+}
+
+XmlToken XmlReader::Fail(const char* message)
+{
+    if (m_token != XmlToken::PARSE_ERROR)
+    {
+        Aws::StringStream ss;
+        ss << message << " at offset " << (m_offset + m_position);
+        m_errorMessage = ss.str();
+        m_token = XmlToken::PARSE_ERROR;
+    }
+    return m_token;
+}
+
+XmlToken XmlReader::Next()
+{
+    if (m_token == XmlToken::PARSE_ERROR || m_token == XmlToken::END_DOCUMENT)
+    {
+        return m_token;
+    }
+
+    if (m_pendingEnd)
+    {
+        m_pendingEnd = false;
+        m_attributeCount = 0;
+        --m_depth;
+        m_token = XmlToken::END_ELEMENT;
+        return m_token;
+    }
+
+    m_attributeCount = 0;
+    for (;;)
+    {
+        int c = Peek();
+        if (c == END_OF_STREAM)
+        {
+            if (m_depth > 0)
+            {
+                return Fail("Unexpected end of document");
+            }
+            if (!m_sawRoot)
+            {
+                return Fail("Document has no root element");
+            }
+            m_token = XmlToken::END_DOCUMENT;
+            return m_token;
+        }
+
+        bool emitted = false;
+        XmlToken token;
+        if (c == '<')
+        {
+            ++m_position;
+            token = ReadMarkup(emitted);
+        }
+        else
+        {
+            token = ReadText(emitted);
+        }
+
+        if (emitted || token == XmlToken::PARSE_ERROR)
+        {
+            m_token = token;
+            return m_token;
+        }
+    }
+}
+
+XmlToken XmlReader::ReadMarkup(bool& emitted)
+{
+    int c = Peek();
+    if (c == '?')
+    {
+        SkipPast("?>", nullptr);
+        return m_token;
+    }
+
+    if (c == '!')
+    {
+        ++m_position;
+        if (Peek() == '-')
+        {
+            if (Consume("--"))
+            {
+                SkipPast("-->", nullptr);
+            }
+            return m_token;
+        }
+
+        if (Peek() == '[')
+        {
+            if (!Consume("[CDATA[") || m_depth == 0)
+            {
+                return Fail("Unexpected CDATA section");
+            }
+            m_text.clear();
+            if (!SkipPast("]]>", &m_text))
+            {
+                return m_token;
+            }
+            emitted = true;
+            return XmlToken::TEXT;
+        }
+
+        //a doctype; internal subsets are not supported.
+        SkipPast(">", nullptr);
+        return m_token;
+    }
+
+    emitted = true;
+    if (c == '/')
+    {
+        ++m_position;
+        if (!ReadName(m_name))
+        {
+            return m_token;
+        }
+        SkipWhitespace();
+        if (Peek() != '>')
+        {
+            return Fail("Expected '>' to close the end tag");
+        }
+        ++m_position;
+        if (m_depth == 0 || m_elements[m_depth - 1] != m_name)
+        {
+            return Fail("End tag does not match the open element");
+        }
+        --m_depth;
+        return XmlToken::END_ELEMENT;
+    }
+
+    if (m_depth == 0 && m_sawRoot)
+    {
+        return Fail("More than one root element");
+    }
+
+    if (!ReadName(m_name) || !ReadAttributes())
+    {
+        return m_token;
+    }
+
+    if (Peek() == '/')
+    {
+        ++m_position;
+        m_pendingEnd = true;
+    }
+    if (Peek() != '>')
+    {
+        return Fail("Expected '>' to close the start tag");
+    }
+    ++m_position;
+
+    if (m_elements.size() <= m_depth)
+    {
+        m_elements.push_back(m_name);
+    }
+    else
+    {
+        m_elements[m_depth] = m_name;
+    }
+    ++m_depth;
+    m_sawRoot = true;
+    return XmlToken::START_ELEMENT;
+}
+
+bool XmlReader::ReadName(Aws::String& name)
+{
+    name.clear();
+    for (;;)
+    {
+        if (m_position == m_length && !Fill())
+        {
+            break;
+        }
+
+        size_t runStart = m_position;
+        while (m_position < m_length && !IsNameTerminator(m_buffer[m_position]))
+        {
+            ++m_position;
+        }
+        name.append(m_buffer + runStart, m_position - runStart);
+        if (m_position < m_length)
+        {
+            break;
+        }
+    }
+
+    if (name.empty())
+    {
+        Fail("Expected a name");
+        return false;
+    }
+
+    return true;
+}
+
+bool XmlReader::ReadAttributes()
+{
+    for (;;)
+    {
+        SkipWhitespace();
+        int c = Peek();
+        if (c == '/' || c == '>')
+        {
+            return true;
+        }
+
+        if (m_attributes.size() <= m_attributeCount)
+        {
+            m_attributes.push_back(std::pair<Aws::String, Aws::String>());
+        }
+        std::pair<Aws::String, Aws::String>& attribute = m_attributes[m_attributeCount];
+        if (!ReadName(attribute.first))
+        {
+            return false;
+        }
+        SkipWhitespace();
+        if (Peek() != '=')
+        {
+            Fail("Expected '=' after attribute name");
+            return false;
+        }
+        ++m_position;
+        SkipWhitespace();
+
+        int quote = Peek();
+        if (quote != '"' && quote != '\'')
+        {
+            Fail("Expected a quoted attribute value");
+            return false;
+        }
+        ++m_position;
+
+        attribute.second.clear();
+        for (;;)
+        {
+            c = Peek();
+            if (c == END_OF_STREAM || c == '<')
+            {
+                Fail("Unterminated attribute value");
+                return false;
+            }
+            ++m_position;
+            if (c == quote)
+            {
+                break;
+            }
+            if (c == '&')
+            {
+                if (!ReadEntity(attribute.second))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                attribute.second.push_back(static_cast<char>(c));
+            }
+        }
+        ++m_attributeCount;
+    }
+}
+
+//the '&' has already been consumed.
+bool XmlReader::ReadEntity(Aws::String& out)
+{
+    char entity[12];
+    size_t length = 0;
+    for (;;)
+    {
+        int c = Peek();
+        if (c == END_OF_STREAM || length == sizeof(entity) - 1)
+        {
+            Fail("Unterminated entity reference");
+            return false;
+        }
+        ++m_position;
+        if (c == ';')
+        {
+            break;
+        }
+        entity[length++] = static_cast<char>(c);
+    }
+    entity[length] = 0;
+
+    if (strcmp(entity, "lt") == 0) out.push_back('<');
+    else if (strcmp(entity, "gt") == 0) out.push_back('>');
+    else if (strcmp(entity, "amp") == 0) out.push_back('&');
+    else if (strcmp(entity, "quot") == 0) out.push_back('"');
+    else if (strcmp(entity, "apos") == 0) out.push_back('\'');
+    else if (entity[0] == '#' && length > 1)
+    {
+        bool hex = entity[1] == 'x' || entity[1] == 'X';
+        char* end = nullptr;
+        unsigned long codePoint = strtoul(entity + (hex ? 2 : 1), &end, hex ? 16 : 10);
+        if (*end != 0 || end == entity + (hex ? 2 : 1) || codePoint == 0 || codePoint > 0x10FFFF)
+        {
+            Fail("Invalid character reference");
+            return false;
+        }
+        AppendUtf8(out, codePoint);
+    }
+    else
+    {
+        Fail("Unknown entity reference");
+        return false;
+    }
+
+    return true;
+}
+
+XmlToken XmlReader::ReadText(bool& emitted)
+{
+    m_text.clear();
+    bool whitespaceOnly = true;
+    for (;;)
+    {
+        if (m_position == m_length && !Fill())
+        {
+            break;
+        }
+
+        size_t runStart = m_position;
+        while (m_position < m_length && m_buffer[m_position] != '<' && m_buffer[m_position] != '&')
+        {
+            whitespaceOnly = whitespaceOnly && IsWhitespace(m_buffer[m_position]);
+            ++m_position;
+        }
+        m_text.append(m_buffer + runStart, m_position - runStart);
+        if (m_position == m_length)
+        {
+            continue;
+        }
+
+        if (m_buffer[m_position] == '<')
+        {
+            break;
+        }
+
+        ++m_position;
+        whitespaceOnly = false;
+        if (!ReadEntity(m_text))
+        {
+            return m_token;
+        }
+    }
+
+    if (whitespaceOnly)
+    {
+        return m_token;
+    }
+
+    if (m_depth == 0)
+    {
+        return Fail("Text outside of the root element");
+    }
+
+    emitted = true;
+    return XmlToken::TEXT;
+}
+
+const Aws::String& XmlReader::GetAttributeValue(const char* name) const
+{
+    for (size_t i = 0; i < m_attributeCount; ++i)
+    {
+        if (m_attributes[i].first == name)
+        {
+            return m_attributes[i].second;
+        }
+    }
+
+    return m_emptyString;
+}
+
+const Aws::String& XmlReader::ReadElementText()
+{
+    m_elementText.clear();
+    if (m_token != XmlToken::START_ELEMENT)
+    {
+        return m_elementText;
+    }
+
+    size_t depth = m_depth;
+    for (;;)
+    {
+        XmlToken token = Next();
+        if (token == XmlToken::TEXT)
+        {
+            if (m_elementText.empty())
+            {
+                //the usual case of a single text node: hand over the buffer instead of copying out of it.
+                m_elementText.swap(m_text);
+            }
+            else
+            {
+                m_elementText.append(m_text);
+            }
+        }
+        else if ((token == XmlToken::END_ELEMENT && m_depth < depth) || token == XmlToken::PARSE_ERROR || token == XmlToken::END_DOCUMENT)
+        {
+            break;
+        }
+    }
+
+    size_t end = m_elementText.length();
+    while (end > 0 && IsWhitespace(m_elementText[end - 1]))
+    {
+        --end;
+    }
+    size_t begin = 0;
+    while (begin < end && IsWhitespace(m_elementText[begin]))
+    {
+        ++begin;
+    }
+    m_elementText.erase(end);
+    m_elementText.erase(0, begin);
+
+    return m_elementText;
+}
+
+void XmlReader::SkipElement()
+{
+    if (m_token != XmlToken::START_ELEMENT)
+    {
+        return;
+    }
+
+    size_t depth = m_depth;
+    for (;;)
+    {
+        XmlToken token = Next();
+        if ((token == XmlToken::END_ELEMENT && m_depth < depth) || token == XmlToken::PARSE_ERROR || token == XmlToken::END_DOCUMENT)
+        {
+            return;
+        }
+    }
+}
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ActivatePipelineRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ActivatePipeline"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     AddTagsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddTags"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeactivatePipelineRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeactivatePipeline"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeletePipelineRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeletePipeline"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeObjectsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeObjects"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribePipelinesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribePipelines"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     EvaluateExpressionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EvaluateExpression"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetPipelineDefinitionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetPipelineDefinition"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
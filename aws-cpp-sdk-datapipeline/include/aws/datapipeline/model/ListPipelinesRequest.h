@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListPipelinesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListPipelines"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     PollForTaskRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PollForTask"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     PutPipelineDefinitionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutPipelineDefinition"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
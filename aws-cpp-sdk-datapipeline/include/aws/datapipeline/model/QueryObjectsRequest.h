@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     QueryObjectsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "QueryObjects"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ReportTaskProgressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReportTaskProgress"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ReportTaskRunnerHeartbeatRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReportTaskRunnerHeartbeat"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
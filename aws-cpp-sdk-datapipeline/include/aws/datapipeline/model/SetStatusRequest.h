@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetStatusRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetStatus"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
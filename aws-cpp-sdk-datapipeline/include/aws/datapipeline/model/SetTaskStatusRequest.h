@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetTaskStatusRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetTaskStatus"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ValidatePipelineDefinitionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ValidatePipelineDefinition"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
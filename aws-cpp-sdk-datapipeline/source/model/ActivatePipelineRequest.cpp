@@ -56,7 +56,7 @@ Aws::String ActivatePipelineRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ActivatePipelineRequest::GetRequestSpecificHeaders() const
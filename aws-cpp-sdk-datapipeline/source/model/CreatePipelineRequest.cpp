@@ -62,7 +62,7 @@ Aws::String CreatePipelineRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreatePipelineRequest::GetRequestSpecificHeaders() const
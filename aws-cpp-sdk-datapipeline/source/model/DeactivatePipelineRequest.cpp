@@ -44,7 +44,7 @@ Aws::String DeactivatePipelineRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeactivatePipelineRequest::GetRequestSpecificHeaders() const
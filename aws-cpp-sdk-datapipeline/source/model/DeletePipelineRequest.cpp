@@ -36,7 +36,7 @@ Aws::String DeletePipelineRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeletePipelineRequest::GetRequestSpecificHeaders() const
@@ -63,7 +63,7 @@ Aws::String DescribeObjectsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeObjectsRequest::GetRequestSpecificHeaders() const
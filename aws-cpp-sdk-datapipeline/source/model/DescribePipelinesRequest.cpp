@@ -41,7 +41,7 @@ Aws::String DescribePipelinesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribePipelinesRequest::GetRequestSpecificHeaders() const
@@ -50,7 +50,7 @@ Aws::String EvaluateExpressionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection EvaluateExpressionRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String GetPipelineDefinitionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetPipelineDefinitionRequest::GetRequestSpecificHeaders() const
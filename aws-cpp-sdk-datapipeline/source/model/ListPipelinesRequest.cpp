@@ -36,7 +36,7 @@ Aws::String ListPipelinesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListPipelinesRequest::GetRequestSpecificHeaders() const
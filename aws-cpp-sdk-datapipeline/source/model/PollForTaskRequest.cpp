@@ -50,7 +50,7 @@ Aws::String PollForTaskRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PollForTaskRequest::GetRequestSpecificHeaders() const
@@ -72,7 +72,7 @@ Aws::String PutPipelineDefinitionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PutPipelineDefinitionRequest::GetRequestSpecificHeaders() const
@@ -65,7 +65,7 @@ Aws::String QueryObjectsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection QueryObjectsRequest::GetRequestSpecificHeaders() const
@@ -48,7 +48,7 @@ Aws::String RemoveTagsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RemoveTagsRequest::GetRequestSpecificHeaders() const
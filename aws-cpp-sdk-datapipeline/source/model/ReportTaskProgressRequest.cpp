@@ -48,7 +48,7 @@ Aws::String ReportTaskProgressRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ReportTaskProgressRequest::GetRequestSpecificHeaders() const
@@ -55,7 +55,7 @@ Aws::String SetStatusRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection SetStatusRequest::GetRequestSpecificHeaders() const
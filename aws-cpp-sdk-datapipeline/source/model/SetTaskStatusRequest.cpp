@@ -63,7 +63,7 @@ Aws::String SetTaskStatusRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection SetTaskStatusRequest::GetRequestSpecificHeaders() const
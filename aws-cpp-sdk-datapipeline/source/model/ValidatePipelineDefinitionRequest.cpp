@@ -72,7 +72,7 @@ Aws::String ValidatePipelineDefinitionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ValidatePipelineDefinitionRequest::GetRequestSpecificHeaders() const
@@ -19,6 +19,7 @@
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/Array.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 namespace Aws
 {
@@ -36,6 +37,8 @@ public:
     explicit AttributeValue(const Aws::String& s) { SetS(s); }
     explicit AttributeValue(const Aws::Vector<Aws::String>& ss) { SetSS(ss); }
     AttributeValue(const Aws::Utils::Json::JsonValue& jsonValue) { *this = jsonValue; }
+    /// reads the attribute value object the reader is positioned on (its BEGIN_OBJECT token)
+    AttributeValue(Aws::Utils::Json::JsonReader& reader) { *this = reader; }
 
     /// returns the String value if the value is specialized to this type, otherwise an empty String
     const Aws::String& GetS() const;
@@ -151,6 +154,7 @@ public:
     AttributeValue& SetNull(bool value);
 
     AttributeValue& operator = (const Aws::Utils::Json::JsonValue&);
+    AttributeValue& operator = (Aws::Utils::Json::JsonReader&);
 
     bool operator == (const AttributeValue& other) const;
     inline bool operator != (const AttributeValue& other) const { return !(*this == other); }
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     BatchGetItemRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "BatchGetItem"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
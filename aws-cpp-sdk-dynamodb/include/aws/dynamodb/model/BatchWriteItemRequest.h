@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     BatchWriteItemRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "BatchWriteItem"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -38,6 +38,7 @@ namespace Model
   {
   public:
     CreateTableRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateTable"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
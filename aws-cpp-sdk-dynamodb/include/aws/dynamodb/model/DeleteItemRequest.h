@@ -38,6 +38,7 @@ namespace Model
   {
   public:
     DeleteItemRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteItem"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
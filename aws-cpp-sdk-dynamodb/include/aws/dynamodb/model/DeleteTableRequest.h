@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteTableRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteTable"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
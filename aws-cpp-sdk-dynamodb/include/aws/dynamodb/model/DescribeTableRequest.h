@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeTableRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeTable"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
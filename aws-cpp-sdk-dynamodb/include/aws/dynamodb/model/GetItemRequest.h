@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     GetItemRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetItem"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -0,0 +1,50 @@
+/*
+* Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+#pragma once
+
+#include <aws/dynamodb/DynamoDB_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/dynamodb/model/AttributeValue.h>
+#include <aws/dynamodb/model/ConsumedCapacity.h>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Json
+{
+class JsonReader;
+} // namespace Json
+} // namespace Utils
+namespace DynamoDB
+{
+namespace Model
+{
+
+/// Reads a Scan or Query result page, whose members are the same for both, from a reader positioned at the start of the
+/// response body. Members that are missing, null or of an unexpected type leave the corresponding output untouched, and
+/// members the page doesn't know about are skipped.
+AWS_DYNAMODB_API void ReadItemPage(Aws::Utils::Json::JsonReader& reader,
+    Aws::Vector<Aws::Map<Aws::String, AttributeValue>>& items,
+    long& count,
+    long& scannedCount,
+    Aws::Map<Aws::String, AttributeValue>& lastEvaluatedKey,
+    ConsumedCapacity& consumedCapacity);
+
+} // namespace Model
+} // namespace DynamoDB
+} // namespace Aws
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListTablesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListTables"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -38,6 +38,7 @@ namespace Model
   {
   public:
     PutItemRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutItem"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -38,6 +38,7 @@ namespace Model
   {
   public:
     QueryRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "Query"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Utils
 namespace Json
 {
   class JsonValue;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -45,6 +46,11 @@ namespace Model
     QueryResult();
     QueryResult(const AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
     QueryResult& operator=(const AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
+    /*
+     Reads the result straight off a response body reader positioned at the start of the document, without building a JsonValue for the whole page.
+    */
+    QueryResult(Aws::Utils::Json::JsonReader& reader);
+    QueryResult& operator=(Aws::Utils::Json::JsonReader& reader);
 
     /*
      <p>An array of item attributes that match the query criteria. Each element in this array consists of an attribute name and the value for that attribute.</p>
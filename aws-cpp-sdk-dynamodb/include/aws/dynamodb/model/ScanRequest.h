@@ -38,6 +38,7 @@ namespace Model
   {
   public:
     ScanRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "Scan"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
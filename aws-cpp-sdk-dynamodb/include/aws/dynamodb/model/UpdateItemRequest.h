@@ -39,6 +39,7 @@ namespace Model
   {
   public:
     UpdateItemRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateItem"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     UpdateTableRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateTable"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -21,6 +21,7 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/dynamodb/DynamoDBClient.h>
@@ -99,12 +100,8 @@ void DynamoDBClient::init(const ClientConfiguration& config)
 
   m_uri = ss.str();
 }
-BatchGetItemOutcome DynamoDBClient::BatchGetItem(const BatchGetItemRequest& request) const
+static BatchGetItemOutcome BuildBatchGetItemOutcome(JsonOutcome& outcome)
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return BatchGetItemOutcome(BatchGetItemResult(outcome.GetResult()));
@@ -115,27 +112,34 @@ BatchGetItemOutcome DynamoDBClient::BatchGetItem(const BatchGetItemRequest& requ
   }
 }
 
-BatchGetItemOutcomeCallable DynamoDBClient::BatchGetItemCallable(const BatchGetItemRequest& request) const
+BatchGetItemOutcome DynamoDBClient::BatchGetItem(const BatchGetItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::BatchGetItem, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::BatchGetItemAsync(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::BatchGetItemAsyncHelper, this, request, handler, context);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildBatchGetItemOutcome(outcome);
 }
 
-void DynamoDBClient::BatchGetItemAsyncHelper(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+BatchGetItemOutcomeCallable DynamoDBClient::BatchGetItemCallable(const BatchGetItemRequest& request) const
 {
-  handler(this, request, BatchGetItem(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::BatchGetItem, this, request);
 }
 
-BatchWriteItemOutcome DynamoDBClient::BatchWriteItem(const BatchWriteItemRequest& request) const
+void DynamoDBClient::BatchGetItemAsync(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<BatchGetItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](JsonOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildBatchGetItemOutcome(outcome), context);
+  });
+}
+
+static BatchWriteItemOutcome BuildBatchWriteItemOutcome(JsonOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return BatchWriteItemOutcome(BatchWriteItemResult(outcome.GetResult()));
@@ -146,27 +150,34 @@ BatchWriteItemOutcome DynamoDBClient::BatchWriteItem(const BatchWriteItemRequest
   }
 }
 
-BatchWriteItemOutcomeCallable DynamoDBClient::BatchWriteItemCallable(const BatchWriteItemRequest& request) const
+BatchWriteItemOutcome DynamoDBClient::BatchWriteItem(const BatchWriteItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::BatchWriteItem, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::BatchWriteItemAsync(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::BatchWriteItemAsyncHelper, this, request, handler, context);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildBatchWriteItemOutcome(outcome);
 }
 
-void DynamoDBClient::BatchWriteItemAsyncHelper(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+BatchWriteItemOutcomeCallable DynamoDBClient::BatchWriteItemCallable(const BatchWriteItemRequest& request) const
 {
-  handler(this, request, BatchWriteItem(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::BatchWriteItem, this, request);
 }
 
-CreateTableOutcome DynamoDBClient::CreateTable(const CreateTableRequest& request) const
+void DynamoDBClient::BatchWriteItemAsync(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<BatchWriteItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](JsonOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildBatchWriteItemOutcome(outcome), context);
+  });
+}
+
+static CreateTableOutcome BuildCreateTableOutcome(JsonOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return CreateTableOutcome(CreateTableResult(outcome.GetResult()));
@@ -177,27 +188,34 @@ CreateTableOutcome DynamoDBClient::CreateTable(const CreateTableRequest& request
   }
 }
 
-CreateTableOutcomeCallable DynamoDBClient::CreateTableCallable(const CreateTableRequest& request) const
+CreateTableOutcome DynamoDBClient::CreateTable(const CreateTableRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::CreateTable, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::CreateTableAsync(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::CreateTableAsyncHelper, this, request, handler, context);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildCreateTableOutcome(outcome);
 }
 
-void DynamoDBClient::CreateTableAsyncHelper(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+CreateTableOutcomeCallable DynamoDBClient::CreateTableCallable(const CreateTableRequest& request) const
 {
-  handler(this, request, CreateTable(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::CreateTable, this, request);
 }
 
-DeleteItemOutcome DynamoDBClient::DeleteItem(const DeleteItemRequest& request) const
+void DynamoDBClient::CreateTableAsync(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<CreateTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](JsonOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildCreateTableOutcome(outcome), context);
+  });
+}
+
+static DeleteItemOutcome BuildDeleteItemOutcome(JsonOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return DeleteItemOutcome(DeleteItemResult(outcome.GetResult()));
@@ -208,27 +226,34 @@ DeleteItemOutcome DynamoDBClient::DeleteItem(const DeleteItemRequest& request) c
   }
 }
 
-DeleteItemOutcomeCallable DynamoDBClient::DeleteItemCallable(const DeleteItemRequest& request) const
+DeleteItemOutcome DynamoDBClient::DeleteItem(const DeleteItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::DeleteItem, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::DeleteItemAsync(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::DeleteItemAsyncHelper, this, request, handler, context);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildDeleteItemOutcome(outcome);
 }
 
-void DynamoDBClient::DeleteItemAsyncHelper(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+DeleteItemOutcomeCallable DynamoDBClient::DeleteItemCallable(const DeleteItemRequest& request) const
 {
-  handler(this, request, DeleteItem(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::DeleteItem, this, request);
 }
 
-DeleteTableOutcome DynamoDBClient::DeleteTable(const DeleteTableRequest& request) const
+void DynamoDBClient::DeleteItemAsync(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<DeleteItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](JsonOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDeleteItemOutcome(outcome), context);
+  });
+}
+
+static DeleteTableOutcome BuildDeleteTableOutcome(JsonOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return DeleteTableOutcome(DeleteTableResult(outcome.GetResult()));
@@ -239,27 +264,34 @@ DeleteTableOutcome DynamoDBClient::DeleteTable(const DeleteTableRequest& request
   }
 }
 
-DeleteTableOutcomeCallable DynamoDBClient::DeleteTableCallable(const DeleteTableRequest& request) const
+DeleteTableOutcome DynamoDBClient::DeleteTable(const DeleteTableRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::DeleteTable, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::DeleteTableAsync(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::DeleteTableAsyncHelper, this, request, handler, context);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildDeleteTableOutcome(outcome);
 }
 
-void DynamoDBClient::DeleteTableAsyncHelper(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+DeleteTableOutcomeCallable DynamoDBClient::DeleteTableCallable(const DeleteTableRequest& request) const
 {
-  handler(this, request, DeleteTable(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::DeleteTable, this, request);
 }
 
-DescribeTableOutcome DynamoDBClient::DescribeTable(const DescribeTableRequest& request) const
+void DynamoDBClient::DeleteTableAsync(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<DeleteTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](JsonOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDeleteTableOutcome(outcome), context);
+  });
+}
+
+static DescribeTableOutcome BuildDescribeTableOutcome(JsonOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return DescribeTableOutcome(DescribeTableResult(outcome.GetResult()));
@@ -270,27 +302,34 @@ DescribeTableOutcome DynamoDBClient::DescribeTable(const DescribeTableRequest& r
   }
 }
 
-DescribeTableOutcomeCallable DynamoDBClient::DescribeTableCallable(const DescribeTableRequest& request) const
+DescribeTableOutcome DynamoDBClient::DescribeTable(const DescribeTableRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::DescribeTable, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::DescribeTableAsync(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::DescribeTableAsyncHelper, this, request, handler, context);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildDescribeTableOutcome(outcome);
 }
 
-void DynamoDBClient::DescribeTableAsyncHelper(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+DescribeTableOutcomeCallable DynamoDBClient::DescribeTableCallable(const DescribeTableRequest& request) const
 {
-  handler(this, request, DescribeTable(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::DescribeTable, this, request);
 }
 
-GetItemOutcome DynamoDBClient::GetItem(const GetItemRequest& request) const
+void DynamoDBClient::DescribeTableAsync(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<DescribeTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](JsonOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDescribeTableOutcome(outcome), context);
+  });
+}
+
+static GetItemOutcome BuildGetItemOutcome(JsonOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return GetItemOutcome(GetItemResult(outcome.GetResult()));
@@ -301,27 +340,34 @@ GetItemOutcome DynamoDBClient::GetItem(const GetItemRequest& request) const
   }
 }
 
-GetItemOutcomeCallable DynamoDBClient::GetItemCallable(const GetItemRequest& request) const
+GetItemOutcome DynamoDBClient::GetItem(const GetItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::GetItem, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::GetItemAsync(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::GetItemAsyncHelper, this, request, handler, context);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildGetItemOutcome(outcome);
 }
 
-void DynamoDBClient::GetItemAsyncHelper(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+GetItemOutcomeCallable DynamoDBClient::GetItemCallable(const GetItemRequest& request) const
 {
-  handler(this, request, GetItem(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::GetItem, this, request);
 }
 
-ListTablesOutcome DynamoDBClient::ListTables(const ListTablesRequest& request) const
+void DynamoDBClient::GetItemAsync(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<GetItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](JsonOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetItemOutcome(outcome), context);
+  });
+}
+
+static ListTablesOutcome BuildListTablesOutcome(JsonOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return ListTablesOutcome(ListTablesResult(outcome.GetResult()));
@@ -332,27 +378,34 @@ ListTablesOutcome DynamoDBClient::ListTables(const ListTablesRequest& request) c
   }
 }
 
-ListTablesOutcomeCallable DynamoDBClient::ListTablesCallable(const ListTablesRequest& request) const
+ListTablesOutcome DynamoDBClient::ListTables(const ListTablesRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::ListTables, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::ListTablesAsync(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::ListTablesAsyncHelper, this, request, handler, context);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildListTablesOutcome(outcome);
 }
 
-void DynamoDBClient::ListTablesAsyncHelper(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+ListTablesOutcomeCallable DynamoDBClient::ListTablesCallable(const ListTablesRequest& request) const
 {
-  handler(this, request, ListTables(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::ListTables, this, request);
 }
 
-PutItemOutcome DynamoDBClient::PutItem(const PutItemRequest& request) const
+void DynamoDBClient::ListTablesAsync(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<ListTablesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](JsonOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildListTablesOutcome(outcome), context);
+  });
+}
+
+static PutItemOutcome BuildPutItemOutcome(JsonOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return PutItemOutcome(PutItemResult(outcome.GetResult()));
@@ -363,30 +416,43 @@ PutItemOutcome DynamoDBClient::PutItem(const PutItemRequest& request) const
   }
 }
 
-PutItemOutcomeCallable DynamoDBClient::PutItemCallable(const PutItemRequest& request) const
+PutItemOutcome DynamoDBClient::PutItem(const PutItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::PutItem, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::PutItemAsync(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::PutItemAsyncHelper, this, request, handler, context);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildPutItemOutcome(outcome);
 }
 
-void DynamoDBClient::PutItemAsyncHelper(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+PutItemOutcomeCallable DynamoDBClient::PutItemCallable(const PutItemRequest& request) const
 {
-  handler(this, request, PutItem(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::PutItem, this, request);
 }
 
-QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
+void DynamoDBClient::PutItemAsync(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<PutItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](JsonOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutItemOutcome(outcome), context);
+  });
+}
+
+static QueryOutcome BuildQueryOutcome(StreamOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
-    return QueryOutcome(QueryResult(outcome.GetResult()));
+    JsonReader reader(outcome.GetResult().GetPayload().GetUnderlyingStream());
+    QueryResult result(reader);
+    if(!reader.WasParseSuccessful())
+    {
+      return QueryOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", reader.GetErrorMessage(), false));
+    }
+    return QueryOutcome(std::move(result));
   }
   else
   {
@@ -394,30 +460,44 @@ QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
   }
 }
 
-QueryOutcomeCallable DynamoDBClient::QueryCallable(const QueryRequest& request) const
+QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::Query, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::QueryAsync(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::QueryAsyncHelper, this, request, handler, context);
+  //result pages can be large, so they are read straight off the body instead of through a JsonValue.
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildQueryOutcome(outcome);
 }
 
-void DynamoDBClient::QueryAsyncHelper(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+QueryOutcomeCallable DynamoDBClient::QueryCallable(const QueryRequest& request) const
 {
-  handler(this, request, Query(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::Query, this, request);
 }
 
-ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
+void DynamoDBClient::QueryAsync(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<QueryRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](StreamOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildQueryOutcome(outcome), context);
+  });
+}
+
+static ScanOutcome BuildScanOutcome(StreamOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
-    return ScanOutcome(ScanResult(outcome.GetResult()));
+    JsonReader reader(outcome.GetResult().GetPayload().GetUnderlyingStream());
+    ScanResult result(reader);
+    if(!reader.WasParseSuccessful())
+    {
+      return ScanOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", reader.GetErrorMessage(), false));
+    }
+    return ScanOutcome(std::move(result));
   }
   else
   {
@@ -425,27 +505,35 @@ ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
   }
 }
 
-ScanOutcomeCallable DynamoDBClient::ScanCallable(const ScanRequest& request) const
+ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::Scan, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::ScanAsync(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::ScanAsyncHelper, this, request, handler, context);
+  //result pages can be large, so they are read straight off the body instead of through a JsonValue.
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildScanOutcome(outcome);
 }
 
-void DynamoDBClient::ScanAsyncHelper(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+ScanOutcomeCallable DynamoDBClient::ScanCallable(const ScanRequest& request) const
 {
-  handler(this, request, Scan(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::Scan, this, request);
 }
 
-UpdateItemOutcome DynamoDBClient::UpdateItem(const UpdateItemRequest& request) const
+void DynamoDBClient::ScanAsync(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<ScanRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](StreamOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildScanOutcome(outcome), context);
+  });
+}
+
+static UpdateItemOutcome BuildUpdateItemOutcome(JsonOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return UpdateItemOutcome(UpdateItemResult(outcome.GetResult()));
@@ -456,27 +544,34 @@ UpdateItemOutcome DynamoDBClient::UpdateItem(const UpdateItemRequest& request) c
   }
 }
 
-UpdateItemOutcomeCallable DynamoDBClient::UpdateItemCallable(const UpdateItemRequest& request) const
+UpdateItemOutcome DynamoDBClient::UpdateItem(const UpdateItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::UpdateItem, this, request);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::UpdateItemAsync(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&DynamoDBClient::UpdateItemAsyncHelper, this, request, handler, context);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildUpdateItemOutcome(outcome);
 }
 
-void DynamoDBClient::UpdateItemAsyncHelper(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+UpdateItemOutcomeCallable DynamoDBClient::UpdateItemCallable(const UpdateItemRequest& request) const
 {
-  handler(this, request, UpdateItem(request), context);
+  return std::async(std::launch::async, &DynamoDBClient::UpdateItem, this, request);
 }
 
-UpdateTableOutcome DynamoDBClient::UpdateTable(const UpdateTableRequest& request) const
+void DynamoDBClient::UpdateItemAsync(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<UpdateItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](JsonOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildUpdateItemOutcome(outcome), context);
+  });
+}
+
+static UpdateTableOutcome BuildUpdateTableOutcome(JsonOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return UpdateTableOutcome(UpdateTableResult(outcome.GetResult()));
@@ -487,6 +582,15 @@ UpdateTableOutcome DynamoDBClient::UpdateTable(const UpdateTableRequest& request
   }
 }
 
+UpdateTableOutcome DynamoDBClient::UpdateTable(const UpdateTableRequest& request) const
+{
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildUpdateTableOutcome(outcome);
+}
+
 UpdateTableOutcomeCallable DynamoDBClient::UpdateTableCallable(const UpdateTableRequest& request) const
 {
   return std::async(std::launch::async, &DynamoDBClient::UpdateTable, this, request);
@@ -494,11 +598,13 @@ UpdateTableOutcomeCallable DynamoDBClient::UpdateTableCallable(const UpdateTable
 
 void DynamoDBClient::UpdateTableAsync(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::UpdateTableAsyncHelper, this, request, handler, context);
-}
+  Aws::StringStream ss;
+  ss << m_uri << "/";
 
-void DynamoDBClient::UpdateTableAsyncHelper(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateTable(request), context);
+  auto requestCopy = Aws::MakeShared<UpdateTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](JsonOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildUpdateTableOutcome(outcome), context);
+  });
 }
 
@@ -14,6 +14,7 @@
 */
 #include <aws/dynamodb/model/AttributeValue.h>
 #include <aws/dynamodb/model/AttributeValueValue.h>
+#include <aws/core/utils/HashingUtils.h>
 
 #include <utility>
 
@@ -349,6 +350,85 @@ AttributeValue& AttributeValue::operator =(const JsonValue& jsonValue)
     return *this;
 }
 
+//elements that aren't strings, such as nulls, are left out.
+static Aws::Vector<Aws::String> ReadStringArray(JsonReader& reader)
+{
+    Aws::Vector<Aws::String> values;
+    reader.ReadArray([&]()
+    {
+        if (reader.GetCurrentToken() == JsonToken::STRING)
+        {
+            values.push_back(reader.GetString());
+        }
+    });
+    return values;
+}
+
+AttributeValue& AttributeValue::operator =(JsonReader& reader)
+{
+    reader.ReadObject([&](const Aws::String& type)
+    {
+        JsonToken token = reader.GetCurrentToken();
+        if (type == "S" && token == JsonToken::STRING)
+        {
+            SetS(reader.GetString());
+        }
+        else if (type == "N" && token == JsonToken::STRING)
+        {
+            SetN(reader.GetString());
+        }
+        else if (type == "B" && token == JsonToken::STRING)
+        {
+            SetB(HashingUtils::Base64Decode(reader.GetString()));
+        }
+        else if (type == "SS")
+        {
+            SetSS(ReadStringArray(reader));
+        }
+        else if (type == "NS")
+        {
+            SetNS(ReadStringArray(reader));
+        }
+        else if (type == "BS")
+        {
+            Aws::Vector<ByteBuffer> bs;
+            for (const auto& value : ReadStringArray(reader))
+            {
+                bs.push_back(HashingUtils::Base64Decode(value));
+            }
+            SetBS(bs);
+        }
+        else if (type == "M")
+        {
+            Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> map;
+            reader.ReadObject([&](const Aws::String& key)
+            {
+                map.insert(std::pair<Aws::String, const std::shared_ptr<AttributeValue>>(key, Aws::MakeShared<AttributeValue>("AttributeValue", reader)));
+            });
+            SetM(map);
+        }
+        else if (type == "L")
+        {
+            Aws::Vector<std::shared_ptr<AttributeValue>> list;
+            reader.ReadArray([&]()
+            {
+                list.push_back(Aws::MakeShared<AttributeValue>("AttributeValue", reader));
+            });
+            SetL(list);
+        }
+        else if (type == "BOOL" && token == JsonToken::BOOL)
+        {
+            SetBool(reader.GetBool());
+        }
+        else if (type == "NULL" && token == JsonToken::BOOL)
+        {
+            SetNull(reader.GetBool());
+        }
+    });
+
+    return *this;
+}
+
 bool AttributeValue::operator ==(const AttributeValue& other) const
 {
     if (this == &other)
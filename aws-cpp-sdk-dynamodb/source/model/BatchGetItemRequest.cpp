@@ -47,7 +47,7 @@ Aws::String BatchGetItemRequest::SerializePayload() const
    payload.WithString("ReturnConsumedCapacity", ReturnConsumedCapacityMapper::GetNameForReturnConsumedCapacity(m_returnConsumedCapacity));
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection BatchGetItemRequest::GetRequestSpecificHeaders() const
@@ -58,7 +58,7 @@ Aws::String BatchWriteItemRequest::SerializePayload() const
    payload.WithString("ReturnItemCollectionMetrics", ReturnItemCollectionMetricsMapper::GetNameForReturnItemCollectionMetrics(m_returnItemCollectionMetrics));
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection BatchWriteItemRequest::GetRequestSpecificHeaders() const
@@ -98,7 +98,7 @@ Aws::String CreateTableRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateTableRequest::GetRequestSpecificHeaders() const
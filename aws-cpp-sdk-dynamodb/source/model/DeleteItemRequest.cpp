@@ -115,7 +115,7 @@ Aws::String DeleteItemRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteItemRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DeleteTableRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteTableRequest::GetRequestSpecificHeaders() const
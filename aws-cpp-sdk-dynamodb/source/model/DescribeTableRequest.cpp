@@ -36,7 +36,7 @@ Aws::String DescribeTableRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeTableRequest::GetRequestSpecificHeaders() const
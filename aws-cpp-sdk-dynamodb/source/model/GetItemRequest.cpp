@@ -93,7 +93,7 @@ Aws::String GetItemRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetItemRequest::GetRequestSpecificHeaders() const
@@ -0,0 +1,73 @@
+/*
+* Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+#include <aws/dynamodb/model/ItemPageReader.h>
+#include <aws/core/utils/json/JsonReader.h>
+
+#include <utility>
+
+using namespace Aws::DynamoDB::Model;
+using namespace Aws::Utils::Json;
+
+static void ReadAttributeMap(JsonReader& reader, Aws::Map<Aws::String, AttributeValue>& attributes)
+{
+    reader.ReadObject([&](const Aws::String& name)
+    {
+        if (reader.GetCurrentToken() == JsonToken::BEGIN_OBJECT)
+        {
+            attributes[name] = reader;
+        }
+    });
+}
+
+void Aws::DynamoDB::Model::ReadItemPage(JsonReader& reader,
+    Aws::Vector<Aws::Map<Aws::String, AttributeValue>>& items,
+    long& count,
+    long& scannedCount,
+    Aws::Map<Aws::String, AttributeValue>& lastEvaluatedKey,
+    ConsumedCapacity& consumedCapacity)
+{
+    reader.Next();
+    reader.ReadObject([&](const Aws::String& name)
+    {
+        if (name == "Items")
+        {
+            reader.ReadArray([&]()
+            {
+                if (reader.GetCurrentToken() == JsonToken::BEGIN_OBJECT)
+                {
+                    Aws::Map<Aws::String, AttributeValue> item;
+                    ReadAttributeMap(reader, item);
+                    items.push_back(std::move(item));
+                }
+            });
+        }
+        else if (name == "Count" && reader.GetCurrentToken() == JsonToken::NUMBER)
+        {
+            count = reader.GetInteger();
+        }
+        else if (name == "ScannedCount" && reader.GetCurrentToken() == JsonToken::NUMBER)
+        {
+            scannedCount = reader.GetInteger();
+        }
+        else if (name == "LastEvaluatedKey")
+        {
+            ReadAttributeMap(reader, lastEvaluatedKey);
+        }
+        else if (name == "ConsumedCapacity" && reader.GetCurrentToken() == JsonToken::BEGIN_OBJECT)
+        {
+            consumedCapacity = reader.ReadValue();
+        }
+    });
+}
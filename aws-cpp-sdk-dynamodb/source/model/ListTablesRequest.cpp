@@ -44,7 +44,7 @@ Aws::String ListTablesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListTablesRequest::GetRequestSpecificHeaders() const
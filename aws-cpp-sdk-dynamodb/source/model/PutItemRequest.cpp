@@ -115,7 +115,7 @@ Aws::String PutItemRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PutItemRequest::GetRequestSpecificHeaders() const
@@ -178,7 +178,7 @@ Aws::String QueryRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection QueryRequest::GetRequestSpecificHeaders() const
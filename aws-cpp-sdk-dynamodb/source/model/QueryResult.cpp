@@ -14,6 +14,8 @@
 */
 #include <aws/dynamodb/model/QueryResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/dynamodb/model/ItemPageReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/UnreferencedParam.h>
 
@@ -84,5 +86,18 @@ QueryResult& QueryResult::operator =(const AmazonWebServiceResult<JsonValue>& re
 
 
 
+  return *this;
+}
+
+QueryResult::QueryResult(JsonReader& reader) : 
+    m_count(0),
+    m_scannedCount(0)
+{
+  *this = reader;
+}
+
+QueryResult& QueryResult::operator =(JsonReader& reader)
+{
+  ReadItemPage(reader, m_items, m_count, m_scannedCount, m_lastEvaluatedKey, m_consumedCapacity);
   return *this;
 }
@@ -167,7 +167,7 @@ Aws::String ScanRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ScanRequest::GetRequestSpecificHeaders() const
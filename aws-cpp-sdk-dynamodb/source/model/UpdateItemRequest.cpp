@@ -134,7 +134,7 @@ Aws::String UpdateItemRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateItemRequest::GetRequestSpecificHeaders() const
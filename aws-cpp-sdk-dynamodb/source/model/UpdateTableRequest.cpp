@@ -74,7 +74,7 @@ Aws::String UpdateTableRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateTableRequest::GetRequestSpecificHeaders() const
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AcceptVpcPeeringConnectionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AcceptVpcPeeringConnection"; }
     Aws::String SerializePayload() const override;
 
 
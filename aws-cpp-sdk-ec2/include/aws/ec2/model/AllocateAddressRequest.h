@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AllocateAddressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AllocateAddress"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AssignPrivateIpAddressesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AssignPrivateIpAddresses"; }
     Aws::String SerializePayload() const override;
 
 
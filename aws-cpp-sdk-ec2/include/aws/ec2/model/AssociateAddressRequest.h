@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AssociateAddressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AssociateAddress"; }
     Aws::String SerializePayload() const override;
 
 
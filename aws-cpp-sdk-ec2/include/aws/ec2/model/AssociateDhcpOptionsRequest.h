@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AssociateDhcpOptionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AssociateDhcpOptions"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AssociateRouteTableRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AssociateRouteTable"; }
     Aws::String SerializePayload() const override;
 
 
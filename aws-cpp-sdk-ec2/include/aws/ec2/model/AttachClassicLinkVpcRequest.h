@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AttachClassicLinkVpcRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachClassicLinkVpc"; }
     Aws::String SerializePayload() const override;
 
 
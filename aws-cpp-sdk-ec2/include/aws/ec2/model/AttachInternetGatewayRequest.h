@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AttachInternetGatewayRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachInternetGateway"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AttachNetworkInterfaceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachNetworkInterface"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AttachVolumeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachVolume"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AttachVpnGatewayRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachVpnGateway"; }
     Aws::String SerializePayload() const override;
 
 
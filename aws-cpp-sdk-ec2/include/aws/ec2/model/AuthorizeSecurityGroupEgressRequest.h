@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     AuthorizeSecurityGroupEgressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AuthorizeSecurityGroupEgress"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     AuthorizeSecurityGroupIngressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AuthorizeSecurityGroupIngress"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     BundleInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "BundleInstance"; }
     Aws::String SerializePayload() const override;
 
 
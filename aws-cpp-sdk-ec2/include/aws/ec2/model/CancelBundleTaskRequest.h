@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CancelBundleTaskRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CancelBundleTask"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CancelConversionTaskRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CancelConversionTask"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CancelExportTaskRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CancelExportTask"; }
     Aws::String SerializePayload() const override;
 
 
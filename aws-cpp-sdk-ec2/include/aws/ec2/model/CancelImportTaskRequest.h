@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CancelImportTaskRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CancelImportTask"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CancelReservedInstancesListingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CancelReservedInstancesListing"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CancelSpotFleetRequestsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CancelSpotFleetRequests"; }
     Aws::String SerializePayload() const override;
 
 
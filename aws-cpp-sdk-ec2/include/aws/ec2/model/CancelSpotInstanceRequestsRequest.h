@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CancelSpotInstanceRequestsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CancelSpotInstanceRequests"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ConfirmProductInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ConfirmProductInstance"; }
     Aws::String SerializePayload() const override;
 
 
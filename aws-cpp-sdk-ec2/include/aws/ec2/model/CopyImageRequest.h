@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CopyImageRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CopyImage"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CopySnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CopySnapshot"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateCustomerGatewayRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateCustomerGateway"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateDhcpOptionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDhcpOptions"; }
     Aws::String SerializePayload() const override;
 
 
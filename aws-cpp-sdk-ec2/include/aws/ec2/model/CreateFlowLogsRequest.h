@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateFlowLogsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateFlowLogs"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateImageRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateImage"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateInstanceExportTaskRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateInstanceExportTask"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     CreateInternetGatewayRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateInternetGateway"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateKeyPairRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateKeyPair"; }
     Aws::String SerializePayload() const override;
 
 
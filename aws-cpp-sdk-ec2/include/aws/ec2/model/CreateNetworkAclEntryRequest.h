@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateNetworkAclEntryRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateNetworkAclEntry"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateNetworkAclRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateNetworkAcl"; }
     Aws::String SerializePayload() const override;
 
 
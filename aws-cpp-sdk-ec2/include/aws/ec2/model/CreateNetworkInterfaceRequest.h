@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateNetworkInterfaceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateNetworkInterface"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreatePlacementGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreatePlacementGroup"; }
     Aws::String SerializePayload() const override;
 
 
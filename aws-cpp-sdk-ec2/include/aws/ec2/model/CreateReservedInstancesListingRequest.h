@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateReservedInstancesListingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateReservedInstancesListing"; }
     Aws::String SerializePayload() const override;
 
 
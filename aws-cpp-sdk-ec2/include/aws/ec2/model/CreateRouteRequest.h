@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateRouteRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateRoute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateRouteTableRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateRouteTable"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateSecurityGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateSecurityGroup"; }
     Aws::String SerializePayload() const override;
 
 
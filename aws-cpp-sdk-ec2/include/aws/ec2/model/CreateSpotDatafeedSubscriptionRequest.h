@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateSpotDatafeedSubscriptionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateSpotDatafeedSubscription"; }
     Aws::String SerializePayload() const override;
 
 
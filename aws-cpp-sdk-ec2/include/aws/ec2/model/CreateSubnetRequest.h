@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateSubnetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateSubnet"; }
     Aws::String SerializePayload() const override;
 
 
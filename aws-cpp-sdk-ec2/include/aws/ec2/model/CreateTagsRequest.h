@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateTagsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateTags"; }
     Aws::String SerializePayload() const override;
 
 
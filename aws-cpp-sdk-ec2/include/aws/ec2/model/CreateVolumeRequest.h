@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateVolumeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateVolume"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateVpcEndpointRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateVpcEndpoint"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateVpcPeeringConnectionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateVpcPeeringConnection"; }
     Aws::String SerializePayload() const override;
 
 
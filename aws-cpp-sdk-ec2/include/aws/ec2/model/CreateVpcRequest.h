@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateVpcRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateVpc"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateVpnConnectionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateVpnConnection"; }
     Aws::String SerializePayload() const override;
 
 
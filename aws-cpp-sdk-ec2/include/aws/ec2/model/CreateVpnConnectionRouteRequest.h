@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateVpnConnectionRouteRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateVpnConnectionRoute"; }
     Aws::String SerializePayload() const override;
 
 
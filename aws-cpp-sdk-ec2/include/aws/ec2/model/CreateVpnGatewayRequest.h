@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateVpnGatewayRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateVpnGateway"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteCustomerGatewayRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteCustomerGateway"; }
     Aws::String SerializePayload() const override;
 
 
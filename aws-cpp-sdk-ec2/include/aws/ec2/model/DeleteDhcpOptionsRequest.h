@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteDhcpOptionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDhcpOptions"; }
     Aws::String SerializePayload() const override;
 
 
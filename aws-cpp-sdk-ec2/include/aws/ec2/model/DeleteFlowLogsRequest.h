@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteFlowLogsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteFlowLogs"; }
     Aws::String SerializePayload() const override;
 
 
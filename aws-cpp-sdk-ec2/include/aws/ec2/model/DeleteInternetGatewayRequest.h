@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteInternetGatewayRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteInternetGateway"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteKeyPairRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteKeyPair"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteNetworkAclEntryRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteNetworkAclEntry"; }
     Aws::String SerializePayload() const override;
 
 
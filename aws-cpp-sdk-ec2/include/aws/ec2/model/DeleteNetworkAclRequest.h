@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteNetworkAclRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteNetworkAcl"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteNetworkInterfaceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteNetworkInterface"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeletePlacementGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeletePlacementGroup"; }
     Aws::String SerializePayload() const override;
 
 
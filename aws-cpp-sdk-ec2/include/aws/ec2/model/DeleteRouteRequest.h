@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteRouteRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteRoute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteRouteTableRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteRouteTable"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteSecurityGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteSecurityGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteSpotDatafeedSubscriptionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteSpotDatafeedSubscription"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteSubnetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteSubnet"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteVolumeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVolume"; }
     Aws::String SerializePayload() const override;
 
 
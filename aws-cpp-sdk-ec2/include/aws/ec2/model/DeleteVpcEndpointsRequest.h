@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteVpcEndpointsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVpcEndpoints"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteVpcPeeringConnectionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVpcPeeringConnection"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteVpcRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVpc"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteVpnConnectionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVpnConnection"; }
     Aws::String SerializePayload() const override;
 
 
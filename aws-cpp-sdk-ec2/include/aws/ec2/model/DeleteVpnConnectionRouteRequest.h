@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteVpnConnectionRouteRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVpnConnectionRoute"; }
     Aws::String SerializePayload() const override;
 
 
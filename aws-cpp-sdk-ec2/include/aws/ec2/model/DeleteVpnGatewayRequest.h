@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteVpnGatewayRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVpnGateway"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeregisterImageRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeregisterImage"; }
     Aws::String SerializePayload() const override;
 
 
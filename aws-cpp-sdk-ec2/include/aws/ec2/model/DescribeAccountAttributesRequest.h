@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeAccountAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAccountAttributes"; }
     Aws::String SerializePayload() const override;
 
 
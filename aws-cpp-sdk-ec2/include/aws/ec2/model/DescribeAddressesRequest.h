@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeAddressesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAddresses"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeAvailabilityZonesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAvailabilityZones"; }
     Aws::String SerializePayload() const override;
 
 
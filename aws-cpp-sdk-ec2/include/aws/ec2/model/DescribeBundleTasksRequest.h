@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeBundleTasksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeBundleTasks"; }
     Aws::String SerializePayload() const override;
 
 
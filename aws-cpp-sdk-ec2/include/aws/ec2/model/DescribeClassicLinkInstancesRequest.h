@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeClassicLinkInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeClassicLinkInstances"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeConversionTasksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeConversionTasks"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeCustomerGatewaysRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeCustomerGateways"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeDhcpOptionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDhcpOptions"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeExportTasksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeExportTasks"; }
     Aws::String SerializePayload() const override;
 
 
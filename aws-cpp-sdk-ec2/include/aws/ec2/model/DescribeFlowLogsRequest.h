@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeFlowLogsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeFlowLogs"; }
     Aws::String SerializePayload() const override;
 
 
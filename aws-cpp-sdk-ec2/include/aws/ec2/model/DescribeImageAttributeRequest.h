@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeImageAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeImageAttribute"; }
     Aws::String SerializePayload() const override;
 
 
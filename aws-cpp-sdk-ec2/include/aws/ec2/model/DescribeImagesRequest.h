@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeImagesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeImages"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeImportImageTasksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeImportImageTasks"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeImportSnapshotTasksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeImportSnapshotTasks"; }
     Aws::String SerializePayload() const override;
 
 
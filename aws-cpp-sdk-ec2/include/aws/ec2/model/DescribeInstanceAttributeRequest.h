@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeInstanceAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeInstanceAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeInstanceStatusRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeInstanceStatus"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeInstances"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeInternetGatewaysRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeInternetGateways"; }
     Aws::String SerializePayload() const override;
 
 
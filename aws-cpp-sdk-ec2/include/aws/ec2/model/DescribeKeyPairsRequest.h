@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeKeyPairsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeKeyPairs"; }
     Aws::String SerializePayload() const override;
 
 
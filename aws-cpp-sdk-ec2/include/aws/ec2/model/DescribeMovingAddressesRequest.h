@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeMovingAddressesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeMovingAddresses"; }
     Aws::String SerializePayload() const override;
 
 
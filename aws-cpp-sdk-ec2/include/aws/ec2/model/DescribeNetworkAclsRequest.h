@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeNetworkAclsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeNetworkAcls"; }
     Aws::String SerializePayload() const override;
 
 
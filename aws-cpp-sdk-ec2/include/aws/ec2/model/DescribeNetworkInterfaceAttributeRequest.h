@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeNetworkInterfaceAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeNetworkInterfaceAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeNetworkInterfacesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeNetworkInterfaces"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribePlacementGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribePlacementGroups"; }
     Aws::String SerializePayload() const override;
 
 
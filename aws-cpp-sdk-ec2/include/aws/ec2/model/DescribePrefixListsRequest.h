@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribePrefixListsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribePrefixLists"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeRegionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeRegions"; }
     Aws::String SerializePayload() const override;
 
 
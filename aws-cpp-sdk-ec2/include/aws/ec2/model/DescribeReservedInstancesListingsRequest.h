@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeReservedInstancesListingsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReservedInstancesListings"; }
     Aws::String SerializePayload() const override;
 
 
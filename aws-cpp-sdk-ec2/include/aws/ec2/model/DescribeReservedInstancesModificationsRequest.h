@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeReservedInstancesModificationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReservedInstancesModifications"; }
     Aws::String SerializePayload() const override;
 
 
@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     DescribeReservedInstancesOfferingsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReservedInstancesOfferings"; }
     Aws::String SerializePayload() const override;
 
 
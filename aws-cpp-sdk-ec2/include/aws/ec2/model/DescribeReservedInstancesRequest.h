@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeReservedInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReservedInstances"; }
     Aws::String SerializePayload() const override;
 
 
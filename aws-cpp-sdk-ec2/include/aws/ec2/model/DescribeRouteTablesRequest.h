@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeRouteTablesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeRouteTables"; }
     Aws::String SerializePayload() const override;
 
 
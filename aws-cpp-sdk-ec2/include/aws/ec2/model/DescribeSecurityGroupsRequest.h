@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeSecurityGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSecurityGroups"; }
     Aws::String SerializePayload() const override;
 
 
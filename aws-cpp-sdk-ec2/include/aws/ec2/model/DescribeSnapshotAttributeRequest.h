@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeSnapshotAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSnapshotAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeSpotDatafeedSubscriptionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSpotDatafeedSubscription"; }
     Aws::String SerializePayload() const override;
 
 
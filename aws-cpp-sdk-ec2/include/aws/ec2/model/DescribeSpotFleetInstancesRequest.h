@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeSpotFleetInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSpotFleetInstances"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeSpotFleetRequestHistoryRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSpotFleetRequestHistory"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeSpotFleetRequestsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSpotFleetRequests"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeSpotInstanceRequestsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSpotInstanceRequests"; }
     Aws::String SerializePayload() const override;
 
 
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     DescribeSpotPriceHistoryRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSpotPriceHistory"; }
     Aws::String SerializePayload() const override;
 
 
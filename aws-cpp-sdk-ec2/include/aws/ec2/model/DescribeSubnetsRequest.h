@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeSubnetsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSubnets"; }
     Aws::String SerializePayload() const override;
 
 
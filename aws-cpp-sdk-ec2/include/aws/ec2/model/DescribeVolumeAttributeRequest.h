@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeVolumeAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVolumeAttribute"; }
     Aws::String SerializePayload() const override;
 
 
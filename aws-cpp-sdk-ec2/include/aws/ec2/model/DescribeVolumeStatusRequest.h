@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeVolumeStatusRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVolumeStatus"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeVolumesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVolumes"; }
     Aws::String SerializePayload() const override;
 
 
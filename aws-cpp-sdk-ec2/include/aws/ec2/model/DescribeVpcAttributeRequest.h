@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeVpcAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVpcAttribute"; }
     Aws::String SerializePayload() const override;
 
 
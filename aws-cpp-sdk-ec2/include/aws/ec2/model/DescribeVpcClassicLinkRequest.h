@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeVpcClassicLinkRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVpcClassicLink"; }
     Aws::String SerializePayload() const override;
 
 
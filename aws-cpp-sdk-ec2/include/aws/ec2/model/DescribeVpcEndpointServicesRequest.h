@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeVpcEndpointServicesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVpcEndpointServices"; }
     Aws::String SerializePayload() const override;
 
 
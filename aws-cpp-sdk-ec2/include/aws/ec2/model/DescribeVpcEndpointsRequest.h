@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeVpcEndpointsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVpcEndpoints"; }
     Aws::String SerializePayload() const override;
 
 
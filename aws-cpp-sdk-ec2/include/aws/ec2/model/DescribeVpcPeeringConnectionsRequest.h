@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeVpcPeeringConnectionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVpcPeeringConnections"; }
     Aws::String SerializePayload() const override;
 
 
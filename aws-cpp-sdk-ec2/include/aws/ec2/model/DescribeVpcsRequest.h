@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeVpcsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVpcs"; }
     Aws::String SerializePayload() const override;
 
 
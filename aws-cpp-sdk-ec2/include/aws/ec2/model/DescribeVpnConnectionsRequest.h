@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeVpnConnectionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVpnConnections"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeVpnGatewaysRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVpnGateways"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DetachClassicLinkVpcRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachClassicLinkVpc"; }
     Aws::String SerializePayload() const override;
 
 
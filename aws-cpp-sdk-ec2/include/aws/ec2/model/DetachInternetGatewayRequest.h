@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DetachInternetGatewayRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachInternetGateway"; }
     Aws::String SerializePayload() const override;
 
 
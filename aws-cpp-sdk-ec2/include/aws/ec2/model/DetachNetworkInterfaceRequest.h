@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DetachNetworkInterfaceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachNetworkInterface"; }
     Aws::String SerializePayload() const override;
 
 
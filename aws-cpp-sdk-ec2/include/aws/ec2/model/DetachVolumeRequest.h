@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DetachVolumeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachVolume"; }
     Aws::String SerializePayload() const override;
 
 
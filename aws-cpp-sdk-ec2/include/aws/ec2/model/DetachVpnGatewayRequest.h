@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DetachVpnGatewayRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachVpnGateway"; }
     Aws::String SerializePayload() const override;
 
 
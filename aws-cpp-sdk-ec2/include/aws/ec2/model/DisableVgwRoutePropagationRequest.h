@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DisableVgwRoutePropagationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisableVgwRoutePropagation"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DisableVpcClassicLinkRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisableVpcClassicLink"; }
     Aws::String SerializePayload() const override;
 
 
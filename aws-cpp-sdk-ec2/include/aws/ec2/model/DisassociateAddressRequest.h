@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DisassociateAddressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisassociateAddress"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DisassociateRouteTableRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisassociateRouteTable"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     EnableVgwRoutePropagationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnableVgwRoutePropagation"; }
     Aws::String SerializePayload() const override;
 
 
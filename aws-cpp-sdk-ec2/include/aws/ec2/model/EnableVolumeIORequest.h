@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     EnableVolumeIORequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnableVolumeIO"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     EnableVpcClassicLinkRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnableVpcClassicLink"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetConsoleOutputRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetConsoleOutput"; }
     Aws::String SerializePayload() const override;
 
 
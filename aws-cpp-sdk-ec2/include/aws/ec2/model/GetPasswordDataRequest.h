@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetPasswordDataRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetPasswordData"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ImportImageRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ImportImage"; }
     Aws::String SerializePayload() const override;
 
 
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     ImportInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ImportInstance"; }
     Aws::String SerializePayload() const override;
 
 
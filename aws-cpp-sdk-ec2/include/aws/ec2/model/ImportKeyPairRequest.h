@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ImportKeyPairRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ImportKeyPair"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ImportSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ImportSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
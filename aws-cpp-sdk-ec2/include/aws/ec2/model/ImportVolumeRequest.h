@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ImportVolumeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ImportVolume"; }
     Aws::String SerializePayload() const override;
 
 
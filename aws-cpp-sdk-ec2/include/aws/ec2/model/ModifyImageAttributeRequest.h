@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     ModifyImageAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyImageAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     ModifyInstanceAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyInstanceAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     ModifyNetworkInterfaceAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyNetworkInterfaceAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ModifyReservedInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyReservedInstances"; }
     Aws::String SerializePayload() const override;
 
 
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     ModifySnapshotAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifySnapshotAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ModifySubnetAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifySubnetAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ModifyVolumeAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyVolumeAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ModifyVpcAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyVpcAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ModifyVpcEndpointRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyVpcEndpoint"; }
     Aws::String SerializePayload() const override;
 
 
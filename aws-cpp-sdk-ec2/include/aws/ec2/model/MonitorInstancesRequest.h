@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     MonitorInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "MonitorInstances"; }
     Aws::String SerializePayload() const override;
 
 
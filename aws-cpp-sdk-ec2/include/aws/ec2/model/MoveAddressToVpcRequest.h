@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     MoveAddressToVpcRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "MoveAddressToVpc"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PurchaseReservedInstancesOfferingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PurchaseReservedInstancesOffering"; }
     Aws::String SerializePayload() const override;
 
 
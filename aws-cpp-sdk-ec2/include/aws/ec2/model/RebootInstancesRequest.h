@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RebootInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RebootInstances"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     RegisterImageRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterImage"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RejectVpcPeeringConnectionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RejectVpcPeeringConnection"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ReleaseAddressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReleaseAddress"; }
     Aws::String SerializePayload() const override;
 
 
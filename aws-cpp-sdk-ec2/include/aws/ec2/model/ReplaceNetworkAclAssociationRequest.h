@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ReplaceNetworkAclAssociationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReplaceNetworkAclAssociation"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ReplaceNetworkAclEntryRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReplaceNetworkAclEntry"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ReplaceRouteRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReplaceRoute"; }
     Aws::String SerializePayload() const override;
 
 
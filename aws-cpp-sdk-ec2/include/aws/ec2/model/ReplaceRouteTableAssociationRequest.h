@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ReplaceRouteTableAssociationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReplaceRouteTableAssociation"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ReportInstanceStatusRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReportInstanceStatus"; }
     Aws::String SerializePayload() const override;
 
 
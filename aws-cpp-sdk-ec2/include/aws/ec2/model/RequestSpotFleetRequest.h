@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RequestSpotFleetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RequestSpotFleet"; }
     Aws::String SerializePayload() const override;
 
 
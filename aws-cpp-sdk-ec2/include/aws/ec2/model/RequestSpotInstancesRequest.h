@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     RequestSpotInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RequestSpotInstances"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ResetImageAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ResetImageAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ResetInstanceAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ResetInstanceAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ResetNetworkInterfaceAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ResetNetworkInterfaceAttribute"; }
     Aws::String SerializePayload() const override;
 
 
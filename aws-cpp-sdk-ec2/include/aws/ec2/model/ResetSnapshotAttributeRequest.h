@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ResetSnapshotAttributeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ResetSnapshotAttribute"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RestoreAddressToClassicRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RestoreAddressToClassic"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RevokeSecurityGroupEgressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RevokeSecurityGroupEgress"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RevokeSecurityGroupIngressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RevokeSecurityGroupIngress"; }
     Aws::String SerializePayload() const override;
 
 
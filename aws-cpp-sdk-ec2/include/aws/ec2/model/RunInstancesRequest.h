@@ -38,6 +38,7 @@ namespace Model
   {
   public:
     RunInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RunInstances"; }
     Aws::String SerializePayload() const override;
 
 
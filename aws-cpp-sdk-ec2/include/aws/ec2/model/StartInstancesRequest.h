@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     StartInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "StartInstances"; }
     Aws::String SerializePayload() const override;
 
 
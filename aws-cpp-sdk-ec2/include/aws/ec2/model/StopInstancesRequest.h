@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     StopInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "StopInstances"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     TerminateInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "TerminateInstances"; }
     Aws::String SerializePayload() const override;
 
 
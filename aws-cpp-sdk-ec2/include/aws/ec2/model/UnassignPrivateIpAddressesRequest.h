@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UnassignPrivateIpAddressesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UnassignPrivateIpAddresses"; }
     Aws::String SerializePayload() const override;
 
 
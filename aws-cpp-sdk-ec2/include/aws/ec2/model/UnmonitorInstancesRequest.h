@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UnmonitorInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UnmonitorInstances"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateCluster"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
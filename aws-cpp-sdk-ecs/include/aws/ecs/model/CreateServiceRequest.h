@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateServiceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateService"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteCluster"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteServiceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteService"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeregisterContainerInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeregisterContainerInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeregisterTaskDefinitionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeregisterTaskDefinition"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeClustersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeClusters"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
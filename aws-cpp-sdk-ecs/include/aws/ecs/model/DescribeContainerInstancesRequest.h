@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeContainerInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeContainerInstances"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeServicesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeServices"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeTaskDefinitionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeTaskDefinition"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
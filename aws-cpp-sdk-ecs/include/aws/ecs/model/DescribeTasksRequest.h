@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeTasksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeTasks"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
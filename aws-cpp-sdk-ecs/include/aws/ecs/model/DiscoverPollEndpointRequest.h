@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DiscoverPollEndpointRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DiscoverPollEndpoint"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
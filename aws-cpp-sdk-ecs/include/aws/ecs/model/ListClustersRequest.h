@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListClustersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListClusters"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
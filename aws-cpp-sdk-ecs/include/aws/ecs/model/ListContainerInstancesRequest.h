@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListContainerInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListContainerInstances"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
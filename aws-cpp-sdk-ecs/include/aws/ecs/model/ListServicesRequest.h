@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListServicesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListServices"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListTaskDefinitionFamiliesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListTaskDefinitionFamilies"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
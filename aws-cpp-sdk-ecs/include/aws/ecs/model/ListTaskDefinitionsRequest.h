@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ListTaskDefinitionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListTaskDefinitions"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
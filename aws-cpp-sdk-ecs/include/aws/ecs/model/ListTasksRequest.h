@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListTasksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListTasks"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
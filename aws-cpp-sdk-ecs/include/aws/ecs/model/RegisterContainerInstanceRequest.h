@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     RegisterContainerInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterContainerInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
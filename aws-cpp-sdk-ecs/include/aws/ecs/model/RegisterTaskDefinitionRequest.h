@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     RegisterTaskDefinitionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterTaskDefinition"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RunTaskRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RunTask"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
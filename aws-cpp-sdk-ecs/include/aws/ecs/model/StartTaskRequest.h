@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     StartTaskRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "StartTask"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     StopTaskRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "StopTask"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
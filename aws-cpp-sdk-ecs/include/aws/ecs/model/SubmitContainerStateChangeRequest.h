@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SubmitContainerStateChangeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SubmitContainerStateChange"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
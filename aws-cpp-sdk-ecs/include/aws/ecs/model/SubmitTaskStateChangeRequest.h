@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     SubmitTaskStateChangeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SubmitTaskStateChange"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateContainerAgentRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateContainerAgent"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
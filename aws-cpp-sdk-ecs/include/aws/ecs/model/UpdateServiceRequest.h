@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateServiceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateService"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
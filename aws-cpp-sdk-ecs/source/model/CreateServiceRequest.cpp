@@ -84,7 +84,7 @@ Aws::String CreateServiceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateServiceRequest::GetRequestSpecificHeaders() const
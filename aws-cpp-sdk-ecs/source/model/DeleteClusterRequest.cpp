@@ -36,7 +36,7 @@ Aws::String DeleteClusterRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteClusterRequest::GetRequestSpecificHeaders() const
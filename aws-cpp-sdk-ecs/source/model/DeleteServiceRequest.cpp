@@ -43,7 +43,7 @@ Aws::String DeleteServiceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteServiceRequest::GetRequestSpecificHeaders() const
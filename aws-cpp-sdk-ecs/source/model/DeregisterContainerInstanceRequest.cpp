@@ -51,7 +51,7 @@ Aws::String DeregisterContainerInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeregisterContainerInstanceRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DeregisterTaskDefinitionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeregisterTaskDefinitionRequest::GetRequestSpecificHeaders() const
@@ -41,7 +41,7 @@ Aws::String DescribeClustersRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeClustersRequest::GetRequestSpecificHeaders() const
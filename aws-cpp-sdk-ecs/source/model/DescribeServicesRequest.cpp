@@ -48,7 +48,7 @@ Aws::String DescribeServicesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeServicesRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DescribeTaskDefinitionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeTaskDefinitionRequest::GetRequestSpecificHeaders() const
@@ -48,7 +48,7 @@ Aws::String DescribeTasksRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeTasksRequest::GetRequestSpecificHeaders() const
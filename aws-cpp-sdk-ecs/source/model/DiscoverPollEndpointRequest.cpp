@@ -43,7 +43,7 @@ Aws::String DiscoverPollEndpointRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DiscoverPollEndpointRequest::GetRequestSpecificHeaders() const
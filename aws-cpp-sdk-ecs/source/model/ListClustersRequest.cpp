@@ -44,7 +44,7 @@ Aws::String ListClustersRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListClustersRequest::GetRequestSpecificHeaders() const
@@ -51,7 +51,7 @@ Aws::String ListContainerInstancesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListContainerInstancesRequest::GetRequestSpecificHeaders() const
@@ -51,7 +51,7 @@ Aws::String ListServicesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListServicesRequest::GetRequestSpecificHeaders() const
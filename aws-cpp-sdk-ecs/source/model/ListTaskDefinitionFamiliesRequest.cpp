@@ -51,7 +51,7 @@ Aws::String ListTaskDefinitionFamiliesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListTaskDefinitionFamiliesRequest::GetRequestSpecificHeaders() const
@@ -85,7 +85,7 @@ Aws::String ListTasksRequest::SerializePayload() const
    payload.WithString("desiredStatus", DesiredStatusMapper::GetNameForDesiredStatus(m_desiredStatus));
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListTasksRequest::GetRequestSpecificHeaders() const
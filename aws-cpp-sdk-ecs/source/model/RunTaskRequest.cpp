@@ -65,7 +65,7 @@ Aws::String RunTaskRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RunTaskRequest::GetRequestSpecificHeaders() const
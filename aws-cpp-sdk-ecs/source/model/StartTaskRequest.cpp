@@ -69,7 +69,7 @@ Aws::String StartTaskRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection StartTaskRequest::GetRequestSpecificHeaders() const
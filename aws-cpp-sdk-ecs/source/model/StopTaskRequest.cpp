@@ -43,7 +43,7 @@ Aws::String StopTaskRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection StopTaskRequest::GetRequestSpecificHeaders() const
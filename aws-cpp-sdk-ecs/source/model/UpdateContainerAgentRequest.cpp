@@ -43,7 +43,7 @@ Aws::String UpdateContainerAgentRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateContainerAgentRequest::GetRequestSpecificHeaders() const
@@ -58,7 +58,7 @@ Aws::String UpdateServiceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateServiceRequest::GetRequestSpecificHeaders() const
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AuthorizeCacheSecurityGroupIngressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AuthorizeCacheSecurityGroupIngress"; }
     Aws::String SerializePayload() const override;
 
 
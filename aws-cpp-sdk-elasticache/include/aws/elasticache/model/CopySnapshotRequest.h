@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CopySnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CopySnapshot"; }
     Aws::String SerializePayload() const override;
 
 
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     CreateCacheClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateCacheCluster"; }
     Aws::String SerializePayload() const override;
 
 
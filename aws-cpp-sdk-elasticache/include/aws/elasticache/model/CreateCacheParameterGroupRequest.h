@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateCacheParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateCacheParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateCacheSecurityGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateCacheSecurityGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateCacheSubnetGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateCacheSubnetGroup"; }
     Aws::String SerializePayload() const override;
 
 
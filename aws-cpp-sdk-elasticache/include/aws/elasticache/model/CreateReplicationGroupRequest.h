@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateReplicationGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateReplicationGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteCacheClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteCacheCluster"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteCacheParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteCacheParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
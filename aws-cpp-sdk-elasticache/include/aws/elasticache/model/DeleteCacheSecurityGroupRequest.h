@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteCacheSecurityGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteCacheSecurityGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteCacheSubnetGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteCacheSubnetGroup"; }
     Aws::String SerializePayload() const override;
 
 
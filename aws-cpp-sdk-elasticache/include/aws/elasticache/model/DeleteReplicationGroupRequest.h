@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteReplicationGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteReplicationGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeCacheClustersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeCacheClusters"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeCacheEngineVersionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeCacheEngineVersions"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeCacheParameterGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeCacheParameterGroups"; }
     Aws::String SerializePayload() const override;
 
 
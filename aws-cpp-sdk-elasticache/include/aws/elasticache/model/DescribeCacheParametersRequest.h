@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeCacheParametersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeCacheParameters"; }
     Aws::String SerializePayload() const override;
 
 
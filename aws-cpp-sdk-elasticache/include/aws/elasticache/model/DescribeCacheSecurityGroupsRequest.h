@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeCacheSecurityGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeCacheSecurityGroups"; }
     Aws::String SerializePayload() const override;
 
 
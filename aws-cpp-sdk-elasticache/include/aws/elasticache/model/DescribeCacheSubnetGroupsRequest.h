@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeCacheSubnetGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeCacheSubnetGroups"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeEngineDefaultParametersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeEngineDefaultParameters"; }
     Aws::String SerializePayload() const override;
 
 
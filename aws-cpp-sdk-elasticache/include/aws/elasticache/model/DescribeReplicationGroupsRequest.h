@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeReplicationGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReplicationGroups"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeReservedCacheNodesOfferingsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReservedCacheNodesOfferings"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeReservedCacheNodesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReservedCacheNodes"; }
     Aws::String SerializePayload() const override;
 
 
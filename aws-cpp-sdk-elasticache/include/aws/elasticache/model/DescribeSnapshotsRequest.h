@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeSnapshotsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSnapshots"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ModifyCacheClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyCacheCluster"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ModifyCacheParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyCacheParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
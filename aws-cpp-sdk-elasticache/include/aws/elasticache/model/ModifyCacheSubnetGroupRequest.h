@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ModifyCacheSubnetGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyCacheSubnetGroup"; }
     Aws::String SerializePayload() const override;
 
 
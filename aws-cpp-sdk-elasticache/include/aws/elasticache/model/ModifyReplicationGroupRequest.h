@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ModifyReplicationGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyReplicationGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PurchaseReservedCacheNodesOfferingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PurchaseReservedCacheNodesOffering"; }
     Aws::String SerializePayload() const override;
 
 
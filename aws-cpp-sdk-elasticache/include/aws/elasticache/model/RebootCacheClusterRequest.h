@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RebootCacheClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RebootCacheCluster"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RemoveTagsFromResourceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemoveTagsFromResource"; }
     Aws::String SerializePayload() const override;
 
 
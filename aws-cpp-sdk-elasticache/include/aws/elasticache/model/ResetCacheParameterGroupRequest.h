@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ResetCacheParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ResetCacheParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
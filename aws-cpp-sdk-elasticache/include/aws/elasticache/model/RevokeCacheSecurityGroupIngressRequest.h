@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RevokeCacheSecurityGroupIngressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RevokeCacheSecurityGroupIngress"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AbortEnvironmentUpdateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AbortEnvironmentUpdate"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CheckDNSAvailabilityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CheckDNSAvailability"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateApplicationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateApplication"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateApplicationVersionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateApplicationVersion"; }
     Aws::String SerializePayload() const override;
 
 
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     CreateConfigurationTemplateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateConfigurationTemplate"; }
     Aws::String SerializePayload() const override;
 
 
@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     CreateEnvironmentRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateEnvironment"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     CreateStorageLocationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateStorageLocation"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteApplicationVersionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteApplicationVersion"; }
     Aws::String SerializePayload() const override;
 
 
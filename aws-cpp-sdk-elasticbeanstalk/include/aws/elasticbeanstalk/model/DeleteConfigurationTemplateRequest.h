@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteConfigurationTemplateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteConfigurationTemplate"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteEnvironmentConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteEnvironmentConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeApplicationVersionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeApplicationVersions"; }
     Aws::String SerializePayload() const override;
 
 
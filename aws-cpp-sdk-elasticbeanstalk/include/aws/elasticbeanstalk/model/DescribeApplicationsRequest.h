@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeApplicationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeApplications"; }
     Aws::String SerializePayload() const override;
 
 
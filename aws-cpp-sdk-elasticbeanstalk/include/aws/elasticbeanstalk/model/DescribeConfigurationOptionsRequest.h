@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeConfigurationOptionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeConfigurationOptions"; }
     Aws::String SerializePayload() const override;
 
 
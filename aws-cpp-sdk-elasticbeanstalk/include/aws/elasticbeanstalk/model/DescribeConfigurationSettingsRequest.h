@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeConfigurationSettingsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeConfigurationSettings"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeEnvironmentHealthRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeEnvironmentHealth"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeEnvironmentResourcesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeEnvironmentResources"; }
     Aws::String SerializePayload() const override;
 
 
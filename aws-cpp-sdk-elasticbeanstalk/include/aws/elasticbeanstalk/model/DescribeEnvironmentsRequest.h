@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeEnvironmentsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeEnvironments"; }
     Aws::String SerializePayload() const override;
 
 
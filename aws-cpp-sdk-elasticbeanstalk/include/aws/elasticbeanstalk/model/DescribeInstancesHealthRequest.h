@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeInstancesHealthRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeInstancesHealth"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     ListAvailableSolutionStacksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListAvailableSolutionStacks"; }
     Aws::String SerializePayload() const override;
 
 
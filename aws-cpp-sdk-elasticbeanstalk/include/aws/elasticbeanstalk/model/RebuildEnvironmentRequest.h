@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RebuildEnvironmentRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RebuildEnvironment"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RequestEnvironmentInfoRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RequestEnvironmentInfo"; }
     Aws::String SerializePayload() const override;
 
 
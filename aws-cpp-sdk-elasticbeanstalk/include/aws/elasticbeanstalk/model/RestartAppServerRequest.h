@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RestartAppServerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RestartAppServer"; }
     Aws::String SerializePayload() const override;
 
 
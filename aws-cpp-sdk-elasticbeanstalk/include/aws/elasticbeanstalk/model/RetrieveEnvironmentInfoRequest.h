@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RetrieveEnvironmentInfoRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RetrieveEnvironmentInfo"; }
     Aws::String SerializePayload() const override;
 
 
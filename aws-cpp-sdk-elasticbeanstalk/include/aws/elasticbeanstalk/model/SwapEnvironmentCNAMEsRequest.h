@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SwapEnvironmentCNAMEsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SwapEnvironmentCNAMEs"; }
     Aws::String SerializePayload() const override;
 
 
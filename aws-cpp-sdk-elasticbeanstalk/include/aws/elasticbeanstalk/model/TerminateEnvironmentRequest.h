@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     TerminateEnvironmentRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "TerminateEnvironment"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UpdateApplicationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateApplication"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UpdateApplicationVersionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateApplicationVersion"; }
     Aws::String SerializePayload() const override;
 
 
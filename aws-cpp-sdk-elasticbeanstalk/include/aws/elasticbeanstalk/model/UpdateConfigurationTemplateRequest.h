@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     UpdateConfigurationTemplateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateConfigurationTemplate"; }
     Aws::String SerializePayload() const override;
 
 
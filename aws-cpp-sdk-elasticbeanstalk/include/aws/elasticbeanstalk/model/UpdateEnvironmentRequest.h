@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     UpdateEnvironmentRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateEnvironment"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ValidateConfigurationSettingsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ValidateConfigurationSettings"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ApplySecurityGroupsToLoadBalancerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ApplySecurityGroupsToLoadBalancer"; }
     Aws::String SerializePayload() const override;
 
 
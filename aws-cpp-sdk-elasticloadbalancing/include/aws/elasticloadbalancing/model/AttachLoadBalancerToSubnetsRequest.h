@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AttachLoadBalancerToSubnetsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachLoadBalancerToSubnets"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ConfigureHealthCheckRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ConfigureHealthCheck"; }
     Aws::String SerializePayload() const override;
 
 
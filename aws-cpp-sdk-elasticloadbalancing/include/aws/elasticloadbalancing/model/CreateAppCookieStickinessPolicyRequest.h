@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateAppCookieStickinessPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateAppCookieStickinessPolicy"; }
     Aws::String SerializePayload() const override;
 
 
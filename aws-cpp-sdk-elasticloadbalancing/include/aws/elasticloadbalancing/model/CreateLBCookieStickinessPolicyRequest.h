@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateLBCookieStickinessPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateLBCookieStickinessPolicy"; }
     Aws::String SerializePayload() const override;
 
 
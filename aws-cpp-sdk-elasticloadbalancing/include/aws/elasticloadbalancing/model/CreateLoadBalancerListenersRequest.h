@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateLoadBalancerListenersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateLoadBalancerListeners"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateLoadBalancerPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateLoadBalancerPolicy"; }
     Aws::String SerializePayload() const override;
 
 
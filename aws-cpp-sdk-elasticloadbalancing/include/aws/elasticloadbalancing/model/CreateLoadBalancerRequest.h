@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateLoadBalancerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateLoadBalancer"; }
     Aws::String SerializePayload() const override;
 
 
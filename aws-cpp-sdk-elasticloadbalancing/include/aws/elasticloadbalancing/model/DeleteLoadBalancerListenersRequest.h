@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteLoadBalancerListenersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteLoadBalancerListeners"; }
     Aws::String SerializePayload() const override;
 
 
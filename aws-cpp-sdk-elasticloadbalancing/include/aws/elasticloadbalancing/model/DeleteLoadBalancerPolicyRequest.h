@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteLoadBalancerPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteLoadBalancerPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteLoadBalancerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteLoadBalancer"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DeregisterInstancesFromLoadBalancerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeregisterInstancesFromLoadBalancer"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeInstanceHealthRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeInstanceHealth"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeLoadBalancerAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLoadBalancerAttributes"; }
     Aws::String SerializePayload() const override;
 
 
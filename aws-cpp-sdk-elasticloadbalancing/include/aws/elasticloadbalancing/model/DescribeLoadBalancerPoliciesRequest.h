@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeLoadBalancerPoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLoadBalancerPolicies"; }
     Aws::String SerializePayload() const override;
 
 
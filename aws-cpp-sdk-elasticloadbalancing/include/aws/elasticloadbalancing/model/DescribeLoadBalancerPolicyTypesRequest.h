@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeLoadBalancerPolicyTypesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLoadBalancerPolicyTypes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeLoadBalancersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLoadBalancers"; }
     Aws::String SerializePayload() const override;
 
 
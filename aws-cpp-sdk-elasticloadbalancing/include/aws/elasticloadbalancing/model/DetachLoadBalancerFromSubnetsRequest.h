@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DetachLoadBalancerFromSubnetsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachLoadBalancerFromSubnets"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DisableAvailabilityZonesForLoadBalancerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisableAvailabilityZonesForLoadBalancer"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     EnableAvailabilityZonesForLoadBalancerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnableAvailabilityZonesForLoadBalancer"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ModifyLoadBalancerAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyLoadBalancerAttributes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RegisterInstancesWithLoadBalancerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterInstancesWithLoadBalancer"; }
     Aws::String SerializePayload() const override;
 
 
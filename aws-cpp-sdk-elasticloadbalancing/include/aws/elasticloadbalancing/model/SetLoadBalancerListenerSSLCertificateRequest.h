@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     SetLoadBalancerListenerSSLCertificateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetLoadBalancerListenerSSLCertificate"; }
     Aws::String SerializePayload() const override;
 
 
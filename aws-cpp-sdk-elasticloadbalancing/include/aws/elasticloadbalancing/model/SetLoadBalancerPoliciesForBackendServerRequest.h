@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SetLoadBalancerPoliciesForBackendServerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetLoadBalancerPoliciesForBackendServer"; }
     Aws::String SerializePayload() const override;
 
 
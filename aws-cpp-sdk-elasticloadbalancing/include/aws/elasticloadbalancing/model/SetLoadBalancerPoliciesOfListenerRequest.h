@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SetLoadBalancerPoliciesOfListenerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetLoadBalancerPoliciesOfListener"; }
     Aws::String SerializePayload() const override;
 
 
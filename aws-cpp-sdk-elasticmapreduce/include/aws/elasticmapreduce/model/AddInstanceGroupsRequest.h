@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     AddInstanceGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddInstanceGroups"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     AddJobFlowStepsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddJobFlowSteps"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
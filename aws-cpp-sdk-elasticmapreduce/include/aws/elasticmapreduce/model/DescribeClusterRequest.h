@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeCluster"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
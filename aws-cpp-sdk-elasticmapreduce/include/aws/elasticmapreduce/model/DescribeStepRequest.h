@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeStepRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeStep"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
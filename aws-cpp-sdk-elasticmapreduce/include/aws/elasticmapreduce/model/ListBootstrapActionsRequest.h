@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListBootstrapActionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListBootstrapActions"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
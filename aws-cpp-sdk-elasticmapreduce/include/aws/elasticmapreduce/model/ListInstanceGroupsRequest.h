@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListInstanceGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListInstanceGroups"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ListInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListInstances"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ListStepsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListSteps"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ModifyInstanceGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyInstanceGroups"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RemoveTagsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemoveTags"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
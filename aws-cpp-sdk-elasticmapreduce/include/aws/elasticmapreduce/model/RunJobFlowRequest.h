@@ -39,6 +39,7 @@ namespace Model
   {
   public:
     RunJobFlowRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RunJobFlow"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetTerminationProtectionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetTerminationProtection"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetVisibleToAllUsersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetVisibleToAllUsers"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
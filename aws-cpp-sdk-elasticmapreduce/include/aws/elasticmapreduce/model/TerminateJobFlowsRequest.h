@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     TerminateJobFlowsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "TerminateJobFlows"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -48,7 +48,7 @@ Aws::String AddInstanceGroupsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection AddInstanceGroupsRequest::GetRequestSpecificHeaders() const
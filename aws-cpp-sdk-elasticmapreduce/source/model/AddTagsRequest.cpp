@@ -48,7 +48,7 @@ Aws::String AddTagsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection AddTagsRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DescribeClusterRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeClusterRequest::GetRequestSpecificHeaders() const
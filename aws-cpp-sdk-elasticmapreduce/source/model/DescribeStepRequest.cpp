@@ -43,7 +43,7 @@ Aws::String DescribeStepRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeStepRequest::GetRequestSpecificHeaders() const
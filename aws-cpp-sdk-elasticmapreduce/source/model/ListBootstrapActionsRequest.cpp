@@ -43,7 +43,7 @@ Aws::String ListBootstrapActionsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListBootstrapActionsRequest::GetRequestSpecificHeaders() const
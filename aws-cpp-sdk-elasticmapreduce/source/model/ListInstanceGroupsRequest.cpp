@@ -43,7 +43,7 @@ Aws::String ListInstanceGroupsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListInstanceGroupsRequest::GetRequestSpecificHeaders() const
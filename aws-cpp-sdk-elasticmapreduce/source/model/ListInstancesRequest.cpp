@@ -62,7 +62,7 @@ Aws::String ListInstancesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListInstancesRequest::GetRequestSpecificHeaders() const
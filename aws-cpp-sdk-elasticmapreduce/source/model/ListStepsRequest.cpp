@@ -67,7 +67,7 @@ Aws::String ListStepsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListStepsRequest::GetRequestSpecificHeaders() const
@@ -41,7 +41,7 @@ Aws::String ModifyInstanceGroupsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ModifyInstanceGroupsRequest::GetRequestSpecificHeaders() const
@@ -177,7 +177,7 @@ Aws::String RunJobFlowRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RunJobFlowRequest::GetRequestSpecificHeaders() const
@@ -49,7 +49,7 @@ Aws::String SetTerminationProtectionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection SetTerminationProtectionRequest::GetRequestSpecificHeaders() const
@@ -41,7 +41,7 @@ Aws::String TerminateJobFlowsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection TerminateJobFlowsRequest::GetRequestSpecificHeaders() const
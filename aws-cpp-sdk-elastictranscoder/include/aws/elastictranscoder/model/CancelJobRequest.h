@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CancelJobRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CancelJob"; }
     Aws::String SerializePayload() const override;
 
 
@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     CreateJobRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateJob"; }
     Aws::String SerializePayload() const override;
 
 
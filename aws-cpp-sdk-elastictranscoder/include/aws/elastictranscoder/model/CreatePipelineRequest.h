@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreatePipelineRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreatePipeline"; }
     Aws::String SerializePayload() const override;
 
 
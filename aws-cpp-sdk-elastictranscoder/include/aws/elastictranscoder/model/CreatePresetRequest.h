@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     CreatePresetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreatePreset"; }
     Aws::String SerializePayload() const override;
 
 
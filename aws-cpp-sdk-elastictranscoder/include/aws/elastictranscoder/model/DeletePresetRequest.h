@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeletePresetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeletePreset"; }
     Aws::String SerializePayload() const override;
 
 
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListJobsByPipelineRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListJobsByPipeline"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
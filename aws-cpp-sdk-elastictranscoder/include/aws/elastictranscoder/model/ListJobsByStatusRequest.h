@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListJobsByStatusRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListJobsByStatus"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListPipelinesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListPipelines"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListPresetsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListPresets"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ReadJobRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReadJob"; }
     Aws::String SerializePayload() const override;
 
 
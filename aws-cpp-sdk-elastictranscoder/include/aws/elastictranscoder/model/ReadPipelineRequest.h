@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ReadPipelineRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReadPipeline"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ReadPresetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReadPreset"; }
     Aws::String SerializePayload() const override;
 
 
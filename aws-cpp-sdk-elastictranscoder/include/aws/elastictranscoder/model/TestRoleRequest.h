@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     TestRoleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "TestRole"; }
     Aws::String SerializePayload() const override;
 
 
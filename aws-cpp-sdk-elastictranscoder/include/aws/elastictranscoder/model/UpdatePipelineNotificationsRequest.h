@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     UpdatePipelineNotificationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdatePipelineNotifications"; }
     Aws::String SerializePayload() const override;
 
 
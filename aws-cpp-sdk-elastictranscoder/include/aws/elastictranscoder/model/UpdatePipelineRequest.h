@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     UpdatePipelineRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdatePipeline"; }
     Aws::String SerializePayload() const override;
 
 
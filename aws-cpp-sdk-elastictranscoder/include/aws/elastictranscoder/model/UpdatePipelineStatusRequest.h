@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UpdatePipelineStatusRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdatePipelineStatus"; }
     Aws::String SerializePayload() const override;
 
 
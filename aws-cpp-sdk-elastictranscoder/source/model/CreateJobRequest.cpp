@@ -93,7 +93,7 @@ Aws::String CreateJobRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
@@ -71,7 +71,7 @@ Aws::String CreatePresetRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
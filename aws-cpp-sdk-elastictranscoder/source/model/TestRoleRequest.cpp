@@ -62,7 +62,7 @@ Aws::String TestRoleRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
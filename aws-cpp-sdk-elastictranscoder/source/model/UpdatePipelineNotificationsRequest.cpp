@@ -37,7 +37,7 @@ Aws::String UpdatePipelineNotificationsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
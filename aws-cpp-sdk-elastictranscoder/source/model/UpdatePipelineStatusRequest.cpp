@@ -37,7 +37,7 @@ Aws::String UpdatePipelineStatusRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
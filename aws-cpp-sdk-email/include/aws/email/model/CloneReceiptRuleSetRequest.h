@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CloneReceiptRuleSetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CloneReceiptRuleSet"; }
     Aws::String SerializePayload() const override;
 
 
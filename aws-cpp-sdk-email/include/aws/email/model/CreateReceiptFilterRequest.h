@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateReceiptFilterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateReceiptFilter"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateReceiptRuleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateReceiptRule"; }
     Aws::String SerializePayload() const override;
 
 
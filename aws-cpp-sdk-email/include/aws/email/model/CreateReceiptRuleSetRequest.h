@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateReceiptRuleSetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateReceiptRuleSet"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteIdentityPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteIdentityPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteIdentityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteIdentity"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteReceiptFilterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteReceiptFilter"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteReceiptRuleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteReceiptRule"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteReceiptRuleSetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteReceiptRuleSet"; }
     Aws::String SerializePayload() const override;
 
 
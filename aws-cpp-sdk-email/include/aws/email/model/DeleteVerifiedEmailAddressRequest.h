@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteVerifiedEmailAddressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVerifiedEmailAddress"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     DescribeActiveReceiptRuleSetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeActiveReceiptRuleSet"; }
     Aws::String SerializePayload() const override;
 
 
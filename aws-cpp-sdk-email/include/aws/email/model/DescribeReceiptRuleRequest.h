@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeReceiptRuleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReceiptRule"; }
     Aws::String SerializePayload() const override;
 
 
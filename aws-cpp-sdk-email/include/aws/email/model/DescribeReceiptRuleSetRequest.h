@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeReceiptRuleSetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReceiptRuleSet"; }
     Aws::String SerializePayload() const override;
 
 
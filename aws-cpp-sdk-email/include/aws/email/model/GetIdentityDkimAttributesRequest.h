@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     GetIdentityDkimAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetIdentityDkimAttributes"; }
     Aws::String SerializePayload() const override;
 
 
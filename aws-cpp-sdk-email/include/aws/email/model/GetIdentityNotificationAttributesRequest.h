@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetIdentityNotificationAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetIdentityNotificationAttributes"; }
     Aws::String SerializePayload() const override;
 
 
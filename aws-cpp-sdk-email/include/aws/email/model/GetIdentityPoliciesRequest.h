@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     GetIdentityPoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetIdentityPolicies"; }
     Aws::String SerializePayload() const override;
 
 
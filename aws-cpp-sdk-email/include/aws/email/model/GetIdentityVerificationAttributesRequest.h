@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     GetIdentityVerificationAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetIdentityVerificationAttributes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     GetSendQuotaRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetSendQuota"; }
     Aws::String SerializePayload() const override;
 
 
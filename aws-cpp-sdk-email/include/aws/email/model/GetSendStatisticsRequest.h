@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     GetSendStatisticsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetSendStatistics"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ListIdentitiesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListIdentities"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListIdentityPoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListIdentityPolicies"; }
     Aws::String SerializePayload() const override;
 
 
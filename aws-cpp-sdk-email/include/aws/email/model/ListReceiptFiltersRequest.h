@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     ListReceiptFiltersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListReceiptFilters"; }
     Aws::String SerializePayload() const override;
 
 
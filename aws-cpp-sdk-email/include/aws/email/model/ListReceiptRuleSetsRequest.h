@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListReceiptRuleSetsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListReceiptRuleSets"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     ListVerifiedEmailAddressesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListVerifiedEmailAddresses"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutIdentityPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutIdentityPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ReorderReceiptRuleSetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReorderReceiptRuleSet"; }
     Aws::String SerializePayload() const override;
 
 
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     SendBounceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SendBounce"; }
     Aws::String SerializePayload() const override;
 
 
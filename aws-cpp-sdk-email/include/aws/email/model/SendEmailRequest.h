@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     SendEmailRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SendEmail"; }
     Aws::String SerializePayload() const override;
 
 
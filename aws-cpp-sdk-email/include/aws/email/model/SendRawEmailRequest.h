@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     SendRawEmailRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SendRawEmail"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     SetActiveReceiptRuleSetRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetActiveReceiptRuleSet"; }
     Aws::String SerializePayload() const override;
 
 
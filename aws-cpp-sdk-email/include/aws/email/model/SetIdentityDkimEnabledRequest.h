@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SetIdentityDkimEnabledRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetIdentityDkimEnabled"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     SetIdentityFeedbackForwardingEnabledRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetIdentityFeedbackForwardingEnabled"; }
     Aws::String SerializePayload() const override;
 
 
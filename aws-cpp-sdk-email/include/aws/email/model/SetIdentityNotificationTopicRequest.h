@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetIdentityNotificationTopicRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetIdentityNotificationTopic"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     SetReceiptRulePositionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetReceiptRulePosition"; }
     Aws::String SerializePayload() const override;
 
 
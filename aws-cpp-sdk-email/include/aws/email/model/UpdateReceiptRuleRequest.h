@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UpdateReceiptRuleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateReceiptRule"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     VerifyDomainDkimRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "VerifyDomainDkim"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     VerifyDomainIdentityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "VerifyDomainIdentity"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     VerifyEmailAddressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "VerifyEmailAddress"; }
     Aws::String SerializePayload() const override;
 
 
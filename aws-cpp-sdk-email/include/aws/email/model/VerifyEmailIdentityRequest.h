@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     VerifyEmailIdentityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "VerifyEmailIdentity"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AbortMultipartUploadRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AbortMultipartUpload"; }
     Aws::String SerializePayload() const override;
 
 
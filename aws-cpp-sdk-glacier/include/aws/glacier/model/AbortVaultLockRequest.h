@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AbortVaultLockRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AbortVaultLock"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     AddTagsToVaultRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddTagsToVault"; }
     Aws::String SerializePayload() const override;
 
 
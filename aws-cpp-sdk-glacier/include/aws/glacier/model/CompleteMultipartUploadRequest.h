@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CompleteMultipartUploadRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CompleteMultipartUpload"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CompleteVaultLockRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CompleteVaultLock"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateVaultRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateVault"; }
     Aws::String SerializePayload() const override;
 
 
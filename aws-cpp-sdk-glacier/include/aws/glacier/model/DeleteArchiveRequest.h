@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteArchiveRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteArchive"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteVaultAccessPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVaultAccessPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteVaultNotificationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVaultNotifications"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteVaultRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVault"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeJobRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeJob"; }
     Aws::String SerializePayload() const override;
 
 
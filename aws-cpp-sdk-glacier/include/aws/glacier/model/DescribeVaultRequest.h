@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeVaultRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVault"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetDataRetrievalPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetDataRetrievalPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetJobOutputRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetJobOutput"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetVaultAccessPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetVaultAccessPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetVaultLockRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetVaultLock"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetVaultNotificationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetVaultNotifications"; }
     Aws::String SerializePayload() const override;
 
 
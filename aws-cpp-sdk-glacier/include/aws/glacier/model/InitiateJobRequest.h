@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     InitiateJobRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "InitiateJob"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     InitiateMultipartUploadRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "InitiateMultipartUpload"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
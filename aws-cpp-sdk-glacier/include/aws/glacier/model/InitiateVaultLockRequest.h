@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     InitiateVaultLockRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "InitiateVaultLock"; }
     Aws::String SerializePayload() const override;
 
 
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListJobsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListJobs"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListTagsForVaultRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListTagsForVault"; }
     Aws::String SerializePayload() const override;
 
 
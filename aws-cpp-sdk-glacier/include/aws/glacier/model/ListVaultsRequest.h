@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListVaultsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListVaults"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
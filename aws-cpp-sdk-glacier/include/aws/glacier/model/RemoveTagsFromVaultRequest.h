@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RemoveTagsFromVaultRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemoveTagsFromVault"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetDataRetrievalPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetDataRetrievalPolicy"; }
     Aws::String SerializePayload() const override;
 
 
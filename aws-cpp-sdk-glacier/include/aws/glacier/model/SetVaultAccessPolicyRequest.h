@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetVaultAccessPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetVaultAccessPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetVaultNotificationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetVaultNotifications"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     UploadArchiveRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UploadArchive"; }
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
 
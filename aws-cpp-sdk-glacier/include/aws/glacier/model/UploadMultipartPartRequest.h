@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     UploadMultipartPartRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UploadMultipartPart"; }
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
 
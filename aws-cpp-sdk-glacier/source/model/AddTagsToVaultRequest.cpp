@@ -43,7 +43,7 @@ Aws::String AddTagsToVaultRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
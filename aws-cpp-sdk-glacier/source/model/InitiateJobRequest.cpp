@@ -38,7 +38,7 @@ Aws::String InitiateJobRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
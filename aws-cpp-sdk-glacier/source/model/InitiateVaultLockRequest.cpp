@@ -38,7 +38,7 @@ Aws::String InitiateVaultLockRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
@@ -43,7 +43,7 @@ Aws::String RemoveTagsFromVaultRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
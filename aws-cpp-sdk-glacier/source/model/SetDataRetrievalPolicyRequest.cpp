@@ -37,7 +37,7 @@ Aws::String SetDataRetrievalPolicyRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
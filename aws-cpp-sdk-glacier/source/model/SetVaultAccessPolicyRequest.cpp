@@ -38,7 +38,7 @@ Aws::String SetVaultAccessPolicyRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
@@ -38,7 +38,7 @@ Aws::String SetVaultNotificationsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
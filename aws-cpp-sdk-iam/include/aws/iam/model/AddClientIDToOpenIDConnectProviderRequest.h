@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AddClientIDToOpenIDConnectProviderRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddClientIDToOpenIDConnectProvider"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AddRoleToInstanceProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddRoleToInstanceProfile"; }
     Aws::String SerializePayload() const override;
 
 
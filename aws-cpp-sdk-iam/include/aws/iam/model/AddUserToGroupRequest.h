@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AddUserToGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddUserToGroup"; }
     Aws::String SerializePayload() const override;
 
 
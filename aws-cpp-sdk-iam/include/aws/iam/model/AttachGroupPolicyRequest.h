@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AttachGroupPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachGroupPolicy"; }
     Aws::String SerializePayload() const override;
 
 
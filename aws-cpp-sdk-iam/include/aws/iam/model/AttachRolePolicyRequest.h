@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AttachRolePolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachRolePolicy"; }
     Aws::String SerializePayload() const override;
 
 
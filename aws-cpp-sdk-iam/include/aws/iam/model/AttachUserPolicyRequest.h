@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AttachUserPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachUserPolicy"; }
     Aws::String SerializePayload() const override;
 
 
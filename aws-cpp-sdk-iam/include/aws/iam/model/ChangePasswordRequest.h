@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ChangePasswordRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ChangePassword"; }
     Aws::String SerializePayload() const override;
 
 
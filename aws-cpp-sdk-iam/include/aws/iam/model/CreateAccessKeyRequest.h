@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateAccessKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateAccessKey"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateAccountAliasRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateAccountAlias"; }
     Aws::String SerializePayload() const override;
 
 
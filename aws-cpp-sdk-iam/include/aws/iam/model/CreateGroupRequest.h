@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateGroup"; }
     Aws::String SerializePayload() const override;
 
 
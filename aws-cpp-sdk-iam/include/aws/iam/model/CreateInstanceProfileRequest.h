@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateInstanceProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateInstanceProfile"; }
     Aws::String SerializePayload() const override;
 
 
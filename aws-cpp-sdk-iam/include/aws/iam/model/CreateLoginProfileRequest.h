@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateLoginProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateLoginProfile"; }
     Aws::String SerializePayload() const override;
 
 
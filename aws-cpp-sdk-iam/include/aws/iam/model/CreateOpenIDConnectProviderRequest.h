@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateOpenIDConnectProviderRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateOpenIDConnectProvider"; }
     Aws::String SerializePayload() const override;
 
 
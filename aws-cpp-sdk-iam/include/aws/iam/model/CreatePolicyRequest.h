@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreatePolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreatePolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreatePolicyVersionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreatePolicyVersion"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateRoleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateRole"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateSAMLProviderRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateSAMLProvider"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateUserRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateUser"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateVirtualMFADeviceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateVirtualMFADevice"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeactivateMFADeviceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeactivateMFADevice"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteAccessKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteAccessKey"; }
     Aws::String SerializePayload() const override;
 
 
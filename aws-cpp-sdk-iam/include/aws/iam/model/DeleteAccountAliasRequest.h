@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteAccountAliasRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteAccountAlias"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     DeleteAccountPasswordPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteAccountPasswordPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteGroupPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteGroupPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteInstanceProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteInstanceProfile"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteLoginProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteLoginProfile"; }
     Aws::String SerializePayload() const override;
 
 
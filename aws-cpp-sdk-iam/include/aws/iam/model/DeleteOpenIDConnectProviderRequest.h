@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteOpenIDConnectProviderRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteOpenIDConnectProvider"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeletePolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeletePolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeletePolicyVersionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeletePolicyVersion"; }
     Aws::String SerializePayload() const override;
 
 
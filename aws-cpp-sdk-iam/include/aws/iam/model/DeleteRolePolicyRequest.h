@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteRolePolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteRolePolicy"; }
     Aws::String SerializePayload() const override;
 
 
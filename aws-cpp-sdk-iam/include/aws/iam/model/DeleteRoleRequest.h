@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteRoleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteRole"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteSAMLProviderRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteSAMLProvider"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteSSHPublicKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteSSHPublicKey"; }
     Aws::String SerializePayload() const override;
 
 
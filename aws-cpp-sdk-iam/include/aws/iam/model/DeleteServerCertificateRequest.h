@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteServerCertificateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteServerCertificate"; }
     Aws::String SerializePayload() const override;
 
 
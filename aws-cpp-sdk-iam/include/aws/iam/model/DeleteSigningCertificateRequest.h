@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteSigningCertificateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteSigningCertificate"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteUserPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteUserPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteUserRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteUser"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteVirtualMFADeviceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteVirtualMFADevice"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DetachGroupPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachGroupPolicy"; }
     Aws::String SerializePayload() const override;
 
 
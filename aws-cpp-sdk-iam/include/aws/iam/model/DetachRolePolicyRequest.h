@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DetachRolePolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachRolePolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DetachUserPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachUserPolicy"; }
     Aws::String SerializePayload() const override;
 
 
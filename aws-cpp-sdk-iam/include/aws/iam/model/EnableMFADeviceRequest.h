@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     EnableMFADeviceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnableMFADevice"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     GenerateCredentialReportRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GenerateCredentialReport"; }
     Aws::String SerializePayload() const override;
 
 
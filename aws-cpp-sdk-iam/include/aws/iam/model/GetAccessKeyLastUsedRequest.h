@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetAccessKeyLastUsedRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetAccessKeyLastUsed"; }
     Aws::String SerializePayload() const override;
 
 
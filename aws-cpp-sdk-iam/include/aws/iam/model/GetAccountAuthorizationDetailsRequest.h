@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     GetAccountAuthorizationDetailsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetAccountAuthorizationDetails"; }
     Aws::String SerializePayload() const override;
 
 
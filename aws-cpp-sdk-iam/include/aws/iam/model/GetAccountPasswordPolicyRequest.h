@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     GetAccountPasswordPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetAccountPasswordPolicy"; }
     Aws::String SerializePayload() const override;
 
 
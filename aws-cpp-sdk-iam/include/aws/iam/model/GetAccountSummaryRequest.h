@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     GetAccountSummaryRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetAccountSummary"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetContextKeysForPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetContextKeysForPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     GetCredentialReportRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetCredentialReport"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetGroupPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetGroupPolicy"; }
     Aws::String SerializePayload() const override;
 
 
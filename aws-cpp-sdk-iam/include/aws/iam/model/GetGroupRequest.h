@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetInstanceProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetInstanceProfile"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetLoginProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetLoginProfile"; }
     Aws::String SerializePayload() const override;
 
 
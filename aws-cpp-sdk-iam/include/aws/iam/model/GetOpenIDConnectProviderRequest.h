@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetOpenIDConnectProviderRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetOpenIDConnectProvider"; }
     Aws::String SerializePayload() const override;
 
 
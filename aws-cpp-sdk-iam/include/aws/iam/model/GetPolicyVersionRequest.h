@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetPolicyVersionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetPolicyVersion"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetRolePolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetRolePolicy"; }
     Aws::String SerializePayload() const override;
 
 
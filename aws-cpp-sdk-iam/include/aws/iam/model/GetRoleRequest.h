@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetRoleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetRole"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetSAMLProviderRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetSAMLProvider"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetSSHPublicKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetSSHPublicKey"; }
     Aws::String SerializePayload() const override;
 
 
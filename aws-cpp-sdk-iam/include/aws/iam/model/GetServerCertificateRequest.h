@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetServerCertificateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetServerCertificate"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetUserPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetUserPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetUserRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetUser"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListAccessKeysRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListAccessKeys"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListAccountAliasesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListAccountAliases"; }
     Aws::String SerializePayload() const override;
 
 
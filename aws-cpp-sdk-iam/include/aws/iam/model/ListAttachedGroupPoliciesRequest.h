@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListAttachedGroupPoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListAttachedGroupPolicies"; }
     Aws::String SerializePayload() const override;
 
 
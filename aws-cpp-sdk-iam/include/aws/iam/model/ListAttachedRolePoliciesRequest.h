@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListAttachedRolePoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListAttachedRolePolicies"; }
     Aws::String SerializePayload() const override;
 
 
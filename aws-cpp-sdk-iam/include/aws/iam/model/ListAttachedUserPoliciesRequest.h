@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListAttachedUserPoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListAttachedUserPolicies"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListEntitiesForPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListEntitiesForPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListGroupPoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListGroupPolicies"; }
     Aws::String SerializePayload() const override;
 
 
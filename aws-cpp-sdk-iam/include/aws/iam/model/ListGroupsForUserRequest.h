@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListGroupsForUserRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListGroupsForUser"; }
     Aws::String SerializePayload() const override;
 
 
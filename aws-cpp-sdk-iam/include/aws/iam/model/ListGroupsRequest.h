@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListGroups"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListInstanceProfilesForRoleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListInstanceProfilesForRole"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListInstanceProfilesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListInstanceProfiles"; }
     Aws::String SerializePayload() const override;
 
 
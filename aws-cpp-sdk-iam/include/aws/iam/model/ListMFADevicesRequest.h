@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListMFADevicesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListMFADevices"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     ListOpenIDConnectProvidersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListOpenIDConnectProviders"; }
     Aws::String SerializePayload() const override;
 
 
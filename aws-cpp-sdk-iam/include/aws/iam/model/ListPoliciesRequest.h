@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListPoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListPolicies"; }
     Aws::String SerializePayload() const override;
 
 
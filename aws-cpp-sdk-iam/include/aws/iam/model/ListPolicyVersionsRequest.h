@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListPolicyVersionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListPolicyVersions"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListRolePoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListRolePolicies"; }
     Aws::String SerializePayload() const override;
 
 
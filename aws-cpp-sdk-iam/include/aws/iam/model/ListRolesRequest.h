@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListRolesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListRoles"; }
     Aws::String SerializePayload() const override;
 
 
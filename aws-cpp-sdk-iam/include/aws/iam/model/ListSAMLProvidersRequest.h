@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     ListSAMLProvidersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListSAMLProviders"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListSSHPublicKeysRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListSSHPublicKeys"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListServerCertificatesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListServerCertificates"; }
     Aws::String SerializePayload() const override;
 
 
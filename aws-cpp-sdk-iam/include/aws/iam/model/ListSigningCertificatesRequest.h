@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListSigningCertificatesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListSigningCertificates"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListUserPoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListUserPolicies"; }
     Aws::String SerializePayload() const override;
 
 
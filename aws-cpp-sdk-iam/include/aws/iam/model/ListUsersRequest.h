@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListUsersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListUsers"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListVirtualMFADevicesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListVirtualMFADevices"; }
     Aws::String SerializePayload() const override;
 
 
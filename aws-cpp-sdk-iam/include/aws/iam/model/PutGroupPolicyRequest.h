@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PutGroupPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutGroupPolicy"; }
     Aws::String SerializePayload() const override;
 
 
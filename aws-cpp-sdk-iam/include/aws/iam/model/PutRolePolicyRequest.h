@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PutRolePolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutRolePolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PutUserPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutUserPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RemoveClientIDFromOpenIDConnectProviderRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemoveClientIDFromOpenIDConnectProvider"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RemoveRoleFromInstanceProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemoveRoleFromInstanceProfile"; }
     Aws::String SerializePayload() const override;
 
 
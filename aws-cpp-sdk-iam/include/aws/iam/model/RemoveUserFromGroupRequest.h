@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RemoveUserFromGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemoveUserFromGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ResyncMFADeviceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ResyncMFADevice"; }
     Aws::String SerializePayload() const override;
 
 
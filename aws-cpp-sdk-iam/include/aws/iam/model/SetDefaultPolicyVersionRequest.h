@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     SetDefaultPolicyVersionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetDefaultPolicyVersion"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SimulatePolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SimulatePolicy"; }
     Aws::String SerializePayload() const override;
 
 
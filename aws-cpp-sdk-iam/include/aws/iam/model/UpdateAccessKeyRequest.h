@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UpdateAccessKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateAccessKey"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     UpdateAccountPasswordPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateAccountPasswordPolicy"; }
     Aws::String SerializePayload() const override;
 
 
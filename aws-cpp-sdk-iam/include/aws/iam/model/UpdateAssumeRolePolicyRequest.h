@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateAssumeRolePolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateAssumeRolePolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateGroup"; }
     Aws::String SerializePayload() const override;
 
 
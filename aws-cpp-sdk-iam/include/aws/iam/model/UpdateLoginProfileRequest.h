@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateLoginProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateLoginProfile"; }
     Aws::String SerializePayload() const override;
 
 
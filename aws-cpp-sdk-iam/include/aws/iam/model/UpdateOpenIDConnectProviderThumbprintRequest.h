@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UpdateOpenIDConnectProviderThumbprintRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateOpenIDConnectProviderThumbprint"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateSAMLProviderRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateSAMLProvider"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UpdateSSHPublicKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateSSHPublicKey"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateServerCertificateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateServerCertificate"; }
     Aws::String SerializePayload() const override;
 
 
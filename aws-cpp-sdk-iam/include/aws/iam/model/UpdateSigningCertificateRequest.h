@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UpdateSigningCertificateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateSigningCertificate"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateUserRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateUser"; }
     Aws::String SerializePayload() const override;
 
 
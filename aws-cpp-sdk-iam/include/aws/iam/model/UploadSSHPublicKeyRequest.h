@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UploadSSHPublicKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UploadSSHPublicKey"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UploadServerCertificateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UploadServerCertificate"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UploadSigningCertificateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UploadSigningCertificate"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     AddTagsToStreamRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddTagsToStream"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
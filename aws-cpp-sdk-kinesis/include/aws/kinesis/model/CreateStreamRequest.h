@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateStreamRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateStream"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
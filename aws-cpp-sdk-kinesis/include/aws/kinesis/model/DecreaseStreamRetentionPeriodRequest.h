@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DecreaseStreamRetentionPeriodRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DecreaseStreamRetentionPeriod"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteStreamRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteStream"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeStreamRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeStream"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetRecordsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetRecords"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     GetShardIteratorRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetShardIterator"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
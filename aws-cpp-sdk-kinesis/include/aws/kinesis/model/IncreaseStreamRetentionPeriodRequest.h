@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     IncreaseStreamRetentionPeriodRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "IncreaseStreamRetentionPeriod"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
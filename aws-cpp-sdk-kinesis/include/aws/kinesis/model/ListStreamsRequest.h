@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListStreamsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListStreams"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListTagsForStreamRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListTagsForStream"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
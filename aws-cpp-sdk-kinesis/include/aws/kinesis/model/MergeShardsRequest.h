@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     MergeShardsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "MergeShards"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
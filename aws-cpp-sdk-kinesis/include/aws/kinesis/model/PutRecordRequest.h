@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     PutRecordRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutRecord"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
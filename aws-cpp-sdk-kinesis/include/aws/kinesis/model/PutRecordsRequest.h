@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     PutRecordsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutRecords"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RemoveTagsFromStreamRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemoveTagsFromStream"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SplitShardRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SplitShard"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
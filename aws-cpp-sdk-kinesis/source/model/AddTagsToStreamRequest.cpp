@@ -48,7 +48,7 @@ Aws::String AddTagsToStreamRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection AddTagsToStreamRequest::GetRequestSpecificHeaders() const
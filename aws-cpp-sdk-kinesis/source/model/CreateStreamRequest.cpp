@@ -44,7 +44,7 @@ Aws::String CreateStreamRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateStreamRequest::GetRequestSpecificHeaders() const
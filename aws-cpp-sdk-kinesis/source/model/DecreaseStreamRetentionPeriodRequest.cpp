@@ -44,7 +44,7 @@ Aws::String DecreaseStreamRetentionPeriodRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DecreaseStreamRetentionPeriodRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DeleteStreamRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteStreamRequest::GetRequestSpecificHeaders() const
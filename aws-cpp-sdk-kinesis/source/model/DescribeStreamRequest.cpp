@@ -51,7 +51,7 @@ Aws::String DescribeStreamRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeStreamRequest::GetRequestSpecificHeaders() const
@@ -44,7 +44,7 @@ Aws::String GetRecordsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetRecordsRequest::GetRequestSpecificHeaders() const
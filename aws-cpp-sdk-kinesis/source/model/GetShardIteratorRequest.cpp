@@ -56,7 +56,7 @@ Aws::String GetShardIteratorRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetShardIteratorRequest::GetRequestSpecificHeaders() const
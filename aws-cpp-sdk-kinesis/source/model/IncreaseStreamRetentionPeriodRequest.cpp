@@ -44,7 +44,7 @@ Aws::String IncreaseStreamRetentionPeriodRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection IncreaseStreamRetentionPeriodRequest::GetRequestSpecificHeaders() const
@@ -44,7 +44,7 @@ Aws::String ListStreamsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListStreamsRequest::GetRequestSpecificHeaders() const
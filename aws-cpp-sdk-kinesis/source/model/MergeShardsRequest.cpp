@@ -50,7 +50,7 @@ Aws::String MergeShardsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection MergeShardsRequest::GetRequestSpecificHeaders() const
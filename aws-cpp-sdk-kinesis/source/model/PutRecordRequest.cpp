@@ -64,7 +64,7 @@ Aws::String PutRecordRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PutRecordRequest::GetRequestSpecificHeaders() const
@@ -48,7 +48,7 @@ Aws::String PutRecordsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PutRecordsRequest::GetRequestSpecificHeaders() const
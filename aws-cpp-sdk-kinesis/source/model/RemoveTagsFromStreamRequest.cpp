@@ -48,7 +48,7 @@ Aws::String RemoveTagsFromStreamRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RemoveTagsFromStreamRequest::GetRequestSpecificHeaders() const
@@ -50,7 +50,7 @@ Aws::String SplitShardRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection SplitShardRequest::GetRequestSpecificHeaders() const
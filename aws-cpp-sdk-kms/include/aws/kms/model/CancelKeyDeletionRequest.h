@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CancelKeyDeletionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CancelKeyDeletion"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
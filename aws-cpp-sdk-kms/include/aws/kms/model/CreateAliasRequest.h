@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateAliasRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateAlias"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateGrantRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateGrant"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
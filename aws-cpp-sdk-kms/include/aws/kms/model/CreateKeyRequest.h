@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateKey"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
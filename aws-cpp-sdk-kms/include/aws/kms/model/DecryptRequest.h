@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DecryptRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "Decrypt"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteAliasRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteAlias"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeKey"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
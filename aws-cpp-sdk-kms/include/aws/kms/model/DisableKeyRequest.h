@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DisableKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisableKey"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
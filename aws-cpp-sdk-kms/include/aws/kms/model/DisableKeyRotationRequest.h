@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DisableKeyRotationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisableKeyRotation"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
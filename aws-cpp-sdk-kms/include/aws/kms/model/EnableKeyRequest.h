@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     EnableKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnableKey"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     EnableKeyRotationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnableKeyRotation"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
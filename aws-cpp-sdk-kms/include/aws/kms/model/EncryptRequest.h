@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     EncryptRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "Encrypt"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
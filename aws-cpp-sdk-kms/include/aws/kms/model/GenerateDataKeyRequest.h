@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     GenerateDataKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GenerateDataKey"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     GenerateDataKeyWithoutPlaintextRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GenerateDataKeyWithoutPlaintext"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
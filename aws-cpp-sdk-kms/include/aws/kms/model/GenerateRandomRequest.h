@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     GenerateRandomRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GenerateRandom"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
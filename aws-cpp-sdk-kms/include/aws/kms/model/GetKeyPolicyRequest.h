@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetKeyPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetKeyPolicy"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetKeyRotationStatusRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetKeyRotationStatus"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListAliasesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListAliases"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListGrantsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListGrants"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListKeyPoliciesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListKeyPolicies"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
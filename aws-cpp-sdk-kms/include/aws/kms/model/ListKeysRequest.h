@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListKeysRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListKeys"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
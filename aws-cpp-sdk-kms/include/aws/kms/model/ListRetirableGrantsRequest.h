@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListRetirableGrantsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListRetirableGrants"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
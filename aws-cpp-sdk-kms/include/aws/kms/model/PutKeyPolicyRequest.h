@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PutKeyPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutKeyPolicy"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ReEncryptRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReEncrypt"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RetireGrantRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RetireGrant"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
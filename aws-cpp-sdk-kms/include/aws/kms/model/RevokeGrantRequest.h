@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RevokeGrantRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RevokeGrant"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
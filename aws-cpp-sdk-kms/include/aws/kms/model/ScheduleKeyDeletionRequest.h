@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ScheduleKeyDeletionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ScheduleKeyDeletion"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
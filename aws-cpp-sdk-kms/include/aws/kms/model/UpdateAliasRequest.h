@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateAliasRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateAlias"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
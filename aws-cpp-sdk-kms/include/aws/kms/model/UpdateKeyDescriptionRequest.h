@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateKeyDescriptionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateKeyDescription"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
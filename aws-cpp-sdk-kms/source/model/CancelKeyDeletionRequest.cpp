@@ -36,7 +36,7 @@ Aws::String CancelKeyDeletionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CancelKeyDeletionRequest::GetRequestSpecificHeaders() const
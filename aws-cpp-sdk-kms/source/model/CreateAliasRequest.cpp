@@ -43,7 +43,7 @@ Aws::String CreateAliasRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateAliasRequest::GetRequestSpecificHeaders() const
@@ -88,7 +88,7 @@ Aws::String CreateGrantRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateGrantRequest::GetRequestSpecificHeaders() const
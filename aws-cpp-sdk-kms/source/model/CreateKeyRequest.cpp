@@ -49,7 +49,7 @@ Aws::String CreateKeyRequest::SerializePayload() const
    payload.WithString("KeyUsage", KeyUsageTypeMapper::GetNameForKeyUsageType(m_keyUsage));
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateKeyRequest::GetRequestSpecificHeaders() const
@@ -60,7 +60,7 @@ Aws::String DecryptRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DecryptRequest::GetRequestSpecificHeaders() const
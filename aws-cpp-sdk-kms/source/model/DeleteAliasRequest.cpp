@@ -36,7 +36,7 @@ Aws::String DeleteAliasRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteAliasRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DescribeKeyRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeKeyRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DisableKeyRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DisableKeyRequest::GetRequestSpecificHeaders() const
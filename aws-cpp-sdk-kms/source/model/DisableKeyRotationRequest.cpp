@@ -36,7 +36,7 @@ Aws::String DisableKeyRotationRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DisableKeyRotationRequest::GetRequestSpecificHeaders() const
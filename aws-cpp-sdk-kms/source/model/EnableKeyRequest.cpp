@@ -36,7 +36,7 @@ Aws::String EnableKeyRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection EnableKeyRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String EnableKeyRotationRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection EnableKeyRotationRequest::GetRequestSpecificHeaders() const
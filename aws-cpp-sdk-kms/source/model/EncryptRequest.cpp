@@ -67,7 +67,7 @@ Aws::String EncryptRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection EncryptRequest::GetRequestSpecificHeaders() const
@@ -74,7 +74,7 @@ Aws::String GenerateDataKeyRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GenerateDataKeyRequest::GetRequestSpecificHeaders() const
@@ -74,7 +74,7 @@ Aws::String GenerateDataKeyWithoutPlaintextRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GenerateDataKeyWithoutPlaintextRequest::GetRequestSpecificHeaders() const
@@ -37,7 +37,7 @@ Aws::String GenerateRandomRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GenerateRandomRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String GetKeyPolicyRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetKeyPolicyRequest::GetRequestSpecificHeaders() const
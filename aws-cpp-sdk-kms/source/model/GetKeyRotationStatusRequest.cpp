@@ -36,7 +36,7 @@ Aws::String GetKeyRotationStatusRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetKeyRotationStatusRequest::GetRequestSpecificHeaders() const
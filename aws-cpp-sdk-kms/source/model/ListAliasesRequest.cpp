@@ -44,7 +44,7 @@ Aws::String ListAliasesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListAliasesRequest::GetRequestSpecificHeaders() const
@@ -51,7 +51,7 @@ Aws::String ListGrantsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListGrantsRequest::GetRequestSpecificHeaders() const
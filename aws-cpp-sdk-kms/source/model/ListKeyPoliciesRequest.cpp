@@ -51,7 +51,7 @@ Aws::String ListKeyPoliciesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListKeyPoliciesRequest::GetRequestSpecificHeaders() const
@@ -44,7 +44,7 @@ Aws::String ListKeysRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListKeysRequest::GetRequestSpecificHeaders() const
@@ -51,7 +51,7 @@ Aws::String ListRetirableGrantsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListRetirableGrantsRequest::GetRequestSpecificHeaders() const
@@ -50,7 +50,7 @@ Aws::String PutKeyPolicyRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PutKeyPolicyRequest::GetRequestSpecificHeaders() const
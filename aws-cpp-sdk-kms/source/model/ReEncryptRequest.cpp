@@ -79,7 +79,7 @@ Aws::String ReEncryptRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ReEncryptRequest::GetRequestSpecificHeaders() const
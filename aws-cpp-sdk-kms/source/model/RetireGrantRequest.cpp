@@ -50,7 +50,7 @@ Aws::String RetireGrantRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RetireGrantRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String RevokeGrantRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RevokeGrantRequest::GetRequestSpecificHeaders() const
@@ -44,7 +44,7 @@ Aws::String ScheduleKeyDeletionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ScheduleKeyDeletionRequest::GetRequestSpecificHeaders() const
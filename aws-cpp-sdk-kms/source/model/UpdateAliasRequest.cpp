@@ -43,7 +43,7 @@ Aws::String UpdateAliasRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateAliasRequest::GetRequestSpecificHeaders() const
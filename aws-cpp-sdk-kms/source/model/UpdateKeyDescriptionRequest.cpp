@@ -43,7 +43,7 @@ Aws::String UpdateKeyDescriptionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateKeyDescriptionRequest::GetRequestSpecificHeaders() const
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AddPermissionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddPermission"; }
     Aws::String SerializePayload() const override;
 
 
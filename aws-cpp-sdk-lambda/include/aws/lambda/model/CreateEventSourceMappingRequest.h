@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateEventSourceMappingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateEventSourceMapping"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateFunctionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateFunction"; }
     Aws::String SerializePayload() const override;
 
 
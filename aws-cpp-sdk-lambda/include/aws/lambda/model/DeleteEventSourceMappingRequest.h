@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteEventSourceMappingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteEventSourceMapping"; }
     Aws::String SerializePayload() const override;
 
 
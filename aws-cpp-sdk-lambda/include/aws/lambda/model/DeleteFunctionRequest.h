@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteFunctionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteFunction"; }
     Aws::String SerializePayload() const override;
 
 
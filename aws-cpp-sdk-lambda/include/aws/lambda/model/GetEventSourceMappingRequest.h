@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetEventSourceMappingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetEventSourceMapping"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetFunctionConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetFunctionConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetFunctionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetFunction"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetPolicy"; }
     Aws::String SerializePayload() const override;
 
 
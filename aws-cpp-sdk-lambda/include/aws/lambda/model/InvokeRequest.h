@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     InvokeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "Invoke"; }
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
 
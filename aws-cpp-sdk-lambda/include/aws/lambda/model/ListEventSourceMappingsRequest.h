@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     ListEventSourceMappingsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListEventSourceMappings"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     ListFunctionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListFunctions"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateEventSourceMappingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateEventSourceMapping"; }
     Aws::String SerializePayload() const override;
 
 
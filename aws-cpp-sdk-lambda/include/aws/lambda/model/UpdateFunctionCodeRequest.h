@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UpdateFunctionCodeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateFunctionCode"; }
     Aws::String SerializePayload() const override;
 
 
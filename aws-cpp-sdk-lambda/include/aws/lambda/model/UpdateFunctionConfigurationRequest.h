@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateFunctionConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateFunctionConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
@@ -65,7 +65,7 @@ Aws::String AddPermissionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
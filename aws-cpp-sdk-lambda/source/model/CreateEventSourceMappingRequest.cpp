@@ -65,7 +65,7 @@ Aws::String CreateEventSourceMappingRequest::SerializePayload() const
    payload.WithString("StartingPosition", EventSourcePositionMapper::GetNameForEventSourcePosition(m_startingPosition));
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
@@ -86,7 +86,7 @@ Aws::String CreateFunctionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
@@ -53,7 +53,7 @@ Aws::String UpdateEventSourceMappingRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
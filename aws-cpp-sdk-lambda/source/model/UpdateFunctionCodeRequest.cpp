@@ -58,7 +58,7 @@ Aws::String UpdateFunctionCodeRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
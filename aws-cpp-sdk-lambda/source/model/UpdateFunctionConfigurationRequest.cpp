@@ -67,7 +67,7 @@ Aws::String UpdateFunctionConfigurationRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 
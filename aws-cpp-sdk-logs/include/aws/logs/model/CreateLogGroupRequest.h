@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateLogGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateLogGroup"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateLogStreamRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateLogStream"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteDestinationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDestination"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
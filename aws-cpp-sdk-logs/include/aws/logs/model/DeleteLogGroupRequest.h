@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteLogGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteLogGroup"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
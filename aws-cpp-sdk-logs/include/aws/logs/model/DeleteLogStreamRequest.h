@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteLogStreamRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteLogStream"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
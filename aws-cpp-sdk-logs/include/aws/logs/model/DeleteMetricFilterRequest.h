@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteMetricFilterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteMetricFilter"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
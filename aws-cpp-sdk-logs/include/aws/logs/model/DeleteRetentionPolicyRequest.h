@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteRetentionPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteRetentionPolicy"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteSubscriptionFilterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteSubscriptionFilter"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeDestinationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDestinations"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
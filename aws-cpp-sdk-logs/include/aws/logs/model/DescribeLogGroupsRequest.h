@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeLogGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLogGroups"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
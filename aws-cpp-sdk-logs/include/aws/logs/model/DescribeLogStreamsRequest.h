@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeLogStreamsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLogStreams"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
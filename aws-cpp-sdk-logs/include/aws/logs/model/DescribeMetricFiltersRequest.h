@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeMetricFiltersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeMetricFilters"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
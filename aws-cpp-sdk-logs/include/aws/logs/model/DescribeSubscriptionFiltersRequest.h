@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeSubscriptionFiltersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSubscriptionFilters"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
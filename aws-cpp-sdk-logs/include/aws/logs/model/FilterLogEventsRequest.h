@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     FilterLogEventsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "FilterLogEvents"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetLogEventsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetLogEvents"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
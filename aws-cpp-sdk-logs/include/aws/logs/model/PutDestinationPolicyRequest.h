@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PutDestinationPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutDestinationPolicy"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
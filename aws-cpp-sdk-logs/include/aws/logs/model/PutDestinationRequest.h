@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PutDestinationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutDestination"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
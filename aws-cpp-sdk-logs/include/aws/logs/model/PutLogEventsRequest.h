@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     PutLogEventsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutLogEvents"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     PutMetricFilterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutMetricFilter"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
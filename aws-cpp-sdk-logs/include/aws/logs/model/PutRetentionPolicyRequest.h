@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PutRetentionPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutRetentionPolicy"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PutSubscriptionFilterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutSubscriptionFilter"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
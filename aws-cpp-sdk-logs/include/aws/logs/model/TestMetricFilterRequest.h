@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     TestMetricFilterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "TestMetricFilter"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,7 +36,7 @@ Aws::String CreateLogGroupRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateLogGroupRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String CreateLogStreamRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateLogStreamRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DeleteDestinationRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteDestinationRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DeleteLogGroupRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteLogGroupRequest::GetRequestSpecificHeaders() const
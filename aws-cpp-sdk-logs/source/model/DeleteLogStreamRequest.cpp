@@ -43,7 +43,7 @@ Aws::String DeleteLogStreamRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteLogStreamRequest::GetRequestSpecificHeaders() const
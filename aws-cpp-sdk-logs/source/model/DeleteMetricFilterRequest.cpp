@@ -43,7 +43,7 @@ Aws::String DeleteMetricFilterRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteMetricFilterRequest::GetRequestSpecificHeaders() const
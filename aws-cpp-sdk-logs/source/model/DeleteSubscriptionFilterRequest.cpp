@@ -43,7 +43,7 @@ Aws::String DeleteSubscriptionFilterRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteSubscriptionFilterRequest::GetRequestSpecificHeaders() const
@@ -51,7 +51,7 @@ Aws::String DescribeDestinationsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeDestinationsRequest::GetRequestSpecificHeaders() const
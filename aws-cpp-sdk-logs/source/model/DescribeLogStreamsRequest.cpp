@@ -72,7 +72,7 @@ Aws::String DescribeLogStreamsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeLogStreamsRequest::GetRequestSpecificHeaders() const
@@ -58,7 +58,7 @@ Aws::String DescribeMetricFiltersRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeMetricFiltersRequest::GetRequestSpecificHeaders() const
@@ -58,7 +58,7 @@ Aws::String DescribeSubscriptionFiltersRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeSubscriptionFiltersRequest::GetRequestSpecificHeaders() const
@@ -94,7 +94,7 @@ Aws::String FilterLogEventsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection FilterLogEventsRequest::GetRequestSpecificHeaders() const
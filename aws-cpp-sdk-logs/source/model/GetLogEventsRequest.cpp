@@ -82,7 +82,7 @@ Aws::String GetLogEventsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetLogEventsRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String PutDestinationPolicyRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PutDestinationPolicyRequest::GetRequestSpecificHeaders() const
@@ -50,7 +50,7 @@ Aws::String PutDestinationRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PutDestinationRequest::GetRequestSpecificHeaders() const
@@ -62,7 +62,7 @@ Aws::String PutLogEventsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PutLogEventsRequest::GetRequestSpecificHeaders() const
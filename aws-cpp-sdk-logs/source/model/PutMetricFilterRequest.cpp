@@ -62,7 +62,7 @@ Aws::String PutMetricFilterRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PutMetricFilterRequest::GetRequestSpecificHeaders() const
@@ -48,7 +48,7 @@ Aws::String TestMetricFilterRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection TestMetricFilterRequest::GetRequestSpecificHeaders() const
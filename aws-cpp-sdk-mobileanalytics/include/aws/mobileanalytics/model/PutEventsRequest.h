@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     PutEventsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutEvents"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
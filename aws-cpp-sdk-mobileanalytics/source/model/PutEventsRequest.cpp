@@ -44,7 +44,7 @@ Aws::String PutEventsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PutEventsRequest::GetRequestSpecificHeaders() const
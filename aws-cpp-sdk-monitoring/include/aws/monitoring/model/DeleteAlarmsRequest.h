@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteAlarmsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteAlarms"; }
     Aws::String SerializePayload() const override;
 
 
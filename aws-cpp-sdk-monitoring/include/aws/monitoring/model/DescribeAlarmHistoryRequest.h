@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeAlarmHistoryRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAlarmHistory"; }
     Aws::String SerializePayload() const override;
 
 
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     DescribeAlarmsForMetricRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAlarmsForMetric"; }
     Aws::String SerializePayload() const override;
 
 
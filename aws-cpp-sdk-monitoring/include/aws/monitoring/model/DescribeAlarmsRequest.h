@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeAlarmsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAlarms"; }
     Aws::String SerializePayload() const override;
 
 
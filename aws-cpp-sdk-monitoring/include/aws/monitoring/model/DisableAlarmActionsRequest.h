@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DisableAlarmActionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisableAlarmActions"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     EnableAlarmActionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnableAlarmActions"; }
     Aws::String SerializePayload() const override;
 
 
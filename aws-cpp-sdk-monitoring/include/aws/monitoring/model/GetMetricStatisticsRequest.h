@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     GetMetricStatisticsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetMetricStatistics"; }
     Aws::String SerializePayload() const override;
 
 
@@ -29,6 +29,7 @@ namespace Model
   {
   public:
     ListHostInfoRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListHostInfo"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ListMetricsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListMetrics"; }
     Aws::String SerializePayload() const override;
 
 
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     PutMetricAlarmRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutMetricAlarm"; }
     Aws::String SerializePayload() const override;
 
 
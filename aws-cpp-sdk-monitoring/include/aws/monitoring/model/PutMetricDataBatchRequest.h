@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutMetricDataBatchRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutMetricDataBatch"; }
     Aws::String SerializePayload() const override;
 
 
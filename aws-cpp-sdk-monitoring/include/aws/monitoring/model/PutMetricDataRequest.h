@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     PutMetricDataRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutMetricData"; }
     Aws::String SerializePayload() const override;
 
 
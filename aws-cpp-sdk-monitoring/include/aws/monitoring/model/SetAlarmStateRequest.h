@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SetAlarmStateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetAlarmState"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AssignInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AssignInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AssignVolumeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AssignVolume"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AssociateElasticIpRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AssociateElasticIp"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AttachElasticLoadBalancerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AttachElasticLoadBalancer"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
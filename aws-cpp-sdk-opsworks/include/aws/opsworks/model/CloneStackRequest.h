@@ -37,6 +37,7 @@ namespace Model
   {
   public:
     CloneStackRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CloneStack"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
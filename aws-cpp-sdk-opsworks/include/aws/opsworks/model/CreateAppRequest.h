@@ -38,6 +38,7 @@ namespace Model
   {
   public:
     CreateAppRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateApp"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateDeploymentRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDeployment"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     CreateInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -37,6 +37,7 @@ namespace Model
   {
   public:
     CreateLayerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateLayer"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateUserProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateUserProfile"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteAppRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteApp"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteLayerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteLayer"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
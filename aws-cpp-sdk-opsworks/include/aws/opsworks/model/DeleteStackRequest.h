@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteStackRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteStack"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
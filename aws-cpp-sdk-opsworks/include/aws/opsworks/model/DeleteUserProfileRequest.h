@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteUserProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteUserProfile"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
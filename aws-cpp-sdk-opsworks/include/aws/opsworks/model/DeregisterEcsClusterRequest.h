@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeregisterEcsClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeregisterEcsCluster"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
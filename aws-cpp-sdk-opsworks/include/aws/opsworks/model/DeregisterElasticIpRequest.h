@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeregisterElasticIpRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeregisterElasticIp"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeregisterInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeregisterInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
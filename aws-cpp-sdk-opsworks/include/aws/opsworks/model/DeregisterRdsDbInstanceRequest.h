@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeregisterRdsDbInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeregisterRdsDbInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
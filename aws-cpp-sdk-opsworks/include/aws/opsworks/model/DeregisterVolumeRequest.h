@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeregisterVolumeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeregisterVolume"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeAgentVersionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeAgentVersions"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeAppsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeApps"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeCommandsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeCommands"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeDeploymentsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDeployments"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeEcsClustersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeEcsClusters"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeElasticIpsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeElasticIps"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeElasticLoadBalancersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeElasticLoadBalancers"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeInstances"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
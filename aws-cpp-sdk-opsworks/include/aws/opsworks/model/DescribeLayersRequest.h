@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeLayersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLayers"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeLoadBasedAutoScalingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLoadBasedAutoScaling"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribePermissionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribePermissions"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeRaidArraysRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeRaidArrays"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
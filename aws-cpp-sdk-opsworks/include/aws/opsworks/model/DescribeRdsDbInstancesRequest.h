@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeRdsDbInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeRdsDbInstances"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeServiceErrorsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeServiceErrors"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
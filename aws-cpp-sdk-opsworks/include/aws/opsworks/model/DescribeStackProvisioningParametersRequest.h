@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeStackProvisioningParametersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeStackProvisioningParameters"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeStackSummaryRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeStackSummary"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeStacksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeStacks"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
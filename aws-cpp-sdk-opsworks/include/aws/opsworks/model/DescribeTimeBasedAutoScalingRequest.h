@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeTimeBasedAutoScalingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeTimeBasedAutoScaling"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeUserProfilesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeUserProfiles"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeVolumesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeVolumes"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
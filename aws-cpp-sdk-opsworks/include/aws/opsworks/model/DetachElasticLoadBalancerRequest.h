@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DetachElasticLoadBalancerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DetachElasticLoadBalancer"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
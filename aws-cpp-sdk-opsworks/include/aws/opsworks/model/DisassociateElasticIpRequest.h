@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DisassociateElasticIpRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisassociateElasticIp"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetHostnameSuggestionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetHostnameSuggestion"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GrantAccessRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GrantAccess"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RebootInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RebootInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
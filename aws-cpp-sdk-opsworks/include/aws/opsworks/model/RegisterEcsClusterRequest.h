@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RegisterEcsClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterEcsCluster"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RegisterElasticIpRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterElasticIp"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RegisterInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RegisterRdsDbInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterRdsDbInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RegisterVolumeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterVolume"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SetLoadBasedAutoScalingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetLoadBasedAutoScaling"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     SetPermissionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetPermission"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SetTimeBasedAutoScalingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetTimeBasedAutoScaling"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
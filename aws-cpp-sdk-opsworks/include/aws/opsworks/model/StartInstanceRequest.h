@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     StartInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "StartInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     StartStackRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "StartStack"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     StopInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "StopInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
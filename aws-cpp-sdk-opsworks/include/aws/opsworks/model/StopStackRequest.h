@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     StopStackRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "StopStack"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UnassignInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UnassignInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
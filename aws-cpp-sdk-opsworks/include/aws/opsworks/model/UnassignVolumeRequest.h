@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UnassignVolumeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UnassignVolume"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
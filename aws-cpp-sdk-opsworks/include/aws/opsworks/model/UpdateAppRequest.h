@@ -38,6 +38,7 @@ namespace Model
   {
   public:
     UpdateAppRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateApp"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateElasticIpRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateElasticIp"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
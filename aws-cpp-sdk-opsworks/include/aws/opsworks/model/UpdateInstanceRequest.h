@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     UpdateInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     UpdateLayerRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateLayer"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateMyUserProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateMyUserProfile"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
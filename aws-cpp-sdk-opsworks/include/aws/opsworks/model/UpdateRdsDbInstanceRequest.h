@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateRdsDbInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateRdsDbInstance"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
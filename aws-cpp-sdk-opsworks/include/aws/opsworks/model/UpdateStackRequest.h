@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     UpdateStackRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateStack"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateUserProfileRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateUserProfile"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     UpdateVolumeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UpdateVolume"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
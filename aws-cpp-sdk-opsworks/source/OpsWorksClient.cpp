@@ -1121,7 +1121,7 @@ DescribeMyUserProfileOutcome OpsWorksClient::DescribeMyUserProfile() const
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), HttpMethod::HTTP_POST, "DescribeMyUserProfile");
   if(outcome.IsSuccess())
   {
     return DescribeMyUserProfileOutcome(DescribeMyUserProfileResult(outcome.GetResult()));
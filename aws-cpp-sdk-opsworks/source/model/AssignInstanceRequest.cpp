@@ -48,7 +48,7 @@ Aws::String AssignInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection AssignInstanceRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String AssignVolumeRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection AssignVolumeRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String AssociateElasticIpRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection AssociateElasticIpRequest::GetRequestSpecificHeaders() const
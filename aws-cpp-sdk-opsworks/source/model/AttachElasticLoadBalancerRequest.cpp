@@ -43,7 +43,7 @@ Aws::String AttachElasticLoadBalancerRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection AttachElasticLoadBalancerRequest::GetRequestSpecificHeaders() const
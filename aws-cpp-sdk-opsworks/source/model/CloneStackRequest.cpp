@@ -195,7 +195,7 @@ Aws::String CloneStackRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CloneStackRequest::GetRequestSpecificHeaders() const
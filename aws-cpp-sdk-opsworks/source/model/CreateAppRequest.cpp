@@ -133,7 +133,7 @@ Aws::String CreateAppRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateAppRequest::GetRequestSpecificHeaders() const
@@ -76,7 +76,7 @@ Aws::String CreateDeploymentRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateDeploymentRequest::GetRequestSpecificHeaders() const
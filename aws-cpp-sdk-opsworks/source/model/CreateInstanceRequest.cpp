@@ -157,7 +157,7 @@ Aws::String CreateInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateInstanceRequest::GetRequestSpecificHeaders() const
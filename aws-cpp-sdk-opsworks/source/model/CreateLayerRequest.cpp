@@ -172,7 +172,7 @@ Aws::String CreateLayerRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateLayerRequest::GetRequestSpecificHeaders() const
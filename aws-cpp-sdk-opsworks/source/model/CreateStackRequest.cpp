@@ -168,7 +168,7 @@ Aws::String CreateStackRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateStackRequest::GetRequestSpecificHeaders() const
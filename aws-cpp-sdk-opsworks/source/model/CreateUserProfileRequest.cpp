@@ -58,7 +58,7 @@ Aws::String CreateUserProfileRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CreateUserProfileRequest::GetRequestSpecificHeaders() const
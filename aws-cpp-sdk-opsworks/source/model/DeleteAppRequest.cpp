@@ -36,7 +36,7 @@ Aws::String DeleteAppRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteAppRequest::GetRequestSpecificHeaders() const
@@ -52,7 +52,7 @@ Aws::String DeleteInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteInstanceRequest::GetRequestSpecificHeaders() const
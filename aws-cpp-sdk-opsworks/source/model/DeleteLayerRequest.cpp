@@ -36,7 +36,7 @@ Aws::String DeleteLayerRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteLayerRequest::GetRequestSpecificHeaders() const
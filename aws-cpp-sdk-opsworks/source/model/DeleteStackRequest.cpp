@@ -36,7 +36,7 @@ Aws::String DeleteStackRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteStackRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DeleteUserProfileRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeleteUserProfileRequest::GetRequestSpecificHeaders() const
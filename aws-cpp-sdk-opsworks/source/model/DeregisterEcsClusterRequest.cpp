@@ -36,7 +36,7 @@ Aws::String DeregisterEcsClusterRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeregisterEcsClusterRequest::GetRequestSpecificHeaders() const
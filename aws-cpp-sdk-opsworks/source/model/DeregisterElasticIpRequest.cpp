@@ -36,7 +36,7 @@ Aws::String DeregisterElasticIpRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeregisterElasticIpRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DeregisterInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeregisterInstanceRequest::GetRequestSpecificHeaders() const
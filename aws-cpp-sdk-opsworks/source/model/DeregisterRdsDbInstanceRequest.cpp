@@ -36,7 +36,7 @@ Aws::String DeregisterRdsDbInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeregisterRdsDbInstanceRequest::GetRequestSpecificHeaders() const
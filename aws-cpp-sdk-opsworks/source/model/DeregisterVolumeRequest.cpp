@@ -36,7 +36,7 @@ Aws::String DeregisterVolumeRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeregisterVolumeRequest::GetRequestSpecificHeaders() const
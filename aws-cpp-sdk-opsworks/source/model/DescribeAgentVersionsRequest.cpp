@@ -43,7 +43,7 @@ Aws::String DescribeAgentVersionsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeAgentVersionsRequest::GetRequestSpecificHeaders() const
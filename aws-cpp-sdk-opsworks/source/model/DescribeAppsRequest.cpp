@@ -48,7 +48,7 @@ Aws::String DescribeAppsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeAppsRequest::GetRequestSpecificHeaders() const
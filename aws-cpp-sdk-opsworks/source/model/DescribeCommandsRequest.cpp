@@ -55,7 +55,7 @@ Aws::String DescribeCommandsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeCommandsRequest::GetRequestSpecificHeaders() const
@@ -55,7 +55,7 @@ Aws::String DescribeDeploymentsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeDeploymentsRequest::GetRequestSpecificHeaders() const
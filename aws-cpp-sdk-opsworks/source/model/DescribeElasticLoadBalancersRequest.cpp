@@ -48,7 +48,7 @@ Aws::String DescribeElasticLoadBalancersRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeElasticLoadBalancersRequest::GetRequestSpecificHeaders() const
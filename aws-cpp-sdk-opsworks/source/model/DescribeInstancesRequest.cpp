@@ -55,7 +55,7 @@ Aws::String DescribeInstancesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeInstancesRequest::GetRequestSpecificHeaders() const
@@ -48,7 +48,7 @@ Aws::String DescribeLayersRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeLayersRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String DescribePermissionsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribePermissionsRequest::GetRequestSpecificHeaders() const
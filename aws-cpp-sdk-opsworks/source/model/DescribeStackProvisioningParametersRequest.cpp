@@ -36,7 +36,7 @@ Aws::String DescribeStackProvisioningParametersRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeStackProvisioningParametersRequest::GetRequestSpecificHeaders() const
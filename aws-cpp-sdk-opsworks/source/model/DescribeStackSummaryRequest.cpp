@@ -36,7 +36,7 @@ Aws::String DescribeStackSummaryRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeStackSummaryRequest::GetRequestSpecificHeaders() const
@@ -41,7 +41,7 @@ Aws::String DescribeStacksRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeStacksRequest::GetRequestSpecificHeaders() const
@@ -62,7 +62,7 @@ Aws::String DescribeVolumesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeVolumesRequest::GetRequestSpecificHeaders() const
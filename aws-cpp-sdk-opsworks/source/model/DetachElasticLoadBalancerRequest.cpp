@@ -43,7 +43,7 @@ Aws::String DetachElasticLoadBalancerRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DetachElasticLoadBalancerRequest::GetRequestSpecificHeaders() const
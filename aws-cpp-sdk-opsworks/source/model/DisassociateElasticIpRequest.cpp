@@ -36,7 +36,7 @@ Aws::String DisassociateElasticIpRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DisassociateElasticIpRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String GetHostnameSuggestionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GetHostnameSuggestionRequest::GetRequestSpecificHeaders() const
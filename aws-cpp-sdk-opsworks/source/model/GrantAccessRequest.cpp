@@ -44,7 +44,7 @@ Aws::String GrantAccessRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection GrantAccessRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String RebootInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RebootInstanceRequest::GetRequestSpecificHeaders() const
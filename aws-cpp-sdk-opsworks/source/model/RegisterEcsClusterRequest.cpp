@@ -43,7 +43,7 @@ Aws::String RegisterEcsClusterRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RegisterEcsClusterRequest::GetRequestSpecificHeaders() const
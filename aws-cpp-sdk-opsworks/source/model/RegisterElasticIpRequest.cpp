@@ -43,7 +43,7 @@ Aws::String RegisterElasticIpRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RegisterElasticIpRequest::GetRequestSpecificHeaders() const
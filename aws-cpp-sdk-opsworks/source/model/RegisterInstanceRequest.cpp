@@ -78,7 +78,7 @@ Aws::String RegisterInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RegisterInstanceRequest::GetRequestSpecificHeaders() const
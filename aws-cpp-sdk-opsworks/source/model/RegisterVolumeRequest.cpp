@@ -43,7 +43,7 @@ Aws::String RegisterVolumeRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RegisterVolumeRequest::GetRequestSpecificHeaders() const
@@ -66,7 +66,7 @@ Aws::String SetPermissionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection SetPermissionRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String SetTimeBasedAutoScalingRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection SetTimeBasedAutoScalingRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String StartInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection StartInstanceRequest::GetRequestSpecificHeaders() const
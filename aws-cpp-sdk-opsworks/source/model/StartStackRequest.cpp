@@ -36,7 +36,7 @@ Aws::String StartStackRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection StartStackRequest::GetRequestSpecificHeaders() const
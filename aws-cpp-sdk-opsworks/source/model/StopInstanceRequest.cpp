@@ -36,7 +36,7 @@ Aws::String StopInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection StopInstanceRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String StopStackRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection StopStackRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String UnassignInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UnassignInstanceRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String UnassignVolumeRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UnassignVolumeRequest::GetRequestSpecificHeaders() const
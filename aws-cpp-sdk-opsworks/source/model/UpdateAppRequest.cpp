@@ -126,7 +126,7 @@ Aws::String UpdateAppRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateAppRequest::GetRequestSpecificHeaders() const
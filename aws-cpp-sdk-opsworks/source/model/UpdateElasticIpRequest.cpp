@@ -43,7 +43,7 @@ Aws::String UpdateElasticIpRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateElasticIpRequest::GetRequestSpecificHeaders() const
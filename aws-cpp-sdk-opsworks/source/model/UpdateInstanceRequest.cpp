@@ -118,7 +118,7 @@ Aws::String UpdateInstanceRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateInstanceRequest::GetRequestSpecificHeaders() const
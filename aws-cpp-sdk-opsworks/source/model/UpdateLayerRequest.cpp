@@ -166,7 +166,7 @@ Aws::String UpdateLayerRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateLayerRequest::GetRequestSpecificHeaders() const
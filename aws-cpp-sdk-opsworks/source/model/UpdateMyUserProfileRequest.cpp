@@ -36,7 +36,7 @@ Aws::String UpdateMyUserProfileRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateMyUserProfileRequest::GetRequestSpecificHeaders() const
@@ -161,7 +161,7 @@ Aws::String UpdateStackRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateStackRequest::GetRequestSpecificHeaders() const
@@ -58,7 +58,7 @@ Aws::String UpdateUserProfileRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateUserProfileRequest::GetRequestSpecificHeaders() const
@@ -50,7 +50,7 @@ Aws::String UpdateVolumeRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection UpdateVolumeRequest::GetRequestSpecificHeaders() const
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AddSourceIdentifierToSubscriptionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddSourceIdentifierToSubscription"; }
     Aws::String SerializePayload() const override;
 
 
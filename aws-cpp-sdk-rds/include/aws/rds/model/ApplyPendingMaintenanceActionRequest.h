@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ApplyPendingMaintenanceActionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ApplyPendingMaintenanceAction"; }
     Aws::String SerializePayload() const override;
 
 
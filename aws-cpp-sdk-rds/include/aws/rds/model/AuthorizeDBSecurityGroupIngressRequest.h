@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AuthorizeDBSecurityGroupIngressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AuthorizeDBSecurityGroupIngress"; }
     Aws::String SerializePayload() const override;
 
 
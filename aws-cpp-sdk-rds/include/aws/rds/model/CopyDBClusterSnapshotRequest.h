@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CopyDBClusterSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CopyDBClusterSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
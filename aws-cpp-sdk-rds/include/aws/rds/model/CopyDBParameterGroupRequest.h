@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CopyDBParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CopyDBParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
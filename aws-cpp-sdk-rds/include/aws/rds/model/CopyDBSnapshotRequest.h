@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CopyDBSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CopyDBSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
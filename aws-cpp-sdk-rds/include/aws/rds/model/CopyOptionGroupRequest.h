@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CopyOptionGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CopyOptionGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateDBClusterParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDBClusterParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
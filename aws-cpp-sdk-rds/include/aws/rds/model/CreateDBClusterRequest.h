@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateDBClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDBCluster"; }
     Aws::String SerializePayload() const override;
 
 
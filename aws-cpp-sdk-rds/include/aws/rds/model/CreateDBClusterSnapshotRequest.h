@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateDBClusterSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDBClusterSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
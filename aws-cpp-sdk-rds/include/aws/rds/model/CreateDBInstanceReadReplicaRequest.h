@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateDBInstanceReadReplicaRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDBInstanceReadReplica"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateDBInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDBInstance"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateDBParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDBParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
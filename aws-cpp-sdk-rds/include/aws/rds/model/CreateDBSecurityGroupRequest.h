@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateDBSecurityGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDBSecurityGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateDBSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDBSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
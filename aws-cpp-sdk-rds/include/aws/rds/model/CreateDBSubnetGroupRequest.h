@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateDBSubnetGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDBSubnetGroup"; }
     Aws::String SerializePayload() const override;
 
 
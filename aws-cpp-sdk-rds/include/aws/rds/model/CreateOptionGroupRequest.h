@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateOptionGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateOptionGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteDBClusterParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDBClusterParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteDBClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDBCluster"; }
     Aws::String SerializePayload() const override;
 
 
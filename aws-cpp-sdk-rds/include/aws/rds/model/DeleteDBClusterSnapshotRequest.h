@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteDBClusterSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDBClusterSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteDBInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDBInstance"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteDBParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDBParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteDBSecurityGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDBSecurityGroup"; }
     Aws::String SerializePayload() const override;
 
 
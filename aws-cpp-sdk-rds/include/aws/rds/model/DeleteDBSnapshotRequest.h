@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteDBSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDBSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteDBSubnetGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDBSubnetGroup"; }
     Aws::String SerializePayload() const override;
 
 
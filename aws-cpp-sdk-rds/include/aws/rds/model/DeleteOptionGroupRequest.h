@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteOptionGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteOptionGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeCertificatesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeCertificates"; }
     Aws::String SerializePayload() const override;
 
 
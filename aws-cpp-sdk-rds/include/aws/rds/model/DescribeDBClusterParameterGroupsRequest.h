@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeDBClusterParameterGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBClusterParameterGroups"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeDBClusterParametersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBClusterParameters"; }
     Aws::String SerializePayload() const override;
 
 
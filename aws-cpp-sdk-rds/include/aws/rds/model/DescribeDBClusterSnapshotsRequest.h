@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeDBClusterSnapshotsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBClusterSnapshots"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeDBClustersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBClusters"; }
     Aws::String SerializePayload() const override;
 
 
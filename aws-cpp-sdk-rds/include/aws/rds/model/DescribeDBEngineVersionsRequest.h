@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeDBEngineVersionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBEngineVersions"; }
     Aws::String SerializePayload() const override;
 
 
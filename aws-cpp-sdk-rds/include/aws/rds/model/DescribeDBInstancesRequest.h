@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeDBInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBInstances"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeDBLogFilesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBLogFiles"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeDBParameterGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBParameterGroups"; }
     Aws::String SerializePayload() const override;
 
 
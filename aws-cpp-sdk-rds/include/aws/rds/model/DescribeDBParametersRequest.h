@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeDBParametersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBParameters"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeDBSecurityGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBSecurityGroups"; }
     Aws::String SerializePayload() const override;
 
 
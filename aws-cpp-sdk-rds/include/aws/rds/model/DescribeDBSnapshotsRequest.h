@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeDBSnapshotsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBSnapshots"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeDBSubnetGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDBSubnetGroups"; }
     Aws::String SerializePayload() const override;
 
 
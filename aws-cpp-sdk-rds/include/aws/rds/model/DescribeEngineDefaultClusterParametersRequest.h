@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeEngineDefaultClusterParametersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeEngineDefaultClusterParameters"; }
     Aws::String SerializePayload() const override;
 
 
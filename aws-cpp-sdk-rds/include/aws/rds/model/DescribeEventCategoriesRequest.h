@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeEventCategoriesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeEventCategories"; }
     Aws::String SerializePayload() const override;
 
 
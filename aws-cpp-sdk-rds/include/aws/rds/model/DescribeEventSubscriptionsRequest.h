@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeEventSubscriptionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeEventSubscriptions"; }
     Aws::String SerializePayload() const override;
 
 
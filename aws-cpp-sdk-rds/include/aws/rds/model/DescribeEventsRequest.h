@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeEventsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeEvents"; }
     Aws::String SerializePayload() const override;
 
 
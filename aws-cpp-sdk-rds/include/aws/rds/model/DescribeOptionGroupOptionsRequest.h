@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeOptionGroupOptionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeOptionGroupOptions"; }
     Aws::String SerializePayload() const override;
 
 
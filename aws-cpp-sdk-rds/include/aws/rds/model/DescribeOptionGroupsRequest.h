@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeOptionGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeOptionGroups"; }
     Aws::String SerializePayload() const override;
 
 
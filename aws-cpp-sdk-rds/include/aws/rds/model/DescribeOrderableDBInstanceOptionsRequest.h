@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeOrderableDBInstanceOptionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeOrderableDBInstanceOptions"; }
     Aws::String SerializePayload() const override;
 
 
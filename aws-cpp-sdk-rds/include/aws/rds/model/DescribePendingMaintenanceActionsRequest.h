@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribePendingMaintenanceActionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribePendingMaintenanceActions"; }
     Aws::String SerializePayload() const override;
 
 
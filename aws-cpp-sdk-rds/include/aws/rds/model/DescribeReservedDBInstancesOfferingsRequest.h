@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeReservedDBInstancesOfferingsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReservedDBInstancesOfferings"; }
     Aws::String SerializePayload() const override;
 
 
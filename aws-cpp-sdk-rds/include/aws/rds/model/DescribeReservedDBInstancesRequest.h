@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DescribeReservedDBInstancesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReservedDBInstances"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DownloadDBLogFilePortionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DownloadDBLogFilePortion"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     FailoverDBClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "FailoverDBCluster"; }
     Aws::String SerializePayload() const override;
 
 
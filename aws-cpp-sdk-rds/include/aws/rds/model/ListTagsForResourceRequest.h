@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ListTagsForResourceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListTagsForResource"; }
     Aws::String SerializePayload() const override;
 
 
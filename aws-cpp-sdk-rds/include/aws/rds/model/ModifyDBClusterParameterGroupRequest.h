@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ModifyDBClusterParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyDBClusterParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ModifyDBClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyDBCluster"; }
     Aws::String SerializePayload() const override;
 
 
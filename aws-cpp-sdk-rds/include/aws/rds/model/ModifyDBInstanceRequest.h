@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ModifyDBInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyDBInstance"; }
     Aws::String SerializePayload() const override;
 
 
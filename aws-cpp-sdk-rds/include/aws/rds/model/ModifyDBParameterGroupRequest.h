@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ModifyDBParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyDBParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
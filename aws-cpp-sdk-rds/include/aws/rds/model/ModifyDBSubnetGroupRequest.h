@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ModifyDBSubnetGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyDBSubnetGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ModifyOptionGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyOptionGroup"; }
     Aws::String SerializePayload() const override;
 
 
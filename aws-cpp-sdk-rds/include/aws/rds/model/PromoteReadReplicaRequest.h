@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PromoteReadReplicaRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PromoteReadReplica"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     PurchaseReservedDBInstancesOfferingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PurchaseReservedDBInstancesOffering"; }
     Aws::String SerializePayload() const override;
 
 
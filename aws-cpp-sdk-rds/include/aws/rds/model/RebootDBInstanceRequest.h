@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RebootDBInstanceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RebootDBInstance"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RemoveSourceIdentifierFromSubscriptionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemoveSourceIdentifierFromSubscription"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ResetDBClusterParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ResetDBClusterParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
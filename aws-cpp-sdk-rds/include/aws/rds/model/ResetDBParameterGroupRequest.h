@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ResetDBParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ResetDBParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     RestoreDBClusterFromSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RestoreDBClusterFromSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     RestoreDBClusterToPointInTimeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RestoreDBClusterToPointInTime"; }
     Aws::String SerializePayload() const override;
 
 
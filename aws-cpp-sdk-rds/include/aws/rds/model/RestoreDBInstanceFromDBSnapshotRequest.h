@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     RestoreDBInstanceFromDBSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RestoreDBInstanceFromDBSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     RestoreDBInstanceToPointInTimeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RestoreDBInstanceToPointInTime"; }
     Aws::String SerializePayload() const override;
 
 
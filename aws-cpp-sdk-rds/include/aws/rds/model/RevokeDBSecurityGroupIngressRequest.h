@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RevokeDBSecurityGroupIngressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RevokeDBSecurityGroupIngress"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AuthorizeClusterSecurityGroupIngressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AuthorizeClusterSecurityGroupIngress"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AuthorizeSnapshotAccessRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AuthorizeSnapshotAccess"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CopyClusterSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CopyClusterSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateClusterParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateClusterParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateClusterSecurityGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateClusterSecurityGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateClusterSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateClusterSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateClusterSubnetGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateClusterSubnetGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateEventSubscriptionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateEventSubscription"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateHsmClientCertificateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateHsmClientCertificate"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateHsmConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateHsmConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     CreateSnapshotCopyGrantRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateSnapshotCopyGrant"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteClusterParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteClusterParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
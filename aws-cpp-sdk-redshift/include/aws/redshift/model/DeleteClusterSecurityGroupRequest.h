@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteClusterSecurityGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteClusterSecurityGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteClusterSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteClusterSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
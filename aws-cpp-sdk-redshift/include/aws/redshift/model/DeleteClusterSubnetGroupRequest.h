@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteClusterSubnetGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteClusterSubnetGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteEventSubscriptionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteEventSubscription"; }
     Aws::String SerializePayload() const override;
 
 
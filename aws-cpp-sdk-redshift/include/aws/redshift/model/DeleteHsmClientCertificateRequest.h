@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteHsmClientCertificateRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteHsmClientCertificate"; }
     Aws::String SerializePayload() const override;
 
 
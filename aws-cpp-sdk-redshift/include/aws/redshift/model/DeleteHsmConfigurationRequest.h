@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteHsmConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteHsmConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
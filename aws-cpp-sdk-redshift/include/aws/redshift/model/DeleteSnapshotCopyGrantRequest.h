@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteSnapshotCopyGrantRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteSnapshotCopyGrant"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeClusterParameterGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeClusterParameterGroups"; }
     Aws::String SerializePayload() const override;
 
 
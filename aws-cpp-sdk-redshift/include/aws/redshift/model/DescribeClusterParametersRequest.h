@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeClusterParametersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeClusterParameters"; }
     Aws::String SerializePayload() const override;
 
 
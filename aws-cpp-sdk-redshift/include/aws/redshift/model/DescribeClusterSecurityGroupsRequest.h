@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeClusterSecurityGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeClusterSecurityGroups"; }
     Aws::String SerializePayload() const override;
 
 
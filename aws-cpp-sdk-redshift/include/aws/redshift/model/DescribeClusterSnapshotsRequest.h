@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeClusterSnapshotsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeClusterSnapshots"; }
     Aws::String SerializePayload() const override;
 
 
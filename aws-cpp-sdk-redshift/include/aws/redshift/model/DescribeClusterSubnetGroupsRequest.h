@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeClusterSubnetGroupsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeClusterSubnetGroups"; }
     Aws::String SerializePayload() const override;
 
 
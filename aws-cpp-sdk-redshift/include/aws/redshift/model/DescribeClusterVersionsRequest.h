@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeClusterVersionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeClusterVersions"; }
     Aws::String SerializePayload() const override;
 
 
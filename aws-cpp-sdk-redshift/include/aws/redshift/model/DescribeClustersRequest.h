@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeClustersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeClusters"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeDefaultClusterParametersRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDefaultClusterParameters"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeHsmClientCertificatesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeHsmClientCertificates"; }
     Aws::String SerializePayload() const override;
 
 
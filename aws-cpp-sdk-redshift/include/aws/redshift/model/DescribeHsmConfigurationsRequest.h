@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeHsmConfigurationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeHsmConfigurations"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeLoggingStatusRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeLoggingStatus"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeOrderableClusterOptionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeOrderableClusterOptions"; }
     Aws::String SerializePayload() const override;
 
 
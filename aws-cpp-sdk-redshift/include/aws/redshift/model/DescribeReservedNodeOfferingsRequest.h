@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeReservedNodeOfferingsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReservedNodeOfferings"; }
     Aws::String SerializePayload() const override;
 
 
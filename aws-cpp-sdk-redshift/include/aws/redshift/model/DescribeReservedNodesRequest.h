@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeReservedNodesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeReservedNodes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeResizeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeResize"; }
     Aws::String SerializePayload() const override;
 
 
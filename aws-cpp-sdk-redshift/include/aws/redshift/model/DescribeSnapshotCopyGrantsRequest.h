@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DescribeSnapshotCopyGrantsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeSnapshotCopyGrants"; }
     Aws::String SerializePayload() const override;
 
 
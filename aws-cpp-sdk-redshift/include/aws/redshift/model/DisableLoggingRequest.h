@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DisableLoggingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisableLogging"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DisableSnapshotCopyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DisableSnapshotCopy"; }
     Aws::String SerializePayload() const override;
 
 
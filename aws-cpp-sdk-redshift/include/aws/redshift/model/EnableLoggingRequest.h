@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     EnableLoggingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnableLogging"; }
     Aws::String SerializePayload() const override;
 
 
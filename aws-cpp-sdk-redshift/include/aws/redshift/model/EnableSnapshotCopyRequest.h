@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     EnableSnapshotCopyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "EnableSnapshotCopy"; }
     Aws::String SerializePayload() const override;
 
 
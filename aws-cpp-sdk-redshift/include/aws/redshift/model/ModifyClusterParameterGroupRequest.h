@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ModifyClusterParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyClusterParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ModifyClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyCluster"; }
     Aws::String SerializePayload() const override;
 
 
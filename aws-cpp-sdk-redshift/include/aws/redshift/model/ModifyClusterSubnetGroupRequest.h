@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ModifyClusterSubnetGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyClusterSubnetGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ModifyEventSubscriptionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifyEventSubscription"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ModifySnapshotCopyRetentionPeriodRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ModifySnapshotCopyRetentionPeriod"; }
     Aws::String SerializePayload() const override;
 
 
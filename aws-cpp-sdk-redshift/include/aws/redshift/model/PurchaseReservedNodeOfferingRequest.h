@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PurchaseReservedNodeOfferingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PurchaseReservedNodeOffering"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RebootClusterRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RebootCluster"; }
     Aws::String SerializePayload() const override;
 
 
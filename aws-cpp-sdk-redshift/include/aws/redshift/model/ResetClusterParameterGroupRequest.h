@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     ResetClusterParameterGroupRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ResetClusterParameterGroup"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RestoreFromClusterSnapshotRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RestoreFromClusterSnapshot"; }
     Aws::String SerializePayload() const override;
 
 
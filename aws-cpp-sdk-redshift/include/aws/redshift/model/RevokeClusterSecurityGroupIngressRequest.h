@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RevokeClusterSecurityGroupIngressRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RevokeClusterSecurityGroupIngress"; }
     Aws::String SerializePayload() const override;
 
 
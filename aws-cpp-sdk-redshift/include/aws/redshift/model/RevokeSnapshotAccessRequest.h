@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RevokeSnapshotAccessRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RevokeSnapshotAccess"; }
     Aws::String SerializePayload() const override;
 
 
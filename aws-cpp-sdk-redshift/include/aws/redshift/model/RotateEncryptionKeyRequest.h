@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RotateEncryptionKeyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RotateEncryptionKey"; }
     Aws::String SerializePayload() const override;
 
 
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     AbortMultipartUploadRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AbortMultipartUpload"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -23,6 +23,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -38,6 +39,11 @@ namespace Model
     CommonPrefix();
     CommonPrefix(const Aws::Utils::Xml::XmlNode& xmlNode);
     CommonPrefix& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    /*
+     Reads the element the reader is positioned on (its START_ELEMENT) through its END_ELEMENT.
+    */
+    CommonPrefix(Aws::Utils::Xml::XmlReader& xmlReader);
+    CommonPrefix& operator=(Aws::Utils::Xml::XmlReader& xmlReader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
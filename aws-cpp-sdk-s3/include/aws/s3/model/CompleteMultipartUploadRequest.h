@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     CompleteMultipartUploadRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CompleteMultipartUpload"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
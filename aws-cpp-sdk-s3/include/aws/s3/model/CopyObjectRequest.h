@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     CopyObjectRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CopyObject"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
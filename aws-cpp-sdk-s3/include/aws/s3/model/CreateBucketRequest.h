@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateBucketRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateBucket"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     CreateMultipartUploadRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateMultipartUpload"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteBucketCorsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteBucketCors"; }
     Aws::String SerializePayload() const override;
 
 
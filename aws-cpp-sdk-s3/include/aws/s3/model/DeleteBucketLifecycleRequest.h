@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteBucketLifecycleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteBucketLifecycle"; }
     Aws::String SerializePayload() const override;
 
 
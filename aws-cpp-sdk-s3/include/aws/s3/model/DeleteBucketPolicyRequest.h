@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteBucketPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteBucketPolicy"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteBucketReplicationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteBucketReplication"; }
     Aws::String SerializePayload() const override;
 
 
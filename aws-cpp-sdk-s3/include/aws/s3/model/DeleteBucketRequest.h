@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteBucketRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteBucket"; }
     Aws::String SerializePayload() const override;
 
 
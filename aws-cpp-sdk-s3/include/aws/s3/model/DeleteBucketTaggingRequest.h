@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteBucketTaggingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteBucketTagging"; }
     Aws::String SerializePayload() const override;
 
 
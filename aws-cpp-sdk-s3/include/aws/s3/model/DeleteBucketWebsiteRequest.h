@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteBucketWebsiteRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteBucketWebsite"; }
     Aws::String SerializePayload() const override;
 
 
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     DeleteObjectRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteObject"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DeleteObjectsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteObjects"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
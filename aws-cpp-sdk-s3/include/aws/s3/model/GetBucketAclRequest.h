@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketAclRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketAcl"; }
     Aws::String SerializePayload() const override;
 
 
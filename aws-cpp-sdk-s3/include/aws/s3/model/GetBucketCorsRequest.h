@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketCorsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketCors"; }
     Aws::String SerializePayload() const override;
 
 
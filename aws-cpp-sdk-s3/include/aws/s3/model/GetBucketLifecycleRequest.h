@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketLifecycleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketLifecycle"; }
     Aws::String SerializePayload() const override;
 
 
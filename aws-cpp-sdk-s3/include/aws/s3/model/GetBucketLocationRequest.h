@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketLocationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketLocation"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketLoggingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketLogging"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketNotificationConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketNotificationConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
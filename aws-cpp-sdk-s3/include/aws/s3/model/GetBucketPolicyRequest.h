@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketPolicy"; }
     Aws::String SerializePayload() const override;
 
 
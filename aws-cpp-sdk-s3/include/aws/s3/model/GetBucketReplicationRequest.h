@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketReplicationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketReplication"; }
     Aws::String SerializePayload() const override;
 
 
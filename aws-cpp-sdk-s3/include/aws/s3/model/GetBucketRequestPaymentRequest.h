@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketRequestPaymentRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketRequestPayment"; }
     Aws::String SerializePayload() const override;
 
 
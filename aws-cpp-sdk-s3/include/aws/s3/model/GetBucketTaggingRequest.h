@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketTaggingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketTagging"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketVersioningRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketVersioning"; }
     Aws::String SerializePayload() const override;
 
 
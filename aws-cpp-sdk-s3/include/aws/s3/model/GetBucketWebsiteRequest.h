@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetBucketWebsiteRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetBucketWebsite"; }
     Aws::String SerializePayload() const override;
 
 
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     GetObjectAclRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetObjectAcl"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     GetObjectRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetObject"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetObjectTorrentRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetObjectTorrent"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     HeadBucketRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "HeadBucket"; }
     Aws::String SerializePayload() const override;
 
 
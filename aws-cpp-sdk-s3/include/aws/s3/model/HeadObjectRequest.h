@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     HeadObjectRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "HeadObject"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
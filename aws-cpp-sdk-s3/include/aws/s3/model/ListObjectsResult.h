@@ -30,6 +30,7 @@ namespace Utils
 namespace Xml
 {
   class XmlDocument;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -45,6 +46,11 @@ namespace Model
     ListObjectsResult();
     ListObjectsResult(const AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
     ListObjectsResult& operator=(const AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
+    /*
+     Reads the result straight off a response body reader positioned at the start of the document, without loading it into an XmlDocument.
+    */
+    ListObjectsResult(Aws::Utils::Xml::XmlReader& xmlReader);
+    ListObjectsResult& operator=(Aws::Utils::Xml::XmlReader& xmlReader);
 
     /*
      A flag that indicates whether or not Amazon S3 returned all of the results that satisfied the search criteria.
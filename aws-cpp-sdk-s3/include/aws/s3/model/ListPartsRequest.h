@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListPartsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListParts"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -25,6 +25,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -40,6 +41,11 @@ namespace Model
     Object();
     Object(const Aws::Utils::Xml::XmlNode& xmlNode);
     Object& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    /*
+     Reads the element the reader is positioned on (its START_ELEMENT) through its END_ELEMENT.
+    */
+    Object(Aws::Utils::Xml::XmlReader& xmlReader);
+    Object& operator=(Aws::Utils::Xml::XmlReader& xmlReader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
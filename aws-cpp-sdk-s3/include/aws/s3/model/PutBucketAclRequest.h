@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     PutBucketAclRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutBucketAcl"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutBucketCorsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutBucketCors"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutBucketLifecycleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutBucketLifecycle"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutBucketLoggingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutBucketLogging"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutBucketNotificationConfigurationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutBucketNotificationConfiguration"; }
     Aws::String SerializePayload() const override;
 
 
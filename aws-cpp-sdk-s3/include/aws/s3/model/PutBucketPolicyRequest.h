@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PutBucketPolicyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutBucketPolicy"; }
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutBucketReplicationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutBucketReplication"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutBucketRequestPaymentRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutBucketRequestPayment"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutBucketTaggingRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutBucketTagging"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
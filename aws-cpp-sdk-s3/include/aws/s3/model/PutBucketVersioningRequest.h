@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutBucketVersioningRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutBucketVersioning"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
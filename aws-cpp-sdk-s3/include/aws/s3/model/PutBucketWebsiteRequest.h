@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PutBucketWebsiteRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutBucketWebsite"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     PutObjectAclRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutObjectAcl"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     PutObjectRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutObject"; }
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
 
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     UploadPartCopyRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UploadPartCopy"; }
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -36,6 +36,7 @@ namespace Model
   {
   public:
     UploadPartRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "UploadPart"; }
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -21,6 +21,7 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/s3/S3Client.h>
@@ -90,18 +91,18 @@ using namespace Aws::Utils::Xml;
 static const char* SERVICE_NAME = "s3";
 static const char* ALLOCATION_TAG = "S3Client";
 
-S3Client::S3Client(const Client::ClientConfiguration& clientConfiguration) :
+S3Client::S3Client(const Client::ClientConfiguration& clientConfiguration, Client::PayloadSigningPolicy payloadSigningPolicy) :
   BASECLASS(Aws::MakeShared<HttpClientFactory>(ALLOCATION_TAG), clientConfiguration,
-    Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, Aws::MakeShared<DefaultAWSCredentialsProviderChain>(ALLOCATION_TAG), SERVICE_NAME, clientConfiguration.region),
+    Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, Aws::MakeShared<DefaultAWSCredentialsProviderChain>(ALLOCATION_TAG), SERVICE_NAME, clientConfiguration.region, payloadSigningPolicy),
     Aws::MakeShared<S3ErrorMarshaller>(ALLOCATION_TAG)),
     m_executor(clientConfiguration.executor)
 {
   init(clientConfiguration);
 }
 
-S3Client::S3Client(const AWSCredentials& credentials, const Client::ClientConfiguration& clientConfiguration) :
+S3Client::S3Client(const AWSCredentials& credentials, const Client::ClientConfiguration& clientConfiguration, Client::PayloadSigningPolicy payloadSigningPolicy) :
   BASECLASS(Aws::MakeShared<HttpClientFactory>(ALLOCATION_TAG), clientConfiguration,
-    Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, credentials), SERVICE_NAME, clientConfiguration.region),
+    Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, credentials), SERVICE_NAME, clientConfiguration.region, payloadSigningPolicy),
     Aws::MakeShared<S3ErrorMarshaller>(ALLOCATION_TAG)),
     m_executor(clientConfiguration.executor)
 {
@@ -109,9 +110,10 @@ S3Client::S3Client(const AWSCredentials& credentials, const Client::ClientConfig
 }
 
 S3Client::S3Client(const std::shared_ptr<AWSCredentialsProvider>& credentialsProvider,
-  const Client::ClientConfiguration& clientConfiguration, const std::shared_ptr<HttpClientFactory const>& httpClientFactory) :
+  const Client::ClientConfiguration& clientConfiguration, const std::shared_ptr<HttpClientFactory const>& httpClientFactory,
+  Client::PayloadSigningPolicy payloadSigningPolicy) :
   BASECLASS(httpClientFactory != nullptr ? httpClientFactory : Aws::MakeShared<HttpClientFactory>(ALLOCATION_TAG), clientConfiguration,
-    Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, credentialsProvider, SERVICE_NAME, clientConfiguration.region),
+    Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, credentialsProvider, SERVICE_NAME, clientConfiguration.region, payloadSigningPolicy),
     Aws::MakeShared<S3ErrorMarshaller>(ALLOCATION_TAG)),
     m_executor(clientConfiguration.executor)
 {
@@ -138,14 +140,8 @@ void S3Client::init(const ClientConfiguration& config)
 
   m_uri = ss.str();
 }
-AbortMultipartUploadOutcome S3Client::AbortMultipartUpload(const AbortMultipartUploadRequest& request) const
+static AbortMultipartUploadOutcome BuildAbortMultipartUploadOutcome(XmlOutcome& outcome)
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return AbortMultipartUploadOutcome(AbortMultipartUploadResult(outcome.GetResult()));
@@ -156,29 +152,38 @@ AbortMultipartUploadOutcome S3Client::AbortMultipartUpload(const AbortMultipartU
   }
 }
 
-AbortMultipartUploadOutcomeCallable S3Client::AbortMultipartUploadCallable(const AbortMultipartUploadRequest& request) const
-{
-  return std::async(std::launch::async, &S3Client::AbortMultipartUpload, this, request);
-}
-
-void S3Client::AbortMultipartUploadAsync(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+AbortMultipartUploadOutcome S3Client::AbortMultipartUpload(const AbortMultipartUploadRequest& request) const
 {
-  m_executor->Submit(&S3Client::AbortMultipartUploadAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  return BuildAbortMultipartUploadOutcome(outcome);
 }
 
-void S3Client::AbortMultipartUploadAsyncHelper(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+AbortMultipartUploadOutcomeCallable S3Client::AbortMultipartUploadCallable(const AbortMultipartUploadRequest& request) const
 {
-  handler(this, request, AbortMultipartUpload(request), context);
+  return std::async(std::launch::async, &S3Client::AbortMultipartUpload, this, request);
 }
 
-CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteMultipartUploadRequest& request) const
+void S3Client::AbortMultipartUploadAsync(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  auto requestCopy = Aws::MakeShared<AbortMultipartUploadRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_DELETE, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildAbortMultipartUploadOutcome(outcome), context);
+  });
+}
+
+static CompleteMultipartUploadOutcome BuildCompleteMultipartUploadOutcome(XmlOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return CompleteMultipartUploadOutcome(CompleteMultipartUploadResult(outcome.GetResult()));
@@ -189,29 +194,38 @@ CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteM
   }
 }
 
-CompleteMultipartUploadOutcomeCallable S3Client::CompleteMultipartUploadCallable(const CompleteMultipartUploadRequest& request) const
-{
-  return std::async(std::launch::async, &S3Client::CompleteMultipartUpload, this, request);
-}
-
-void S3Client::CompleteMultipartUploadAsync(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteMultipartUploadRequest& request) const
 {
-  m_executor->Submit(&S3Client::CompleteMultipartUploadAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  return BuildCompleteMultipartUploadOutcome(outcome);
 }
 
-void S3Client::CompleteMultipartUploadAsyncHelper(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+CompleteMultipartUploadOutcomeCallable S3Client::CompleteMultipartUploadCallable(const CompleteMultipartUploadRequest& request) const
 {
-  handler(this, request, CompleteMultipartUpload(request), context);
+  return std::async(std::launch::async, &S3Client::CompleteMultipartUpload, this, request);
 }
 
-CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
+void S3Client::CompleteMultipartUploadAsync(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  auto requestCopy = Aws::MakeShared<CompleteMultipartUploadRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildCompleteMultipartUploadOutcome(outcome), context);
+  });
+}
+
+static CopyObjectOutcome BuildCopyObjectOutcome(XmlOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return CopyObjectOutcome(CopyObjectResult(outcome.GetResult()));
@@ -222,27 +236,38 @@ CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
   }
 }
 
-CopyObjectOutcomeCallable S3Client::CopyObjectCallable(const CopyObjectRequest& request) const
-{
-  return std::async(std::launch::async, &S3Client::CopyObject, this, request);
-}
-
-void S3Client::CopyObjectAsync(const CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
 {
-  m_executor->Submit(&S3Client::CopyObjectAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  return BuildCopyObjectOutcome(outcome);
 }
 
-void S3Client::CopyObjectAsyncHelper(const CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+CopyObjectOutcomeCallable S3Client::CopyObjectCallable(const CopyObjectRequest& request) const
 {
-  handler(this, request, CopyObject(request), context);
+  return std::async(std::launch::async, &S3Client::CopyObject, this, request);
 }
 
-CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) const
+void S3Client::CopyObjectAsync(const CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  ss << "/";
+  ss << request.GetKey();
+  auto requestCopy = Aws::MakeShared<CopyObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildCopyObjectOutcome(outcome), context);
+  });
+}
+
+static CreateBucketOutcome BuildCreateBucketOutcome(XmlOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return CreateBucketOutcome(CreateBucketResult(outcome.GetResult()));
@@ -253,6 +278,15 @@ CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) c
   }
 }
 
+CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) const
+{
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  return BuildCreateBucketOutcome(outcome);
+}
+
 CreateBucketOutcomeCallable S3Client::CreateBucketCallable(const CreateBucketRequest& request) const
 {
   return std::async(std::launch::async, &S3Client::CreateBucket, this, request);
@@ -260,12 +294,26 @@ CreateBucketOutcomeCallable S3Client::CreateBucketCallable(const CreateBucketReq
 
 void S3Client::CreateBucketAsync(const CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::CreateBucketAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  auto requestCopy = Aws::MakeShared<CreateBucketRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildCreateBucketOutcome(outcome), context);
+  });
 }
 
-void S3Client::CreateBucketAsyncHelper(const CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static CreateMultipartUploadOutcome BuildCreateMultipartUploadOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, CreateBucket(request), context);
+  if(outcome.IsSuccess())
+  {
+    return CreateMultipartUploadOutcome(CreateMultipartUploadResult(outcome.GetResult()));
+  }
+  else
+  {
+    return CreateMultipartUploadOutcome(outcome.GetError());
+  }
 }
 
 CreateMultipartUploadOutcome S3Client::CreateMultipartUpload(const CreateMultipartUploadRequest& request) const
@@ -277,14 +325,7 @@ CreateMultipartUploadOutcome S3Client::CreateMultipartUpload(const CreateMultipa
   ss << request.GetKey();
   ss << "?uploads";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
-  if(outcome.IsSuccess())
-  {
-    return CreateMultipartUploadOutcome(CreateMultipartUploadResult(outcome.GetResult()));
-  }
-  else
-  {
-    return CreateMultipartUploadOutcome(outcome.GetError());
-  }
+  return BuildCreateMultipartUploadOutcome(outcome);
 }
 
 CreateMultipartUploadOutcomeCallable S3Client::CreateMultipartUploadCallable(const CreateMultipartUploadRequest& request) const
@@ -293,21 +334,22 @@ CreateMultipartUploadOutcomeCallable S3Client::CreateMultipartUploadCallable(con
 }
 
 void S3Client::CreateMultipartUploadAsync(const CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&S3Client::CreateMultipartUploadAsyncHelper, this, request, handler, context);
-}
-
-void S3Client::CreateMultipartUploadAsyncHelper(const CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateMultipartUpload(request), context);
-}
-
-DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  ss << "/";
+  ss << request.GetKey();
+  ss << "?uploads";
+  auto requestCopy = Aws::MakeShared<CreateMultipartUploadRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildCreateMultipartUploadOutcome(outcome), context);
+  });
+}
+
+static DeleteBucketOutcome BuildDeleteBucketOutcome(XmlOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return DeleteBucketOutcome(NoResult());
@@ -318,6 +360,15 @@ DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) c
   }
 }
 
+DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) const
+{
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  return BuildDeleteBucketOutcome(outcome);
+}
+
 DeleteBucketOutcomeCallable S3Client::DeleteBucketCallable(const DeleteBucketRequest& request) const
 {
   return std::async(std::launch::async, &S3Client::DeleteBucket, this, request);
@@ -325,12 +376,26 @@ DeleteBucketOutcomeCallable S3Client::DeleteBucketCallable(const DeleteBucketReq
 
 void S3Client::DeleteBucketAsync(const DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  auto requestCopy = Aws::MakeShared<DeleteBucketRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_DELETE, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDeleteBucketOutcome(outcome), context);
+  });
 }
 
-void S3Client::DeleteBucketAsyncHelper(const DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static DeleteBucketCorsOutcome BuildDeleteBucketCorsOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, DeleteBucket(request), context);
+  if(outcome.IsSuccess())
+  {
+    return DeleteBucketCorsOutcome(NoResult());
+  }
+  else
+  {
+    return DeleteBucketCorsOutcome(outcome.GetError());
+  }
 }
 
 DeleteBucketCorsOutcome S3Client::DeleteBucketCors(const DeleteBucketCorsRequest& request) const
@@ -340,14 +405,7 @@ DeleteBucketCorsOutcome S3Client::DeleteBucketCors(const DeleteBucketCorsRequest
   ss << request.GetBucket();
   ss << "?cors";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
-  if(outcome.IsSuccess())
-  {
-    return DeleteBucketCorsOutcome(NoResult());
-  }
-  else
-  {
-    return DeleteBucketCorsOutcome(outcome.GetError());
-  }
+  return BuildDeleteBucketCorsOutcome(outcome);
 }
 
 DeleteBucketCorsOutcomeCallable S3Client::DeleteBucketCorsCallable(const DeleteBucketCorsRequest& request) const
@@ -357,12 +415,27 @@ DeleteBucketCorsOutcomeCallable S3Client::DeleteBucketCorsCallable(const DeleteB
 
 void S3Client::DeleteBucketCorsAsync(const DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketCorsAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?cors";
+  auto requestCopy = Aws::MakeShared<DeleteBucketCorsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_DELETE, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDeleteBucketCorsOutcome(outcome), context);
+  });
 }
 
-void S3Client::DeleteBucketCorsAsyncHelper(const DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static DeleteBucketLifecycleOutcome BuildDeleteBucketLifecycleOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, DeleteBucketCors(request), context);
+  if(outcome.IsSuccess())
+  {
+    return DeleteBucketLifecycleOutcome(NoResult());
+  }
+  else
+  {
+    return DeleteBucketLifecycleOutcome(outcome.GetError());
+  }
 }
 
 DeleteBucketLifecycleOutcome S3Client::DeleteBucketLifecycle(const DeleteBucketLifecycleRequest& request) const
@@ -372,14 +445,7 @@ DeleteBucketLifecycleOutcome S3Client::DeleteBucketLifecycle(const DeleteBucketL
   ss << request.GetBucket();
   ss << "?lifecycle";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
-  if(outcome.IsSuccess())
-  {
-    return DeleteBucketLifecycleOutcome(NoResult());
-  }
-  else
-  {
-    return DeleteBucketLifecycleOutcome(outcome.GetError());
-  }
+  return BuildDeleteBucketLifecycleOutcome(outcome);
 }
 
 DeleteBucketLifecycleOutcomeCallable S3Client::DeleteBucketLifecycleCallable(const DeleteBucketLifecycleRequest& request) const
@@ -389,12 +455,27 @@ DeleteBucketLifecycleOutcomeCallable S3Client::DeleteBucketLifecycleCallable(con
 
 void S3Client::DeleteBucketLifecycleAsync(const DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketLifecycleAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?lifecycle";
+  auto requestCopy = Aws::MakeShared<DeleteBucketLifecycleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_DELETE, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDeleteBucketLifecycleOutcome(outcome), context);
+  });
 }
 
-void S3Client::DeleteBucketLifecycleAsyncHelper(const DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static DeleteBucketPolicyOutcome BuildDeleteBucketPolicyOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, DeleteBucketLifecycle(request), context);
+  if(outcome.IsSuccess())
+  {
+    return DeleteBucketPolicyOutcome(NoResult());
+  }
+  else
+  {
+    return DeleteBucketPolicyOutcome(outcome.GetError());
+  }
 }
 
 DeleteBucketPolicyOutcome S3Client::DeleteBucketPolicy(const DeleteBucketPolicyRequest& request) const
@@ -404,14 +485,7 @@ DeleteBucketPolicyOutcome S3Client::DeleteBucketPolicy(const DeleteBucketPolicyR
   ss << request.GetBucket();
   ss << "?policy";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
-  if(outcome.IsSuccess())
-  {
-    return DeleteBucketPolicyOutcome(NoResult());
-  }
-  else
-  {
-    return DeleteBucketPolicyOutcome(outcome.GetError());
-  }
+  return BuildDeleteBucketPolicyOutcome(outcome);
 }
 
 DeleteBucketPolicyOutcomeCallable S3Client::DeleteBucketPolicyCallable(const DeleteBucketPolicyRequest& request) const
@@ -421,12 +495,27 @@ DeleteBucketPolicyOutcomeCallable S3Client::DeleteBucketPolicyCallable(const Del
 
 void S3Client::DeleteBucketPolicyAsync(const DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketPolicyAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?policy";
+  auto requestCopy = Aws::MakeShared<DeleteBucketPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_DELETE, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDeleteBucketPolicyOutcome(outcome), context);
+  });
 }
 
-void S3Client::DeleteBucketPolicyAsyncHelper(const DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static DeleteBucketReplicationOutcome BuildDeleteBucketReplicationOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, DeleteBucketPolicy(request), context);
+  if(outcome.IsSuccess())
+  {
+    return DeleteBucketReplicationOutcome(NoResult());
+  }
+  else
+  {
+    return DeleteBucketReplicationOutcome(outcome.GetError());
+  }
 }
 
 DeleteBucketReplicationOutcome S3Client::DeleteBucketReplication(const DeleteBucketReplicationRequest& request) const
@@ -436,14 +525,7 @@ DeleteBucketReplicationOutcome S3Client::DeleteBucketReplication(const DeleteBuc
   ss << request.GetBucket();
   ss << "?replication";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
-  if(outcome.IsSuccess())
-  {
-    return DeleteBucketReplicationOutcome(NoResult());
-  }
-  else
-  {
-    return DeleteBucketReplicationOutcome(outcome.GetError());
-  }
+  return BuildDeleteBucketReplicationOutcome(outcome);
 }
 
 DeleteBucketReplicationOutcomeCallable S3Client::DeleteBucketReplicationCallable(const DeleteBucketReplicationRequest& request) const
@@ -453,12 +535,27 @@ DeleteBucketReplicationOutcomeCallable S3Client::DeleteBucketReplicationCallable
 
 void S3Client::DeleteBucketReplicationAsync(const DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketReplicationAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?replication";
+  auto requestCopy = Aws::MakeShared<DeleteBucketReplicationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_DELETE, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDeleteBucketReplicationOutcome(outcome), context);
+  });
 }
 
-void S3Client::DeleteBucketReplicationAsyncHelper(const DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static DeleteBucketTaggingOutcome BuildDeleteBucketTaggingOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, DeleteBucketReplication(request), context);
+  if(outcome.IsSuccess())
+  {
+    return DeleteBucketTaggingOutcome(NoResult());
+  }
+  else
+  {
+    return DeleteBucketTaggingOutcome(outcome.GetError());
+  }
 }
 
 DeleteBucketTaggingOutcome S3Client::DeleteBucketTagging(const DeleteBucketTaggingRequest& request) const
@@ -468,14 +565,7 @@ DeleteBucketTaggingOutcome S3Client::DeleteBucketTagging(const DeleteBucketTaggi
   ss << request.GetBucket();
   ss << "?tagging";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
-  if(outcome.IsSuccess())
-  {
-    return DeleteBucketTaggingOutcome(NoResult());
-  }
-  else
-  {
-    return DeleteBucketTaggingOutcome(outcome.GetError());
-  }
+  return BuildDeleteBucketTaggingOutcome(outcome);
 }
 
 DeleteBucketTaggingOutcomeCallable S3Client::DeleteBucketTaggingCallable(const DeleteBucketTaggingRequest& request) const
@@ -485,12 +575,27 @@ DeleteBucketTaggingOutcomeCallable S3Client::DeleteBucketTaggingCallable(const D
 
 void S3Client::DeleteBucketTaggingAsync(const DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketTaggingAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?tagging";
+  auto requestCopy = Aws::MakeShared<DeleteBucketTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_DELETE, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDeleteBucketTaggingOutcome(outcome), context);
+  });
 }
 
-void S3Client::DeleteBucketTaggingAsyncHelper(const DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static DeleteBucketWebsiteOutcome BuildDeleteBucketWebsiteOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, DeleteBucketTagging(request), context);
+  if(outcome.IsSuccess())
+  {
+    return DeleteBucketWebsiteOutcome(NoResult());
+  }
+  else
+  {
+    return DeleteBucketWebsiteOutcome(outcome.GetError());
+  }
 }
 
 DeleteBucketWebsiteOutcome S3Client::DeleteBucketWebsite(const DeleteBucketWebsiteRequest& request) const
@@ -500,14 +605,7 @@ DeleteBucketWebsiteOutcome S3Client::DeleteBucketWebsite(const DeleteBucketWebsi
   ss << request.GetBucket();
   ss << "?website";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
-  if(outcome.IsSuccess())
-  {
-    return DeleteBucketWebsiteOutcome(NoResult());
-  }
-  else
-  {
-    return DeleteBucketWebsiteOutcome(outcome.GetError());
-  }
+  return BuildDeleteBucketWebsiteOutcome(outcome);
 }
 
 DeleteBucketWebsiteOutcomeCallable S3Client::DeleteBucketWebsiteCallable(const DeleteBucketWebsiteRequest& request) const
@@ -517,12 +615,27 @@ DeleteBucketWebsiteOutcomeCallable S3Client::DeleteBucketWebsiteCallable(const D
 
 void S3Client::DeleteBucketWebsiteAsync(const DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketWebsiteAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?website";
+  auto requestCopy = Aws::MakeShared<DeleteBucketWebsiteRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_DELETE, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDeleteBucketWebsiteOutcome(outcome), context);
+  });
 }
 
-void S3Client::DeleteBucketWebsiteAsyncHelper(const DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static DeleteObjectOutcome BuildDeleteObjectOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, DeleteBucketWebsite(request), context);
+  if(outcome.IsSuccess())
+  {
+    return DeleteObjectOutcome(DeleteObjectResult(outcome.GetResult()));
+  }
+  else
+  {
+    return DeleteObjectOutcome(outcome.GetError());
+  }
 }
 
 DeleteObjectOutcome S3Client::DeleteObject(const DeleteObjectRequest& request) const
@@ -533,14 +646,7 @@ DeleteObjectOutcome S3Client::DeleteObject(const DeleteObjectRequest& request) c
   ss << "/";
   ss << request.GetKey();
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
-  if(outcome.IsSuccess())
-  {
-    return DeleteObjectOutcome(DeleteObjectResult(outcome.GetResult()));
-  }
-  else
-  {
-    return DeleteObjectOutcome(outcome.GetError());
-  }
+  return BuildDeleteObjectOutcome(outcome);
 }
 
 DeleteObjectOutcomeCallable S3Client::DeleteObjectCallable(const DeleteObjectRequest& request) const
@@ -550,12 +656,28 @@ DeleteObjectOutcomeCallable S3Client::DeleteObjectCallable(const DeleteObjectReq
 
 void S3Client::DeleteObjectAsync(const DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteObjectAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto requestCopy = Aws::MakeShared<DeleteObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_DELETE, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDeleteObjectOutcome(outcome), context);
+  });
 }
 
-void S3Client::DeleteObjectAsyncHelper(const DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static DeleteObjectsOutcome BuildDeleteObjectsOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, DeleteObject(request), context);
+  if(outcome.IsSuccess())
+  {
+    return DeleteObjectsOutcome(DeleteObjectsResult(outcome.GetResult()));
+  }
+  else
+  {
+    return DeleteObjectsOutcome(outcome.GetError());
+  }
 }
 
 DeleteObjectsOutcome S3Client::DeleteObjects(const DeleteObjectsRequest& request) const
@@ -565,14 +687,7 @@ DeleteObjectsOutcome S3Client::DeleteObjects(const DeleteObjectsRequest& request
   ss << request.GetBucket();
   ss << "?delete";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
-  if(outcome.IsSuccess())
-  {
-    return DeleteObjectsOutcome(DeleteObjectsResult(outcome.GetResult()));
-  }
-  else
-  {
-    return DeleteObjectsOutcome(outcome.GetError());
-  }
+  return BuildDeleteObjectsOutcome(outcome);
 }
 
 DeleteObjectsOutcomeCallable S3Client::DeleteObjectsCallable(const DeleteObjectsRequest& request) const
@@ -582,12 +697,27 @@ DeleteObjectsOutcomeCallable S3Client::DeleteObjectsCallable(const DeleteObjects
 
 void S3Client::DeleteObjectsAsync(const DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteObjectsAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?delete";
+  auto requestCopy = Aws::MakeShared<DeleteObjectsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildDeleteObjectsOutcome(outcome), context);
+  });
 }
 
-void S3Client::DeleteObjectsAsyncHelper(const DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetBucketAclOutcome BuildGetBucketAclOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, DeleteObjects(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetBucketAclOutcome(GetBucketAclResult(outcome.GetResult()));
+  }
+  else
+  {
+    return GetBucketAclOutcome(outcome.GetError());
+  }
 }
 
 GetBucketAclOutcome S3Client::GetBucketAcl(const GetBucketAclRequest& request) const
@@ -597,14 +727,7 @@ GetBucketAclOutcome S3Client::GetBucketAcl(const GetBucketAclRequest& request) c
   ss << request.GetBucket();
   ss << "?acl";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetBucketAclOutcome(GetBucketAclResult(outcome.GetResult()));
-  }
-  else
-  {
-    return GetBucketAclOutcome(outcome.GetError());
-  }
+  return BuildGetBucketAclOutcome(outcome);
 }
 
 GetBucketAclOutcomeCallable S3Client::GetBucketAclCallable(const GetBucketAclRequest& request) const
@@ -613,22 +736,20 @@ GetBucketAclOutcomeCallable S3Client::GetBucketAclCallable(const GetBucketAclReq
 }
 
 void S3Client::GetBucketAclAsync(const GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&S3Client::GetBucketAclAsyncHelper, this, request, handler, context);
-}
-
-void S3Client::GetBucketAclAsyncHelper(const GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetBucketAcl(request), context);
-}
-
-GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
-  ss << "?cors";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  ss << "?acl";
+  auto requestCopy = Aws::MakeShared<GetBucketAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketAclOutcome(outcome), context);
+  });
+}
+
+static GetBucketCorsOutcome BuildGetBucketCorsOutcome(XmlOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return GetBucketCorsOutcome(GetBucketCorsResult(outcome.GetResult()));
@@ -639,28 +760,36 @@ GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request
   }
 }
 
-GetBucketCorsOutcomeCallable S3Client::GetBucketCorsCallable(const GetBucketCorsRequest& request) const
-{
-  return std::async(std::launch::async, &S3Client::GetBucketCors, this, request);
-}
-
-void S3Client::GetBucketCorsAsync(const GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request) const
 {
-  m_executor->Submit(&S3Client::GetBucketCorsAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?cors";
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  return BuildGetBucketCorsOutcome(outcome);
 }
 
-void S3Client::GetBucketCorsAsyncHelper(const GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+GetBucketCorsOutcomeCallable S3Client::GetBucketCorsCallable(const GetBucketCorsRequest& request) const
 {
-  handler(this, request, GetBucketCors(request), context);
+  return std::async(std::launch::async, &S3Client::GetBucketCors, this, request);
 }
 
-GetBucketLifecycleOutcome S3Client::GetBucketLifecycle(const GetBucketLifecycleRequest& request) const
+void S3Client::GetBucketCorsAsync(const GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
-  ss << "?lifecycle";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  ss << "?cors";
+  auto requestCopy = Aws::MakeShared<GetBucketCorsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketCorsOutcome(outcome), context);
+  });
+}
+
+static GetBucketLifecycleOutcome BuildGetBucketLifecycleOutcome(XmlOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return GetBucketLifecycleOutcome(GetBucketLifecycleResult(outcome.GetResult()));
@@ -671,6 +800,16 @@ GetBucketLifecycleOutcome S3Client::GetBucketLifecycle(const GetBucketLifecycleR
   }
 }
 
+GetBucketLifecycleOutcome S3Client::GetBucketLifecycle(const GetBucketLifecycleRequest& request) const
+{
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?lifecycle";
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  return BuildGetBucketLifecycleOutcome(outcome);
+}
+
 GetBucketLifecycleOutcomeCallable S3Client::GetBucketLifecycleCallable(const GetBucketLifecycleRequest& request) const
 {
   return std::async(std::launch::async, &S3Client::GetBucketLifecycle, this, request);
@@ -678,12 +817,27 @@ GetBucketLifecycleOutcomeCallable S3Client::GetBucketLifecycleCallable(const Get
 
 void S3Client::GetBucketLifecycleAsync(const GetBucketLifecycleRequest& request, const GetBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketLifecycleAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?lifecycle";
+  auto requestCopy = Aws::MakeShared<GetBucketLifecycleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketLifecycleOutcome(outcome), context);
+  });
 }
 
-void S3Client::GetBucketLifecycleAsyncHelper(const GetBucketLifecycleRequest& request, const GetBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetBucketLocationOutcome BuildGetBucketLocationOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, GetBucketLifecycle(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetBucketLocationOutcome(GetBucketLocationResult(outcome.GetResult()));
+  }
+  else
+  {
+    return GetBucketLocationOutcome(outcome.GetError());
+  }
 }
 
 GetBucketLocationOutcome S3Client::GetBucketLocation(const GetBucketLocationRequest& request) const
@@ -693,14 +847,7 @@ GetBucketLocationOutcome S3Client::GetBucketLocation(const GetBucketLocationRequ
   ss << request.GetBucket();
   ss << "?location";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetBucketLocationOutcome(GetBucketLocationResult(outcome.GetResult()));
-  }
-  else
-  {
-    return GetBucketLocationOutcome(outcome.GetError());
-  }
+  return BuildGetBucketLocationOutcome(outcome);
 }
 
 GetBucketLocationOutcomeCallable S3Client::GetBucketLocationCallable(const GetBucketLocationRequest& request) const
@@ -710,12 +857,27 @@ GetBucketLocationOutcomeCallable S3Client::GetBucketLocationCallable(const GetBu
 
 void S3Client::GetBucketLocationAsync(const GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketLocationAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?location";
+  auto requestCopy = Aws::MakeShared<GetBucketLocationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketLocationOutcome(outcome), context);
+  });
 }
 
-void S3Client::GetBucketLocationAsyncHelper(const GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetBucketLoggingOutcome BuildGetBucketLoggingOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, GetBucketLocation(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetBucketLoggingOutcome(GetBucketLoggingResult(outcome.GetResult()));
+  }
+  else
+  {
+    return GetBucketLoggingOutcome(outcome.GetError());
+  }
 }
 
 GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest& request) const
@@ -725,14 +887,7 @@ GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest
   ss << request.GetBucket();
   ss << "?logging";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetBucketLoggingOutcome(GetBucketLoggingResult(outcome.GetResult()));
-  }
-  else
-  {
-    return GetBucketLoggingOutcome(outcome.GetError());
-  }
+  return BuildGetBucketLoggingOutcome(outcome);
 }
 
 GetBucketLoggingOutcomeCallable S3Client::GetBucketLoggingCallable(const GetBucketLoggingRequest& request) const
@@ -742,12 +897,27 @@ GetBucketLoggingOutcomeCallable S3Client::GetBucketLoggingCallable(const GetBuck
 
 void S3Client::GetBucketLoggingAsync(const GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketLoggingAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?logging";
+  auto requestCopy = Aws::MakeShared<GetBucketLoggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketLoggingOutcome(outcome), context);
+  });
 }
 
-void S3Client::GetBucketLoggingAsyncHelper(const GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetBucketNotificationConfigurationOutcome BuildGetBucketNotificationConfigurationOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, GetBucketLogging(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetBucketNotificationConfigurationOutcome(GetBucketNotificationConfigurationResult(outcome.GetResult()));
+  }
+  else
+  {
+    return GetBucketNotificationConfigurationOutcome(outcome.GetError());
+  }
 }
 
 GetBucketNotificationConfigurationOutcome S3Client::GetBucketNotificationConfiguration(const GetBucketNotificationConfigurationRequest& request) const
@@ -757,14 +927,7 @@ GetBucketNotificationConfigurationOutcome S3Client::GetBucketNotificationConfigu
   ss << request.GetBucket();
   ss << "?notification";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetBucketNotificationConfigurationOutcome(GetBucketNotificationConfigurationResult(outcome.GetResult()));
-  }
-  else
-  {
-    return GetBucketNotificationConfigurationOutcome(outcome.GetError());
-  }
+  return BuildGetBucketNotificationConfigurationOutcome(outcome);
 }
 
 GetBucketNotificationConfigurationOutcomeCallable S3Client::GetBucketNotificationConfigurationCallable(const GetBucketNotificationConfigurationRequest& request) const
@@ -774,12 +937,27 @@ GetBucketNotificationConfigurationOutcomeCallable S3Client::GetBucketNotificatio
 
 void S3Client::GetBucketNotificationConfigurationAsync(const GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketNotificationConfigurationAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?notification";
+  auto requestCopy = Aws::MakeShared<GetBucketNotificationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketNotificationConfigurationOutcome(outcome), context);
+  });
 }
 
-void S3Client::GetBucketNotificationConfigurationAsyncHelper(const GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetBucketPolicyOutcome BuildGetBucketPolicyOutcome(StreamOutcome& outcome)
 {
-  handler(this, request, GetBucketNotificationConfiguration(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetBucketPolicyOutcome(GetBucketPolicyResult(outcome.GetResultWithOwnership()));
+  }
+  else
+  {
+    return GetBucketPolicyOutcome(outcome.GetError());
+  }
 }
 
 GetBucketPolicyOutcome S3Client::GetBucketPolicy(const GetBucketPolicyRequest& request) const
@@ -789,14 +967,7 @@ GetBucketPolicyOutcome S3Client::GetBucketPolicy(const GetBucketPolicyRequest& r
   ss << request.GetBucket();
   ss << "?policy";
   StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetBucketPolicyOutcome(GetBucketPolicyResult(outcome.GetResultWithOwnership()));
-  }
-  else
-  {
-    return GetBucketPolicyOutcome(outcome.GetError());
-  }
+  return BuildGetBucketPolicyOutcome(outcome);
 }
 
 GetBucketPolicyOutcomeCallable S3Client::GetBucketPolicyCallable(const GetBucketPolicyRequest& request) const
@@ -806,12 +977,27 @@ GetBucketPolicyOutcomeCallable S3Client::GetBucketPolicyCallable(const GetBucket
 
 void S3Client::GetBucketPolicyAsync(const GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketPolicyAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?policy";
+  auto requestCopy = Aws::MakeShared<GetBucketPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](StreamOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketPolicyOutcome(outcome), context);
+  });
 }
 
-void S3Client::GetBucketPolicyAsyncHelper(const GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetBucketReplicationOutcome BuildGetBucketReplicationOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, GetBucketPolicy(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetBucketReplicationOutcome(GetBucketReplicationResult(outcome.GetResult()));
+  }
+  else
+  {
+    return GetBucketReplicationOutcome(outcome.GetError());
+  }
 }
 
 GetBucketReplicationOutcome S3Client::GetBucketReplication(const GetBucketReplicationRequest& request) const
@@ -821,14 +1007,7 @@ GetBucketReplicationOutcome S3Client::GetBucketReplication(const GetBucketReplic
   ss << request.GetBucket();
   ss << "?replication";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetBucketReplicationOutcome(GetBucketReplicationResult(outcome.GetResult()));
-  }
-  else
-  {
-    return GetBucketReplicationOutcome(outcome.GetError());
-  }
+  return BuildGetBucketReplicationOutcome(outcome);
 }
 
 GetBucketReplicationOutcomeCallable S3Client::GetBucketReplicationCallable(const GetBucketReplicationRequest& request) const
@@ -838,12 +1017,27 @@ GetBucketReplicationOutcomeCallable S3Client::GetBucketReplicationCallable(const
 
 void S3Client::GetBucketReplicationAsync(const GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketReplicationAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?replication";
+  auto requestCopy = Aws::MakeShared<GetBucketReplicationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketReplicationOutcome(outcome), context);
+  });
 }
 
-void S3Client::GetBucketReplicationAsyncHelper(const GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetBucketRequestPaymentOutcome BuildGetBucketRequestPaymentOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, GetBucketReplication(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetBucketRequestPaymentOutcome(GetBucketRequestPaymentResult(outcome.GetResult()));
+  }
+  else
+  {
+    return GetBucketRequestPaymentOutcome(outcome.GetError());
+  }
 }
 
 GetBucketRequestPaymentOutcome S3Client::GetBucketRequestPayment(const GetBucketRequestPaymentRequest& request) const
@@ -853,14 +1047,7 @@ GetBucketRequestPaymentOutcome S3Client::GetBucketRequestPayment(const GetBucket
   ss << request.GetBucket();
   ss << "?requestPayment";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetBucketRequestPaymentOutcome(GetBucketRequestPaymentResult(outcome.GetResult()));
-  }
-  else
-  {
-    return GetBucketRequestPaymentOutcome(outcome.GetError());
-  }
+  return BuildGetBucketRequestPaymentOutcome(outcome);
 }
 
 GetBucketRequestPaymentOutcomeCallable S3Client::GetBucketRequestPaymentCallable(const GetBucketRequestPaymentRequest& request) const
@@ -870,12 +1057,27 @@ GetBucketRequestPaymentOutcomeCallable S3Client::GetBucketRequestPaymentCallable
 
 void S3Client::GetBucketRequestPaymentAsync(const GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketRequestPaymentAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?requestPayment";
+  auto requestCopy = Aws::MakeShared<GetBucketRequestPaymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketRequestPaymentOutcome(outcome), context);
+  });
 }
 
-void S3Client::GetBucketRequestPaymentAsyncHelper(const GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetBucketTaggingOutcome BuildGetBucketTaggingOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, GetBucketRequestPayment(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetBucketTaggingOutcome(GetBucketTaggingResult(outcome.GetResult()));
+  }
+  else
+  {
+    return GetBucketTaggingOutcome(outcome.GetError());
+  }
 }
 
 GetBucketTaggingOutcome S3Client::GetBucketTagging(const GetBucketTaggingRequest& request) const
@@ -885,14 +1087,7 @@ GetBucketTaggingOutcome S3Client::GetBucketTagging(const GetBucketTaggingRequest
   ss << request.GetBucket();
   ss << "?tagging";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetBucketTaggingOutcome(GetBucketTaggingResult(outcome.GetResult()));
-  }
-  else
-  {
-    return GetBucketTaggingOutcome(outcome.GetError());
-  }
+  return BuildGetBucketTaggingOutcome(outcome);
 }
 
 GetBucketTaggingOutcomeCallable S3Client::GetBucketTaggingCallable(const GetBucketTaggingRequest& request) const
@@ -902,12 +1097,27 @@ GetBucketTaggingOutcomeCallable S3Client::GetBucketTaggingCallable(const GetBuck
 
 void S3Client::GetBucketTaggingAsync(const GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketTaggingAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?tagging";
+  auto requestCopy = Aws::MakeShared<GetBucketTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketTaggingOutcome(outcome), context);
+  });
 }
 
-void S3Client::GetBucketTaggingAsyncHelper(const GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetBucketVersioningOutcome BuildGetBucketVersioningOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, GetBucketTagging(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetBucketVersioningOutcome(GetBucketVersioningResult(outcome.GetResult()));
+  }
+  else
+  {
+    return GetBucketVersioningOutcome(outcome.GetError());
+  }
 }
 
 GetBucketVersioningOutcome S3Client::GetBucketVersioning(const GetBucketVersioningRequest& request) const
@@ -917,14 +1127,7 @@ GetBucketVersioningOutcome S3Client::GetBucketVersioning(const GetBucketVersioni
   ss << request.GetBucket();
   ss << "?versioning";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetBucketVersioningOutcome(GetBucketVersioningResult(outcome.GetResult()));
-  }
-  else
-  {
-    return GetBucketVersioningOutcome(outcome.GetError());
-  }
+  return BuildGetBucketVersioningOutcome(outcome);
 }
 
 GetBucketVersioningOutcomeCallable S3Client::GetBucketVersioningCallable(const GetBucketVersioningRequest& request) const
@@ -934,12 +1137,27 @@ GetBucketVersioningOutcomeCallable S3Client::GetBucketVersioningCallable(const G
 
 void S3Client::GetBucketVersioningAsync(const GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketVersioningAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?versioning";
+  auto requestCopy = Aws::MakeShared<GetBucketVersioningRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketVersioningOutcome(outcome), context);
+  });
 }
 
-void S3Client::GetBucketVersioningAsyncHelper(const GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetBucketWebsiteOutcome BuildGetBucketWebsiteOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, GetBucketVersioning(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetBucketWebsiteOutcome(GetBucketWebsiteResult(outcome.GetResult()));
+  }
+  else
+  {
+    return GetBucketWebsiteOutcome(outcome.GetError());
+  }
 }
 
 GetBucketWebsiteOutcome S3Client::GetBucketWebsite(const GetBucketWebsiteRequest& request) const
@@ -949,14 +1167,7 @@ GetBucketWebsiteOutcome S3Client::GetBucketWebsite(const GetBucketWebsiteRequest
   ss << request.GetBucket();
   ss << "?website";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetBucketWebsiteOutcome(GetBucketWebsiteResult(outcome.GetResult()));
-  }
-  else
-  {
-    return GetBucketWebsiteOutcome(outcome.GetError());
-  }
+  return BuildGetBucketWebsiteOutcome(outcome);
 }
 
 GetBucketWebsiteOutcomeCallable S3Client::GetBucketWebsiteCallable(const GetBucketWebsiteRequest& request) const
@@ -966,12 +1177,27 @@ GetBucketWebsiteOutcomeCallable S3Client::GetBucketWebsiteCallable(const GetBuck
 
 void S3Client::GetBucketWebsiteAsync(const GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketWebsiteAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?website";
+  auto requestCopy = Aws::MakeShared<GetBucketWebsiteRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetBucketWebsiteOutcome(outcome), context);
+  });
 }
 
-void S3Client::GetBucketWebsiteAsyncHelper(const GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetObjectOutcome BuildGetObjectOutcome(StreamOutcome& outcome)
 {
-  handler(this, request, GetBucketWebsite(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetObjectOutcome(GetObjectResult(outcome.GetResultWithOwnership()));
+  }
+  else
+  {
+    return GetObjectOutcome(outcome.GetError());
+  }
 }
 
 GetObjectOutcome S3Client::GetObject(const GetObjectRequest& request) const
@@ -982,14 +1208,7 @@ GetObjectOutcome S3Client::GetObject(const GetObjectRequest& request) const
   ss << "/";
   ss << request.GetKey();
   StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetObjectOutcome(GetObjectResult(outcome.GetResultWithOwnership()));
-  }
-  else
-  {
-    return GetObjectOutcome(outcome.GetError());
-  }
+  return BuildGetObjectOutcome(outcome);
 }
 
 GetObjectOutcomeCallable S3Client::GetObjectCallable(const GetObjectRequest& request) const
@@ -999,12 +1218,28 @@ GetObjectOutcomeCallable S3Client::GetObjectCallable(const GetObjectRequest& req
 
 void S3Client::GetObjectAsync(const GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetObjectAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto requestCopy = Aws::MakeShared<GetObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](StreamOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetObjectOutcome(outcome), context);
+  });
 }
 
-void S3Client::GetObjectAsyncHelper(const GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static GetObjectAclOutcome BuildGetObjectAclOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, GetObject(request), context);
+  if(outcome.IsSuccess())
+  {
+    return GetObjectAclOutcome(GetObjectAclResult(outcome.GetResult()));
+  }
+  else
+  {
+    return GetObjectAclOutcome(outcome.GetError());
+  }
 }
 
 GetObjectAclOutcome S3Client::GetObjectAcl(const GetObjectAclRequest& request) const
@@ -1016,14 +1251,7 @@ GetObjectAclOutcome S3Client::GetObjectAcl(const GetObjectAclRequest& request) c
   ss << request.GetKey();
   ss << "?acl";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return GetObjectAclOutcome(GetObjectAclResult(outcome.GetResult()));
-  }
-  else
-  {
-    return GetObjectAclOutcome(outcome.GetError());
-  }
+  return BuildGetObjectAclOutcome(outcome);
 }
 
 GetObjectAclOutcomeCallable S3Client::GetObjectAclCallable(const GetObjectAclRequest& request) const
@@ -1032,24 +1260,22 @@ GetObjectAclOutcomeCallable S3Client::GetObjectAclCallable(const GetObjectAclReq
 }
 
 void S3Client::GetObjectAclAsync(const GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&S3Client::GetObjectAclAsyncHelper, this, request, handler, context);
-}
-
-void S3Client::GetObjectAclAsyncHelper(const GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetObjectAcl(request), context);
-}
-
-GetObjectTorrentOutcome S3Client::GetObjectTorrent(const GetObjectTorrentRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  ss << "?torrent";
-  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
+  ss << "?acl";
+  auto requestCopy = Aws::MakeShared<GetObjectAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetObjectAclOutcome(outcome), context);
+  });
+}
+
+static GetObjectTorrentOutcome BuildGetObjectTorrentOutcome(StreamOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return GetObjectTorrentOutcome(GetObjectTorrentResult(outcome.GetResultWithOwnership()));
@@ -1060,27 +1286,40 @@ GetObjectTorrentOutcome S3Client::GetObjectTorrent(const GetObjectTorrentRequest
   }
 }
 
-GetObjectTorrentOutcomeCallable S3Client::GetObjectTorrentCallable(const GetObjectTorrentRequest& request) const
-{
-  return std::async(std::launch::async, &S3Client::GetObjectTorrent, this, request);
-}
-
-void S3Client::GetObjectTorrentAsync(const GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+GetObjectTorrentOutcome S3Client::GetObjectTorrent(const GetObjectTorrentRequest& request) const
 {
-  m_executor->Submit(&S3Client::GetObjectTorrentAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  ss << "?torrent";
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
+  return BuildGetObjectTorrentOutcome(outcome);
 }
 
-void S3Client::GetObjectTorrentAsyncHelper(const GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+GetObjectTorrentOutcomeCallable S3Client::GetObjectTorrentCallable(const GetObjectTorrentRequest& request) const
 {
-  handler(this, request, GetObjectTorrent(request), context);
+  return std::async(std::launch::async, &S3Client::GetObjectTorrent, this, request);
 }
 
-HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
+void S3Client::GetObjectTorrentAsync(const GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_HEAD);
+  ss << "/";
+  ss << request.GetKey();
+  ss << "?torrent";
+  auto requestCopy = Aws::MakeShared<GetObjectTorrentRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](StreamOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildGetObjectTorrentOutcome(outcome), context);
+  });
+}
+
+static HeadBucketOutcome BuildHeadBucketOutcome(XmlOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return HeadBucketOutcome(NoResult());
@@ -1091,6 +1330,15 @@ HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
   }
 }
 
+HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
+{
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_HEAD);
+  return BuildHeadBucketOutcome(outcome);
+}
+
 HeadBucketOutcomeCallable S3Client::HeadBucketCallable(const HeadBucketRequest& request) const
 {
   return std::async(std::launch::async, &S3Client::HeadBucket, this, request);
@@ -1098,12 +1346,26 @@ HeadBucketOutcomeCallable S3Client::HeadBucketCallable(const HeadBucketRequest&
 
 void S3Client::HeadBucketAsync(const HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::HeadBucketAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  auto requestCopy = Aws::MakeShared<HeadBucketRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_HEAD, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildHeadBucketOutcome(outcome), context);
+  });
 }
 
-void S3Client::HeadBucketAsyncHelper(const HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static HeadObjectOutcome BuildHeadObjectOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, HeadBucket(request), context);
+  if(outcome.IsSuccess())
+  {
+    return HeadObjectOutcome(HeadObjectResult(outcome.GetResult()));
+  }
+  else
+  {
+    return HeadObjectOutcome(outcome.GetError());
+  }
 }
 
 HeadObjectOutcome S3Client::HeadObject(const HeadObjectRequest& request) const
@@ -1114,14 +1376,7 @@ HeadObjectOutcome S3Client::HeadObject(const HeadObjectRequest& request) const
   ss << "/";
   ss << request.GetKey();
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_HEAD);
-  if(outcome.IsSuccess())
-  {
-    return HeadObjectOutcome(HeadObjectResult(outcome.GetResult()));
-  }
-  else
-  {
-    return HeadObjectOutcome(outcome.GetError());
-  }
+  return BuildHeadObjectOutcome(outcome);
 }
 
 HeadObjectOutcomeCallable S3Client::HeadObjectCallable(const HeadObjectRequest& request) const
@@ -1131,19 +1386,20 @@ HeadObjectOutcomeCallable S3Client::HeadObjectCallable(const HeadObjectRequest&
 
 void S3Client::HeadObjectAsync(const HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::HeadObjectAsyncHelper, this, request, handler, context);
-}
-
-void S3Client::HeadObjectAsyncHelper(const HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, HeadObject(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto requestCopy = Aws::MakeShared<HeadObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_HEAD, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildHeadObjectOutcome(outcome), context);
+  });
 }
 
-ListBucketsOutcome S3Client::ListBuckets() const
+static ListBucketsOutcome BuildListBucketsOutcome(XmlOutcome& outcome)
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListBucketsOutcome(ListBucketsResult(outcome.GetResult()));
@@ -1154,6 +1410,14 @@ ListBucketsOutcome S3Client::ListBuckets() const
   }
 }
 
+ListBucketsOutcome S3Client::ListBuckets() const
+{
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  XmlOutcome outcome = MakeRequest(ss.str(), HttpMethod::HTTP_GET, "ListBuckets");
+  return BuildListBucketsOutcome(outcome);
+}
+
 ListBucketsOutcomeCallable S3Client::ListBucketsCallable() const
 {
   return std::async(std::launch::async, &S3Client::ListBuckets, this);
@@ -1161,12 +1425,24 @@ ListBucketsOutcomeCallable S3Client::ListBucketsCallable() const
 
 void S3Client::ListBucketsAsync(const ListBucketsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListBucketsAsyncHelper, this, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  MakeRequestAsync(ss.str(), HttpMethod::HTTP_GET, [this, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, BuildListBucketsOutcome(outcome), context);
+  }, "ListBuckets");
 }
 
-void S3Client::ListBucketsAsyncHelper(const ListBucketsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static ListMultipartUploadsOutcome BuildListMultipartUploadsOutcome(XmlOutcome& outcome)
 {
-  handler(this, ListBuckets(), context);
+  if(outcome.IsSuccess())
+  {
+    return ListMultipartUploadsOutcome(ListMultipartUploadsResult(outcome.GetResult()));
+  }
+  else
+  {
+    return ListMultipartUploadsOutcome(outcome.GetError());
+  }
 }
 
 ListMultipartUploadsOutcome S3Client::ListMultipartUploads(const ListMultipartUploadsRequest& request) const
@@ -1176,14 +1452,7 @@ ListMultipartUploadsOutcome S3Client::ListMultipartUploads(const ListMultipartUp
   ss << request.GetBucket();
   ss << "?uploads";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return ListMultipartUploadsOutcome(ListMultipartUploadsResult(outcome.GetResult()));
-  }
-  else
-  {
-    return ListMultipartUploadsOutcome(outcome.GetError());
-  }
+  return BuildListMultipartUploadsOutcome(outcome);
 }
 
 ListMultipartUploadsOutcomeCallable S3Client::ListMultipartUploadsCallable(const ListMultipartUploadsRequest& request) const
@@ -1193,12 +1462,27 @@ ListMultipartUploadsOutcomeCallable S3Client::ListMultipartUploadsCallable(const
 
 void S3Client::ListMultipartUploadsAsync(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListMultipartUploadsAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?uploads";
+  auto requestCopy = Aws::MakeShared<ListMultipartUploadsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildListMultipartUploadsOutcome(outcome), context);
+  });
 }
 
-void S3Client::ListMultipartUploadsAsyncHelper(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static ListObjectVersionsOutcome BuildListObjectVersionsOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, ListMultipartUploads(request), context);
+  if(outcome.IsSuccess())
+  {
+    return ListObjectVersionsOutcome(ListObjectVersionsResult(outcome.GetResult()));
+  }
+  else
+  {
+    return ListObjectVersionsOutcome(outcome.GetError());
+  }
 }
 
 ListObjectVersionsOutcome S3Client::ListObjectVersions(const ListObjectVersionsRequest& request) const
@@ -1208,14 +1492,7 @@ ListObjectVersionsOutcome S3Client::ListObjectVersions(const ListObjectVersionsR
   ss << request.GetBucket();
   ss << "?versions";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return ListObjectVersionsOutcome(ListObjectVersionsResult(outcome.GetResult()));
-  }
-  else
-  {
-    return ListObjectVersionsOutcome(outcome.GetError());
-  }
+  return BuildListObjectVersionsOutcome(outcome);
 }
 
 ListObjectVersionsOutcomeCallable S3Client::ListObjectVersionsCallable(const ListObjectVersionsRequest& request) const
@@ -1224,24 +1501,29 @@ ListObjectVersionsOutcomeCallable S3Client::ListObjectVersionsCallable(const Lis
 }
 
 void S3Client::ListObjectVersionsAsync(const ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&S3Client::ListObjectVersionsAsyncHelper, this, request, handler, context);
-}
-
-void S3Client::ListObjectVersionsAsyncHelper(const ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ListObjectVersions(request), context);
-}
-
-ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  ss << "?versions";
+  auto requestCopy = Aws::MakeShared<ListObjectVersionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildListObjectVersionsOutcome(outcome), context);
+  });
+}
+
+static ListObjectsOutcome BuildListObjectsOutcome(StreamOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
-    return ListObjectsOutcome(ListObjectsResult(outcome.GetResult()));
+    XmlReader xmlReader(outcome.GetResult().GetPayload().GetUnderlyingStream());
+    ListObjectsResult result(xmlReader);
+    if(!xmlReader.WasParseSuccessful())
+    {
+      return ListObjectsOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Xml Parse Error", xmlReader.GetErrorMessage(), false));
+    }
+    return ListObjectsOutcome(std::move(result));
   }
   else
   {
@@ -1249,6 +1531,16 @@ ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) cons
   }
 }
 
+ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) const
+{
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  //listings are read straight off the body instead of through an XmlDocument; a page can hold 1000 keys.
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
+  return BuildListObjectsOutcome(outcome);
+}
+
 ListObjectsOutcomeCallable S3Client::ListObjectsCallable(const ListObjectsRequest& request) const
 {
   return std::async(std::launch::async, &S3Client::ListObjects, this, request);
@@ -1256,12 +1548,26 @@ ListObjectsOutcomeCallable S3Client::ListObjectsCallable(const ListObjectsReques
 
 void S3Client::ListObjectsAsync(const ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListObjectsAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  auto requestCopy = Aws::MakeShared<ListObjectsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](StreamOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildListObjectsOutcome(outcome), context);
+  });
 }
 
-void S3Client::ListObjectsAsyncHelper(const ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static ListPartsOutcome BuildListPartsOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, ListObjects(request), context);
+  if(outcome.IsSuccess())
+  {
+    return ListPartsOutcome(ListPartsResult(outcome.GetResult()));
+  }
+  else
+  {
+    return ListPartsOutcome(outcome.GetError());
+  }
 }
 
 ListPartsOutcome S3Client::ListParts(const ListPartsRequest& request) const
@@ -1272,14 +1578,7 @@ ListPartsOutcome S3Client::ListParts(const ListPartsRequest& request) const
   ss << "/";
   ss << request.GetKey();
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
-  if(outcome.IsSuccess())
-  {
-    return ListPartsOutcome(ListPartsResult(outcome.GetResult()));
-  }
-  else
-  {
-    return ListPartsOutcome(outcome.GetError());
-  }
+  return BuildListPartsOutcome(outcome);
 }
 
 ListPartsOutcomeCallable S3Client::ListPartsCallable(const ListPartsRequest& request) const
@@ -1289,12 +1588,28 @@ ListPartsOutcomeCallable S3Client::ListPartsCallable(const ListPartsRequest& req
 
 void S3Client::ListPartsAsync(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListPartsAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto requestCopy = Aws::MakeShared<ListPartsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_GET, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildListPartsOutcome(outcome), context);
+  });
 }
 
-void S3Client::ListPartsAsyncHelper(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutBucketAclOutcome BuildPutBucketAclOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, ListParts(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutBucketAclOutcome(NoResult());
+  }
+  else
+  {
+    return PutBucketAclOutcome(outcome.GetError());
+  }
 }
 
 PutBucketAclOutcome S3Client::PutBucketAcl(const PutBucketAclRequest& request) const
@@ -1304,14 +1619,7 @@ PutBucketAclOutcome S3Client::PutBucketAcl(const PutBucketAclRequest& request) c
   ss << request.GetBucket();
   ss << "?acl";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutBucketAclOutcome(NoResult());
-  }
-  else
-  {
-    return PutBucketAclOutcome(outcome.GetError());
-  }
+  return BuildPutBucketAclOutcome(outcome);
 }
 
 PutBucketAclOutcomeCallable S3Client::PutBucketAclCallable(const PutBucketAclRequest& request) const
@@ -1321,12 +1629,27 @@ PutBucketAclOutcomeCallable S3Client::PutBucketAclCallable(const PutBucketAclReq
 
 void S3Client::PutBucketAclAsync(const PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketAclAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?acl";
+  auto requestCopy = Aws::MakeShared<PutBucketAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutBucketAclOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutBucketAclAsyncHelper(const PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutBucketCorsOutcome BuildPutBucketCorsOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutBucketAcl(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutBucketCorsOutcome(NoResult());
+  }
+  else
+  {
+    return PutBucketCorsOutcome(outcome.GetError());
+  }
 }
 
 PutBucketCorsOutcome S3Client::PutBucketCors(const PutBucketCorsRequest& request) const
@@ -1336,14 +1659,7 @@ PutBucketCorsOutcome S3Client::PutBucketCors(const PutBucketCorsRequest& request
   ss << request.GetBucket();
   ss << "?cors";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutBucketCorsOutcome(NoResult());
-  }
-  else
-  {
-    return PutBucketCorsOutcome(outcome.GetError());
-  }
+  return BuildPutBucketCorsOutcome(outcome);
 }
 
 PutBucketCorsOutcomeCallable S3Client::PutBucketCorsCallable(const PutBucketCorsRequest& request) const
@@ -1353,12 +1669,27 @@ PutBucketCorsOutcomeCallable S3Client::PutBucketCorsCallable(const PutBucketCors
 
 void S3Client::PutBucketCorsAsync(const PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketCorsAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?cors";
+  auto requestCopy = Aws::MakeShared<PutBucketCorsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutBucketCorsOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutBucketCorsAsyncHelper(const PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutBucketLifecycleOutcome BuildPutBucketLifecycleOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutBucketCors(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutBucketLifecycleOutcome(NoResult());
+  }
+  else
+  {
+    return PutBucketLifecycleOutcome(outcome.GetError());
+  }
 }
 
 PutBucketLifecycleOutcome S3Client::PutBucketLifecycle(const PutBucketLifecycleRequest& request) const
@@ -1368,14 +1699,7 @@ PutBucketLifecycleOutcome S3Client::PutBucketLifecycle(const PutBucketLifecycleR
   ss << request.GetBucket();
   ss << "?lifecycle";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutBucketLifecycleOutcome(NoResult());
-  }
-  else
-  {
-    return PutBucketLifecycleOutcome(outcome.GetError());
-  }
+  return BuildPutBucketLifecycleOutcome(outcome);
 }
 
 PutBucketLifecycleOutcomeCallable S3Client::PutBucketLifecycleCallable(const PutBucketLifecycleRequest& request) const
@@ -1385,12 +1709,27 @@ PutBucketLifecycleOutcomeCallable S3Client::PutBucketLifecycleCallable(const Put
 
 void S3Client::PutBucketLifecycleAsync(const PutBucketLifecycleRequest& request, const PutBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketLifecycleAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?lifecycle";
+  auto requestCopy = Aws::MakeShared<PutBucketLifecycleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutBucketLifecycleOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutBucketLifecycleAsyncHelper(const PutBucketLifecycleRequest& request, const PutBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutBucketLoggingOutcome BuildPutBucketLoggingOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutBucketLifecycle(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutBucketLoggingOutcome(NoResult());
+  }
+  else
+  {
+    return PutBucketLoggingOutcome(outcome.GetError());
+  }
 }
 
 PutBucketLoggingOutcome S3Client::PutBucketLogging(const PutBucketLoggingRequest& request) const
@@ -1400,14 +1739,7 @@ PutBucketLoggingOutcome S3Client::PutBucketLogging(const PutBucketLoggingRequest
   ss << request.GetBucket();
   ss << "?logging";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutBucketLoggingOutcome(NoResult());
-  }
-  else
-  {
-    return PutBucketLoggingOutcome(outcome.GetError());
-  }
+  return BuildPutBucketLoggingOutcome(outcome);
 }
 
 PutBucketLoggingOutcomeCallable S3Client::PutBucketLoggingCallable(const PutBucketLoggingRequest& request) const
@@ -1417,12 +1749,27 @@ PutBucketLoggingOutcomeCallable S3Client::PutBucketLoggingCallable(const PutBuck
 
 void S3Client::PutBucketLoggingAsync(const PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketLoggingAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?logging";
+  auto requestCopy = Aws::MakeShared<PutBucketLoggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutBucketLoggingOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutBucketLoggingAsyncHelper(const PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutBucketNotificationConfigurationOutcome BuildPutBucketNotificationConfigurationOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutBucketLogging(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutBucketNotificationConfigurationOutcome(NoResult());
+  }
+  else
+  {
+    return PutBucketNotificationConfigurationOutcome(outcome.GetError());
+  }
 }
 
 PutBucketNotificationConfigurationOutcome S3Client::PutBucketNotificationConfiguration(const PutBucketNotificationConfigurationRequest& request) const
@@ -1432,14 +1779,7 @@ PutBucketNotificationConfigurationOutcome S3Client::PutBucketNotificationConfigu
   ss << request.GetBucket();
   ss << "?notification";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutBucketNotificationConfigurationOutcome(NoResult());
-  }
-  else
-  {
-    return PutBucketNotificationConfigurationOutcome(outcome.GetError());
-  }
+  return BuildPutBucketNotificationConfigurationOutcome(outcome);
 }
 
 PutBucketNotificationConfigurationOutcomeCallable S3Client::PutBucketNotificationConfigurationCallable(const PutBucketNotificationConfigurationRequest& request) const
@@ -1449,12 +1789,27 @@ PutBucketNotificationConfigurationOutcomeCallable S3Client::PutBucketNotificatio
 
 void S3Client::PutBucketNotificationConfigurationAsync(const PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketNotificationConfigurationAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?notification";
+  auto requestCopy = Aws::MakeShared<PutBucketNotificationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutBucketNotificationConfigurationOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutBucketNotificationConfigurationAsyncHelper(const PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutBucketPolicyOutcome BuildPutBucketPolicyOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutBucketNotificationConfiguration(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutBucketPolicyOutcome(NoResult());
+  }
+  else
+  {
+    return PutBucketPolicyOutcome(outcome.GetError());
+  }
 }
 
 PutBucketPolicyOutcome S3Client::PutBucketPolicy(const PutBucketPolicyRequest& request) const
@@ -1464,14 +1819,7 @@ PutBucketPolicyOutcome S3Client::PutBucketPolicy(const PutBucketPolicyRequest& r
   ss << request.GetBucket();
   ss << "?policy";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutBucketPolicyOutcome(NoResult());
-  }
-  else
-  {
-    return PutBucketPolicyOutcome(outcome.GetError());
-  }
+  return BuildPutBucketPolicyOutcome(outcome);
 }
 
 PutBucketPolicyOutcomeCallable S3Client::PutBucketPolicyCallable(const PutBucketPolicyRequest& request) const
@@ -1481,12 +1829,27 @@ PutBucketPolicyOutcomeCallable S3Client::PutBucketPolicyCallable(const PutBucket
 
 void S3Client::PutBucketPolicyAsync(const PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketPolicyAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?policy";
+  auto requestCopy = Aws::MakeShared<PutBucketPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutBucketPolicyOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutBucketPolicyAsyncHelper(const PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutBucketReplicationOutcome BuildPutBucketReplicationOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutBucketPolicy(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutBucketReplicationOutcome(NoResult());
+  }
+  else
+  {
+    return PutBucketReplicationOutcome(outcome.GetError());
+  }
 }
 
 PutBucketReplicationOutcome S3Client::PutBucketReplication(const PutBucketReplicationRequest& request) const
@@ -1496,14 +1859,7 @@ PutBucketReplicationOutcome S3Client::PutBucketReplication(const PutBucketReplic
   ss << request.GetBucket();
   ss << "?replication";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutBucketReplicationOutcome(NoResult());
-  }
-  else
-  {
-    return PutBucketReplicationOutcome(outcome.GetError());
-  }
+  return BuildPutBucketReplicationOutcome(outcome);
 }
 
 PutBucketReplicationOutcomeCallable S3Client::PutBucketReplicationCallable(const PutBucketReplicationRequest& request) const
@@ -1513,12 +1869,27 @@ PutBucketReplicationOutcomeCallable S3Client::PutBucketReplicationCallable(const
 
 void S3Client::PutBucketReplicationAsync(const PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketReplicationAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?replication";
+  auto requestCopy = Aws::MakeShared<PutBucketReplicationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutBucketReplicationOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutBucketReplicationAsyncHelper(const PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutBucketRequestPaymentOutcome BuildPutBucketRequestPaymentOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutBucketReplication(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutBucketRequestPaymentOutcome(NoResult());
+  }
+  else
+  {
+    return PutBucketRequestPaymentOutcome(outcome.GetError());
+  }
 }
 
 PutBucketRequestPaymentOutcome S3Client::PutBucketRequestPayment(const PutBucketRequestPaymentRequest& request) const
@@ -1528,14 +1899,7 @@ PutBucketRequestPaymentOutcome S3Client::PutBucketRequestPayment(const PutBucket
   ss << request.GetBucket();
   ss << "?requestPayment";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutBucketRequestPaymentOutcome(NoResult());
-  }
-  else
-  {
-    return PutBucketRequestPaymentOutcome(outcome.GetError());
-  }
+  return BuildPutBucketRequestPaymentOutcome(outcome);
 }
 
 PutBucketRequestPaymentOutcomeCallable S3Client::PutBucketRequestPaymentCallable(const PutBucketRequestPaymentRequest& request) const
@@ -1545,12 +1909,27 @@ PutBucketRequestPaymentOutcomeCallable S3Client::PutBucketRequestPaymentCallable
 
 void S3Client::PutBucketRequestPaymentAsync(const PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketRequestPaymentAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?requestPayment";
+  auto requestCopy = Aws::MakeShared<PutBucketRequestPaymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutBucketRequestPaymentOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutBucketRequestPaymentAsyncHelper(const PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutBucketTaggingOutcome BuildPutBucketTaggingOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutBucketRequestPayment(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutBucketTaggingOutcome(NoResult());
+  }
+  else
+  {
+    return PutBucketTaggingOutcome(outcome.GetError());
+  }
 }
 
 PutBucketTaggingOutcome S3Client::PutBucketTagging(const PutBucketTaggingRequest& request) const
@@ -1560,14 +1939,7 @@ PutBucketTaggingOutcome S3Client::PutBucketTagging(const PutBucketTaggingRequest
   ss << request.GetBucket();
   ss << "?tagging";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutBucketTaggingOutcome(NoResult());
-  }
-  else
-  {
-    return PutBucketTaggingOutcome(outcome.GetError());
-  }
+  return BuildPutBucketTaggingOutcome(outcome);
 }
 
 PutBucketTaggingOutcomeCallable S3Client::PutBucketTaggingCallable(const PutBucketTaggingRequest& request) const
@@ -1577,12 +1949,27 @@ PutBucketTaggingOutcomeCallable S3Client::PutBucketTaggingCallable(const PutBuck
 
 void S3Client::PutBucketTaggingAsync(const PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketTaggingAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?tagging";
+  auto requestCopy = Aws::MakeShared<PutBucketTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutBucketTaggingOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutBucketTaggingAsyncHelper(const PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutBucketVersioningOutcome BuildPutBucketVersioningOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutBucketTagging(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutBucketVersioningOutcome(NoResult());
+  }
+  else
+  {
+    return PutBucketVersioningOutcome(outcome.GetError());
+  }
 }
 
 PutBucketVersioningOutcome S3Client::PutBucketVersioning(const PutBucketVersioningRequest& request) const
@@ -1592,14 +1979,7 @@ PutBucketVersioningOutcome S3Client::PutBucketVersioning(const PutBucketVersioni
   ss << request.GetBucket();
   ss << "?versioning";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutBucketVersioningOutcome(NoResult());
-  }
-  else
-  {
-    return PutBucketVersioningOutcome(outcome.GetError());
-  }
+  return BuildPutBucketVersioningOutcome(outcome);
 }
 
 PutBucketVersioningOutcomeCallable S3Client::PutBucketVersioningCallable(const PutBucketVersioningRequest& request) const
@@ -1609,12 +1989,27 @@ PutBucketVersioningOutcomeCallable S3Client::PutBucketVersioningCallable(const P
 
 void S3Client::PutBucketVersioningAsync(const PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketVersioningAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?versioning";
+  auto requestCopy = Aws::MakeShared<PutBucketVersioningRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutBucketVersioningOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutBucketVersioningAsyncHelper(const PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutBucketWebsiteOutcome BuildPutBucketWebsiteOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutBucketVersioning(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutBucketWebsiteOutcome(NoResult());
+  }
+  else
+  {
+    return PutBucketWebsiteOutcome(outcome.GetError());
+  }
 }
 
 PutBucketWebsiteOutcome S3Client::PutBucketWebsite(const PutBucketWebsiteRequest& request) const
@@ -1624,14 +2019,7 @@ PutBucketWebsiteOutcome S3Client::PutBucketWebsite(const PutBucketWebsiteRequest
   ss << request.GetBucket();
   ss << "?website";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutBucketWebsiteOutcome(NoResult());
-  }
-  else
-  {
-    return PutBucketWebsiteOutcome(outcome.GetError());
-  }
+  return BuildPutBucketWebsiteOutcome(outcome);
 }
 
 PutBucketWebsiteOutcomeCallable S3Client::PutBucketWebsiteCallable(const PutBucketWebsiteRequest& request) const
@@ -1641,12 +2029,27 @@ PutBucketWebsiteOutcomeCallable S3Client::PutBucketWebsiteCallable(const PutBuck
 
 void S3Client::PutBucketWebsiteAsync(const PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketWebsiteAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?website";
+  auto requestCopy = Aws::MakeShared<PutBucketWebsiteRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutBucketWebsiteOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutBucketWebsiteAsyncHelper(const PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutObjectOutcome BuildPutObjectOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutBucketWebsite(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutObjectOutcome(PutObjectResult(outcome.GetResult()));
+  }
+  else
+  {
+    return PutObjectOutcome(outcome.GetError());
+  }
 }
 
 PutObjectOutcome S3Client::PutObject(const PutObjectRequest& request) const
@@ -1657,14 +2060,7 @@ PutObjectOutcome S3Client::PutObject(const PutObjectRequest& request) const
   ss << "/";
   ss << request.GetKey();
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutObjectOutcome(PutObjectResult(outcome.GetResult()));
-  }
-  else
-  {
-    return PutObjectOutcome(outcome.GetError());
-  }
+  return BuildPutObjectOutcome(outcome);
 }
 
 PutObjectOutcomeCallable S3Client::PutObjectCallable(const PutObjectRequest& request) const
@@ -1674,12 +2070,28 @@ PutObjectOutcomeCallable S3Client::PutObjectCallable(const PutObjectRequest& req
 
 void S3Client::PutObjectAsync(const PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutObjectAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto requestCopy = Aws::MakeShared<PutObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutObjectOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutObjectAsyncHelper(const PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static PutObjectAclOutcome BuildPutObjectAclOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutObject(request), context);
+  if(outcome.IsSuccess())
+  {
+    return PutObjectAclOutcome(PutObjectAclResult(outcome.GetResult()));
+  }
+  else
+  {
+    return PutObjectAclOutcome(outcome.GetError());
+  }
 }
 
 PutObjectAclOutcome S3Client::PutObjectAcl(const PutObjectAclRequest& request) const
@@ -1691,14 +2103,7 @@ PutObjectAclOutcome S3Client::PutObjectAcl(const PutObjectAclRequest& request) c
   ss << request.GetKey();
   ss << "?acl";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
-  if(outcome.IsSuccess())
-  {
-    return PutObjectAclOutcome(PutObjectAclResult(outcome.GetResult()));
-  }
-  else
-  {
-    return PutObjectAclOutcome(outcome.GetError());
-  }
+  return BuildPutObjectAclOutcome(outcome);
 }
 
 PutObjectAclOutcomeCallable S3Client::PutObjectAclCallable(const PutObjectAclRequest& request) const
@@ -1708,12 +2113,29 @@ PutObjectAclOutcomeCallable S3Client::PutObjectAclCallable(const PutObjectAclReq
 
 void S3Client::PutObjectAclAsync(const PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutObjectAclAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  ss << "?acl";
+  auto requestCopy = Aws::MakeShared<PutObjectAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildPutObjectAclOutcome(outcome), context);
+  });
 }
 
-void S3Client::PutObjectAclAsyncHelper(const PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+static RestoreObjectOutcome BuildRestoreObjectOutcome(XmlOutcome& outcome)
 {
-  handler(this, request, PutObjectAcl(request), context);
+  if(outcome.IsSuccess())
+  {
+    return RestoreObjectOutcome(RestoreObjectResult(outcome.GetResult()));
+  }
+  else
+  {
+    return RestoreObjectOutcome(outcome.GetError());
+  }
 }
 
 RestoreObjectOutcome S3Client::RestoreObject(const RestoreObjectRequest& request) const
@@ -1725,14 +2147,7 @@ RestoreObjectOutcome S3Client::RestoreObject(const RestoreObjectRequest& request
   ss << request.GetKey();
   ss << "?restore";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
-  if(outcome.IsSuccess())
-  {
-    return RestoreObjectOutcome(RestoreObjectResult(outcome.GetResult()));
-  }
-  else
-  {
-    return RestoreObjectOutcome(outcome.GetError());
-  }
+  return BuildRestoreObjectOutcome(outcome);
 }
 
 RestoreObjectOutcomeCallable S3Client::RestoreObjectCallable(const RestoreObjectRequest& request) const
@@ -1741,23 +2156,22 @@ RestoreObjectOutcomeCallable S3Client::RestoreObjectCallable(const RestoreObject
 }
 
 void S3Client::RestoreObjectAsync(const RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&S3Client::RestoreObjectAsyncHelper, this, request, handler, context);
-}
-
-void S3Client::RestoreObjectAsyncHelper(const RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, RestoreObject(request), context);
-}
-
-UploadPartOutcome S3Client::UploadPart(const UploadPartRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  ss << "?restore";
+  auto requestCopy = Aws::MakeShared<RestoreObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_POST, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildRestoreObjectOutcome(outcome), context);
+  });
+}
+
+static UploadPartOutcome BuildUploadPartOutcome(XmlOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return UploadPartOutcome(UploadPartResult(outcome.GetResult()));
@@ -1768,29 +2182,38 @@ UploadPartOutcome S3Client::UploadPart(const UploadPartRequest& request) const
   }
 }
 
-UploadPartOutcomeCallable S3Client::UploadPartCallable(const UploadPartRequest& request) const
-{
-  return std::async(std::launch::async, &S3Client::UploadPart, this, request);
-}
-
-void S3Client::UploadPartAsync(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+UploadPartOutcome S3Client::UploadPart(const UploadPartRequest& request) const
 {
-  m_executor->Submit(&S3Client::UploadPartAsyncHelper, this, request, handler, context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  return BuildUploadPartOutcome(outcome);
 }
 
-void S3Client::UploadPartAsyncHelper(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+UploadPartOutcomeCallable S3Client::UploadPartCallable(const UploadPartRequest& request) const
 {
-  handler(this, request, UploadPart(request), context);
+  return std::async(std::launch::async, &S3Client::UploadPart, this, request);
 }
 
-UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& request) const
+void S3Client::UploadPartAsync(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  auto requestCopy = Aws::MakeShared<UploadPartRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildUploadPartOutcome(outcome), context);
+  });
+}
+
+static UploadPartCopyOutcome BuildUploadPartCopyOutcome(XmlOutcome& outcome)
+{
   if(outcome.IsSuccess())
   {
     return UploadPartCopyOutcome(UploadPartCopyResult(outcome.GetResult()));
@@ -1801,19 +2224,34 @@ UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& requ
   }
 }
 
-UploadPartCopyOutcomeCallable S3Client::UploadPartCopyCallable(const UploadPartCopyRequest& request) const
+UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::UploadPartCopy, this, request);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  return BuildUploadPartCopyOutcome(outcome);
 }
 
-void S3Client::UploadPartCopyAsync(const UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+UploadPartCopyOutcomeCallable S3Client::UploadPartCopyCallable(const UploadPartCopyRequest& request) const
 {
-  m_executor->Submit(&S3Client::UploadPartCopyAsyncHelper, this, request, handler, context);
+  return std::async(std::launch::async, &S3Client::UploadPartCopy, this, request);
 }
 
-void S3Client::UploadPartCopyAsyncHelper(const UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+void S3Client::UploadPartCopyAsync(const UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UploadPartCopy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto requestCopy = Aws::MakeShared<UploadPartCopyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), *requestCopy, HttpMethod::HTTP_PUT, [this, requestCopy, handler, context](XmlOutcome& outcome)
+  {
+    handler(this, *requestCopy, BuildUploadPartCopyOutcome(outcome), context);
+  });
 }
 
 
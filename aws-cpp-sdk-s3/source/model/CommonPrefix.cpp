@@ -14,6 +14,7 @@
 */
 #include <aws/s3/model/CommonPrefix.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -51,6 +52,44 @@ CommonPrefix& CommonPrefix::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+CommonPrefix::CommonPrefix(XmlReader& xmlReader) : 
+    m_prefixHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+CommonPrefix& CommonPrefix::operator =(XmlReader& xmlReader)
+{
+  if(xmlReader.GetCurrentToken() != XmlToken::START_ELEMENT)
+  {
+    return *this;
+  }
+
+  size_t depth = xmlReader.GetDepth();
+  while(xmlReader.Next() != XmlToken::END_ELEMENT || xmlReader.GetDepth() >= depth)
+  {
+    if(xmlReader.GetCurrentToken() == XmlToken::PARSE_ERROR || xmlReader.GetCurrentToken() == XmlToken::END_DOCUMENT)
+    {
+      break;
+    }
+    if(xmlReader.GetCurrentToken() != XmlToken::START_ELEMENT)
+    {
+      continue;
+    }
+    if(xmlReader.GetName() == "Prefix")
+    {
+      m_prefix = xmlReader.ReadElementText();
+      m_prefixHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+
+  return *this;
+}
+
 void CommonPrefix::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -14,6 +14,7 @@
 */
 #include <aws/s3/model/ListObjectsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -110,3 +111,75 @@ ListObjectsResult& ListObjectsResult::operator =(const AmazonWebServiceResult<Xm
 
   return *this;
 }
+
+ListObjectsResult::ListObjectsResult(XmlReader& xmlReader) : 
+    m_isTruncated(false),
+    m_maxKeys(0)
+{
+  *this = xmlReader;
+}
+
+ListObjectsResult& ListObjectsResult::operator =(XmlReader& xmlReader)
+{
+  //the root element
+  if(xmlReader.Next() != XmlToken::START_ELEMENT)
+  {
+    return *this;
+  }
+
+  while(xmlReader.Next() == XmlToken::START_ELEMENT || xmlReader.GetCurrentToken() == XmlToken::TEXT)
+  {
+    if(xmlReader.GetCurrentToken() == XmlToken::TEXT)
+    {
+      continue;
+    }
+
+    const Aws::String& name = xmlReader.GetName();
+    if(name == "IsTruncated")
+    {
+      m_isTruncated = StringUtils::ConvertToBool(xmlReader.ReadElementText().c_str());
+    }
+    else if(name == "Marker")
+    {
+      m_marker = xmlReader.ReadElementText();
+    }
+    else if(name == "NextMarker")
+    {
+      m_nextMarker = xmlReader.ReadElementText();
+    }
+    else if(name == "Contents")
+    {
+      m_contents.push_back(Object(xmlReader));
+    }
+    else if(name == "Name")
+    {
+      m_name = xmlReader.ReadElementText();
+    }
+    else if(name == "Prefix")
+    {
+      m_prefix = xmlReader.ReadElementText();
+    }
+    else if(name == "Delimiter")
+    {
+      m_delimiter = xmlReader.ReadElementText();
+    }
+    else if(name == "MaxKeys")
+    {
+      m_maxKeys = StringUtils::ConvertToInt32(xmlReader.ReadElementText().c_str());
+    }
+    else if(name == "CommonPrefixes")
+    {
+      m_commonPrefixes.push_back(CommonPrefix(xmlReader));
+    }
+    else if(name == "EncodingType")
+    {
+      m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(xmlReader.ReadElementText().c_str());
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+
+  return *this;
+}
@@ -84,7 +84,7 @@ ListPartsResult& ListPartsResult::operator =(const AmazonWebServiceResult<XmlDoc
     {
       m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
     }
-    XmlNode partsNode = resultNode.FirstChild("Parts");
+    XmlNode partsNode = resultNode.FirstChild("Part");
     if(!partsNode.IsNull())
     {
       XmlNode partsMember = partsNode;
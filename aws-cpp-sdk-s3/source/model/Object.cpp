@@ -14,6 +14,7 @@
 */
 #include <aws/s3/model/Object.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -95,6 +96,76 @@ Object& Object::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Object::Object(XmlReader& xmlReader) : 
+    m_keyHasBeenSet(false),
+    m_lastModified(0.0),
+    m_lastModifiedHasBeenSet(false),
+    m_eTagHasBeenSet(false),
+    m_size(0),
+    m_sizeHasBeenSet(false),
+    m_storageClassHasBeenSet(false),
+    m_ownerHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+Object& Object::operator =(XmlReader& xmlReader)
+{
+  if(xmlReader.GetCurrentToken() != XmlToken::START_ELEMENT)
+  {
+    return *this;
+  }
+
+  size_t depth = xmlReader.GetDepth();
+  while(xmlReader.Next() != XmlToken::END_ELEMENT || xmlReader.GetDepth() >= depth)
+  {
+    if(xmlReader.GetCurrentToken() == XmlToken::PARSE_ERROR || xmlReader.GetCurrentToken() == XmlToken::END_DOCUMENT)
+    {
+      break;
+    }
+    if(xmlReader.GetCurrentToken() != XmlToken::START_ELEMENT)
+    {
+      continue;
+    }
+    if(xmlReader.GetName() == "Key")
+    {
+      m_key = xmlReader.ReadElementText();
+      m_keyHasBeenSet = true;
+    }
+    else if(xmlReader.GetName() == "LastModified")
+    {
+      m_lastModified = StringUtils::ConvertToDouble(xmlReader.ReadElementText().c_str());
+      m_lastModifiedHasBeenSet = true;
+    }
+    else if(xmlReader.GetName() == "ETag")
+    {
+      m_eTag = xmlReader.ReadElementText();
+      m_eTagHasBeenSet = true;
+    }
+    else if(xmlReader.GetName() == "Size")
+    {
+      m_size = StringUtils::ConvertToInt32(xmlReader.ReadElementText().c_str());
+      m_sizeHasBeenSet = true;
+    }
+    else if(xmlReader.GetName() == "StorageClass")
+    {
+      m_storageClass = ObjectStorageClassMapper::GetObjectStorageClassForName(xmlReader.ReadElementText().c_str());
+      m_storageClassHasBeenSet = true;
+    }
+    else if(xmlReader.GetName() == "Owner")
+    {
+      m_owner = xmlReader;
+      m_ownerHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+
+  return *this;
+}
+
 void Object::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
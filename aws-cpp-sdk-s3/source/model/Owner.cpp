@@ -14,6 +14,7 @@
 */
 #include <aws/s3/model/Owner.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -59,6 +60,50 @@ Owner& Owner::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Owner::Owner(XmlReader& xmlReader) : 
+    m_displayNameHasBeenSet(false),
+    m_iDHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+Owner& Owner::operator =(XmlReader& xmlReader)
+{
+  if(xmlReader.GetCurrentToken() != XmlToken::START_ELEMENT)
+  {
+    return *this;
+  }
+
+  size_t depth = xmlReader.GetDepth();
+  while(xmlReader.Next() != XmlToken::END_ELEMENT || xmlReader.GetDepth() >= depth)
+  {
+    if(xmlReader.GetCurrentToken() == XmlToken::PARSE_ERROR || xmlReader.GetCurrentToken() == XmlToken::END_DOCUMENT)
+    {
+      break;
+    }
+    if(xmlReader.GetCurrentToken() != XmlToken::START_ELEMENT)
+    {
+      continue;
+    }
+    if(xmlReader.GetName() == "DisplayName")
+    {
+      m_displayName = xmlReader.ReadElementText();
+      m_displayNameHasBeenSet = true;
+    }
+    else if(xmlReader.GetName() == "ID")
+    {
+      m_iD = xmlReader.ReadElementText();
+      m_iDHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+
+  return *this;
+}
+
 void Owner::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
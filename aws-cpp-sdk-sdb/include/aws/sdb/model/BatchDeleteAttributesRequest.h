@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     BatchDeleteAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "BatchDeleteAttributes"; }
     Aws::String SerializePayload() const override;
 
 
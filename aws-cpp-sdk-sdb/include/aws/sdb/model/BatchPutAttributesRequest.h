@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     BatchPutAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "BatchPutAttributes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     CreateDomainRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateDomain"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     DeleteAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteAttributes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteDomainRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteDomain"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DomainMetadataRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DomainMetadata"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetAttributes"; }
     Aws::String SerializePayload() const override;
 
 
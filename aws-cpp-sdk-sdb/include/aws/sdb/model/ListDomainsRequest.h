@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListDomainsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListDomains"; }
     Aws::String SerializePayload() const override;
 
 
@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     PutAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PutAttributes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     SelectRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "Select"; }
     Aws::String SerializePayload() const override;
 
 
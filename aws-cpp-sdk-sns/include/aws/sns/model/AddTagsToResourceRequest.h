@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     AddTagsToResourceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddTagsToResource"; }
     Aws::String SerializePayload() const override;
 
 
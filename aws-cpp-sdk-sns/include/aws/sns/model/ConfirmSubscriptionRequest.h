@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ConfirmSubscriptionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ConfirmSubscription"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreatePlatformApplicationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreatePlatformApplication"; }
     Aws::String SerializePayload() const override;
 
 
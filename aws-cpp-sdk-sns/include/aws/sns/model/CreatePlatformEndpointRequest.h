@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreatePlatformEndpointRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreatePlatformEndpoint"; }
     Aws::String SerializePayload() const override;
 
 
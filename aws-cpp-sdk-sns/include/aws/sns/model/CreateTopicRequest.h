@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CreateTopicRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateTopic"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeleteEndpointRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteEndpoint"; }
     Aws::String SerializePayload() const override;
 
 
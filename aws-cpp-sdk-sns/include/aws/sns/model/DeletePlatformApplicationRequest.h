@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeletePlatformApplicationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeletePlatformApplication"; }
     Aws::String SerializePayload() const override;
 
 
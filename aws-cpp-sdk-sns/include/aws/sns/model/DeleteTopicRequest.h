@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteTopicRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteTopic"; }
     Aws::String SerializePayload() const override;
 
 
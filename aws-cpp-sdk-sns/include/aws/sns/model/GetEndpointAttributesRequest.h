@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetEndpointAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetEndpointAttributes"; }
     Aws::String SerializePayload() const override;
 
 
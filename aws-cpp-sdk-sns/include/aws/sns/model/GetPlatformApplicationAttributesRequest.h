@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetPlatformApplicationAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetPlatformApplicationAttributes"; }
     Aws::String SerializePayload() const override;
 
 
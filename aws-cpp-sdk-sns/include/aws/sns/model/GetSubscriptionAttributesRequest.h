@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetSubscriptionAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetSubscriptionAttributes"; }
     Aws::String SerializePayload() const override;
 
 
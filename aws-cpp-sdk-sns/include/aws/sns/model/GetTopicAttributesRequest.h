@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetTopicAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetTopicAttributes"; }
     Aws::String SerializePayload() const override;
 
 
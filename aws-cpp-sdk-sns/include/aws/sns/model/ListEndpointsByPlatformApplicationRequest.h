@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListEndpointsByPlatformApplicationRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListEndpointsByPlatformApplication"; }
     Aws::String SerializePayload() const override;
 
 
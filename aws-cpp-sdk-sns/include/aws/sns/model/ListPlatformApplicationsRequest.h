@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListPlatformApplicationsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListPlatformApplications"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListSubscriptionsByTopicRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListSubscriptionsByTopic"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListSubscriptionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListSubscriptions"; }
     Aws::String SerializePayload() const override;
 
 
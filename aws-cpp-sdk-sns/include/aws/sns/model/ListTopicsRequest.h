@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListTopicsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListTopics"; }
     Aws::String SerializePayload() const override;
 
 
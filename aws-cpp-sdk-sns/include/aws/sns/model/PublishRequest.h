@@ -33,6 +33,7 @@ namespace Model
   {
   public:
     PublishRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "Publish"; }
     Aws::String SerializePayload() const override;
 
 
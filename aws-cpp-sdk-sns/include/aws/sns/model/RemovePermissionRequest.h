@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RemovePermissionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemovePermission"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RemoveTagsFromResourceRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemoveTagsFromResource"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetEndpointAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetEndpointAttributes"; }
     Aws::String SerializePayload() const override;
 
 
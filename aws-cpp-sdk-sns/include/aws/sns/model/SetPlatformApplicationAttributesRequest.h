@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetPlatformApplicationAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetPlatformApplicationAttributes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SetSubscriptionAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetSubscriptionAttributes"; }
     Aws::String SerializePayload() const override;
 
 
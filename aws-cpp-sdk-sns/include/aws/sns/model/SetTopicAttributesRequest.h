@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SetTopicAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetTopicAttributes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     SubscribeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "Subscribe"; }
     Aws::String SerializePayload() const override;
 
 
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     UnsubscribeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "Unsubscribe"; }
     Aws::String SerializePayload() const override;
 
 
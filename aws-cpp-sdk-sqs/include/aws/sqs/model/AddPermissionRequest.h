@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     AddPermissionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AddPermission"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ChangeMessageVisibilityBatchRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ChangeMessageVisibilityBatch"; }
     Aws::String SerializePayload() const override;
 
 
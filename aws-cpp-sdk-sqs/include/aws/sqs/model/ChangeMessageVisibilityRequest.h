@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ChangeMessageVisibilityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ChangeMessageVisibility"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     CreateQueueRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CreateQueue"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     DeleteMessageBatchRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteMessageBatch"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteMessageRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteMessage"; }
     Aws::String SerializePayload() const override;
 
 
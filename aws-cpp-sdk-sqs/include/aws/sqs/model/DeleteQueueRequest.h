@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeleteQueueRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeleteQueue"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     GetQueueAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetQueueAttributes"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetQueueUrlRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetQueueUrl"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListDeadLetterSourceQueuesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListDeadLetterSourceQueues"; }
     Aws::String SerializePayload() const override;
 
 
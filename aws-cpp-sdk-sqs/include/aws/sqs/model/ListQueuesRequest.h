@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     ListQueuesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListQueues"; }
     Aws::String SerializePayload() const override;
 
 
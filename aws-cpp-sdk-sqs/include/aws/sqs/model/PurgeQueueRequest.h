@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     PurgeQueueRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PurgeQueue"; }
     Aws::String SerializePayload() const override;
 
 
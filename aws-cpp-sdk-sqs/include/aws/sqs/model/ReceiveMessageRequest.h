@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     ReceiveMessageRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ReceiveMessage"; }
     Aws::String SerializePayload() const override;
 
 
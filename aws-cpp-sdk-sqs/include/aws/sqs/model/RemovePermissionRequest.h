@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RemovePermissionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RemovePermission"; }
     Aws::String SerializePayload() const override;
 
 
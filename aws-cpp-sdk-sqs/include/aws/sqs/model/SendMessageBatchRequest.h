@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SendMessageBatchRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SendMessageBatch"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SendMessageRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SendMessage"; }
     Aws::String SerializePayload() const override;
 
 
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     SetQueueAttributesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SetQueueAttributes"; }
     Aws::String SerializePayload() const override;
 
 
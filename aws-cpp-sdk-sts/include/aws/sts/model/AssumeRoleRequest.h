@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AssumeRoleRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AssumeRole"; }
     Aws::String SerializePayload() const override;
 
 
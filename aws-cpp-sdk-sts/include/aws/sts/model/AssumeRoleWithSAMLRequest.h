@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AssumeRoleWithSAMLRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AssumeRoleWithSAML"; }
     Aws::String SerializePayload() const override;
 
 
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     AssumeRoleWithWebIdentityRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "AssumeRoleWithWebIdentity"; }
     Aws::String SerializePayload() const override;
 
 
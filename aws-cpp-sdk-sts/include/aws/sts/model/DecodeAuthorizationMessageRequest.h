@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DecodeAuthorizationMessageRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DecodeAuthorizationMessage"; }
     Aws::String SerializePayload() const override;
 
 
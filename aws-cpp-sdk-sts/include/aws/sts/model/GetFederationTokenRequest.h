@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetFederationTokenRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetFederationToken"; }
     Aws::String SerializePayload() const override;
 
 
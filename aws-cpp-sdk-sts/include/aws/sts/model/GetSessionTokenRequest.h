@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     GetSessionTokenRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetSessionToken"; }
     Aws::String SerializePayload() const override;
 
 
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     CountClosedWorkflowExecutionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CountClosedWorkflowExecutions"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     CountOpenWorkflowExecutionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CountOpenWorkflowExecutions"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CountPendingActivityTasksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CountPendingActivityTasks"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
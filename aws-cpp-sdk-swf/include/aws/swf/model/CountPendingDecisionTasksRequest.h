@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     CountPendingDecisionTasksRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "CountPendingDecisionTasks"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeprecateActivityTypeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeprecateActivityType"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
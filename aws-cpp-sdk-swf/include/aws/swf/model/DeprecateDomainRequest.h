@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DeprecateDomainRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeprecateDomain"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DeprecateWorkflowTypeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DeprecateWorkflowType"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
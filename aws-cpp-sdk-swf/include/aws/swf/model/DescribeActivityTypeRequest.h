@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeActivityTypeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeActivityType"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
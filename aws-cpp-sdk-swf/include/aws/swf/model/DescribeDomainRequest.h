@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     DescribeDomainRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeDomain"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeWorkflowExecutionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeWorkflowExecution"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     DescribeWorkflowTypeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "DescribeWorkflowType"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
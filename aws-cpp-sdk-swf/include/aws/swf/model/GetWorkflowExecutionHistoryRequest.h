@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     GetWorkflowExecutionHistoryRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "GetWorkflowExecutionHistory"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
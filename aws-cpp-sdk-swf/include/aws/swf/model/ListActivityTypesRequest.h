@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListActivityTypesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListActivityTypes"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -35,6 +35,7 @@ namespace Model
   {
   public:
     ListClosedWorkflowExecutionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListClosedWorkflowExecutions"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
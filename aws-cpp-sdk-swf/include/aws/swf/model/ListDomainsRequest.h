@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListDomainsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListDomains"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
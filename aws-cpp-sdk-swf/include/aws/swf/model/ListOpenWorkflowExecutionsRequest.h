@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     ListOpenWorkflowExecutionsRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListOpenWorkflowExecutions"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
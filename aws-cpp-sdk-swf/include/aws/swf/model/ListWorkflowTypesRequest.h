@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     ListWorkflowTypesRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "ListWorkflowTypes"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
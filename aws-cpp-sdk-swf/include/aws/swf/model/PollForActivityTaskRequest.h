@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PollForActivityTaskRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PollForActivityTask"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
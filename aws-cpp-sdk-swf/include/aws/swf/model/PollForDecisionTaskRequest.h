@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     PollForDecisionTaskRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "PollForDecisionTask"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
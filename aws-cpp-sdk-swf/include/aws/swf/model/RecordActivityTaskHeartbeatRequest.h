@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RecordActivityTaskHeartbeatRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RecordActivityTaskHeartbeat"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
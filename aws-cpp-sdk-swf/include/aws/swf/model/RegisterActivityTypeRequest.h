@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     RegisterActivityTypeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterActivityType"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RegisterDomainRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterDomain"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
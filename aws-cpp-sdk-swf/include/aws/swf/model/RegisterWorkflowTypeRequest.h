@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RegisterWorkflowTypeRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RegisterWorkflowType"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
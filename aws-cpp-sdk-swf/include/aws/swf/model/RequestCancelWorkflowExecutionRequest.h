@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RequestCancelWorkflowExecutionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RequestCancelWorkflowExecution"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
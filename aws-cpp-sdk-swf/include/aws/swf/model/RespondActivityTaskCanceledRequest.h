@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RespondActivityTaskCanceledRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RespondActivityTaskCanceled"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RespondActivityTaskCompletedRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RespondActivityTaskCompleted"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     RespondActivityTaskFailedRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RespondActivityTaskFailed"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,7 @@ namespace Model
   {
   public:
     RespondDecisionTaskCompletedRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "RespondDecisionTaskCompleted"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
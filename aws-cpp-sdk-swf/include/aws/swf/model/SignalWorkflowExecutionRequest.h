@@ -30,6 +30,7 @@ namespace Model
   {
   public:
     SignalWorkflowExecutionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "SignalWorkflowExecution"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,7 @@ namespace Model
   {
   public:
     StartWorkflowExecutionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "StartWorkflowExecution"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
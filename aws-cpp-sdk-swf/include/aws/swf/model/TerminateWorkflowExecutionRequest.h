@@ -31,6 +31,7 @@ namespace Model
   {
   public:
     TerminateWorkflowExecutionRequest();
+    inline virtual const char* GetServiceRequestName() const override { return "TerminateWorkflowExecution"; }
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -64,7 +64,7 @@ Aws::String CountOpenWorkflowExecutionsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CountOpenWorkflowExecutionsRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String CountPendingActivityTasksRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CountPendingActivityTasksRequest::GetRequestSpecificHeaders() const
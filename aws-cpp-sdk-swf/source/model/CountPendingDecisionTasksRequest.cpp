@@ -43,7 +43,7 @@ Aws::String CountPendingDecisionTasksRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection CountPendingDecisionTasksRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String DeprecateActivityTypeRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeprecateActivityTypeRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DeprecateDomainRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeprecateDomainRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String DeprecateWorkflowTypeRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DeprecateWorkflowTypeRequest::GetRequestSpecificHeaders() const
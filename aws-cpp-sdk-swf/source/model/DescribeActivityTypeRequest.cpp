@@ -43,7 +43,7 @@ Aws::String DescribeActivityTypeRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeActivityTypeRequest::GetRequestSpecificHeaders() const
@@ -36,7 +36,7 @@ Aws::String DescribeDomainRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeDomainRequest::GetRequestSpecificHeaders() const
@@ -43,7 +43,7 @@ Aws::String DescribeWorkflowTypeRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection DescribeWorkflowTypeRequest::GetRequestSpecificHeaders() const
@@ -72,7 +72,7 @@ Aws::String ListActivityTypesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListActivityTypesRequest::GetRequestSpecificHeaders() const
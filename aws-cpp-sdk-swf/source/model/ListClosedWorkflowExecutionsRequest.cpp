@@ -101,7 +101,7 @@ Aws::String ListClosedWorkflowExecutionsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListClosedWorkflowExecutionsRequest::GetRequestSpecificHeaders() const
@@ -58,7 +58,7 @@ Aws::String ListDomainsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListDomainsRequest::GetRequestSpecificHeaders() const
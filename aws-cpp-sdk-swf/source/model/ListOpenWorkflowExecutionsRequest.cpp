@@ -87,7 +87,7 @@ Aws::String ListOpenWorkflowExecutionsRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListOpenWorkflowExecutionsRequest::GetRequestSpecificHeaders() const
@@ -72,7 +72,7 @@ Aws::String ListWorkflowTypesRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection ListWorkflowTypesRequest::GetRequestSpecificHeaders() const
@@ -50,7 +50,7 @@ Aws::String PollForActivityTaskRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PollForActivityTaskRequest::GetRequestSpecificHeaders() const
@@ -73,7 +73,7 @@ Aws::String PollForDecisionTaskRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection PollForDecisionTaskRequest::GetRequestSpecificHeaders() const
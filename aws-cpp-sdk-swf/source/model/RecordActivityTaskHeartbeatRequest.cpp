@@ -43,7 +43,7 @@ Aws::String RecordActivityTaskHeartbeatRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RecordActivityTaskHeartbeatRequest::GetRequestSpecificHeaders() const
@@ -50,7 +50,7 @@ Aws::String RegisterDomainRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RegisterDomainRequest::GetRequestSpecificHeaders() const
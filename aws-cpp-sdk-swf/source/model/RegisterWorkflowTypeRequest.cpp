@@ -98,7 +98,7 @@ Aws::String RegisterWorkflowTypeRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RegisterWorkflowTypeRequest::GetRequestSpecificHeaders() const
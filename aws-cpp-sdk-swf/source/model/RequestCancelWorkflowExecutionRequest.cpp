@@ -50,7 +50,7 @@ Aws::String RequestCancelWorkflowExecutionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RequestCancelWorkflowExecutionRequest::GetRequestSpecificHeaders() const
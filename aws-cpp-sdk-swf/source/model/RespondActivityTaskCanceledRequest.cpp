@@ -43,7 +43,7 @@ Aws::String RespondActivityTaskCanceledRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RespondActivityTaskCanceledRequest::GetRequestSpecificHeaders() const
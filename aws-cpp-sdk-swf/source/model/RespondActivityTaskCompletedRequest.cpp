@@ -43,7 +43,7 @@ Aws::String RespondActivityTaskCompletedRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RespondActivityTaskCompletedRequest::GetRequestSpecificHeaders() const
@@ -50,7 +50,7 @@ Aws::String RespondActivityTaskFailedRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection RespondActivityTaskFailedRequest::GetRequestSpecificHeaders() const
@@ -64,7 +64,7 @@ Aws::String SignalWorkflowExecutionRequest::SerializePayload() const
 
   }
 
-  return payload.WriteReadable();
+  return payload.WriteCompact();
 }
 
 Aws::Http::HeaderValueCollection SignalWorkflowExecutionRequest::GetRequestSpecificHeaders() const
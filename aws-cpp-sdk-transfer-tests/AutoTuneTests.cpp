@@ -0,0 +1,163 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/transfer/TransferClient.h>
+#include <aws/transfer/TransferConcurrencyController.h>
+
+#include <algorithm>
+#include <functional>
+
+using namespace Aws::Transfer;
+
+using Clock = TransferConcurrencyController::Clock;
+
+static const uint64_t MB = 1024 * 1024;
+
+// Feeds the controller one full window of parts that all ran for the same second, so the window's throughput is exactly
+// linkThroughput(concurrency) whatever the window size is
+static void RunWindow(TransferConcurrencyController& controller, const std::function<uint64_t(uint32_t)>& linkThroughput, uint32_t failures = 0)
+{
+    uint32_t concurrency = controller.GetConcurrency();
+    uint32_t parts = std::max(concurrency, 4u);
+    uint64_t bytesPerPart = linkThroughput(concurrency) / (parts - failures);
+
+    Clock::time_point startedAt = Clock::now();
+    Clock::time_point finishedAt = startedAt + std::chrono::seconds(1);
+    for (uint32_t i = 0; i < parts; ++i)
+    {
+        controller.RecordPart(bytesPerPart, i >= failures, startedAt, finishedAt);
+    }
+}
+
+TEST(TransferConcurrencyControllerTest, ClampsInitialConcurrency)
+{
+    TransferConcurrencyController tooMany(100, 2, 8);
+    ASSERT_EQ(8u, tooMany.GetConcurrency());
+
+    TransferConcurrencyController tooFew(0, 2, 8);
+    ASSERT_EQ(2u, tooFew.GetConcurrency());
+}
+
+TEST(TransferConcurrencyControllerTest, ClimbsWhileThroughputImproves)
+{
+    TransferConcurrencyController controller(4, 2, 64);
+
+    // a link that never runs out, every extra part in flight adds the same again
+    uint32_t lastConcurrency = controller.GetConcurrency();
+    for (unsigned i = 0; i < 6; ++i)
+    {
+        RunWindow(controller, [](uint32_t concurrency) { return concurrency * MB; });
+        ASSERT_GT(controller.GetConcurrency(), lastConcurrency);
+        lastConcurrency = controller.GetConcurrency();
+    }
+
+    // and the steps grow as it keeps paying off
+    ASSERT_GT(lastConcurrency, 4u + 6u);
+}
+
+TEST(TransferConcurrencyControllerTest, SettlesWhereTheLinkIsFull)
+{
+    TransferConcurrencyController controller(4, 2, 64);
+
+    // nothing to gain past 8 parts in flight
+    auto linkThroughput = [](uint32_t concurrency) { return std::min(concurrency, 8u) * MB; };
+    for (unsigned i = 0; i < 12; ++i)
+    {
+        RunWindow(controller, linkThroughput);
+    }
+
+    for (unsigned i = 0; i < 20; ++i)
+    {
+        RunWindow(controller, linkThroughput);
+        ASSERT_GE(controller.GetConcurrency(), 7u);
+        ASSERT_LE(controller.GetConcurrency(), 10u);
+    }
+}
+
+TEST(TransferConcurrencyControllerTest, FallsToMinimumWhenConcurrencyDoesNotMatter)
+{
+    TransferConcurrencyController controller(16, 2, 64);
+
+    for (unsigned i = 0; i < 20; ++i)
+    {
+        RunWindow(controller, [](uint32_t) { return 40 * MB; });
+    }
+
+    // it keeps probing upwards once in a while
+    ASSERT_LE(controller.GetConcurrency(), 3u);
+}
+
+TEST(TransferConcurrencyControllerTest, StaysWithinLimits)
+{
+    TransferConcurrencyController controller(4, 3, 6);
+
+    for (unsigned i = 0; i < 20; ++i)
+    {
+        RunWindow(controller, [](uint32_t concurrency) { return concurrency * MB; });
+        ASSERT_GE(controller.GetConcurrency(), 3u);
+        ASSERT_LE(controller.GetConcurrency(), 6u);
+    }
+    ASSERT_GE(controller.GetConcurrency(), 5u);
+}
+
+TEST(TransferConcurrencyControllerTest, BacksOffOnErrors)
+{
+    Aws::Vector<uint32_t> changes;
+    TransferConcurrencyController controller(16, 2, 64, [&](uint32_t concurrency) { changes.push_back(concurrency); });
+
+    // one failure in sixteen is within bounds
+    RunWindow(controller, [](uint32_t concurrency) { return concurrency * MB; }, 1);
+    ASSERT_EQ(17u, controller.GetConcurrency());
+
+    // three is not
+    RunWindow(controller, [](uint32_t concurrency) { return concurrency * MB; }, 3);
+    ASSERT_EQ(8u, controller.GetConcurrency());
+
+    ASSERT_EQ(2u, changes.size());
+    ASSERT_EQ(17u, changes[0]);
+    ASSERT_EQ(8u, changes[1]);
+}
+
+TEST(TransferConcurrencyControllerTest, WaitsForAFullWindow)
+{
+    TransferConcurrencyController controller(8, 2, 64);
+
+    Clock::time_point startedAt = Clock::now();
+    for (unsigned i = 0; i < 7; ++i)
+    {
+        controller.RecordPart(0, false, startedAt, startedAt + std::chrono::seconds(1));
+    }
+    ASSERT_EQ(8u, controller.GetConcurrency());
+
+    controller.RecordPart(0, false, startedAt, startedAt + std::chrono::seconds(1));
+    ASSERT_EQ(4u, controller.GetConcurrency());
+}
+
+TEST(TransferClientPartSizeTest, KeepsPartSizeWithinPartLimit)
+{
+    ASSERT_EQ(5 * MB, TransferClient::GetPartSizeForObject(100 * MB, 5 * MB));
+    ASSERT_EQ(5 * MB, TransferClient::GetPartSizeForObject(MAX_UPLOAD_PARTS * 5 * MB, 5 * MB));
+    ASSERT_EQ(6 * MB, TransferClient::GetPartSizeForObject(MAX_UPLOAD_PARTS * 5 * MB + 1, 5 * MB));
+
+    // a part size already big enough is left alone, even if it isn't a whole number of MB
+    ASSERT_EQ(64 * MB + 1, TransferClient::GetPartSizeForObject(200 * 1024 * MB, 64 * MB + 1));
+
+    uint64_t objectSize = 200 * 1024 * MB;
+    uint64_t partSize = TransferClient::GetPartSizeForObject(objectSize, 5 * MB);
+    ASSERT_EQ(21 * MB, partSize);
+    ASSERT_LE((objectSize + partSize - 1) / partSize, static_cast<uint64_t>(MAX_UPLOAD_PARTS));
+}
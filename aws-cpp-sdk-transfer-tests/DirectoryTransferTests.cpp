@@ -0,0 +1,135 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/transfer/DirectoryTransferRequest.h>
+#include <aws/transfer/TransferClient.h>
+
+#include <aws/s3/S3Client.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/StringUtils.h>
+
+#include <cstdio>
+#include <fstream>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif // _WIN32
+
+using namespace Aws::Transfer;
+using namespace Aws::Utils;
+
+static const char* ALLOCATION_TAG = "DirectoryTransferTests";
+
+static const char* UNREADABLE_TEST_DIR = "DirectoryTransferUnreadableTest";
+// Enough files that recursing once per file would run off the end of the stack
+static const unsigned UNREADABLE_TEST_FILES = 20000;
+
+static Aws::String LocalPath(const char* keyName)
+{
+    return DirectoryTransferRequest::GetLocalPathForKey("downloads", "prefix/", keyName);
+}
+
+TEST(DirectoryTransferLocalPathTest, MapsKeysIntoTheDirectory)
+{
+    Aws::String delimiter(1, FileSystemUtils::GetPathDelimiter());
+    ASSERT_EQ("downloads" + delimiter + "file.txt", LocalPath("prefix/file.txt"));
+    ASSERT_EQ("downloads" + delimiter + "sub" + delimiter + "file.txt", LocalPath("prefix/sub/file.txt"));
+    // a leading '/' is the key's separator from the prefix, not the root
+    ASSERT_EQ("downloads" + delimiter + "file.txt", LocalPath("prefix//file.txt"));
+    // dots that don't make up a whole segment are ordinary names
+    ASSERT_EQ("downloads" + delimiter + "..file" + delimiter + "a..b", LocalPath("prefix/..file/a..b"));
+    ASSERT_EQ("downloads" + delimiter + "12:00.log", LocalPath("prefix/12:00.log"));
+}
+
+TEST(DirectoryTransferLocalPathTest, SkipsKeysThatArentFiles)
+{
+    ASSERT_EQ("", LocalPath("prefix/"));
+    ASSERT_EQ("", LocalPath("prefix/folder/"));
+    ASSERT_EQ("", LocalPath("elsewhere/file.txt"));
+}
+
+TEST(DirectoryTransferLocalPathTest, RejectsKeysThatLeaveTheDirectory)
+{
+    // climbing out with either platform's delimiter
+    ASSERT_EQ("", LocalPath("prefix/../file.txt"));
+    ASSERT_EQ("", LocalPath("prefix/sub/../../file.txt"));
+    ASSERT_EQ("", LocalPath("prefix/.."));
+    ASSERT_EQ("", LocalPath("prefix/..\\file.txt"));
+    ASSERT_EQ("", LocalPath("prefix/sub\\..\\..\\file.txt"));
+    ASSERT_EQ("", LocalPath("prefix/sub/..\\file.txt"));
+
+    // absolute paths and drive letters
+    ASSERT_EQ("", LocalPath("prefix/\\Windows\\file.txt"));
+    ASSERT_EQ("", LocalPath("prefix/\\\\server\\share\\file.txt"));
+    ASSERT_EQ("", LocalPath("prefix/C:\\Windows\\file.txt"));
+    ASSERT_EQ("", LocalPath("prefix/c:file.txt"));
+    ASSERT_EQ("", LocalPath("prefix/C:/file.txt"));
+}
+
+#ifndef _WIN32
+
+TEST(DirectoryTransferUploadTest, FilesThatCantBeOpenedFailOneAtATime)
+{
+    ASSERT_TRUE(FileSystemUtils::CreateDirectoryIfNotExists(UNREADABLE_TEST_DIR));
+    Aws::Vector<Aws::String> fileNames;
+    for (unsigned i = 0; i < UNREADABLE_TEST_FILES; ++i)
+    {
+        fileNames.push_back(Aws::String(UNREADABLE_TEST_DIR) + FileSystemUtils::GetPathDelimiter() + "file" + StringUtils::to_string(i) + ".txt");
+        std::ofstream file(fileNames.back().c_str(), std::ios::binary | std::ios::trunc);
+        file << "contents";
+        file.close();
+        chmod(fileNames.back().c_str(), 0);
+    }
+
+    // Permissions don't stop a privileged user, whose upload would then go to S3
+    FILE* readable = fopen(fileNames.front().c_str(), "rb");
+    if (readable)
+    {
+        fclose(readable);
+    }
+    else
+    {
+        // Every file fails as its request is created, so none of this touches the network
+        auto s3Client = Aws::MakeShared<Aws::S3::S3Client>(ALLOCATION_TAG, Aws::Auth::AWSCredentials("accessKey", "secretKey"));
+        TransferClient transferClient(s3Client, TransferClientConfiguration());
+
+        const bool cCreateBucket = false;
+        std::shared_ptr<DirectoryTransferRequest> uploadPtr = transferClient.UploadDirectory(UNREADABLE_TEST_DIR, "bucket", "prefix/", "", cCreateBucket);
+
+        ASSERT_TRUE(uploadPtr->IsDone());
+        ASSERT_FALSE(uploadPtr->CompletedSuccessfully());
+        ASSERT_EQ(fileNames.size(), uploadPtr->GetTotalFiles());
+        ASSERT_EQ(0u, uploadPtr->GetFilesCompleted());
+
+        Aws::Vector<std::shared_ptr<S3FileRequest> > failedRequests = uploadPtr->GetFailedRequests();
+        ASSERT_EQ(fileNames.size(), failedRequests.size());
+        for (auto& failedRequest : failedRequests)
+        {
+            ASSERT_EQ("Failed to open file.", failedRequest->GetFailure());
+        }
+    }
+
+    for (auto& fileName : fileNames)
+    {
+        ASSERT_TRUE(FileSystemUtils::RemoveFileIfExists(fileName.c_str()));
+    }
+    //std::remove takes empty directories on posix platforms.
+    std::remove(UNREADABLE_TEST_DIR);
+}
+
+#endif // _WIN32
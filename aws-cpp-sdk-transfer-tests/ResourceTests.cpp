@@ -149,6 +149,31 @@ TEST(FairBoundedResourceManagerTest, ScopedReacquireTest)
     ASSERT_TRUE(scopedSet2.GetResources().size() == 5);
 }
 
+TEST(FairBoundedResourceManagerTest, ScopedReleaseTest)
+{
+    auto manager = Aws::MakeShared<ResourceManagerTestType>(TAG, ResourceFactoryFunction, 5, ResourceWaitPolicy::AT_LEAST_ONE_AVAILABLE);
+
+    ScopedResourceSetTestType scopedSet(5, manager);
+    ASSERT_TRUE(scopedSet.GetResources().size() == 5);
+
+    // hand two back early; they're free for anyone else
+    ASSERT_TRUE(scopedSet.ReleaseResource(0));
+    ASSERT_TRUE(scopedSet.ReleaseResource(0));
+    ASSERT_TRUE(scopedSet.GetResources().size() == 3);
+
+    ScopedResourceSetTestType scopedSet2(5, manager);
+    ASSERT_TRUE(scopedSet2.GetResources().size() == 2);
+
+    // a limited reacquire stops short of what the set originally asked for
+    scopedSet2.ReleaseResource(0);
+    scopedSet2.ReleaseResource(0);
+    scopedSet.TryReacquire(4);
+    ASSERT_TRUE(scopedSet.GetResources().size() == 4);
+
+    scopedSet.TryReacquire();
+    ASSERT_TRUE(scopedSet.GetResources().size() == 5);
+}
+
 
 void AllAcquireThreadFunction(std::shared_ptr<ResourceManagerTestType> manager, uint32_t resourceCount, uint32_t holdTimeInMilliseconds, uint32_t iterations)
 {
@@ -313,6 +338,39 @@ TEST(FairBoundedResourceManagerTest, GrowResourcePool)
     requester.join();
 }
 
+TEST(FairBoundedResourceManagerTest, GrowResourcePoolThenAcquire)
+{
+    ResourceManagerTestType manager(ResourceFactoryFunction, 2, ResourceWaitPolicy::AT_LEAST_ONE_AVAILABLE);
+
+    // the new resources count towards what a single request can get
+    manager.AdjustResourceCount(4);
+
+    ResourceListTestType resources;
+    manager.AcquireResources(6, resources);
+    ASSERT_TRUE(resources.size() == 4);
+
+    manager.ReleaseResources(resources);
+}
+
+TEST(FairBoundedResourceManagerTest, GrowDuringShrink)
+{
+    ResourceManagerTestType manager(ResourceFactoryFunction, 5, ResourceWaitPolicy::AT_LEAST_ONE_AVAILABLE);
+
+    ResourceListTestType resources;
+    manager.AcquireResources(5, resources);
+    ASSERT_TRUE(resources.size() == 5);
+
+    // the shrink can't finish while everything is out, growing again part way should leave exactly the new size behind
+    manager.AdjustResourceCount(2);
+    manager.AdjustResourceCount(4);
+    manager.ReleaseResources(resources);
+
+    manager.AcquireResources(5, resources);
+    ASSERT_TRUE(resources.size() == 4);
+
+    manager.ReleaseResources(resources);
+}
+
 TEST(FairBoundedResourceManagerTest, ShrinkResourcePoolEasy1)
 {
     auto manager = Aws::MakeShared<ResourceManagerTestType>(TAG, ResourceFactoryFunction, 3, ResourceWaitPolicy::AT_LEAST_ONE_AVAILABLE);
@@ -0,0 +1,122 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/transfer/TransferJournal.h>
+
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <fstream>
+
+using namespace Aws::Transfer;
+
+static const char* JOURNAL_TEST_FILE = "TransferJournalTest.bin";
+
+static Aws::String ReadJournalFile(const TransferJournal& journal)
+{
+    Aws::IFStream journalFile(journal.GetPath().c_str(), std::ios_base::in | std::ios_base::binary);
+    Aws::StringStream contents;
+    contents << journalFile.rdbuf();
+    return contents.str();
+}
+
+TEST(TransferJournalTest, RoundTrip)
+{
+    TransferJournal journal(JOURNAL_TEST_FILE);
+    ASSERT_EQ(Aws::String(JOURNAL_TEST_FILE) + TransferJournal::JOURNAL_EXTENSION, journal.GetPath());
+
+    ASSERT_TRUE(journal.Start({ "upload", "bucket", "some key/with spaces and 100%", "", "id" }));
+    ASSERT_TRUE(journal.Append({ "part", "1", "\"etag\"" }));
+    ASSERT_TRUE(journal.Append({ "part", "2", "line\nbreak\r" }));
+
+    // a second journal on the same file sees everything the first one wrote
+    TransferJournal reader(JOURNAL_TEST_FILE);
+    Aws::Vector<TransferJournal::Record> records = reader.Read();
+    ASSERT_EQ(3u, records.size());
+    ASSERT_EQ(5u, records[0].size());
+    ASSERT_EQ("some key/with spaces and 100%", records[0][2]);
+    ASSERT_EQ("", records[0][3]);
+    ASSERT_EQ("id", records[0][4]);
+    ASSERT_EQ("\"etag\"", records[1][2]);
+    ASSERT_EQ("line\nbreak\r", records[2][2]);
+
+    // and Start throws all of it away
+    ASSERT_TRUE(journal.Start({ "download" }));
+    records = reader.Read();
+    ASSERT_EQ(1u, records.size());
+    ASSERT_EQ(1u, records[0].size());
+    ASSERT_EQ("download", records[0][0]);
+
+    journal.Remove();
+    ASSERT_TRUE(reader.Read().empty());
+}
+
+TEST(TransferJournalTest, DropsTornRecord)
+{
+    TransferJournal journal(JOURNAL_TEST_FILE);
+    ASSERT_TRUE(journal.Start({ "upload", "id" }));
+    ASSERT_TRUE(journal.Append({ "part", "1", "etag" }));
+
+    // what a process killed halfway through a record leaves behind
+    {
+        Aws::OFStream journalFile(journal.GetPath().c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::app);
+        journalFile << "part 2 et";
+    }
+
+    TransferJournal resumed(JOURNAL_TEST_FILE);
+    Aws::Vector<TransferJournal::Record> records = resumed.Read();
+    ASSERT_EQ(2u, records.size());
+    ASSERT_EQ("1", records[1][1]);
+
+    // the next run's records start on a line of their own, and the torn one stays dropped
+    ASSERT_TRUE(resumed.Append({ "part", "3", "etag" }));
+    records = resumed.Read();
+    ASSERT_EQ(3u, records.size());
+    ASSERT_EQ("3", records[2][1]);
+    ASSERT_EQ("upload id\npart 1 etag\npart 2 et%\npart 3 etag\n", ReadJournalFile(resumed));
+
+    resumed.Remove();
+}
+
+TEST(TransferJournalTest, DropsMalformedRecord)
+{
+    TransferJournal journal(JOURNAL_TEST_FILE);
+    ASSERT_TRUE(journal.Start({ "upload", "id" }));
+
+    {
+        Aws::OFStream journalFile(journal.GetPath().c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::app);
+        journalFile << "part 1 bad%2\n";
+    }
+
+    TransferJournal resumed(JOURNAL_TEST_FILE);
+    ASSERT_TRUE(resumed.Append({ "part", "2", "etag" }));
+
+    Aws::Vector<TransferJournal::Record> records = resumed.Read();
+    ASSERT_EQ(2u, records.size());
+    ASSERT_EQ("2", records[1][1]);
+
+    resumed.Remove();
+}
+
+TEST(TransferJournalTest, MissingJournalIsEmpty)
+{
+    TransferJournal journal(JOURNAL_TEST_FILE);
+    journal.Remove();
+    ASSERT_TRUE(journal.Read().empty());
+
+    // removing one that isn't there is fine too
+    journal.Remove();
+}
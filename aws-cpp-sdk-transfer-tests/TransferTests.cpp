@@ -34,6 +34,8 @@
 #include <aws/transfer/S3FileRequest.h>
 #include <aws/transfer/UploadFileRequest.h>
 #include <aws/transfer/DownloadFileRequest.h>
+#include <aws/transfer/DirectoryTransferRequest.h>
+#include <aws/core/utils/FileSystemUtils.h>
 
 #include <iostream>
 #include <fstream>
@@ -71,6 +73,12 @@ static const char* CANCEL_TEST_FILE_NAME = "CancelTestFile.txt";
 static const char* CANCEL_FILE_KEY = "CancelFileKey";
 static const char* CANCEL_FILE_KEY2 = "CancelFileKey2";
 
+static const char* DIRECTORY_TEST_DIR = "TransferTestDir";
+static const char* DIRECTORY_TEST_SUBDIR = "Logs";
+static const char* DIRECTORY_TEST_DOWNLOAD_DIR = "TransferTestDirDownload";
+static const char* DIRECTORY_TEST_PREFIX = "DirectoryTest/";
+static const unsigned DIRECTORY_TEST_SMALL_FILES = 6;
+
 static const char* TEST_BUCKET_NAME_BASE = "transferintegrationtestbucket";
 static const unsigned SMALL_TEST_SIZE = MB5_BUFFER_SIZE / 2;
 static const unsigned MEDIUM_TEST_SIZE = MB5_BUFFER_SIZE * 3 / 2;
@@ -728,6 +736,8 @@ TEST_F(TransferTests, BigTest)
 
     ASSERT_TRUE(downloadPtr->CompletedSuccessfully());
 
+    ASSERT_EQ(downloadPtr->GetTotalParts(), PARTS_IN_BIG_TEST);
+
     Aws::IFStream inFile(BIG_TEST_FILE_NAME, std::ios::binary | std::ios::ate);
 
     fileSize = inFile.tellg();
@@ -876,6 +886,9 @@ TEST_F(TransferTests, MultiPartContentTest)
 
     ASSERT_TRUE(downloadPtr->CompletedSuccessfully());
 
+    // Fetched as byte ranges written at their offsets, the content must still match
+    ASSERT_EQ(downloadPtr->GetTotalParts(), PARTS_IN_MEDIUM_TEST);
+
     ASSERT_TRUE(AreFilesSame(MULTI_PART_CONTENT_DOWNLOAD, MULTI_PART_CONTENT_FILE));
 }
 
@@ -1190,3 +1203,62 @@ TEST_F(TransferTests, ScopeTests)
 
 
 }
+
+TEST_F(TransferTests, DirectoryTest)
+{
+    if (EmptyBucket(GetTestBucketName()))
+    {
+        WaitForBucketToEmpty(GetTestBucketName());
+    }
+
+    // Many small files, a subdirectory, and one file big enough to go multipart
+    FileSystemUtils::CreateDirectoryIfNotExists(DIRECTORY_TEST_DIR);
+    Aws::String subdirectory = Aws::String(DIRECTORY_TEST_DIR) + FileSystemUtils::GetPathDelimiter() + DIRECTORY_TEST_SUBDIR;
+    FileSystemUtils::CreateDirectoryIfNotExists(subdirectory.c_str());
+
+    Aws::Vector<Aws::String> relativePaths;
+    for (unsigned i = 0; i < DIRECTORY_TEST_SMALL_FILES; ++i)
+    {
+        relativePaths.push_back(Aws::String(DIRECTORY_TEST_SUBDIR) + FileSystemUtils::GetPathDelimiter() + "log" + StringUtils::to_string(i) + ".txt");
+        CreateTestFile(Aws::String(DIRECTORY_TEST_DIR) + FileSystemUtils::GetPathDelimiter() + relativePaths.back(), CONTENT_TEST_FILE_TEXT + StringUtils::to_string(i));
+    }
+    relativePaths.push_back("medium.txt");
+    CreateTestFile(Aws::String(DIRECTORY_TEST_DIR) + FileSystemUtils::GetPathDelimiter() + relativePaths.back(), MEDIUM_TEST_SIZE, testString);
+
+    const bool cCreateBucket = true;
+    std::shared_ptr<DirectoryTransferRequest> uploadPtr = m_transferClient->UploadDirectory(DIRECTORY_TEST_DIR, GetTestBucketName(), DIRECTORY_TEST_PREFIX, "", cCreateBucket);
+
+    ASSERT_EQ(relativePaths.size(), uploadPtr->GetTotalFiles());
+
+    uploadPtr->WaitUntilDone();
+
+    ASSERT_TRUE(uploadPtr->IsDone());
+    ASSERT_TRUE(uploadPtr->CompletedSuccessfully());
+    ASSERT_EQ(relativePaths.size(), uploadPtr->GetFilesCompleted());
+    ASSERT_EQ(0u, uploadPtr->GetFilesFailed());
+    ASSERT_EQ(uploadPtr->GetTotalBytes(), uploadPtr->GetBytesTransferred());
+
+    Aws::String mediumKey = Aws::String(DIRECTORY_TEST_PREFIX) + "medium.txt";
+    WaitForObjectToPropagate(GetTestBucketName(), mediumKey.c_str());
+
+    std::shared_ptr<DirectoryTransferRequest> downloadPtr = m_transferClient->DownloadDirectory(DIRECTORY_TEST_DOWNLOAD_DIR, GetTestBucketName(), DIRECTORY_TEST_PREFIX);
+
+    downloadPtr->WaitUntilDone();
+
+    ASSERT_TRUE(downloadPtr->IsDone());
+    ASSERT_TRUE(downloadPtr->CompletedSuccessfully());
+    ASSERT_EQ(relativePaths.size(), downloadPtr->GetFilesCompleted());
+
+    for (auto& relativePath : relativePaths)
+    {
+        Aws::String uploaded = Aws::String(DIRECTORY_TEST_DIR) + FileSystemUtils::GetPathDelimiter() + relativePath;
+        Aws::String downloaded = Aws::String(DIRECTORY_TEST_DOWNLOAD_DIR) + FileSystemUtils::GetPathDelimiter() + relativePath;
+        ASSERT_TRUE(AreFilesSame(downloaded, uploaded));
+        remove(uploaded.c_str());
+        remove(downloaded.c_str());
+    }
+    remove(subdirectory.c_str());
+    remove((Aws::String(DIRECTORY_TEST_DOWNLOAD_DIR) + FileSystemUtils::GetPathDelimiter() + DIRECTORY_TEST_SUBDIR).c_str());
+    remove(DIRECTORY_TEST_DIR);
+    remove(DIRECTORY_TEST_DOWNLOAD_DIR);
+}
@@ -0,0 +1,181 @@
+
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/transfer/Transfer_EXPORTS.h>
+
+#include <aws/transfer/S3FileRequest.h>
+#include <aws/s3/S3Client.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+
+namespace Aws
+{
+namespace S3
+{
+    class S3Client;
+} // namespace S3
+
+namespace Transfer
+{
+
+class TransferClient;
+
+// Many files moved between a local directory and a key prefix as one operation.  The bucket is checked once for all of them, files are
+// started as earlier ones finish so no more than the concurrency limit are in flight, and progress is reported for the whole set.
+class AWS_TRANSFER_API DirectoryTransferRequest : public std::enable_shared_from_this<DirectoryTransferRequest>
+{
+public:
+    DirectoryTransferRequest(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& keyPrefix, const std::shared_ptr<Aws::S3::S3Client>& s3Client,
+        uint32_t maxConcurrentFiles);
+    ~DirectoryTransferRequest();
+
+    // Simple accessors to return values passed into constructor
+    const Aws::String& GetDirectory() const { return m_directory; }
+    const Aws::String& GetBucketName() const { return m_bucketName; }
+    const Aws::String& GetKeyPrefix() const { return m_keyPrefix; }
+
+    // Every file has finished, or the directory failed or was cancelled and the files already started have finished
+    bool IsDone() const;
+
+    // Done, and every file was transferred
+    bool CompletedSuccessfully() const;
+
+    // Same CheckDone/Sleep loop as S3FileRequest::WaitUntilDone, the timeout restarting whenever the directory as a whole makes progress
+    bool WaitUntilDone() const;
+
+    // Why the directory as a whole failed (listing it, or setting up the bucket).  Files that failed on their own are in GetFailedRequests
+    Aws::String GetFailure() const;
+
+    // Files found so far - a download keeps adding to these until its listing is complete
+    size_t GetTotalFiles() const;
+    uint64_t GetTotalBytes() const;
+
+    size_t GetFilesCompleted() const;
+    size_t GetFilesFailed() const;
+
+    // Bytes of finished files plus the progress of those in flight
+    uint64_t GetBytesTransferred() const;
+
+    // Percentage of GetTotalBytes
+    float GetProgress() const;
+
+    // Average bytes per second from the first file starting until now, or until the directory was done
+    double GetThroughput() const;
+
+    // The requests of files that didn't transfer, with their GetFileName/GetKeyName/GetFailure
+    Aws::Vector<std::shared_ptr<S3FileRequest> > GetFailedRequests() const;
+
+    // Where a download puts the object keyName listed under keyPrefix, or an empty string when the key doesn't name a file inside directory:
+    // the prefix itself, "folder/" placeholder objects, and keys that could resolve outside it - a ".." segment, a backslash, which Windows
+    // treats as a separator, or a drive letter
+    static Aws::String GetLocalPathForKey(const Aws::String& directory, const Aws::String& keyPrefix, const Aws::String& keyName);
+
+    friend class TransferClient;
+
+private:
+
+    struct FileEntry
+    {
+        Aws::String m_fileName;
+        Aws::String m_keyName;
+        uint64_t m_fileSize;
+        // From the listing of a download, so the object doesn't need a HeadObject of its own
+        Aws::String m_eTag;
+    };
+
+    // Creates the request for one file and sets start to the call that begins it, which is made once the directory is tracking the request
+    using FileTransferFactory = std::function< std::shared_ptr<S3FileRequest>(const FileEntry& file, std::function<void()>& start) >;
+
+    void SetFileTransferFactory(const FileTransferFactory& factory);
+
+    void AddFile(const Aws::String& fileName, const Aws::String& keyName, uint64_t fileSize, const Aws::String& eTag = "");
+
+    // No more files will be added, once those added are done so is the directory
+    void SetListingComplete();
+
+    // Start files until the concurrency limit is reached or none are left
+    void StartFiles();
+
+    void OnFileDone(size_t fileIndex);
+
+    void CheckDone();
+
+    void CompletionFailure(const char* failureStr);
+
+    void Cancel();
+
+    // Uploads that create the bucket do it here once rather than in every file's request
+    void CreateBucket();
+
+    bool HandleCreateBucketOutcome(const Aws::S3::Model::CreateBucketRequest& request,
+        const Aws::S3::Model::CreateBucketOutcome& outcome);
+
+    void WaitForBucketToPropagate();
+
+    bool HandleHeadBucketOutcome(const Aws::S3::Model::HeadBucketRequest& request,
+        const Aws::S3::Model::HeadBucketOutcome& outcome);
+
+    // Downloads list the prefix a page at a time, starting files from each page as it arrives
+    void ListObjects(const Aws::String& marker);
+
+    bool HandleListObjectsOutcome(const Aws::S3::Model::ListObjectsRequest& request,
+        const Aws::S3::Model::ListObjectsOutcome& outcome);
+
+    Aws::String m_directory;
+    Aws::String m_bucketName;
+    Aws::String m_keyPrefix;
+    std::shared_ptr<Aws::S3::S3Client> m_s3Client;
+    uint32_t m_maxConcurrentFiles;
+    FileTransferFactory m_fileTransferFactory;
+
+    mutable std::mutex m_directoryMutex;
+
+    // Everything below is guarded by m_directoryMutex
+    Aws::Vector<FileEntry> m_files;
+    size_t m_nextFile;
+    uint32_t m_filesInFlight;
+    Aws::Map<size_t, std::shared_ptr<S3FileRequest> > m_activeRequests;
+    Aws::Vector<std::shared_ptr<S3FileRequest> > m_failedRequests;
+    size_t m_filesCompleted;
+    uint64_t m_totalBytes;
+    uint64_t m_bytesCompleted;
+    bool m_listingComplete;
+    bool m_cancelled;
+    bool m_failed;
+    Aws::String m_failureString;
+    // A StartFiles loop is running, on this thread or another
+    bool m_startingFiles;
+    bool m_started;
+    std::chrono::steady_clock::time_point m_startTime;
+    std::chrono::steady_clock::time_point m_endTime;
+
+    uint32_t m_createBucketRetries;
+    uint32_t m_headBucketRetries;
+    uint32_t m_listRetries;
+
+    std::atomic<bool> m_isDone;
+    std::atomic<bool> m_completedSuccessfully;
+};
+
+} // namespace Transfer
+} // namespace Aws
@@ -20,7 +20,10 @@
 
 #include <aws/transfer/S3FileRequest.h>
 #include <aws/s3/S3Client.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
+#include <chrono>
 #include <fstream>
 
 namespace Aws
@@ -36,15 +39,27 @@ namespace Http
     class HttpResponse;
 }
 
+namespace Utils
+{
+    class RandomAccessFile;
+}
+
 namespace Transfer
 {
 
 class TransferClient;
+class TransferConcurrencyController;
+class TransferJournal;
 
 class AWS_TRANSFER_API DownloadFileRequest : public S3FileRequest, public std::enable_shared_from_this<DownloadFileRequest>
 {
 public:
-    DownloadFileRequest(const Aws::String& fileName, const Aws::String& bucketName, const Aws::String& keyName, const std::shared_ptr<Aws::S3::S3Client>& s3Client);
+    // Objects larger than partSize are fetched as ranged GetObjects, up to maxConcurrentParts at a time (or as many as concurrencyController
+    // says, when there is one).  Objects that would need more than MAX_UPLOAD_PARTS ranges use bigger ones.  A partSize of 0 always uses a single GetObject.
+    // With useJournal the ranges already in the file are journaled, and a later download of the same object version into the same file only fetches the rest
+    DownloadFileRequest(const Aws::String& fileName, const Aws::String& bucketName, const Aws::String& keyName, const std::shared_ptr<Aws::S3::S3Client>& s3Client,
+        uint64_t partSize = 0, uint32_t maxConcurrentParts = 1, const std::shared_ptr<TransferConcurrencyController>& concurrencyController = nullptr,
+        bool useJournal = false);
     ~DownloadFileRequest();
 
     bool DoSingleObjectDownload();
@@ -55,10 +70,54 @@ public:
 
     uint32_t GetRetries() const { return m_retries; }
 
+    // Number of byte ranges the object is being downloaded in, 0 until the object's size is known and 1 for a single GetObject
+    uint32_t GetTotalParts() const;
+
+    // How many of those ranges were already in the file from an earlier attempt
+    uint32_t GetResumedPartCount() const;
+
     friend class TransferClient;
 
 private:
 
+    struct DownloadPart
+    {
+        uint64_t m_offset;
+        uint64_t m_length;
+        // Written by the part's response stream, checked once its GetObject returns
+        uint64_t m_bytesWritten;
+        // Progress registered for the current attempt, taken back if the part has to be retried
+        uint64_t m_bytesReceived;
+        uint32_t m_retries;
+        // When the current attempt was sent, for the concurrency controller
+        std::chrono::steady_clock::time_point m_startTime;
+        // In the file, by this attempt or an earlier one the journal remembers
+        bool m_completed;
+    };
+
+    void HeadObject();
+
+    bool HandleHeadObjectOutcome(const Aws::S3::Model::HeadObjectRequest& request,
+        const Aws::S3::Model::HeadObjectOutcome& outcome);
+
+    // Size and ETag come from HeadObject, or from the listing of a directory download
+    bool BeginDownload(uint64_t objectSize, const Aws::String& eTag);
+
+    bool DoMultipartDownload(const Aws::String& eTag);
+
+    // True when the journal is from an earlier attempt at this same object version, into a file still the object's size.  Adopts
+    // that attempt's range size and fills completedOffsets with the ranges it finished
+    bool LoadJournal(const Aws::String& eTag, Aws::Set<uint64_t>& completedOffsets);
+
+    void RequestParts();
+
+    void RequestPart(uint32_t partIndex);
+
+    void OnPartDataReceived(uint32_t partIndex, Aws::Http::HttpResponse* response, long long amountReceived);
+
+    bool HandleGetObjectPartOutcome(uint32_t partIndex, const Aws::S3::Model::GetObjectRequest& request,
+        const Aws::S3::Model::GetObjectOutcome& outcome);
+
     bool HandleGetObjectOutcome(const Aws::S3::Model::GetObjectRequest& request,
         const Aws::S3::Model::GetObjectOutcome& outcome);
 
@@ -75,6 +134,22 @@ private:
 
     uint32_t m_retries;
     bool m_gotContents;
+
+    uint64_t m_partSize;
+    uint32_t m_maxConcurrentParts;
+    std::shared_ptr<TransferConcurrencyController> m_concurrencyController;
+
+    // Multipart download state, guarded by m_fileRequestMutex.  m_parts is sized once before the first part is requested
+    Aws::Vector<DownloadPart> m_parts;
+    Aws::String m_eTag;
+    std::shared_ptr<Aws::Utils::RandomAccessFile> m_file;
+    uint32_t m_nextPart;
+    uint32_t m_partsInFlight;
+    uint32_t m_partsCompleted;
+    uint32_t m_partsResumed;
+
+    // Null unless asked for, and only used for multipart downloads
+    std::shared_ptr<TransferJournal> m_journal;
 };
 
 } // namespace Transfer
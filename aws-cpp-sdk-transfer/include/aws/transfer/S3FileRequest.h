@@ -81,6 +81,11 @@ public:
     // Add a callback to be fired on CompletionSuccess
     void AddCompletionCallback(S3FileCompletionCallback addCallback);
 
+    // Add a callback to be fired once when the request is done, whether it succeeded, failed or was cancelled.  Fires right away if it already is
+    void AddDoneCallback(S3FileCompletionCallback addCallback);
+
+    friend class DirectoryTransferRequest;
+
 protected:
 
     const std::shared_ptr<Aws::S3::S3Client>& GetS3Client() const;
@@ -123,6 +128,7 @@ private:
     uint64_t m_fileSize;
     std::atomic<uint64_t> m_progress;
     Aws::List<S3FileCompletionCallback> m_completionCallbacks;
+    Aws::List<S3FileCompletionCallback> m_doneCallbacks;
 };
 
 } // namespace Transfer
@@ -41,15 +41,55 @@ namespace Transfer
 
 class UploadFileRequest;
 class DownloadFileRequest;
+class DirectoryTransferRequest;
+class TransferConcurrencyController;
 
 const uint64_t MB5_BUFFER_SIZE = 5 * 1024 * 1024;
 
+// S3's limits on multipart uploads
+const uint32_t MAX_UPLOAD_PARTS = 10000;
+const uint64_t MAX_UPLOAD_PART_SIZE = 5ULL * 1024 * 1024 * 1024;
+
 struct AWS_TRANSFER_API TransferClientConfiguration
 {
     public:
 
+        TransferClientConfiguration();
+
         uint32_t m_uploadBufferCount;
         std::shared_ptr< UploadBufferResourceManagerType > m_uploadBufferManager;
+
+        // How many parts of one upload may be read into buffers ahead of their part uploads finishing.  Each buffer's part is read
+        // at its own file offset, so this is also how many parts of a file can be read from disk at once.  0 allows up to m_uploadBufferCount
+        uint32_t m_uploadPrefetchDepth;
+
+        // Objects larger than this are downloaded as byte ranges of this size, written into the file at their offsets.  0 downloads every object with a single GetObject
+        uint64_t m_downloadPartSize;
+
+        // How many ranges of one download may be in flight at once
+        uint32_t m_downloadPartConcurrency;
+
+        // How many files of an UploadDirectory/DownloadDirectory are transferred at once.  Uploads are also held to m_uploadBufferCount
+        // files (m_minAutoTuneConcurrency when autotuning), and split the buffers between them, so every file started gets a buffer
+        // without waiting on another file
+        uint32_t m_directoryConcurrency;
+
+        // Smallest part an upload is split into, S3 won't take less than 5MB.  Files that would need more than MAX_UPLOAD_PARTS parts
+        // of this size use bigger ones; parts bigger than a buffer are streamed from the file instead of being read into it
+        uint64_t m_uploadPartSize;
+
+        // Lets throughput and errors decide how many parts are in flight, between m_minAutoTuneConcurrency and m_maxAutoTuneConcurrency.
+        // Uploads start from m_uploadBufferCount and grow or shrink the buffer pool, so up to m_maxAutoTuneConcurrency buffers can be
+        // allocated; downloads start from m_downloadPartConcurrency ranges per file
+        bool m_autoTuneConcurrency;
+        uint32_t m_minAutoTuneConcurrency;
+        uint32_t m_maxAutoTuneConcurrency;
+
+        // Keeps a journal (see TransferJournal) next to each file of a multipart upload or ranged download, so a transfer of the same
+        // file that was cut short - by a crash, a restart, or running out of retries - carries on where it stopped rather than starting
+        // over.  Uploads check the journaled parts against ListParts and downloads the object's ETag before trusting them.  Journals are
+        // removed when their transfer succeeds or is cancelled
+        bool m_useCheckpointJournal;
 };
 
 class AWS_TRANSFER_API TransferClient
@@ -72,15 +112,39 @@ class AWS_TRANSFER_API TransferClient
         // User requested download cancels should go through here
         void CancelDownload(std::shared_ptr<DownloadFileRequest>& fileRequest) const;
 
+        // Uploads every file below directory to keyPrefix followed by the file's path relative to directory, with '/' delimiters (no '/' is added
+        // after keyPrefix).  Files of 5MB or less are a single PutObject, larger ones multipart.  createBucket is checked once for the whole directory
+        std::shared_ptr<DirectoryTransferRequest> UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& keyPrefix, const Aws::String& contentType = "", bool createBucket = false);
+
+        // Downloads every object whose key starts with keyPrefix to the rest of its key below directory, creating subdirectories as needed
+        std::shared_ptr<DirectoryTransferRequest> DownloadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& keyPrefix);
+
+        // User requested directory cancels should go through here - files in flight are cancelled and no more are started
+        void CancelDirectoryTransfer(std::shared_ptr<DirectoryTransferRequest>& directoryRequest) const;
+
         const std::shared_ptr<Aws::S3::S3Client>& GetS3Client() { return m_s3Client; }
 
         uint32_t GetConfigBufferCount() const { return m_config.m_uploadBufferCount; }
 
+        // How many parts are in flight right now when m_autoTuneConcurrency is set, 0 otherwise
+        uint32_t GetUploadConcurrency() const;
+        uint32_t GetDownloadConcurrency() const;
+
+        // Part size for an object of objectSize bytes: partSize, or the smallest whole number of MB that keeps it within MAX_UPLOAD_PARTS parts
+        static uint64_t GetPartSizeForObject(uint64_t objectSize, uint64_t partSize);
+
         friend class UploadFileRequest;
         friend class DownloadFileRequest;
+        friend class DirectoryTransferRequest;
     private:
 
         void UploadFileInternal(std::shared_ptr<UploadFileRequest>& fileRequest);
+
+        // Hands the request up to maxBuffers buffers from bufferManager and starts it.  Static so directory transfers can start files after this returns
+        static void BeginUpload(std::shared_ptr<UploadFileRequest>& fileRequest, const std::shared_ptr<UploadBufferResourceManagerType>& bufferManager, uint32_t maxBuffers);
+
+        // Most buffers one upload may hold, before the prefetch depth and directory share are taken into account
+        uint32_t GetMaxUploadBuffers() const;
   
         void ProcessSingleBuffer(std::shared_ptr<UploadFileRequest>& request, const std::shared_ptr<UploadBuffer>& buffer);
 
@@ -128,6 +192,16 @@ class AWS_TRANSFER_API TransferClient
             const Aws::S3::Model::GetObjectOutcome& outcome,
             const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
 
+        static void OnDownloadGetObjectPart(const Aws::S3::S3Client* s3Client,
+            const Aws::S3::Model::GetObjectRequest& request,
+            const Aws::S3::Model::GetObjectOutcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
+
+        static void OnDownloadHeadObject(const Aws::S3::S3Client* s3Client,
+            const Aws::S3::Model::HeadObjectRequest& request,
+            const Aws::S3::Model::HeadObjectOutcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
+
         static void OnDownloadListObjects(const Aws::S3::S3Client* s3Client,
             const Aws::S3::Model::ListObjectsRequest& request,
             const Aws::S3::Model::ListObjectsOutcome& outcome,
@@ -148,17 +222,41 @@ class AWS_TRANSFER_API TransferClient
             const Aws::S3::Model::ListObjectsOutcome& outcome,
             const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
 
+        static void OnListParts(const Aws::S3::S3Client* s3Client,
+            const Aws::S3::Model::ListPartsRequest& request,
+            const Aws::S3::Model::ListPartsOutcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
+
+        static void OnDirectoryCreateBucket(const Aws::S3::S3Client* s3Client,
+            const Aws::S3::Model::CreateBucketRequest& request,
+            const Aws::S3::Model::CreateBucketOutcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
+
+        static void OnDirectoryHeadBucket(const Aws::S3::S3Client* s3Client,
+            const Aws::S3::Model::HeadBucketRequest& request,
+            const Aws::S3::Model::HeadBucketOutcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
+
+        static void OnDirectoryListObjects(const Aws::S3::S3Client* s3Client,
+            const Aws::S3::Model::ListObjectsRequest& request,
+            const Aws::S3::Model::ListObjectsOutcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
+
         static void OnAbortMultipart(const Aws::S3::S3Client* ,
             const Aws::S3::Model::AbortMultipartUploadRequest& ,
             const Aws::S3::Model::AbortMultipartUploadOutcome& ,
             const std::shared_ptr<const Aws::Client::AsyncCallerContext>& ) {}
 
-        std::shared_ptr< UploadBufferScopedResourceSetType > AcquireUploadBuffers(uint32_t bufferCount);
+        static std::shared_ptr< UploadBufferScopedResourceSetType > AcquireUploadBuffers(const std::shared_ptr<UploadBufferResourceManagerType>& bufferManager, uint32_t bufferCount);
 
         std::shared_ptr<Aws::S3::S3Client> m_s3Client;
         TransferClientConfiguration m_config;
 
         std::shared_ptr<UploadBufferResourceManagerType> m_uploadBufferManager;
+
+        // Only set when m_config.m_autoTuneConcurrency is
+        std::shared_ptr<TransferConcurrencyController> m_uploadConcurrencyController;
+        std::shared_ptr<TransferConcurrencyController> m_downloadConcurrencyController;
     
 };
 
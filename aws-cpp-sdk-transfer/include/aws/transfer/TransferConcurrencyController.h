@@ -0,0 +1,86 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/transfer/Transfer_EXPORTS.h>
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+
+namespace Aws
+{
+namespace Transfer
+{
+
+// Picks how many parts should be in flight from how the parts that finished did.  Parts are counted in windows of at least
+// as many parts as are allowed in flight, and throughput is a window's bytes over the time from its first part starting to its
+// last one finishing.  At the end of each window:
+//   - if more than a tenth of the window's parts failed, the concurrency is halved
+//   - otherwise, climbing, it keeps going up in growing steps while throughput improves by more than 5% on the last window
+//   - once that stops it comes back down a part at a time until throughput falls more than 5% short of the best it saw, then
+//     turns to climb again; so it settles around the fewest parts that fill the link
+// Thread-safe; onChange is called with the new concurrency, outside the controller's lock, whenever it changes
+class AWS_TRANSFER_API TransferConcurrencyController
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using ConcurrencyChangedCallback = std::function<void(uint32_t)>;
+
+    TransferConcurrencyController(uint32_t initialConcurrency, uint32_t minConcurrency, uint32_t maxConcurrency, const ConcurrencyChangedCallback& onChange = nullptr);
+
+    uint32_t GetConcurrency() const;
+
+    // bytes is what the part sent or received, 0 is fine for failures
+    void RecordPart(uint64_t bytes, bool succeeded, Clock::time_point startedAt, Clock::time_point finishedAt);
+    void RecordPart(uint64_t bytes, bool succeeded, Clock::time_point startedAt) { RecordPart(bytes, succeeded, startedAt, Clock::now()); }
+
+private:
+
+    // Called with m_controllerMutex held, returns the new concurrency
+    uint32_t EndWindow();
+
+    uint32_t Clamp(int64_t concurrency) const;
+
+    mutable std::mutex m_controllerMutex;
+    // Keeps changes reaching onChange in the order they were made
+    std::mutex m_notifyMutex;
+
+    uint32_t m_minConcurrency;
+    uint32_t m_maxConcurrency;
+    uint32_t m_concurrency;
+
+    ConcurrencyChangedCallback m_onChange;
+
+    // +1 or -1, and how far the next move goes
+    int32_t m_direction;
+    uint32_t m_step;
+
+    // Throughput of the last window that didn't back off for errors, 0 when there is nothing to compare against
+    double m_lastThroughput;
+    // Best throughput seen before the current descent
+    double m_bestThroughput;
+
+    // The window being filled
+    uint32_t m_windowParts;
+    uint32_t m_windowFailures;
+    uint64_t m_windowBytes;
+    Clock::time_point m_windowStart;
+    Clock::time_point m_windowEnd;
+};
+
+} // namespace Transfer
+} // namespace Aws
@@ -24,6 +24,7 @@ namespace Transfer
 {
     class UploadFileRequest;
     class DownloadFileRequest;
+    class DirectoryTransferRequest;
 
     class UploadFileContext : public Aws::Client::AsyncCallerContext
     {
@@ -43,13 +44,31 @@ namespace Transfer
     {
     public:
 
-        DownloadFileContext(std::shared_ptr<DownloadFileRequest> downloadRequest);
+        DownloadFileContext(std::shared_ptr<DownloadFileRequest> downloadRequest, uint32_t partIndex = 0);
 
         std::shared_ptr<DownloadFileRequest> GetDownloadRequest() const { return m_request; }
 
+        // Which byte range of a multipart download the request was for
+        uint32_t GetPartIndex() const { return m_partIndex; }
+
     private:
 
         std::shared_ptr<DownloadFileRequest> m_request;
+        uint32_t m_partIndex;
+
+    };
+
+    class DirectoryTransferContext : public Aws::Client::AsyncCallerContext
+    {
+    public:
+
+        DirectoryTransferContext(std::shared_ptr<DirectoryTransferRequest> directoryRequest);
+
+        std::shared_ptr<DirectoryTransferRequest> GetDirectoryRequest() const { return m_request; }
+
+    private:
+
+        std::shared_ptr<DirectoryTransferRequest> m_request;
 
     };
 
@@ -0,0 +1,70 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/transfer/Transfer_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <mutex>
+
+namespace Aws
+{
+namespace Transfer
+{
+
+// An append-only record of how far a transfer got, kept next to the local file (JOURNAL_EXTENSION added to its name) so that a
+// transfer interrupted by the process going away can carry on from there.  Each record is one line of space separated, %XX escaped fields;
+// a last line cut short by a crash is dropped when the journal is read back.  Records are flushed as they are appended,
+// which is enough to survive the process but not the machine
+class AWS_TRANSFER_API TransferJournal
+{
+public:
+    using Record = Aws::Vector<Aws::String>;
+
+    static const char* JOURNAL_EXTENSION;
+
+    explicit TransferJournal(const Aws::String& fileName);
+    ~TransferJournal();
+
+    const Aws::String& GetPath() const { return m_path; }
+
+    // Every whole record in the journal, oldest first.  Empty when there is no journal
+    Aws::Vector<Record> Read() const;
+
+    // Replaces any journal already there with one holding just record
+    bool Start(const Record& record);
+
+    // Adds record to the journal started by Start
+    bool Append(const Record& record);
+
+    // Done with the transfer, or its progress is no use any more
+    void Remove();
+
+private:
+
+    bool Write(const Record& record);
+
+    Aws::String m_path;
+
+    std::mutex m_journalMutex;
+    Aws::UniquePtr<Aws::OFStream> m_stream;
+};
+
+} // namespace Transfer
+} // namespace Aws
@@ -20,15 +20,19 @@
 
 #include <aws/transfer/S3FileRequest.h>
 
+#include <aws/core/utils/RandomAccessFile.h>
+#include <aws/core/utils/crypto/MultiHash.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
+#include <aws/s3/model/CompletedPart.h>
 #include <aws/s3/model/UploadPartRequest.h>
 
 #include <aws/transfer/TransferClientDefs.h>
 
-#include <fstream>
+#include <chrono>
 
 namespace Aws
 {
@@ -36,10 +40,6 @@ namespace S3
 {
     class S3Client;
 
-    namespace Model
-    {
-        class CompletedPart;
-    }
 } // namespace S3
 
 namespace Http
@@ -50,6 +50,8 @@ namespace Http
 namespace Transfer
 {
 
+class TransferConcurrencyController;
+class TransferJournal;
 
 // PartRequestRecord is an individual piece of a multi part upload.  
 // m_partRequest contains the information S3 cares about for the request
@@ -57,6 +59,7 @@ namespace Transfer
 // m_partMd5 is to make sure our Md5 matches when the request returns successfully
 // m_retries lets us retry the same request using this record in case of a failure 
 // up to PART_RETRY_MAX (2 default) attempts
+// m_startTime is when the current attempt was sent, for the concurrency controller
 struct AWS_TRANSFER_API PartRequestRecord
 {
 public:
@@ -71,6 +74,7 @@ public:
     Aws::S3::Model::UploadPartRequest m_partRequest;
     Aws::Utils::ByteBuffer m_partMd5;
     uint32_t m_retries;
+    std::chrono::steady_clock::time_point m_startTime;
 };
 
 class AWS_TRANSFER_API UploadFileRequest : public S3FileRequest, public std::enable_shared_from_this<UploadFileRequest>
@@ -82,7 +86,10 @@ public:
                       const Aws::String& contentType, 
                       const std::shared_ptr<Aws::S3::S3Client>& s3Client, 
                       bool createBucket,
-                      bool doConsistencyChecks);
+                      bool doConsistencyChecks,
+                      uint64_t partSize = UPLOAD_BUFFER_SIZE,
+                      const std::shared_ptr<TransferConcurrencyController>& concurrencyController = nullptr,
+                      bool useJournal = false);
     ~UploadFileRequest();
 
     // How many parts have we at least begun to upload
@@ -94,6 +101,9 @@ public:
     // Total number of parts we'll be dividing the file into for upload
     uint32_t GetTotalParts() const { return m_totalParts;  }
 
+    // Size of every part but the last - at least the part size asked for, more for files that would otherwise need too many parts
+    uint64_t GetPartSize() const { return m_partSize; }
+
     // DoneWithRequests is Requested parts == TotalParts (Happens just before the final requests return and IsDone is set when all goes well)
     bool DoneWithRequests() const;
 
@@ -126,6 +136,9 @@ public:
     bool HasPassedGetObject() const { return m_getObjectPassed.load(); }
     bool HasPassedListObjects() const { return m_listObjectsPassed.load(); }
 
+    // How many parts a journal from an earlier attempt let us skip, once ListParts has confirmed them
+    size_t GetResumedPartCount() const { return m_resumedParts.size(); }
+
     friend class TransferClient;
 
 protected:
@@ -136,7 +149,8 @@ private:
     // TransferClient uses these calls
     bool ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffer);
  
-    uint64_t ReadNextPart(const std::shared_ptr<UploadBuffer>& buffer, std::shared_ptr<Aws::IOStream>& streamBuf, uint32_t& partNum);
+    // Claims the next part and hashes it, leaving it in buffer if it fits
+    uint64_t ReadNextPart(const std::shared_ptr<UploadBuffer>& buffer, uint32_t& partNum, uint64_t& offset, Aws::Utils::Crypto::MultiHash& partHash);
 
     void AddCompletedPart(PartRequestRecord& partRequest, const Aws::String& eTag);
     void CompleteUpload();
@@ -160,6 +174,11 @@ private:
     bool CreateMultipartUpload();
     virtual bool IsReady() const override;
 
+    // Picks up the upload id and completed parts of an earlier attempt at this same file, if the journal has them
+    void LoadJournal();
+    // Asks S3 which of the journal's parts it really has before any are skipped
+    bool ListParts(long partNumberMarker);
+
     bool HasUploadId() const;
     const Aws::String& GetUploadId() const { return m_uploadId;  }
     // Testing
@@ -171,6 +190,9 @@ private:
 
     void ReusePart(PartRequestRecord& partRequest);
 
+    // Gives a buffer back to the pool rather than reusing it when more parts are in flight than the concurrency controller wants
+    bool ReleaseExcessBuffer(const std::shared_ptr<UploadBuffer>& buffer);
+
     void PartReturned(PartRequestRecord& partRequest);
 
     void SingleUploadComplete();
@@ -202,13 +224,16 @@ private:
     bool HandleListObjectsOutcome(const Aws::S3::Model::ListObjectsRequest& request,
         const Aws::S3::Model::ListObjectsOutcome& outcome);
 
+    bool HandleListPartsOutcome(const Aws::S3::Model::ListPartsRequest& request,
+        const Aws::S3::Model::ListPartsOutcome& outcome);
+
     void AddReadyBuffer(std::shared_ptr<UploadBuffer> buffer);
     bool GetReadyBuffer(std::shared_ptr<UploadBuffer>& buffer);
     bool ProcessAvailableBuffers();
 
     // Uploads 5mb or less need to perform a single put call - attempting to do a multi part upload with these small 
     // files can cause failures in S3
-    bool DoSingleObjectUpload(std::shared_ptr<Aws::IOStream>& streamBuf, uint64_t bytesRead);
+    bool DoSingleObjectUpload(std::shared_ptr<Aws::IOStream>& streamBuf, uint64_t bytesRead, const Aws::Utils::Crypto::MultiHash& bodyHash);
     
     void SendPutObjectRequest(const Aws::S3::Model::PutObjectRequest& request);
 
@@ -242,16 +267,30 @@ private:
     std::atomic<bool> m_createMultipartUploadPending;
     std::atomic<bool> m_headBucketPending;
     std::atomic<bool> m_completeMultipartUploadPending;
+    std::atomic<bool> m_verifyingResume;
+    std::atomic<bool> m_listPartsPending;
 
     bool m_bucketPropagated;
 
     uint32_t m_totalParts;
+    uint64_t m_partSize;
+
+    // Parts are read with positional reads at their own offsets, so only claiming a part number happens under m_fileRequestMutex.
+    // Shared with the bodies of parts too large for a buffer, which read it as they are sent
+    std::shared_ptr<Aws::Utils::RandomAccessFile> m_sourceFile;
 
-    Aws::IFStream m_fileStream;
+    std::shared_ptr<TransferConcurrencyController> m_concurrencyController;
 
     Aws::Map<uint32_t, Aws::S3::Model::CompletedPart> m_completedParts;
     Aws::Map<uint32_t, PartRequestRecord> m_pendingParts;
 
+    // Null unless the upload is multipart and asked for a journal
+    std::shared_ptr<TransferJournal> m_journal;
+    // Parts the journal says were done, until ListParts confirms them
+    Aws::Map<uint32_t, Aws::S3::Model::CompletedPart> m_journaledParts;
+    // Parts ListParts confirmed, which are never read or sent.  Only written before any part starts, so read without a lock
+    Aws::Set<uint32_t> m_resumedParts;
+
     Aws::List<std::shared_ptr<UploadBuffer> > m_buffersReady;
 
     Aws::String m_contentType;
@@ -259,6 +298,7 @@ private:
     uint32_t m_createMultipartRetries;
     uint32_t m_createBucketRetries;
     uint32_t m_completeRetries;
+    uint32_t m_listPartsRetries;
     uint32_t m_singleRetry;
     bool m_doConsistencyChecks;
 
@@ -214,12 +214,15 @@ void FairBoundedResourceManager< T >::AdjustResourceCount(uint32_t resourceCount
 
     std::unique_lock<std::mutex> lock(m_resourcesMutex);
 
-    if(resourceCount > m_currentResourceCount)
+    if(resourceCount >= m_desiredResourceCount)
     {
         // Grow request
 
+        // a shrink that hasn't finished yet (resources still out) just stops short of where it was going
+        m_desiredResourceCount = resourceCount;
+
         // add a corresponding amount of resources
-        for(uint32_t i = 0; i < resourceCount - m_currentResourceCount; ++i)
+        for(; m_currentResourceCount < resourceCount; ++m_currentResourceCount)
         {
             m_freeResources.push_back(m_resourceFactory());
         }
@@ -238,7 +241,7 @@ void FairBoundedResourceManager< T >::AdjustResourceCount(uint32_t resourceCount
             return;
         }
     }
-    else if (resourceCount < m_currentResourceCount)
+    else
     {
         // Shrink request
 
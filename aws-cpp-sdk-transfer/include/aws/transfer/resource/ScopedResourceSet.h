@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include <aws/transfer/Transfer_EXPORTS.h>
 
 #include <aws/transfer/resource/ResourceManagerInterface.h>
@@ -35,6 +37,12 @@ class ScopedResourceSet
 
         void TryReacquire();
 
+        // Tops the set up to no more than resourceLimit resources
+        void TryReacquire(uint32_t resourceLimit);
+
+        // Hands one resource back to the manager before the set goes away; a later TryReacquire may get it (or another) back
+        bool ReleaseResource(const T& resource);
+
         const typename ResourceManagerInterface< T >::ResourceListType& GetResources() const { return m_resources; }
         
     private:
@@ -64,11 +72,35 @@ ScopedResourceSet< T >::~ScopedResourceSet()
 template< typename T >
 void ScopedResourceSet< T >::TryReacquire()
 {
-    if(m_desiredResourceCount > m_resources.size())
+    TryReacquire(m_desiredResourceCount);
+}
+
+template< typename T >
+void ScopedResourceSet< T >::TryReacquire(uint32_t resourceLimit)
+{
+    uint32_t resourceCount = std::min(m_desiredResourceCount, resourceLimit);
+    if(resourceCount > m_resources.size())
     {
-        m_resourceOwner->TryAcquireResources(m_desiredResourceCount, m_resources);
+        m_resourceOwner->TryAcquireResources(resourceCount, m_resources);
     }
 }
 
+template< typename T >
+bool ScopedResourceSet< T >::ReleaseResource(const T& resource)
+{
+    auto resourceIter = std::find(m_resources.begin(), m_resources.end(), resource);
+    if (resourceIter == m_resources.end())
+    {
+        return false;
+    }
+
+    typename ResourceManagerInterface< T >::ResourceListType released;
+    released.push_back(*resourceIter);
+    m_resources.erase(resourceIter);
+
+    m_resourceOwner->ReleaseResources(released);
+    return true;
+}
+
 } // namespace Transfer
 } // namespace Aws
@@ -0,0 +1,544 @@
+
+/*
+* Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/transfer/DirectoryTransferRequest.h>
+
+#include <aws/transfer/TransferClient.h>
+#include <aws/transfer/TransferContext.h>
+
+#include <aws/s3/model/CreateBucketRequest.h>
+#include <aws/s3/model/HeadBucketRequest.h>
+#include <aws/s3/model/ListObjectsRequest.h>
+
+#include <aws/core/utils/FileSystemUtils.h>
+
+#include <algorithm>
+#include <thread>
+
+using namespace Aws::S3::Model;
+using namespace Aws::Utils;
+
+namespace Aws
+{
+namespace Transfer
+{
+
+static const char* ALLOCATION_TAG = "TransferAPI";
+
+static const uint32_t DIRECTORY_WAIT_TIMEOUT = 100; // In the WaitUntilDone loop this is the maximum time we'll wait without making further progress before bailing out
+static const uint32_t CREATE_BUCKET_RETRY_MAX = 2;
+static const uint32_t HEAD_BUCKET_RETRY_MAX = 20; // Waiting on a new bucket to propagate, as UploadFileRequest does
+static const uint32_t LIST_RETRY_MAX = 2;
+
+static bool IsDriveLetter(const Aws::String& path)
+{
+    return path.length() >= 2 && path[1] == ':' && ((path[0] >= 'A' && path[0] <= 'Z') || (path[0] >= 'a' && path[0] <= 'z'));
+}
+
+Aws::String DirectoryTransferRequest::GetLocalPathForKey(const Aws::String& directory, const Aws::String& keyPrefix, const Aws::String& keyName)
+{
+    if (keyName.compare(0, keyPrefix.length(), keyPrefix) != 0)
+    {
+        return "";
+    }
+
+    Aws::String relativePath = keyName.substr(keyPrefix.length());
+    relativePath.erase(0, relativePath.find_first_not_of('/'));
+    if (relativePath.empty() || relativePath.back() == '/' || IsDriveLetter(relativePath))
+    {
+        return "";
+    }
+
+    // Keys are only split on '/', but Windows splits paths on '\\' too, and "..\\" climbs out just like "../".  Backslashes are refused on
+    // every platform, so a listing maps to the same files everywhere
+    size_t segmentStart = 0;
+    while (segmentStart <= relativePath.length())
+    {
+        size_t segmentEnd = relativePath.find('/', segmentStart);
+        if (segmentEnd == Aws::String::npos)
+        {
+            segmentEnd = relativePath.length();
+        }
+        Aws::String segment = relativePath.substr(segmentStart, segmentEnd - segmentStart);
+        if (segment == ".." || segment.find('\\') != Aws::String::npos)
+        {
+            return "";
+        }
+        segmentStart = segmentEnd + 1;
+    }
+
+    std::replace(relativePath.begin(), relativePath.end(), '/', FileSystemUtils::GetPathDelimiter());
+    return directory + FileSystemUtils::GetPathDelimiter() + relativePath;
+}
+
+DirectoryTransferRequest::DirectoryTransferRequest(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& keyPrefix, const std::shared_ptr<Aws::S3::S3Client>& s3Client,
+    uint32_t maxConcurrentFiles) :
+m_directory(directory),
+m_bucketName(bucketName),
+m_keyPrefix(keyPrefix),
+m_s3Client(s3Client),
+m_maxConcurrentFiles(std::max(maxConcurrentFiles, 1u)),
+m_nextFile(0),
+m_filesInFlight(0),
+m_filesCompleted(0),
+m_totalBytes(0),
+m_bytesCompleted(0),
+m_listingComplete(false),
+m_cancelled(false),
+m_failed(false),
+m_startingFiles(false),
+m_started(false),
+m_createBucketRetries(0),
+m_headBucketRetries(0),
+m_listRetries(0),
+m_isDone(false),
+m_completedSuccessfully(false)
+{
+    while (m_directory.length() > 1 && m_directory.back() == FileSystemUtils::GetPathDelimiter())
+    {
+        m_directory.pop_back();
+    }
+}
+
+DirectoryTransferRequest::~DirectoryTransferRequest()
+{
+
+}
+
+bool DirectoryTransferRequest::IsDone() const
+{
+    return m_isDone.load();
+}
+
+bool DirectoryTransferRequest::CompletedSuccessfully() const
+{
+    return m_completedSuccessfully.load();
+}
+
+bool DirectoryTransferRequest::WaitUntilDone() const
+{
+    unsigned timeoutCount = 0;
+    uint64_t bytesTransferred = GetBytesTransferred();
+    size_t filesDone = GetFilesCompleted() + GetFilesFailed();
+    while (timeoutCount++ < DIRECTORY_WAIT_TIMEOUT)
+    {
+        if (IsDone())
+        {
+            break;
+        }
+        // Let's reset our timeout
+        if (GetBytesTransferred() != bytesTransferred || GetFilesCompleted() + GetFilesFailed() != filesDone)
+        {
+            timeoutCount = 0;
+            bytesTransferred = GetBytesTransferred();
+            filesDone = GetFilesCompleted() + GetFilesFailed();
+        }
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+
+    return IsDone();
+}
+
+Aws::String DirectoryTransferRequest::GetFailure() const
+{
+    std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+    return m_failureString;
+}
+
+size_t DirectoryTransferRequest::GetTotalFiles() const
+{
+    std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+    return m_files.size();
+}
+
+uint64_t DirectoryTransferRequest::GetTotalBytes() const
+{
+    std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+    return m_totalBytes;
+}
+
+size_t DirectoryTransferRequest::GetFilesCompleted() const
+{
+    std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+    return m_filesCompleted;
+}
+
+size_t DirectoryTransferRequest::GetFilesFailed() const
+{
+    std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+    return m_failedRequests.size();
+}
+
+uint64_t DirectoryTransferRequest::GetBytesTransferred() const
+{
+    std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+
+    uint64_t bytesTransferred = m_bytesCompleted;
+    for (auto& activeRequest : m_activeRequests)
+    {
+        // Retried parts can count their bytes more than once, never report more of a file than it has
+        bytesTransferred += std::min(activeRequest.second->GetProgressAmount(), m_files[activeRequest.first].m_fileSize);
+    }
+    return bytesTransferred;
+}
+
+float DirectoryTransferRequest::GetProgress() const
+{
+    if (CompletedSuccessfully())
+    {
+        return 100.0f;
+    }
+
+    uint64_t totalBytes = GetTotalBytes();
+    if (!totalBytes)
+    {
+        return 0.0f;
+    }
+    return std::min(static_cast<float>(static_cast<double>(GetBytesTransferred()) * 100.0f / totalBytes), 100.0f);
+}
+
+double DirectoryTransferRequest::GetThroughput() const
+{
+    std::chrono::steady_clock::time_point startTime;
+    std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+        if (!m_started)
+        {
+            return 0.0;
+        }
+        startTime = m_startTime;
+        if (IsDone())
+        {
+            endTime = m_endTime;
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(endTime - startTime).count();
+    return seconds > 0.0 ? static_cast<double>(GetBytesTransferred()) / seconds : 0.0;
+}
+
+Aws::Vector<std::shared_ptr<S3FileRequest> > DirectoryTransferRequest::GetFailedRequests() const
+{
+    std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+    return m_failedRequests;
+}
+
+void DirectoryTransferRequest::SetFileTransferFactory(const FileTransferFactory& factory)
+{
+    m_fileTransferFactory = factory;
+}
+
+void DirectoryTransferRequest::AddFile(const Aws::String& fileName, const Aws::String& keyName, uint64_t fileSize, const Aws::String& eTag)
+{
+    FileEntry file;
+    file.m_fileName = fileName;
+    file.m_keyName = keyName;
+    file.m_fileSize = fileSize;
+    file.m_eTag = eTag;
+
+    std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+    m_files.push_back(file);
+    m_totalBytes += fileSize;
+}
+
+void DirectoryTransferRequest::SetListingComplete()
+{
+    {
+        std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+        m_listingComplete = true;
+    }
+    CheckDone();
+}
+
+void DirectoryTransferRequest::StartFiles()
+{
+    {
+        // A file that fails as it is created (one that can't be opened, say) is done inside AddDoneCallback below, and its OnFileDone lands
+        // back here.  Whoever is already starting files picks up the slot it freed, rather than every such file adding to the stack
+        std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+        if (m_startingFiles)
+        {
+            return;
+        }
+        m_startingFiles = true;
+    }
+
+    for (;;)
+    {
+        size_t fileIndex = 0;
+        FileEntry file;
+        {
+            std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+            if (m_cancelled || m_failed || m_filesInFlight >= m_maxConcurrentFiles || m_nextFile >= m_files.size())
+            {
+                m_startingFiles = false;
+                break;
+            }
+            if (!m_started)
+            {
+                m_started = true;
+                m_startTime = std::chrono::steady_clock::now();
+            }
+            fileIndex = m_nextFile++;
+            ++m_filesInFlight;
+            file = m_files[fileIndex];
+        }
+
+        std::function<void()> start;
+        std::shared_ptr<S3FileRequest> fileRequest = m_fileTransferFactory(file, start);
+        {
+            std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+            m_activeRequests[fileIndex] = fileRequest;
+        }
+
+        // The callback keeps the directory alive until its last file is done
+        auto self = shared_from_this();
+        fileRequest->AddDoneCallback([self, fileIndex]() { self->OnFileDone(fileIndex); });
+        if (start)
+        {
+            start();
+        }
+    }
+
+    CheckDone();
+}
+
+void DirectoryTransferRequest::OnFileDone(size_t fileIndex)
+{
+    {
+        std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+
+        auto requestIter = m_activeRequests.find(fileIndex);
+        if (requestIter == m_activeRequests.end())
+        {
+            return;
+        }
+
+        std::shared_ptr<S3FileRequest> fileRequest = requestIter->second;
+        m_activeRequests.erase(requestIter);
+        --m_filesInFlight;
+
+        if (fileRequest->CompletedSuccessfully())
+        {
+            ++m_filesCompleted;
+            m_bytesCompleted += m_files[fileIndex].m_fileSize;
+        }
+        else
+        {
+            m_failedRequests.push_back(fileRequest);
+        }
+    }
+
+    StartFiles();
+}
+
+void DirectoryTransferRequest::CheckDone()
+{
+    bool completedSuccessfully = false;
+    {
+        std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+        if (IsDone() || m_filesInFlight)
+        {
+            return;
+        }
+        if (!m_cancelled && !m_failed && !(m_listingComplete && m_nextFile == m_files.size()))
+        {
+            return;
+        }
+
+        completedSuccessfully = !m_cancelled && !m_failed && m_failedRequests.empty();
+        m_endTime = std::chrono::steady_clock::now();
+        if (!m_started)
+        {
+            m_startTime = m_endTime;
+            m_started = true;
+        }
+    }
+
+    m_completedSuccessfully.store(completedSuccessfully);
+    m_isDone.store(true);
+}
+
+void DirectoryTransferRequest::CompletionFailure(const char* failureStr)
+{
+    {
+        std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+        if (m_failed)
+        {
+            return;
+        }
+        m_failed = true;
+        if (failureStr)
+        {
+            m_failureString = failureStr;
+        }
+    }
+    // Files already started finish on their own, nothing new is started
+    CheckDone();
+}
+
+void DirectoryTransferRequest::Cancel()
+{
+    Aws::Vector<std::shared_ptr<S3FileRequest> > activeRequests;
+    {
+        std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+        m_cancelled = true;
+        for (auto& activeRequest : m_activeRequests)
+        {
+            activeRequests.push_back(activeRequest.second);
+        }
+    }
+
+    for (auto& activeRequest : activeRequests)
+    {
+        activeRequest->Cancel();
+    }
+    CheckDone();
+}
+
+void DirectoryTransferRequest::CreateBucket()
+{
+    CreateBucketRequest createBucketRequest;
+    createBucketRequest.SetBucket(GetBucketName());
+    createBucketRequest.SetACL(BucketCannedACL::private_);
+
+    std::shared_ptr<Aws::Client::AsyncCallerContext> context = Aws::MakeShared<DirectoryTransferContext>(ALLOCATION_TAG, shared_from_this());
+
+    m_s3Client->CreateBucketAsync(createBucketRequest, &TransferClient::OnDirectoryCreateBucket, context);
+}
+
+bool DirectoryTransferRequest::HandleCreateBucketOutcome(const Aws::S3::Model::CreateBucketRequest& request, const Aws::S3::Model::CreateBucketOutcome& outcome)
+{
+    AWS_UNREFERENCED_PARAM(request);
+
+    if (outcome.IsSuccess())
+    {
+        WaitForBucketToPropagate();
+        return true;
+    }
+
+    // Bucket is already there, didn't need to create it
+    if (outcome.GetError().GetErrorType() == S3::S3Errors::BUCKET_ALREADY_EXISTS)
+    {
+        StartFiles();
+        return true;
+    }
+    if (m_createBucketRetries < CREATE_BUCKET_RETRY_MAX)
+    {
+        ++m_createBucketRetries;
+        CreateBucket();
+        return false;
+    }
+    CompletionFailure(outcome.GetError().GetMessage().c_str());
+    return false;
+}
+
+void DirectoryTransferRequest::WaitForBucketToPropagate()
+{
+    HeadBucketRequest headBucketRequest;
+    headBucketRequest.SetBucket(GetBucketName());
+
+    std::shared_ptr<Aws::Client::AsyncCallerContext> context = Aws::MakeShared<DirectoryTransferContext>(ALLOCATION_TAG, shared_from_this());
+
+    m_s3Client->HeadBucketAsync(headBucketRequest, &TransferClient::OnDirectoryHeadBucket, context);
+}
+
+bool DirectoryTransferRequest::HandleHeadBucketOutcome(const Aws::S3::Model::HeadBucketRequest& request, const Aws::S3::Model::HeadBucketOutcome& outcome)
+{
+    AWS_UNREFERENCED_PARAM(request);
+
+    if (outcome.IsSuccess())
+    {
+        StartFiles();
+        return true;
+    }
+    if (m_headBucketRetries < HEAD_BUCKET_RETRY_MAX)
+    {
+        ++m_headBucketRetries;
+        WaitForBucketToPropagate();
+        return false;
+    }
+    CompletionFailure(outcome.GetError().GetMessage().c_str());
+    return false;
+}
+
+void DirectoryTransferRequest::ListObjects(const Aws::String& marker)
+{
+    ListObjectsRequest listObjectsRequest;
+    listObjectsRequest.SetBucket(GetBucketName());
+    if (GetKeyPrefix().length())
+    {
+        listObjectsRequest.SetPrefix(GetKeyPrefix());
+    }
+    if (marker.length())
+    {
+        listObjectsRequest.SetMarker(marker);
+    }
+
+    std::shared_ptr<Aws::Client::AsyncCallerContext> context = Aws::MakeShared<DirectoryTransferContext>(ALLOCATION_TAG, shared_from_this());
+
+    m_s3Client->ListObjectsAsync(listObjectsRequest, &TransferClient::OnDirectoryListObjects, context);
+}
+
+bool DirectoryTransferRequest::HandleListObjectsOutcome(const Aws::S3::Model::ListObjectsRequest& request, const Aws::S3::Model::ListObjectsOutcome& outcome)
+{
+    if (!outcome.IsSuccess())
+    {
+        if (m_listRetries < LIST_RETRY_MAX)
+        {
+            ++m_listRetries;
+            ListObjects(request.GetMarker());
+            return false;
+        }
+        CompletionFailure(outcome.GetError().GetMessage().c_str());
+        return false;
+    }
+    m_listRetries = 0;
+
+    const Aws::Vector<Object>& contents = outcome.GetResult().GetContents();
+    for (auto& thisObject : contents)
+    {
+        Aws::String fileName = GetLocalPathForKey(GetDirectory(), GetKeyPrefix(), thisObject.GetKey());
+        if (fileName.length())
+        {
+            AddFile(fileName, thisObject.GetKey(), static_cast<uint64_t>(thisObject.GetSize()), thisObject.GetETag());
+        }
+    }
+
+    bool moreToList = false;
+    {
+        std::lock_guard<std::mutex> directoryLock(m_directoryMutex);
+        moreToList = !m_cancelled && !m_failed && outcome.GetResult().GetIsTruncated() && contents.size();
+    }
+    if (moreToList)
+    {
+        // Without a delimiter S3 doesn't return NextMarker, the last key is where the next page starts
+        const Aws::String& nextMarker = outcome.GetResult().GetNextMarker();
+        ListObjects(nextMarker.length() ? nextMarker : contents.back().GetKey());
+    }
+
+    // Start on this page while the next one is listed
+    StartFiles();
+    if (!moreToList)
+    {
+        SetListingComplete();
+    }
+    return true;
+}
+
+} // namespace Transfer
+} // namespace Aws
@@ -18,11 +18,21 @@
 
 #include <aws/transfer/TransferClient.h>
 #include <aws/transfer/TransferContext.h>
+#include <aws/transfer/TransferConcurrencyController.h>
+#include <aws/transfer/TransferJournal.h>
 
 #include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/HeadObjectRequest.h>
 #include <aws/s3/model/ListObjectsRequest.h>
 
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/RandomAccessFile.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
 #include <algorithm>
+#include <cstring>
 
 using namespace Aws::S3::Model;
 using namespace Aws::Utils;
@@ -36,10 +46,205 @@ static const char* ALLOCATION_TAG = "TransferAPI";
 
 static const uint32_t DOWNLOAD_RETRY_MAX = 2;
 static const float DOWNLOAD_RETRY_THRESHOLD = 10.0f;
+static const uint32_t DOWNLOAD_PART_RETRY_MAX = 2; // How many failures of a single range fail the whole download
+
+// Journal records.  The header names the object version and how it was split up:
+//   download <bucket> <key> <object size> <etag> <range size>
+// followed by one record per range written to the file:
+//   range <offset> <length>
+static const char* JOURNAL_DOWNLOAD_RECORD = "download";
+static const char* JOURNAL_RANGE_RECORD = "range";
+static const size_t JOURNAL_DOWNLOAD_FIELDS = 6;
+static const size_t JOURNAL_RANGE_FIELDS = 3;
+
+// Response body for one range of a multipart download.  Until BindToFile is called, the body is held in memory, so an error response never reaches
+// the file.  Once bound, writes go straight into the file at the range's offset, so parts can arrive in any order without a stream position shared
+// between them.  Either way what was written can be read back, which is how an error response body gets parsed.
+class PartFileStreamBuf : public std::streambuf
+{
+public:
+    PartFileStreamBuf(const std::shared_ptr<RandomAccessFile>& file, uint64_t offset, uint64_t* bytesWritten) :
+        m_file(file),
+        m_offset(offset),
+        m_position(0),
+        m_bytesWritten(bytesWritten),
+        m_bound(false),
+        m_failed(false)
+    {
+        *m_bytesWritten = 0;
+    }
+
+    // Moves what has been held back into the file; everything written after goes straight there
+    void BindToFile()
+    {
+        if (m_bound)
+        {
+            return;
+        }
+
+        DiscardGetArea();
+        m_bound = true;
+        if (!m_pending.empty())
+        {
+            if (m_file->WriteAt(m_offset, m_pending.c_str(), m_pending.size()))
+            {
+                *m_bytesWritten = m_pending.size();
+            }
+            else
+            {
+                m_failed = true;
+            }
+        }
+        Aws::String().swap(m_pending);
+    }
 
-DownloadFileRequest::DownloadFileRequest(const Aws::String& fileName, const Aws::String& bucketName, const Aws::String& keyName, const std::shared_ptr<Aws::S3::S3Client>& s3Client) : S3FileRequest(fileName, bucketName, keyName, s3Client),
+protected:
+    std::streamsize xsputn(const char* data, std::streamsize count) override
+    {
+        DiscardGetArea();
+        if (count <= 0 || m_failed)
+        {
+            return 0;
+        }
+
+        if (m_bound)
+        {
+            if (!m_file->WriteAt(m_offset + m_position, data, static_cast<size_t>(count)))
+            {
+                m_failed = true;
+                return 0;
+            }
+            *m_bytesWritten = std::max(*m_bytesWritten, m_position + count);
+        }
+        else
+        {
+            size_t position = static_cast<size_t>(m_position);
+            if (m_pending.size() < position + count)
+            {
+                m_pending.resize(position + count);
+            }
+            m_pending.replace(position, static_cast<size_t>(count), data, static_cast<size_t>(count));
+        }
+
+        m_position += count;
+        return count;
+    }
+
+    int_type overflow(int_type ch) override
+    {
+        if (traits_type::eq_int_type(ch, traits_type::eof()))
+        {
+            return traits_type::not_eof(ch);
+        }
+
+        char toWrite = traits_type::to_char_type(ch);
+        return xsputn(&toWrite, 1) == 1 ? ch : traits_type::eof();
+    }
+
+    int_type underflow() override
+    {
+        DiscardGetArea();
+        uint64_t end = GetEnd();
+        if (m_position >= end)
+        {
+            return traits_type::eof();
+        }
+
+        size_t toRead = static_cast<size_t>(std::min<uint64_t>(sizeof(m_getBuffer), end - m_position));
+        int64_t bytesRead = static_cast<int64_t>(toRead);
+        if (m_bound)
+        {
+            bytesRead = m_file->ReadAt(m_offset + m_position, m_getBuffer, toRead);
+        }
+        else
+        {
+            memcpy(m_getBuffer, m_pending.c_str() + m_position, toRead);
+        }
+        if (bytesRead <= 0)
+        {
+            return traits_type::eof();
+        }
+
+        setg(m_getBuffer, m_getBuffer, m_getBuffer + bytesRead);
+        m_position += bytesRead;
+        return traits_type::to_int_type(m_getBuffer[0]);
+    }
+
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode) override
+    {
+        DiscardGetArea();
+        int64_t base = direction == std::ios_base::beg ? 0 : (direction == std::ios_base::cur ? m_position : GetEnd());
+        int64_t target = base + offset;
+        if (target < 0)
+        {
+            return pos_type(off_type(-1));
+        }
+
+        m_position = static_cast<uint64_t>(target);
+        return pos_type(target);
+    }
+
+    pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+    {
+        return seekoff(off_type(position), std::ios_base::beg, which);
+    }
+
+private:
+    // Reads run ahead of the logical position by whatever is still buffered, give that back before moving
+    void DiscardGetArea()
+    {
+        m_position -= egptr() - gptr();
+        setg(nullptr, nullptr, nullptr);
+    }
+
+    uint64_t GetEnd() const
+    {
+        return m_bound ? *m_bytesWritten : m_pending.size();
+    }
+
+    std::shared_ptr<RandomAccessFile> m_file;
+    uint64_t m_offset;
+    uint64_t m_position;
+    uint64_t* m_bytesWritten;
+    // The body so far, while it isn't known yet to be the range
+    Aws::String m_pending;
+    bool m_bound;
+    bool m_failed;
+    char m_getBuffer[4096];
+};
+
+class PartFileStream : public Aws::IOStream
+{
+public:
+    PartFileStream(const std::shared_ptr<RandomAccessFile>& file, uint64_t offset, uint64_t* bytesWritten) :
+        Aws::IOStream(nullptr),
+        m_buffer(file, offset, bytesWritten)
+    {
+        rdbuf(&m_buffer);
+    }
+
+    void BindToFile()
+    {
+        m_buffer.BindToFile();
+    }
+
+private:
+    PartFileStreamBuf m_buffer;
+};
+
+DownloadFileRequest::DownloadFileRequest(const Aws::String& fileName, const Aws::String& bucketName, const Aws::String& keyName, const std::shared_ptr<Aws::S3::S3Client>& s3Client,
+    uint64_t partSize, uint32_t maxConcurrentParts, const std::shared_ptr<TransferConcurrencyController>& concurrencyController, bool useJournal) :
+    S3FileRequest(fileName, bucketName, keyName, s3Client),
 m_retries(0),
-m_gotContents(false)
+m_gotContents(false),
+m_partSize(partSize),
+m_maxConcurrentParts(std::max(maxConcurrentParts, 1u)),
+m_concurrencyController(concurrencyController),
+m_nextPart(0),
+m_partsInFlight(0),
+m_partsCompleted(0),
+m_partsResumed(0),
+m_journal(useJournal ? Aws::MakeShared<TransferJournal>(ALLOCATION_TAG, fileName) : nullptr)
 {
 
 }
@@ -63,6 +268,11 @@ void DownloadFileRequest::OnDataReceived(const Aws::Http::HttpRequest*, Aws::Htt
 bool DownloadFileRequest::DoCancelAction()
 {
     // Do we need to tell S3 something here?
+    if (m_journal)
+    {
+        std::lock_guard<std::mutex> partLock(m_fileRequestMutex);
+        m_journal->Remove();
+    }
     return true;
 }
 
@@ -86,6 +296,352 @@ bool DownloadFileRequest::DoSingleObjectDownload()
     return false;
 }
 
+uint32_t DownloadFileRequest::GetTotalParts() const
+{
+    std::lock_guard<std::mutex> partLock(m_fileRequestMutex);
+    return static_cast<uint32_t>(m_parts.size());
+}
+
+uint32_t DownloadFileRequest::GetResumedPartCount() const
+{
+    std::lock_guard<std::mutex> partLock(m_fileRequestMutex);
+    return m_partsResumed;
+}
+
+void DownloadFileRequest::HeadObject()
+{
+    if (m_partSize == 0)
+    {
+        GetContents();
+        DoSingleObjectDownload();
+        return;
+    }
+
+    HeadObjectRequest headObjectRequest;
+    headObjectRequest.SetBucket(GetBucketName());
+    headObjectRequest.SetKey(GetKeyName());
+
+    std::shared_ptr<Aws::Client::AsyncCallerContext> context = Aws::MakeShared<DownloadFileContext>(ALLOCATION_TAG, shared_from_this());
+
+    GetS3Client()->HeadObjectAsync(headObjectRequest, &TransferClient::OnDownloadHeadObject, context);
+}
+
+bool DownloadFileRequest::HandleHeadObjectOutcome(const Aws::S3::Model::HeadObjectRequest& request, const Aws::S3::Model::HeadObjectOutcome& outcome)
+{
+    AWS_UNREFERENCED_PARAM(request);
+
+    if (!outcome.IsSuccess())
+    {
+        // Let GetObject report whatever is wrong with the object
+        GetContents();
+        DoSingleObjectDownload();
+        return false;
+    }
+
+    return BeginDownload(static_cast<uint64_t>(outcome.GetResult().GetContentLength()), outcome.GetResult().GetETag());
+}
+
+bool DownloadFileRequest::BeginDownload(uint64_t objectSize, const Aws::String& eTag)
+{
+    SetFileSize(objectSize);
+    m_gotContents = true;
+
+    if (m_partSize)
+    {
+        // Keep huge objects to a sensible number of requests
+        m_partSize = TransferClient::GetPartSizeForObject(objectSize, m_partSize);
+    }
+
+    if (objectSize <= m_partSize || m_partSize == 0)
+    {
+        {
+            std::lock_guard<std::mutex> partLock(m_fileRequestMutex);
+            m_parts.resize(1);
+        }
+        DoSingleObjectDownload();
+        return true;
+    }
+
+    return DoMultipartDownload(eTag);
+}
+
+bool DownloadFileRequest::LoadJournal(const Aws::String& eTag, Aws::Set<uint64_t>& completedOffsets)
+{
+    // Without an ETag there is no telling whether the object has changed since
+    if (eTag.empty())
+    {
+        return false;
+    }
+
+    Aws::Vector<TransferJournal::Record> records = m_journal->Read();
+    if (records.empty())
+    {
+        return false;
+    }
+
+    const TransferJournal::Record& header = records.front();
+    if (header.size() != JOURNAL_DOWNLOAD_FIELDS || header[0] != JOURNAL_DOWNLOAD_RECORD || header[1] != GetBucketName() || header[2] != GetKeyName() ||
+        header[3] != StringUtils::to_string(GetFileSize()) || header[4] != eTag)
+    {
+        return false;
+    }
+
+    uint64_t partSize = static_cast<uint64_t>(StringUtils::ConvertToInt64(header[5].c_str()));
+    if (partSize == 0 || (GetFileSize() - 1) / partSize >= MAX_UPLOAD_PARTS)
+    {
+        return false;
+    }
+
+    // A file cut short or replaced since can't be holding the ranges the journal says it does
+    RandomAccessFile existingFile;
+    if (!existingFile.OpenForRead(GetFileName().c_str()) || existingFile.GetSize() != GetFileSize())
+    {
+        return false;
+    }
+    existingFile.Close();
+
+    m_partSize = partSize;
+    for (auto recordIter = records.begin() + 1; recordIter != records.end(); ++recordIter)
+    {
+        const TransferJournal::Record& record = *recordIter;
+        if (record.size() != JOURNAL_RANGE_FIELDS || record[0] != JOURNAL_RANGE_RECORD)
+        {
+            continue;
+        }
+
+        uint64_t offset = static_cast<uint64_t>(StringUtils::ConvertToInt64(record[1].c_str()));
+        uint64_t length = static_cast<uint64_t>(StringUtils::ConvertToInt64(record[2].c_str()));
+        if (offset % m_partSize == 0 && offset < GetFileSize() && length == std::min(m_partSize, GetFileSize() - offset))
+        {
+            completedOffsets.insert(offset);
+        }
+    }
+    return true;
+}
+
+bool DownloadFileRequest::DoMultipartDownload(const Aws::String& eTag)
+{
+    Aws::Set<uint64_t> completedOffsets;
+    bool resuming = m_journal && LoadJournal(eTag, completedOffsets);
+
+    // Picking up where an earlier attempt stopped means keeping what it wrote
+    auto file = Aws::MakeShared<RandomAccessFile>(ALLOCATION_TAG);
+    if (!file->OpenForWrite(GetFileName().c_str(), GetFileSize(), !resuming))
+    {
+        CompletionFailure("Unable to create the download file.");
+        return false;
+    }
+
+    bool downloadComplete = false;
+    {
+        std::lock_guard<std::mutex> partLock(m_fileRequestMutex);
+
+        m_file = file;
+        // Every range must come from the same version of the object
+        m_eTag = eTag;
+        for (uint64_t offset = 0; offset < GetFileSize(); offset += m_partSize)
+        {
+            DownloadPart part;
+            part.m_offset = offset;
+            part.m_length = std::min(m_partSize, GetFileSize() - offset);
+            part.m_bytesWritten = 0;
+            part.m_bytesReceived = 0;
+            part.m_retries = 0;
+            part.m_completed = completedOffsets.count(offset) > 0;
+            if (part.m_completed)
+            {
+                ++m_partsResumed;
+                RegisterProgress(static_cast<int64_t>(part.m_length));
+            }
+            m_parts.push_back(part);
+        }
+        m_partsCompleted = m_partsResumed;
+
+        if (resuming)
+        {
+            AWS_LOGSTREAM_INFO(ALLOCATION_TAG, "Resuming download of " << GetFileName() << ", " << m_partsResumed << " of " << m_parts.size() << " ranges already in the file");
+        }
+        else if (m_journal)
+        {
+            m_journal->Start({ JOURNAL_DOWNLOAD_RECORD, GetBucketName(), GetKeyName(), StringUtils::to_string(GetFileSize()), eTag, StringUtils::to_string(m_partSize) });
+        }
+
+        downloadComplete = m_partsCompleted == m_parts.size();
+        if (downloadComplete)
+        {
+            m_file = nullptr;
+            if (m_journal)
+            {
+                m_journal->Remove();
+            }
+        }
+    }
+
+    if (downloadComplete)
+    {
+        CompletionSuccess();
+        return true;
+    }
+
+    RequestParts();
+    return true;
+}
+
+void DownloadFileRequest::RequestParts()
+{
+    uint32_t maxConcurrentParts = m_concurrencyController ? m_concurrencyController->GetConcurrency() : m_maxConcurrentParts;
+
+    Aws::Vector<uint32_t> toRequest;
+    {
+        std::lock_guard<std::mutex> partLock(m_fileRequestMutex);
+
+        while (!IsDone() && m_partsInFlight < maxConcurrentParts && m_nextPart < m_parts.size())
+        {
+            if (m_parts[m_nextPart].m_completed)
+            {
+                ++m_nextPart;
+                continue;
+            }
+            toRequest.push_back(m_nextPart++);
+            ++m_partsInFlight;
+        }
+    }
+
+    for (uint32_t partIndex : toRequest)
+    {
+        RequestPart(partIndex);
+    }
+}
+
+void DownloadFileRequest::RequestPart(uint32_t partIndex)
+{
+    std::shared_ptr<RandomAccessFile> file;
+    DownloadPart* part = nullptr;
+    Aws::String eTag;
+    {
+        std::lock_guard<std::mutex> partLock(m_fileRequestMutex);
+        file = m_file;
+        part = &m_parts[partIndex];
+        part->m_startTime = std::chrono::steady_clock::now();
+        eTag = m_eTag;
+    }
+
+    Aws::StringStream range;
+    range << "bytes=" << part->m_offset << "-" << part->m_offset + part->m_length - 1;
+
+    GetObjectRequest getObjectRequest;
+    getObjectRequest.SetBucket(GetBucketName());
+    getObjectRequest.SetKey(GetKeyName());
+    getObjectRequest.SetRange(range.str());
+    if (eTag.length())
+    {
+        getObjectRequest.SetIfMatch(eTag);
+    }
+
+    uint64_t offset = part->m_offset;
+    uint64_t* bytesWritten = &part->m_bytesWritten;
+    getObjectRequest.SetResponseStreamFactory([file, offset, bytesWritten]() { return Aws::New<PartFileStream>(ALLOCATION_TAG, file, offset, bytesWritten); });
+
+    getObjectRequest.SetDataReceivedEventHandler(std::bind(&DownloadFileRequest::OnPartDataReceived, this, partIndex, std::placeholders::_2, std::placeholders::_3));
+
+    std::shared_ptr<Aws::Client::AsyncCallerContext> context = Aws::MakeShared<DownloadFileContext>(ALLOCATION_TAG, shared_from_this(), partIndex);
+
+    GetS3Client()->GetObjectAsync(getObjectRequest, &TransferClient::OnDownloadGetObjectPart, context);
+}
+
+void DownloadFileRequest::OnPartDataReceived(uint32_t partIndex, Aws::Http::HttpResponse* response, long long amountReceived)
+{
+    // Called after each piece of the body has been written to the part's stream, which holds it back until the status shows it is the range
+    if (response->GetResponseCode() == Aws::Http::HttpResponseCode::PARTIAL_CONTENT)
+    {
+        static_cast<PartFileStream&>(response->GetResponseBody()).BindToFile();
+    }
+
+    // Only the part's own request touches its counters while it is in flight
+    m_parts[partIndex].m_bytesReceived += amountReceived;
+    RegisterProgress(amountReceived);
+}
+
+bool DownloadFileRequest::HandleGetObjectPartOutcome(uint32_t partIndex, const Aws::S3::Model::GetObjectRequest& request, const Aws::S3::Model::GetObjectOutcome& outcome)
+{
+    AWS_UNREFERENCED_PARAM(request);
+
+    bool retryPart = false;
+    bool downloadFailed = false;
+    bool downloadComplete = false;
+    bool partSucceeded = false;
+    uint64_t partLength = 0;
+    std::chrono::steady_clock::time_point partStartTime;
+    {
+        std::lock_guard<std::mutex> partLock(m_fileRequestMutex);
+
+        DownloadPart& part = m_parts[partIndex];
+        partSucceeded = outcome.IsSuccess() && part.m_bytesWritten == part.m_length;
+        partLength = part.m_length;
+        partStartTime = part.m_startTime;
+        if (partSucceeded)
+        {
+            --m_partsInFlight;
+            ++m_partsCompleted;
+            part.m_completed = true;
+            downloadComplete = m_partsCompleted == m_parts.size();
+
+            // Under the lock, so no range can be journaled after the journal is removed
+            if (m_journal)
+            {
+                m_journal->Append({ JOURNAL_RANGE_RECORD, StringUtils::to_string(part.m_offset), StringUtils::to_string(part.m_length) });
+                if (downloadComplete)
+                {
+                    m_journal->Remove();
+                }
+            }
+        }
+        else if (part.m_retries < DOWNLOAD_PART_RETRY_MAX && !IsDone())
+        {
+            // Only this range starts over, everything else already in the file stays
+            ++part.m_retries;
+            ++m_retries;
+            RegisterProgress(-static_cast<int64_t>(part.m_bytesReceived));
+            part.m_bytesReceived = 0;
+            retryPart = true;
+        }
+        else
+        {
+            --m_partsInFlight;
+            downloadFailed = true;
+        }
+
+        if (downloadComplete || downloadFailed)
+        {
+            m_file = nullptr;
+        }
+    }
+
+    if (m_concurrencyController)
+    {
+        m_concurrencyController->RecordPart(partLength, partSucceeded, partStartTime);
+    }
+
+    if (retryPart)
+    {
+        RequestPart(partIndex);
+        return false;
+    }
+    if (downloadFailed)
+    {
+        CompletionFailure(outcome.IsSuccess() ? "Unable to write the downloaded range to the file." : outcome.GetError().GetMessage().c_str());
+        return false;
+    }
+    if (downloadComplete)
+    {
+        CompletionSuccess();
+        return true;
+    }
+
+    RequestParts();
+    return true;
+}
+
 bool DownloadFileRequest::DoRetry()
 {
     if (m_retries >= DOWNLOAD_RETRY_MAX)
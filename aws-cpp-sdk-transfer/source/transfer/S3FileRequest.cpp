@@ -115,7 +115,21 @@ uint64_t S3FileRequest::GetProgressAmount() const
 
 void S3FileRequest::SetDone()
 {
-    m_isDone.store(true);
+    Aws::List<S3FileCompletionCallback> doneCallbacks;
+    {
+        std::lock_guard<std::mutex> completeLock(m_callbackMutex);
+        if (m_isDone.exchange(true))
+        {
+            return;
+        }
+        doneCallbacks.swap(m_doneCallbacks);
+    }
+
+    // Fired outside the lock, a done callback may well start more work that adds callbacks of its own
+    for (auto& thisCallback : doneCallbacks)
+    {
+        thisCallback();
+    }
 }
 
 void S3FileRequest::CompletionSuccess()
@@ -132,6 +146,19 @@ void S3FileRequest::AddCompletionCallback(S3FileCompletionCallback addCallback)
     m_completionCallbacks.push_back(addCallback);
 }
 
+void S3FileRequest::AddDoneCallback(S3FileCompletionCallback addCallback)
+{
+    {
+        std::lock_guard<std::mutex> completeLock(m_callbackMutex);
+        if (!IsDone())
+        {
+            m_doneCallbacks.push_back(addCallback);
+            return;
+        }
+    }
+    addCallback();
+}
+
 void S3FileRequest::FireCompletionCallbacks()
 {
     std::lock_guard<std::mutex> completeLock(m_callbackMutex);
@@ -18,11 +18,14 @@
 
 #include <aws/transfer/UploadFileRequest.h>
 #include <aws/transfer/DownloadFileRequest.h>
+#include <aws/transfer/DirectoryTransferRequest.h>
 #include <aws/transfer/TransferContext.h>
+#include <aws/transfer/TransferConcurrencyController.h>
 
 #include <aws/transfer/resource/FairBoundedResourceManager.h>
 #include <aws/transfer/resource/ScopedResourceSet.h>
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/FileSystemUtils.h>
 
 using namespace Aws::S3::Model;
 using namespace Aws::Utils;
@@ -34,11 +37,33 @@ namespace Transfer
 
 static const char* ALLOCATION_TAG = "TransferAPI";
 
+static const uint32_t DEFAULT_UPLOAD_BUFFER_COUNT = 10;
+static const uint32_t DEFAULT_DOWNLOAD_PART_CONCURRENCY = 8;
+static const uint32_t DEFAULT_DIRECTORY_CONCURRENCY = 10;
+static const uint32_t DEFAULT_MIN_AUTO_TUNE_CONCURRENCY = 4;
+static const uint32_t DEFAULT_MAX_AUTO_TUNE_CONCURRENCY = 64;
+static const uint64_t PART_SIZE_GRANULARITY = 1024 * 1024;
+
 static UploadBufferResourceType ResourceFactoryFunction(void)
 {
     return Aws::MakeShared< UploadBuffer >(ALLOCATION_TAG, UPLOAD_BUFFER_SIZE);
 }
 
+TransferClientConfiguration::TransferClientConfiguration() :
+    m_uploadBufferCount(DEFAULT_UPLOAD_BUFFER_COUNT),
+    m_uploadBufferManager(nullptr),
+    m_uploadPrefetchDepth(0),
+    m_downloadPartSize(MB5_BUFFER_SIZE),
+    m_downloadPartConcurrency(DEFAULT_DOWNLOAD_PART_CONCURRENCY),
+    m_directoryConcurrency(DEFAULT_DIRECTORY_CONCURRENCY),
+    m_uploadPartSize(MB5_BUFFER_SIZE),
+    m_autoTuneConcurrency(false),
+    m_minAutoTuneConcurrency(DEFAULT_MIN_AUTO_TUNE_CONCURRENCY),
+    m_maxAutoTuneConcurrency(DEFAULT_MAX_AUTO_TUNE_CONCURRENCY),
+    m_useCheckpointJournal(false)
+{
+}
+
 TransferClient::TransferClient(const std::shared_ptr<Aws::S3::S3Client>& s3Client, const TransferClientConfiguration& config) :
     m_s3Client(s3Client),
     m_config(config),
@@ -49,6 +74,19 @@ TransferClient::TransferClient(const std::shared_ptr<Aws::S3::S3Client>& s3Clien
         m_uploadBufferManager = Aws::MakeShared< FairBoundedResourceManager< UploadBufferResourceType > >(ALLOCATION_TAG, ResourceFactoryFunction, config.m_uploadBufferCount, ResourceWaitPolicy::AT_LEAST_ONE_AVAILABLE);
     }
 
+    if (m_config.m_autoTuneConcurrency)
+    {
+        // Every upload part in flight holds a buffer, so the size of the pool is the upload concurrency
+        std::shared_ptr<UploadBufferResourceManagerType> bufferManager = m_uploadBufferManager;
+        m_uploadConcurrencyController = Aws::MakeShared<TransferConcurrencyController>(ALLOCATION_TAG, config.m_uploadBufferCount, config.m_minAutoTuneConcurrency, config.m_maxAutoTuneConcurrency,
+            [bufferManager](uint32_t concurrency) { bufferManager->AdjustResourceCount(concurrency); });
+        if (m_uploadConcurrencyController->GetConcurrency() != config.m_uploadBufferCount)
+        {
+            m_uploadBufferManager->AdjustResourceCount(m_uploadConcurrencyController->GetConcurrency());
+        }
+
+        m_downloadConcurrencyController = Aws::MakeShared<TransferConcurrencyController>(ALLOCATION_TAG, config.m_downloadPartConcurrency, config.m_minAutoTuneConcurrency, config.m_maxAutoTuneConcurrency);
+    }
 }
 
 TransferClient::~TransferClient()
@@ -57,7 +95,8 @@ TransferClient::~TransferClient()
 
 std::shared_ptr<UploadFileRequest> TransferClient::UploadFile(const Aws::String& fileName, const Aws::String& bucketName, const Aws::String& keyName, const Aws::String& contentType, bool createBucket, bool doConsistencyChecks)
 {
-    auto request = Aws::MakeShared<UploadFileRequest>(ALLOCATION_TAG, fileName, bucketName, keyName, contentType, m_s3Client, createBucket, doConsistencyChecks);
+    auto request = Aws::MakeShared<UploadFileRequest>(ALLOCATION_TAG, fileName, bucketName, keyName, contentType, m_s3Client, createBucket, doConsistencyChecks,
+        m_config.m_uploadPartSize, m_uploadConcurrencyController, m_config.m_useCheckpointJournal);
 
     UploadFileInternal(request);
 
@@ -66,12 +105,28 @@ std::shared_ptr<UploadFileRequest> TransferClient::UploadFile(const Aws::String&
 
 void TransferClient::UploadFileInternal(std::shared_ptr<UploadFileRequest>& request) 
 {
+    uint32_t maxBuffers = GetMaxUploadBuffers(); // How many will we attempt to acquire from our pool
+    if (m_config.m_uploadPrefetchDepth)
+    {
+        maxBuffers = std::min(maxBuffers, m_config.m_uploadPrefetchDepth);
+    }
+
+    BeginUpload(request, m_uploadBufferManager, maxBuffers);
+}
+
+void TransferClient::BeginUpload(std::shared_ptr<UploadFileRequest>& request, const std::shared_ptr<UploadBufferResourceManagerType>& bufferManager, uint32_t maxBuffers)
+{
+    if (request->IsDone())
+    {
+        // Failed in construction, most likely opening the file
+        return;
+    }
 
     uint32_t neededBuffers = request->GetTotalParts();
 
-    uint32_t requestedBuffers = std::min(neededBuffers, m_config.m_uploadBufferCount); // How many will we attempt to acquire from our pool, this will be more configurable soon
+    uint32_t requestedBuffers = std::min(neededBuffers, maxBuffers);
 
-    std::shared_ptr< UploadBufferScopedResourceSetType > bufferSet = AcquireUploadBuffers(requestedBuffers);
+    std::shared_ptr< UploadBufferScopedResourceSetType > bufferSet = AcquireUploadBuffers(bufferManager, requestedBuffers);
 
     if (!bufferSet->GetResources().size())
     {
@@ -87,6 +142,33 @@ void TransferClient::UploadFileInternal(std::shared_ptr<UploadFileRequest>& requ
     request->ContinueUpload();
 }
 
+uint32_t TransferClient::GetMaxUploadBuffers() const
+{
+    // The controller decides how many of these are really used, by growing and shrinking the pool
+    return m_uploadConcurrencyController ? m_config.m_maxAutoTuneConcurrency : m_config.m_uploadBufferCount;
+}
+
+uint32_t TransferClient::GetUploadConcurrency() const
+{
+    return m_uploadConcurrencyController ? m_uploadConcurrencyController->GetConcurrency() : 0;
+}
+
+uint32_t TransferClient::GetDownloadConcurrency() const
+{
+    return m_downloadConcurrencyController ? m_downloadConcurrencyController->GetConcurrency() : 0;
+}
+
+uint64_t TransferClient::GetPartSizeForObject(uint64_t objectSize, uint64_t partSize)
+{
+    uint64_t smallestPartSize = objectSize / MAX_UPLOAD_PARTS + (objectSize % MAX_UPLOAD_PARTS ? 1 : 0);
+    if (partSize >= smallestPartSize)
+    {
+        return partSize;
+    }
+
+    return (smallestPartSize + PART_SIZE_GRANULARITY - 1) / PART_SIZE_GRANULARITY * PART_SIZE_GRANULARITY;
+}
+
 void TransferClient::CancelUpload(std::shared_ptr<UploadFileRequest>& request) const
 {
     CancelUploadInternal(request);
@@ -104,7 +186,8 @@ void TransferClient::ProcessSingleBuffer(std::shared_ptr<UploadFileRequest>& req
 
 std::shared_ptr<DownloadFileRequest> TransferClient::DownloadFile(const Aws::String& fileName, const Aws::String& bucketName, const Aws::String& keyName)
 {
-    auto request = Aws::MakeShared<DownloadFileRequest>(ALLOCATION_TAG, fileName, bucketName, keyName, m_s3Client);
+    auto request = Aws::MakeShared<DownloadFileRequest>(ALLOCATION_TAG, fileName, bucketName, keyName, m_s3Client, m_config.m_downloadPartSize, m_config.m_downloadPartConcurrency,
+        m_downloadConcurrencyController, m_config.m_useCheckpointJournal);
 
     BeginDownloadFile(request);
 
@@ -113,13 +196,13 @@ std::shared_ptr<DownloadFileRequest> TransferClient::DownloadFile(const Aws::Str
 
 void TransferClient::BeginDownloadFile(std::shared_ptr<DownloadFileRequest>& request) const
 {
-    GetContentsInternal(request);
     DownloadFileInternal(request);
 }
 
 void TransferClient::DownloadFileInternal(std::shared_ptr<DownloadFileRequest>& request) const
 {
-    request->DoSingleObjectDownload();
+    // The object's size decides between a single GetObject and a ranged multipart download
+    request->HeadObject();
 }
 
 void TransferClient::GetContentsInternal(std::shared_ptr<DownloadFileRequest>& request) const
@@ -127,6 +210,111 @@ void TransferClient::GetContentsInternal(std::shared_ptr<DownloadFileRequest>& r
     request->GetContents();
 }
 
+std::shared_ptr<DirectoryTransferRequest> TransferClient::UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& keyPrefix, const Aws::String& contentType, bool createBucket)
+{
+    // Every file in flight needs at least one buffer of its own, even after the controller has shrunk the pool as far as it goes
+    uint32_t poolFloor = m_uploadConcurrencyController ? m_config.m_minAutoTuneConcurrency : m_config.m_uploadBufferCount;
+    uint32_t maxFiles = std::max(1u, std::min(m_config.m_directoryConcurrency, poolFloor));
+    uint32_t maxBuffers = std::max(1u, GetMaxUploadBuffers() / maxFiles);
+    if (m_config.m_uploadPrefetchDepth)
+    {
+        maxBuffers = std::min(maxBuffers, m_config.m_uploadPrefetchDepth);
+    }
+
+    auto request = Aws::MakeShared<DirectoryTransferRequest>(ALLOCATION_TAG, directory, bucketName, keyPrefix, m_s3Client, maxFiles);
+
+    // Captured by value, files keep starting after this call returns
+    std::shared_ptr<Aws::S3::S3Client> s3Client = m_s3Client;
+    std::shared_ptr<UploadBufferResourceManagerType> bufferManager = m_uploadBufferManager;
+    Aws::String bucket = bucketName;
+    Aws::String type = contentType;
+    uint64_t partSize = m_config.m_uploadPartSize;
+    std::shared_ptr<TransferConcurrencyController> concurrencyController = m_uploadConcurrencyController;
+    bool useJournal = m_config.m_useCheckpointJournal;
+    request->SetFileTransferFactory([s3Client, bufferManager, maxBuffers, bucket, type, partSize, concurrencyController, useJournal](const DirectoryTransferRequest::FileEntry& file, std::function<void()>& start)
+    {
+        // The directory has already seen to the bucket, and per file consistency checks are what bulk mode exists to avoid
+        auto fileRequest = Aws::MakeShared<UploadFileRequest>(ALLOCATION_TAG, file.m_fileName, bucket, file.m_keyName, type, s3Client, false, false, partSize, concurrencyController, useJournal);
+        start = [fileRequest, bufferManager, maxBuffers]() { std::shared_ptr<UploadFileRequest> toStart = fileRequest; BeginUpload(toStart, bufferManager, maxBuffers); };
+        return std::static_pointer_cast<S3FileRequest>(fileRequest);
+    });
+
+    Aws::Vector<DirectoryEntry> files;
+    if (!FileSystemUtils::ListFilesRecursively(request->GetDirectory().c_str(), files))
+    {
+        request->CompletionFailure("Unable to read the directory.");
+        return request;
+    }
+
+    for (auto& file : files)
+    {
+        Aws::String keyName = file.m_relativePath;
+        std::replace(keyName.begin(), keyName.end(), FileSystemUtils::GetPathDelimiter(), '/');
+        request->AddFile(request->GetDirectory() + FileSystemUtils::GetPathDelimiter() + file.m_relativePath, keyPrefix + keyName, file.m_fileSize);
+    }
+    request->SetListingComplete();
+
+    if (createBucket)
+    {
+        request->CreateBucket();
+    }
+    else
+    {
+        request->StartFiles();
+    }
+
+    return request;
+}
+
+std::shared_ptr<DirectoryTransferRequest> TransferClient::DownloadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& keyPrefix)
+{
+    auto request = Aws::MakeShared<DirectoryTransferRequest>(ALLOCATION_TAG, directory, bucketName, keyPrefix, m_s3Client, m_config.m_directoryConcurrency);
+
+    std::shared_ptr<Aws::S3::S3Client> s3Client = m_s3Client;
+    Aws::String bucket = bucketName;
+    Aws::String root = request->GetDirectory();
+    uint64_t partSize = m_config.m_downloadPartSize;
+    uint32_t partConcurrency = m_config.m_downloadPartConcurrency;
+    std::shared_ptr<TransferConcurrencyController> concurrencyController = m_downloadConcurrencyController;
+    bool useJournal = m_config.m_useCheckpointJournal;
+    request->SetFileTransferFactory([s3Client, bucket, root, partSize, partConcurrency, concurrencyController, useJournal](const DirectoryTransferRequest::FileEntry& file, std::function<void()>& start)
+    {
+        auto fileRequest = Aws::MakeShared<DownloadFileRequest>(ALLOCATION_TAG, file.m_fileName, bucket, file.m_keyName, s3Client, partSize, partConcurrency, concurrencyController, useJournal);
+
+        // Subdirectories the key implies, the directory itself already exists
+        for (size_t delimiter = file.m_fileName.find(FileSystemUtils::GetPathDelimiter(), root.length() + 1); delimiter != Aws::String::npos;
+            delimiter = file.m_fileName.find(FileSystemUtils::GetPathDelimiter(), delimiter + 1))
+        {
+            if (!FileSystemUtils::CreateDirectoryIfNotExists(file.m_fileName.substr(0, delimiter).c_str()))
+            {
+                fileRequest->CompletionFailure("Unable to create the directory for the file.");
+                return std::static_pointer_cast<S3FileRequest>(fileRequest);
+            }
+        }
+
+        // The listing already gave the size and ETag a HeadObject would have
+        uint64_t fileSize = file.m_fileSize;
+        Aws::String eTag = file.m_eTag;
+        start = [fileRequest, fileSize, eTag]() { fileRequest->BeginDownload(fileSize, eTag); };
+        return std::static_pointer_cast<S3FileRequest>(fileRequest);
+    });
+
+    if (!FileSystemUtils::CreateDirectoryIfNotExists(request->GetDirectory().c_str()))
+    {
+        request->CompletionFailure("Unable to create the directory.");
+        return request;
+    }
+
+    request->ListObjects("");
+
+    return request;
+}
+
+void TransferClient::CancelDirectoryTransfer(std::shared_ptr<DirectoryTransferRequest>& request) const
+{
+    request->Cancel();
+}
+
 void TransferClient::OnCreateBucket(const Aws::S3::S3Client* s3Client,
     const Aws::S3::Model::CreateBucketRequest& request,
     const Aws::S3::Model::CreateBucketOutcome& outcome,
@@ -226,6 +414,33 @@ void TransferClient::OnDownloadGetObject(const Aws::S3::S3Client* s3Client,
     downloadRequest->HandleGetObjectOutcome(request, outcome);
 }
 
+void TransferClient::OnDownloadGetObjectPart(const Aws::S3::S3Client* s3Client,
+    const Aws::S3::Model::GetObjectRequest& request,
+    const Aws::S3::Model::GetObjectOutcome& outcome,
+    const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+{
+    AWS_UNREFERENCED_PARAM(s3Client);
+
+    auto downloadContext = std::static_pointer_cast<const DownloadFileContext>(context);
+
+    std::shared_ptr<DownloadFileRequest> downloadRequest = downloadContext->GetDownloadRequest();
+
+    downloadRequest->HandleGetObjectPartOutcome(downloadContext->GetPartIndex(), request, outcome);
+}
+
+void TransferClient::OnDownloadHeadObject(const Aws::S3::S3Client* s3Client,
+    const Aws::S3::Model::HeadObjectRequest& request,
+    const Aws::S3::Model::HeadObjectOutcome& outcome,
+    const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+{
+    AWS_UNREFERENCED_PARAM(s3Client);
+
+    auto downloadContext = std::static_pointer_cast<const DownloadFileContext>(context);
+
+    std::shared_ptr<DownloadFileRequest> downloadRequest = downloadContext->GetDownloadRequest();
+
+    downloadRequest->HandleHeadObjectOutcome(request, outcome);
+}
 
 void TransferClient::OnDownloadListObjects(const Aws::S3::S3Client* s3Client,
     const Aws::S3::Model::ListObjectsRequest& request,
@@ -283,10 +498,66 @@ void TransferClient::OnUploadListObjects(const Aws::S3::S3Client* s3Client,
     uploadRequest->HandleListObjectsOutcome(request, outcome);
 }
 
+void TransferClient::OnListParts(const Aws::S3::S3Client* s3Client,
+    const Aws::S3::Model::ListPartsRequest& request,
+    const Aws::S3::Model::ListPartsOutcome& outcome,
+    const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+{
+    AWS_UNREFERENCED_PARAM(s3Client);
+
+    auto uploadContext = std::static_pointer_cast<const UploadFileContext>(context);
+
+    std::shared_ptr<UploadFileRequest> uploadRequest = uploadContext->GetUploadRequest();
+
+    uploadRequest->HandleListPartsOutcome(request, outcome);
+}
+
+
+void TransferClient::OnDirectoryCreateBucket(const Aws::S3::S3Client* s3Client,
+    const Aws::S3::Model::CreateBucketRequest& request,
+    const Aws::S3::Model::CreateBucketOutcome& outcome,
+    const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+{
+    AWS_UNREFERENCED_PARAM(s3Client);
+
+    auto directoryContext = std::static_pointer_cast<const DirectoryTransferContext>(context);
+
+    std::shared_ptr<DirectoryTransferRequest> directoryRequest = directoryContext->GetDirectoryRequest();
+
+    directoryRequest->HandleCreateBucketOutcome(request, outcome);
+}
+
+void TransferClient::OnDirectoryHeadBucket(const Aws::S3::S3Client* s3Client,
+    const Aws::S3::Model::HeadBucketRequest& request,
+    const Aws::S3::Model::HeadBucketOutcome& outcome,
+    const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+{
+    AWS_UNREFERENCED_PARAM(s3Client);
+
+    auto directoryContext = std::static_pointer_cast<const DirectoryTransferContext>(context);
+
+    std::shared_ptr<DirectoryTransferRequest> directoryRequest = directoryContext->GetDirectoryRequest();
+
+    directoryRequest->HandleHeadBucketOutcome(request, outcome);
+}
+
+void TransferClient::OnDirectoryListObjects(const Aws::S3::S3Client* s3Client,
+    const Aws::S3::Model::ListObjectsRequest& request,
+    const Aws::S3::Model::ListObjectsOutcome& outcome,
+    const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+{
+    AWS_UNREFERENCED_PARAM(s3Client);
+
+    auto directoryContext = std::static_pointer_cast<const DirectoryTransferContext>(context);
+
+    std::shared_ptr<DirectoryTransferRequest> directoryRequest = directoryContext->GetDirectoryRequest();
+
+    directoryRequest->HandleListObjectsOutcome(request, outcome);
+}
 
-std::shared_ptr< UploadBufferScopedResourceSetType > TransferClient::AcquireUploadBuffers(uint32_t bufferCount)
+std::shared_ptr< UploadBufferScopedResourceSetType > TransferClient::AcquireUploadBuffers(const std::shared_ptr<UploadBufferResourceManagerType>& bufferManager, uint32_t bufferCount)
 {
-    return Aws::MakeShared< ScopedResourceSet< UploadBufferResourceType > >(ALLOCATION_TAG, bufferCount, m_uploadBufferManager);
+    return Aws::MakeShared< ScopedResourceSet< UploadBufferResourceType > >(ALLOCATION_TAG, bufferCount, bufferManager);
 }
 
 } // namespace Transfer
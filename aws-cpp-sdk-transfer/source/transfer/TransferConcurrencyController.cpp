@@ -0,0 +1,178 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/transfer/TransferConcurrencyController.h>
+
+#include <algorithm>
+
+namespace Aws
+{
+namespace Transfer
+{
+
+static const uint32_t MIN_WINDOW_PARTS = 4; // Fewer parts than this say more about the parts than the concurrency
+static const uint32_t ERROR_RATE_DIVISOR = 10; // Back off when more than 1 in this many parts of a window failed
+static const double IMPROVEMENT_THRESHOLD = 1.05; // Throughput differences smaller than this are treated as noise
+
+TransferConcurrencyController::TransferConcurrencyController(uint32_t initialConcurrency, uint32_t minConcurrency, uint32_t maxConcurrency, const ConcurrencyChangedCallback& onChange) :
+    m_controllerMutex(),
+    m_notifyMutex(),
+    m_minConcurrency(std::max(minConcurrency, 1u)),
+    m_maxConcurrency(std::max(maxConcurrency, std::max(minConcurrency, 1u))),
+    m_concurrency(0),
+    m_onChange(onChange),
+    m_direction(1),
+    m_step(1),
+    m_lastThroughput(0),
+    m_bestThroughput(0),
+    m_windowParts(0),
+    m_windowFailures(0),
+    m_windowBytes(0),
+    m_windowStart(),
+    m_windowEnd()
+{
+    m_concurrency = Clamp(initialConcurrency);
+}
+
+uint32_t TransferConcurrencyController::GetConcurrency() const
+{
+    std::lock_guard<std::mutex> controllerLock(m_controllerMutex);
+    return m_concurrency;
+}
+
+void TransferConcurrencyController::RecordPart(uint64_t bytes, bool succeeded, Clock::time_point startedAt, Clock::time_point finishedAt)
+{
+    bool changed = false;
+    {
+        std::lock_guard<std::mutex> controllerLock(m_controllerMutex);
+
+        if (m_windowParts == 0)
+        {
+            m_windowStart = startedAt;
+            m_windowEnd = finishedAt;
+        }
+        else
+        {
+            m_windowStart = std::min(m_windowStart, startedAt);
+            m_windowEnd = std::max(m_windowEnd, finishedAt);
+        }
+
+        ++m_windowParts;
+        if (succeeded)
+        {
+            m_windowBytes += bytes;
+        }
+        else
+        {
+            ++m_windowFailures;
+        }
+
+        if (m_windowParts >= std::max(m_concurrency, MIN_WINDOW_PARTS))
+        {
+            uint32_t previousConcurrency = m_concurrency;
+            changed = EndWindow() != previousConcurrency;
+        }
+    }
+
+    if (changed)
+    {
+        // Pass on the latest value rather than the one computed above, so a late caller can't leave a stale one behind
+        std::lock_guard<std::mutex> notifyLock(m_notifyMutex);
+        if (m_onChange)
+        {
+            m_onChange(GetConcurrency());
+        }
+    }
+}
+
+uint32_t TransferConcurrencyController::EndWindow()
+{
+    double seconds = std::chrono::duration<double>(m_windowEnd - m_windowStart).count();
+    double throughput = seconds > 0 ? static_cast<double>(m_windowBytes) / seconds : 0;
+    bool backOff = m_windowFailures * ERROR_RATE_DIVISOR > m_windowParts;
+
+    m_windowParts = 0;
+    m_windowFailures = 0;
+    m_windowBytes = 0;
+
+    if (backOff)
+    {
+        // Throughput measured while requests were failing isn't worth comparing against, climb again from scratch
+        m_concurrency = Clamp(m_concurrency / 2);
+        m_direction = 1;
+        m_step = 1;
+        m_lastThroughput = 0;
+        m_bestThroughput = 0;
+        return m_concurrency;
+    }
+
+    if (throughput <= 0)
+    {
+        return m_concurrency;
+    }
+
+    if (m_lastThroughput > 0)
+    {
+        if (m_direction > 0)
+        {
+            if (throughput > m_lastThroughput * IMPROVEMENT_THRESHOLD)
+            {
+                // Still paying off, go further next time
+                m_step = std::min(m_step * 2, std::max(m_concurrency / 2, 1u));
+            }
+            else
+            {
+                // Past the point where more parts help; come back down for as long as it costs nothing
+                m_direction = -1;
+                m_step = 1;
+                m_bestThroughput = std::max(throughput, m_lastThroughput);
+            }
+        }
+        else if (throughput * IMPROVEMENT_THRESHOLD < m_bestThroughput)
+        {
+            // Measured against the best rather than the last window, so a slow slide down still gets noticed
+            m_direction = 1;
+            m_step = 1;
+        }
+    }
+    m_lastThroughput = throughput;
+
+    uint32_t nextConcurrency = Clamp(static_cast<int64_t>(m_concurrency) + m_direction * static_cast<int64_t>(m_step));
+    if (nextConcurrency == m_concurrency)
+    {
+        // Up against a limit, the only way left to look is back
+        m_direction = -m_direction;
+        m_step = 1;
+        if (m_direction < 0)
+        {
+            m_bestThroughput = throughput;
+        }
+        else
+        {
+            // Make the next window probe upwards whatever it measures, in case things have got better at the bottom
+            m_lastThroughput = 0;
+        }
+    }
+    m_concurrency = nextConcurrency;
+    return m_concurrency;
+}
+
+uint32_t TransferConcurrencyController::Clamp(int64_t concurrency) const
+{
+    return static_cast<uint32_t>(std::min<int64_t>(std::max<int64_t>(concurrency, m_minConcurrency), m_maxConcurrency));
+}
+
+} // namespace Transfer
+} // namespace Aws
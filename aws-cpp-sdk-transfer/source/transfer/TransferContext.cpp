@@ -26,7 +26,12 @@ UploadFileContext::UploadFileContext(const std::shared_ptr<UploadFileRequest> up
 {
 }
 
-DownloadFileContext::DownloadFileContext(const std::shared_ptr<DownloadFileRequest> downloadFileRequest) : m_request(downloadFileRequest)
+DownloadFileContext::DownloadFileContext(const std::shared_ptr<DownloadFileRequest> downloadFileRequest, uint32_t partIndex) : m_request(downloadFileRequest),
+m_partIndex(partIndex)
+{
+}
+
+DirectoryTransferContext::DirectoryTransferContext(const std::shared_ptr<DirectoryTransferRequest> directoryRequest) : m_request(directoryRequest)
 {
 }
 
@@ -0,0 +1,216 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/transfer/TransferJournal.h>
+
+#include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <fstream>
+
+using namespace Aws::Utils;
+
+namespace Aws
+{
+namespace Transfer
+{
+
+static const char* ALLOCATION_TAG = "TransferJournal";
+
+const char* TransferJournal::JOURNAL_EXTENSION = ".s3journal";
+
+static const char* HEX_DIGITS = "0123456789ABCDEF";
+
+// Only what would break up a record needs escaping; keys are otherwise kept readable
+static Aws::String EncodeField(const Aws::String& field)
+{
+    Aws::String encoded;
+    for (char c : field)
+    {
+        if (c == '%' || c == ' ' || c == '\n' || c == '\r')
+        {
+            unsigned char value = static_cast<unsigned char>(c);
+            encoded += '%';
+            encoded += HEX_DIGITS[value >> 4];
+            encoded += HEX_DIGITS[value & 0xF];
+        }
+        else
+        {
+            encoded += c;
+        }
+    }
+    return encoded;
+}
+
+static int HexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+static bool DecodeField(const Aws::String& field, Aws::String& decoded)
+{
+    decoded.clear();
+    for (size_t i = 0; i < field.length(); ++i)
+    {
+        if (field[i] != '%')
+        {
+            decoded += field[i];
+            continue;
+        }
+
+        int high = i + 2 < field.length() ? HexValue(field[i + 1]) : -1;
+        int low = i + 2 < field.length() ? HexValue(field[i + 2]) : -1;
+        if (high < 0 || low < 0)
+        {
+            return false;
+        }
+        decoded += static_cast<char>((high << 4) | low);
+        i += 2;
+    }
+    return true;
+}
+
+TransferJournal::TransferJournal(const Aws::String& fileName) :
+    m_path(fileName + JOURNAL_EXTENSION),
+    m_journalMutex(),
+    m_stream(nullptr)
+{
+}
+
+TransferJournal::~TransferJournal()
+{
+}
+
+Aws::Vector<TransferJournal::Record> TransferJournal::Read() const
+{
+    Aws::Vector<Record> records;
+
+    Aws::IFStream journal(m_path.c_str(), std::ios_base::in | std::ios_base::binary);
+    if (!journal.good())
+    {
+        return records;
+    }
+
+    Aws::StringStream contents;
+    contents << journal.rdbuf();
+    Aws::String text = contents.str();
+
+    // Only lines that made it all the way to their newline count
+    size_t lineStart = 0;
+    for (size_t lineEnd = text.find('\n'); lineEnd != Aws::String::npos; lineStart = lineEnd + 1, lineEnd = text.find('\n', lineStart))
+    {
+        Record record;
+        bool wellFormed = true;
+        size_t fieldStart = lineStart;
+        while (wellFormed)
+        {
+            size_t fieldEnd = std::min(text.find(' ', fieldStart), lineEnd);
+            Aws::String field;
+            wellFormed = DecodeField(text.substr(fieldStart, fieldEnd - fieldStart), field);
+            record.push_back(field);
+            if (fieldEnd == lineEnd)
+            {
+                break;
+            }
+            fieldStart = fieldEnd + 1;
+        }
+
+        if (wellFormed)
+        {
+            records.push_back(record);
+        }
+    }
+
+    return records;
+}
+
+bool TransferJournal::Start(const Record& record)
+{
+    std::lock_guard<std::mutex> journalLock(m_journalMutex);
+
+    m_stream = Aws::MakeUnique<Aws::OFStream>(ALLOCATION_TAG, m_path.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    return Write(record);
+}
+
+bool TransferJournal::Append(const Record& record)
+{
+    std::lock_guard<std::mutex> journalLock(m_journalMutex);
+
+    if (!m_stream)
+    {
+        // Carrying on with a journal an earlier run started.  Its last line may have been cut short; finish it off with a '%' that
+        // can't be decoded, so it stays dropped rather than reading back as a shorter record, and this one starts a line of its own
+        bool endsWithNewline = true;
+        {
+            Aws::IFStream journal(m_path.c_str(), std::ios_base::in | std::ios_base::binary);
+            if (journal.good() && journal.seekg(-1, std::ios_base::end))
+            {
+                endsWithNewline = journal.get() == '\n';
+            }
+        }
+
+        m_stream = Aws::MakeUnique<Aws::OFStream>(ALLOCATION_TAG, m_path.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::app);
+        if (!endsWithNewline)
+        {
+            *m_stream << "%\n";
+        }
+    }
+
+    return Write(record);
+}
+
+void TransferJournal::Remove()
+{
+    std::lock_guard<std::mutex> journalLock(m_journalMutex);
+
+    m_stream = nullptr;
+    FileSystemUtils::RemoveFileIfExists(m_path.c_str());
+}
+
+// Assumes m_journalMutex is held
+bool TransferJournal::Write(const Record& record)
+{
+    Aws::String line;
+    for (size_t i = 0; i < record.size(); ++i)
+    {
+        if (i > 0)
+        {
+            line += ' ';
+        }
+        line += EncodeField(record[i]);
+    }
+    line += '\n';
+
+    *m_stream << line;
+    m_stream->flush();
+    if (!m_stream->good())
+    {
+        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Unable to write to transfer journal " << m_path);
+        return false;
+    }
+    return true;
+}
+
+} // namespace Transfer
+} // namespace Aws
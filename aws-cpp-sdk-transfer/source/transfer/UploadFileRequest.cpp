@@ -19,12 +19,15 @@
 #include <aws/transfer/resource/ScopedResourceSet.h>
 #include <aws/transfer/TransferClient.h>
 #include <aws/transfer/TransferContext.h>
+#include <aws/transfer/TransferConcurrencyController.h>
+#include <aws/transfer/TransferJournal.h>
 
 #include <aws/s3/model/CreateBucketRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/HeadBucketRequest.h>
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <aws/s3/model/ListObjectsRequest.h>
+#include <aws/s3/model/ListPartsRequest.h>
 #include <aws/s3/model/UploadPartRequest.h>
 #include <aws/s3/model/PutObjectRequest.h>
 
@@ -33,11 +36,17 @@
 #include <aws/s3/model/CompleteMultipartUploadRequest.h>
 
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/crypto/MultiHash.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 
 #include <algorithm>
 
 using namespace Aws::S3::Model;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+using namespace Aws::Utils::Stream;
 using namespace Aws::S3;
 
 namespace Aws
@@ -49,15 +58,126 @@ static const char* ALLOCATION_TAG = "TransferAPI";
 
 static const uint32_t PART_RETRY_MAX = 2; // How many failures on a single part equates to a complete failure?
 
+// Journal records.  The header names the file and the upload it went to:
+//   upload <bucket> <key> <file size> <file modified time> <part size> <upload id>
+// followed by one record per part S3 has acknowledged:
+//   part <part number> <etag>
+static const char* JOURNAL_UPLOAD_RECORD = "upload";
+static const char* JOURNAL_PART_RECORD = "part";
+static const size_t JOURNAL_UPLOAD_FIELDS = 7;
+static const size_t JOURNAL_PART_FIELDS = 3;
+
 static const uint32_t CONSISTENCY_RETRY_MAX = 20; // If we're checking for consistency in S3 we may need to perform HeadObject, GetObject, and ListObjects checks several times to ensure the object has propagated
 
+// Request body for a part too large for its buffer.  The part is read from the file a buffer at a time as the http client asks for it,
+// so the part's buffer is still all the memory it uses.  Seekable, since the signer and retries go back to the start
+class PartBodyStreamBuf : public std::streambuf
+{
+public:
+    PartBodyStreamBuf(const std::shared_ptr<RandomAccessFile>& file, uint64_t offset, uint64_t length, const std::shared_ptr<UploadBuffer>& buffer) :
+        m_file(file),
+        m_offset(offset),
+        m_length(length),
+        m_buffer(buffer),
+        m_windowStart(0)
+    {
+        setg(GetWindow(), GetWindow(), GetWindow());
+    }
+
+protected:
+    int_type underflow() override
+    {
+        if (gptr() < egptr())
+        {
+            return traits_type::to_int_type(*gptr());
+        }
+
+        uint64_t position = m_windowStart + (egptr() - eback());
+        if (position >= m_length)
+        {
+            return traits_type::eof();
+        }
+
+        size_t toRead = static_cast<size_t>(std::min<uint64_t>(m_buffer->GetLength(), m_length - position));
+        int64_t bytesRead = m_file->ReadAt(m_offset + position, GetWindow(), toRead);
+        if (bytesRead <= 0)
+        {
+            return traits_type::eof();
+        }
+
+        m_windowStart = position;
+        setg(GetWindow(), GetWindow(), GetWindow() + bytesRead);
+        return traits_type::to_int_type(*gptr());
+    }
+
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override
+    {
+        if ((which & std::ios_base::in) == 0)
+        {
+            return pos_type(off_type(-1));
+        }
+
+        int64_t windowLength = egptr() - eback();
+        int64_t base = direction == std::ios_base::beg ? 0 : (direction == std::ios_base::cur ? m_windowStart + (gptr() - eback()) : m_length);
+        int64_t target = base + offset;
+        if (target < 0 || target > static_cast<int64_t>(m_length))
+        {
+            return pos_type(off_type(-1));
+        }
+
+        if (target >= static_cast<int64_t>(m_windowStart) && target <= static_cast<int64_t>(m_windowStart) + windowLength)
+        {
+            // Still inside what was last read, just move within it
+            setg(eback(), eback() + (target - m_windowStart), egptr());
+        }
+        else
+        {
+            m_windowStart = static_cast<uint64_t>(target);
+            setg(GetWindow(), GetWindow(), GetWindow());
+        }
+        return pos_type(target);
+    }
+
+    pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+    {
+        return seekoff(off_type(position), std::ios_base::beg, which);
+    }
+
+private:
+    char* GetWindow() const { return reinterpret_cast<char*>(m_buffer->GetUnderlyingData()); }
+
+    std::shared_ptr<RandomAccessFile> m_file;
+    uint64_t m_offset;
+    uint64_t m_length;
+    std::shared_ptr<UploadBuffer> m_buffer;
+    // Where in the part the get area starts
+    uint64_t m_windowStart;
+};
+
+class PartBodyStream : public Aws::IOStream
+{
+public:
+    PartBodyStream(const std::shared_ptr<RandomAccessFile>& file, uint64_t offset, uint64_t length, const std::shared_ptr<UploadBuffer>& buffer) :
+        Aws::IOStream(nullptr),
+        m_buffer(file, offset, length, buffer)
+    {
+        rdbuf(&m_buffer);
+    }
+
+private:
+    PartBodyStreamBuf m_buffer;
+};
+
 UploadFileRequest::UploadFileRequest(const Aws::String& fileName, 
                                      const Aws::String& bucketName, 
                                      const Aws::String& keyName, 
                                      const Aws::String& contentType, 
                                      const std::shared_ptr<Aws::S3::S3Client>& s3Client, 
                                      bool createBucket,
-                                     bool doConsistencyChecks) :
+                                     bool doConsistencyChecks,
+                                     uint64_t partSize,
+                                     const std::shared_ptr<TransferConcurrencyController>& concurrencyController,
+                                     bool useJournal) :
 S3FileRequest(fileName, bucketName, keyName, s3Client),
 m_bytesRemaining(0),
 m_partCount(0),
@@ -69,13 +189,18 @@ m_bucketCreated(false),
 m_createMultipartUploadPending(false),
 m_headBucketPending(false),
 m_completeMultipartUploadPending(false),
+m_verifyingResume(false),
+m_listPartsPending(false),
 m_bucketPropagated(false),
 m_totalParts(0),
-m_fileStream(fileName.c_str(), std::ios::binary | std::ios::ate),
+m_partSize(0),
+m_sourceFile(Aws::MakeShared<RandomAccessFile>(ALLOCATION_TAG)),
+m_concurrencyController(concurrencyController),
 m_contentType(contentType),
 m_createMultipartRetries(0),
 m_createBucketRetries(0),
 m_completeRetries(0),
+m_listPartsRetries(0),
 m_singleRetry(0),
 m_doConsistencyChecks(doConsistencyChecks),
 m_sentConsistencyChecks(false),
@@ -87,11 +212,10 @@ m_getObjectRetries(0),
 m_listObjectsRetries(0),
 m_headBucketRetries(0)
 {
-    if (m_fileStream.good() && m_fileStream.is_open())
+    if (m_sourceFile->OpenForRead(fileName.c_str()))
     {
-        SetFileSize(static_cast<uint64_t>(m_fileStream.tellg()));
+        SetFileSize(m_sourceFile->GetSize());
         m_bytesRemaining = GetFileSize();
-        m_fileStream.seekg(0);
     }
     else
     {
@@ -99,15 +223,27 @@ m_headBucketRetries(0)
         return;
     }
    
-    if (GetFileSize())
+    // S3 won't take parts under 5MB (other than the last), nor more than MAX_UPLOAD_PARTS of them
+    m_partSize = TransferClient::GetPartSizeForObject(GetFileSize(), std::max(partSize, MB5_BUFFER_SIZE));
+    if (m_partSize > MAX_UPLOAD_PART_SIZE)
+    {
+        CompletionFailure("File is too large to upload.");
+        return;
+    }
+
+    // How many total buffer operations are we performing - an empty file is still one (empty) PutObject
+    m_totalParts = GetFileSize() ? 1 + static_cast<uint32_t>((GetFileSize() - 1) / m_partSize) : 1;
+
+    // A single PutObject has nothing to pick up again
+    if (useJournal && !IsSinglePartUpload())
     {
-        m_totalParts = 1 + static_cast<uint32_t>((GetFileSize() - 1) / MB5_BUFFER_SIZE); // How many total buffer operations are we performing
+        m_journal = Aws::MakeShared<TransferJournal>(ALLOCATION_TAG, fileName);
+        LoadJournal();
     }
 }
 
 UploadFileRequest::~UploadFileRequest()
 {
-    m_fileStream.close();
 }
 
 bool UploadFileRequest::CreateBucket()
@@ -226,6 +362,169 @@ bool UploadFileRequest::HandleCreateMultipartUploadOutcome(const Aws::S3::Model:
         CompletionFailure(outcome.GetError().GetMessage().c_str());
         return false;
     }
+
+    if (m_journal)
+    {
+        // Any journal left from an earlier attempt was for some other upload, start over
+        m_journal->Start({ JOURNAL_UPLOAD_RECORD, GetBucketName(), GetKeyName(), StringUtils::to_string(GetFileSize()),
+            StringUtils::to_string(m_sourceFile->GetModifiedTime()), StringUtils::to_string(m_partSize), m_uploadId });
+    }
+    ContinueUpload();
+    return true;
+}
+
+void UploadFileRequest::LoadJournal()
+{
+    Aws::Vector<TransferJournal::Record> records = m_journal->Read();
+    if (records.empty())
+    {
+        return;
+    }
+
+    const TransferJournal::Record& header = records.front();
+    if (header.size() != JOURNAL_UPLOAD_FIELDS || header[0] != JOURNAL_UPLOAD_RECORD || header[1] != GetBucketName() || header[2] != GetKeyName() || header[6].empty())
+    {
+        return;
+    }
+
+    // The file has changed since, so the parts already sent are worthless - don't leave them in S3 to be paid for
+    if (header[3] != StringUtils::to_string(GetFileSize()) || header[4] != StringUtils::to_string(m_sourceFile->GetModifiedTime()))
+    {
+        AbortMultipartUploadRequest abortRequest;
+        abortRequest.SetBucket(GetBucketName());
+        abortRequest.SetKey(GetKeyName());
+        abortRequest.SetUploadId(header[6]);
+
+        GetS3Client()->AbortMultipartUploadAsync(abortRequest, &TransferClient::OnAbortMultipart);
+        return;
+    }
+
+    // The parts S3 has are the size they were cut to then, whatever the part size is now
+    uint64_t partSize = static_cast<uint64_t>(StringUtils::ConvertToInt64(header[5].c_str()));
+    if (partSize < MB5_BUFFER_SIZE || partSize > MAX_UPLOAD_PART_SIZE || (GetFileSize() - 1) / partSize >= MAX_UPLOAD_PARTS)
+    {
+        return;
+    }
+    m_partSize = partSize;
+    m_totalParts = 1 + static_cast<uint32_t>((GetFileSize() - 1) / m_partSize);
+    m_uploadId = header[6];
+
+    for (auto recordIter = records.begin() + 1; recordIter != records.end(); ++recordIter)
+    {
+        const TransferJournal::Record& record = *recordIter;
+        if (record.size() != JOURNAL_PART_FIELDS || record[0] != JOURNAL_PART_RECORD)
+        {
+            continue;
+        }
+
+        long partNumber = StringUtils::ConvertToInt32(record[1].c_str());
+        if (partNumber < 1 || static_cast<uint32_t>(partNumber) > GetTotalParts())
+        {
+            continue;
+        }
+
+        CompletedPart journaledPart;
+        journaledPart.SetPartNumber(partNumber);
+        journaledPart.SetETag(record[2]);
+        m_journaledParts[static_cast<uint32_t>(partNumber)] = journaledPart;
+    }
+
+    AWS_LOGSTREAM_INFO(ALLOCATION_TAG, "Resuming upload " << m_uploadId << " of " << GetFileName() << ", " << m_journaledParts.size() << " of " << GetTotalParts() << " parts journaled");
+    m_verifyingResume.store(true);
+}
+
+bool UploadFileRequest::ListParts(long partNumberMarker)
+{
+    m_listPartsPending.store(true);
+
+    ListPartsRequest listPartsRequest;
+    listPartsRequest.SetBucket(GetBucketName());
+    listPartsRequest.SetKey(GetKeyName());
+    listPartsRequest.SetUploadId(GetUploadId());
+    if (partNumberMarker)
+    {
+        listPartsRequest.SetPartNumberMarker(partNumberMarker);
+    }
+
+    std::shared_ptr<Aws::Client::AsyncCallerContext> context = Aws::MakeShared<UploadFileContext>(ALLOCATION_TAG, shared_from_this());
+
+    GetS3Client()->ListPartsAsync(listPartsRequest, &TransferClient::OnListParts, context);
+    return true;
+}
+
+bool UploadFileRequest::HandleListPartsOutcome(const Aws::S3::Model::ListPartsRequest& request, const Aws::S3::Model::ListPartsOutcome& outcome)
+{
+    if (!outcome.IsSuccess())
+    {
+        if (outcome.GetError().GetErrorType() == S3Errors::NO_SUCH_UPLOAD)
+        {
+            // Completed or aborted since, or expired by a lifecycle rule - nothing to pick up, upload the whole file again
+            AWS_LOGSTREAM_INFO(ALLOCATION_TAG, "Upload " << m_uploadId << " of " << GetFileName() << " is gone, starting over");
+            {
+                std::lock_guard<std::mutex> lockPart(m_completePartMutex);
+                m_completedParts.clear();
+            }
+            m_resumedParts.clear();
+            ClearProgress();
+            m_uploadId.clear();
+            m_listPartsPending.store(false);
+            m_verifyingResume.store(false);
+            ContinueUpload();
+            return false;
+        }
+
+        if (m_listPartsRetries < PART_RETRY_MAX)
+        {
+            ++m_listPartsRetries;
+            ListParts(request.GetPartNumberMarker());
+            return false;
+        }
+        m_listPartsPending.store(false);
+        CompletionFailure(outcome.GetError().GetMessage().c_str());
+        return false;
+    }
+
+    // Only parts S3 still has, with the same contents as when they were journaled, are skipped.  Anything else is sent again
+    for (const Part& listedPart : outcome.GetResult().GetParts())
+    {
+        uint32_t partNumber = static_cast<uint32_t>(listedPart.GetPartNumber());
+        auto journaledIter = m_journaledParts.find(partNumber);
+        if (journaledIter == m_journaledParts.end() || journaledIter->second.GetETag() != listedPart.GetETag())
+        {
+            continue;
+        }
+
+        uint64_t partLength = std::min(GetFileSize() - static_cast<uint64_t>(partNumber - 1) * m_partSize, m_partSize);
+        if (static_cast<uint64_t>(listedPart.GetSize()) != partLength)
+        {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lockPart(m_completePartMutex);
+            m_completedParts[partNumber] = journaledIter->second;
+        }
+        m_resumedParts.insert(partNumber);
+        RegisterProgress(static_cast<int64_t>(partLength));
+    }
+
+    if (outcome.GetResult().GetIsTruncated())
+    {
+        m_listPartsRetries = 0;
+        ListParts(outcome.GetResult().GetNextPartNumberMarker());
+        return true;
+    }
+
+    AWS_LOGSTREAM_INFO(ALLOCATION_TAG, "Upload " << m_uploadId << " of " << GetFileName() << " has " << m_resumedParts.size() << " of " << GetTotalParts() << " parts already");
+    m_journaledParts.clear();
+    m_listPartsPending.store(false);
+    m_verifyingResume.store(false);
+
+    if (m_resumedParts.size() == GetTotalParts())
+    {
+        CompleteUpload();
+        return true;
+    }
     ContinueUpload();
     return true;
 }
@@ -261,6 +560,11 @@ bool UploadFileRequest::IsReady() const
         // Need some data here
         return false;
     }
+    if (m_verifyingResume.load())
+    {
+        // Until ListParts is back we don't know which parts to skip
+        return false;
+    }
 
     return true;
 }
@@ -347,22 +651,38 @@ size_t UploadFileRequest::GetResourcesInUse() const
 
 void UploadFileRequest::CheckReacquireBuffers()
 {
-    std::lock_guard<std::mutex> resourceLock(m_resourceMutex);
-    if (GetPartsRemaining())
+    bool gotResources = false;
     {
-        // Assuming we have something left to do let's see if we can increase our pool
-
-        size_t hadResources = GetResourcesInUse();
-
-        // Can we just make this return how many you got back?
-        m_resources->TryReacquire();
-      
-        if (hadResources != GetResourcesInUse())
+        std::lock_guard<std::mutex> resourceLock(m_resourceMutex);
+        if (GetPartsRemaining() && m_resources)
         {
-            std::for_each(m_resources->GetResources().begin() + hadResources, m_resources->GetResources().end(), [&](const std::shared_ptr<UploadBuffer>& buffer) {  if (!IsUsingBuffer(buffer)) { AddReadyBuffer(buffer); } });
-            ProcessAvailableBuffers();
+            // Assuming we have something left to do let's see if we can increase our pool
+
+            size_t hadResources = GetResourcesInUse();
+
+            // Can we just make this return how many you got back?
+            if (m_concurrencyController)
+            {
+                m_resources->TryReacquire(m_concurrencyController->GetConcurrency());
+            }
+            else
+            {
+                m_resources->TryReacquire();
+            }
+
+            if (hadResources != GetResourcesInUse())
+            {
+                std::for_each(m_resources->GetResources().begin() + hadResources, m_resources->GetResources().end(), [&](const std::shared_ptr<UploadBuffer>& buffer) {  if (!IsUsingBuffer(buffer)) { AddReadyBuffer(buffer); } });
+                gotResources = true;
+            }
         }
     }
+
+    // Outside the lock - a part that fails to read finishes the request, which releases the resources
+    if (gotResources)
+    {
+        ProcessAvailableBuffers();
+    }
 }
 
 void UploadFileRequest::SetDone()
@@ -381,10 +701,22 @@ void UploadFileRequest::SetDone()
 
 bool UploadFileRequest::DoCancelAction()
 {
+    // A cancelled upload is not coming back, so neither its parts nor the journal pointing at them are worth keeping
+    if (m_journal)
+    {
+        m_journal->Remove();
+    }
+
+    if (!HasUploadId())
+    {
+        return true;
+    }
+
     AbortMultipartUploadRequest abortRequest;
 
     abortRequest.SetBucket(GetBucketName());
     abortRequest.SetKey(GetKeyName());
+    abortRequest.SetUploadId(GetUploadId());
 
     GetS3Client()->AbortMultipartUploadAsync(abortRequest, &TransferClient::OnAbortMultipart);
 
@@ -438,6 +770,14 @@ bool UploadFileRequest::ContinueUpload()
         CreateMultipartUpload();
         return true;
     }
+    if (m_verifyingResume.load())
+    {
+        if (!m_listPartsPending.load())
+        {
+            ListParts(0);
+        }
+        return true;
+    }
     ProcessAvailableBuffers();
     return true;
 }
@@ -451,43 +791,66 @@ void UploadFileRequest::CreateStreamBuffer(std::shared_ptr<Aws::IOStream>& strea
     streamBuf->seekg(0);
 }
 
-uint64_t UploadFileRequest::ReadNextPart(const std::shared_ptr<UploadBuffer>& buffer, std::shared_ptr<Aws::IOStream>& streamBuf, uint32_t& partNum)
+uint64_t UploadFileRequest::ReadNextPart(const std::shared_ptr<UploadBuffer>& buffer, uint32_t& partNum, uint64_t& offset, MultiHash& partHash)
 {
-    // This whole call is a WIP.  Big comment below, but yeah, this has to become much simpler and more efficient.
-
-    uint64_t bytesRead = 0;
+    uint64_t partLength = 0;
     {
         std::lock_guard<std::mutex> someLock(m_fileRequestMutex);
-        if (IsDone() || DoneWithRequests())
+        uint32_t nextPart = 0;
+        do
         {
-            return 0;
-        }
-        ++m_partCount;
-
-        partNum = GetPartCount();
-        bytesRead = static_cast<int64_t>(m_fileStream.read((char*)(buffer->GetUnderlyingData()), std::min(m_bytesRemaining, static_cast<uint64_t>(buffer->GetLength()))).gcount()); // This probably isn't necessary.. look at simplifying this
+            if (IsDone() || DoneWithRequests())
+            {
+                return 0;
+            }
+            ++m_partCount;
+            nextPart = GetPartCount();
+
+            // S3 already has this one from an earlier attempt; claimed and returned in one go so AllPartsReturned still adds up
+            if (m_resumedParts.count(nextPart))
+            {
+                ++m_partsReturned;
+                nextPart = 0;
+            }
+        } while (!nextPart);
+
+        partNum = nextPart;
+        offset = static_cast<uint64_t>(partNum - 1) * m_partSize;
+        partLength = std::min(GetFileSize() - offset, m_partSize);
+        m_bytesRemaining -= std::min(m_bytesRemaining, partLength);
+    }
 
-        if (bytesRead > m_bytesRemaining)
+    // Each part sits at a fixed offset, so the reads themselves don't need the lock and parts read concurrently.  A part larger than the
+    // buffer is hashed a buffer at a time here and read again as it is sent
+    bool readFailed = false;
+    uint64_t bytesHashed = 0;
+    do
+    {
+        size_t toRead = static_cast<size_t>(std::min<uint64_t>(partLength - bytesHashed, buffer->GetLength()));
+        int64_t bytesRead = m_sourceFile->ReadAt(offset + bytesHashed, buffer->GetUnderlyingData(), toRead);
+        readFailed = bytesRead < 0 || static_cast<size_t>(bytesRead) != toRead;
+        if (!readFailed)
         {
-            // This should never happen..
-            m_bytesRemaining = 0;
+            partHash.Update(buffer->GetUnderlyingData(), toRead);
+            bytesHashed += toRead;
         }
-        else
+    } while (!readFailed && bytesHashed < partLength);
+
+    if (readFailed)
+    {
+        partNum = 0;
+        CompletionFailure("Failed to read file.");
+        // This part was claimed but will never be sent, count it as returned so the buffers can still be released
+        ++m_partsReturned;
+        if (AllPartsReturned())
         {
-            m_bytesRemaining -= bytesRead;
+            ReleaseResources();
         }
+        return 0;
     }
 
-    // This is not ideal!  You're thinking "Wait, we got this buffer up there and now we're making a copy anyway.." You are right!
-    // This needs to be done in a better way.  pubsetbuf it turns out does not work as I'd hoped.  The buffer is still essentially acting a shared
-    // resource throttle, albeit double what is intended currently with the stream copy happening.  
-    // S3Client could be made to accept a buffer.. I'm thinking we're not doing that either.
-    // At this point this is considered a not horrible solution but one we'd like to try to revisit  
-    streamBuf->write((char*)buffer->GetUnderlyingData(), bytesRead);
-
-    streamBuf->seekg(0);
-
-    return bytesRead;
+    partHash.Finish();
+    return partLength;
 }
 
 // We have a buffer - let's fill it with data from our file and begin a multi part upload request
@@ -498,19 +861,32 @@ bool UploadFileRequest::ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffe
         return false;
     }
 
-    std::shared_ptr<Aws::IOStream> streamBuf = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
     uint32_t partNum = 0;
-    uint64_t bytesRead = ReadNextPart(buffer, streamBuf, partNum);
+    uint64_t offset = 0;
+    // One pass over the part gives both the Content-MD5 and the payload hash the signer would otherwise read the body again for.
+    MultiHash partHash(MultiHash::MD5_DIGEST | MultiHash::SHA256_DIGEST);
+    uint64_t bytesRead = ReadNextPart(buffer, partNum, offset, partHash);
 
-    if (!bytesRead)
+    if (!partNum)
     {
         return false;
     }
 
+    // The body reads the part straight out of the buffer, which stays with this part (see IsUsingBuffer) until its request is done
+    std::shared_ptr<Aws::IOStream> streamBuf;
+    if (bytesRead <= buffer->GetLength())
+    {
+        streamBuf = Aws::MakeShared<PreallocatedIOStream>(ALLOCATION_TAG, buffer.get(), static_cast<size_t>(bytesRead));
+    }
+    else
+    {
+        streamBuf = Aws::MakeShared<PartBodyStream>(ALLOCATION_TAG, m_sourceFile, offset, bytesRead, buffer);
+    }
+
     if (GetTotalParts() == 1)
     {
         // Don't need more than one part, do everything now
-        return DoSingleObjectUpload(streamBuf, bytesRead);
+        return DoSingleObjectUpload(streamBuf, bytesRead, partHash);
     }
     PartRequestRecord thisRequest(buffer);
 
@@ -519,8 +895,12 @@ bool UploadFileRequest::ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffe
     thisRequest.m_partRequest.SetPartNumber(partNum);
     thisRequest.m_partRequest.SetUploadId(GetUploadId());
     thisRequest.m_partRequest.SetBody(streamBuf);
-    thisRequest.m_partMd5 = HashingUtils::CalculateMD5(*streamBuf);
+    thisRequest.m_partMd5 = partHash.GetMD5();
     thisRequest.m_partRequest.SetContentMD5(HashingUtils::Base64Encode(thisRequest.m_partMd5));
+    if (partHash.IsSuccess())
+    {
+        thisRequest.m_partRequest.SetContentSHA256(HashingUtils::HexEncode(partHash.GetSHA256()));
+    }
     thisRequest.m_partRequest.SetContentLength(static_cast<long>(bytesRead));
 
     thisRequest.m_partRequest.SetDataSentEventHandler(std::bind(&UploadFileRequest::OnDataSent, this, std::placeholders::_1, std::placeholders::_2));
@@ -548,6 +928,7 @@ bool UploadFileRequest::RequestPart(uint32_t partId)
     PartRequestRecord& partRequest = partIter->second;
 
     partRequest.m_retries++;
+    partRequest.m_startTime = std::chrono::steady_clock::now();
     std::shared_ptr<Aws::Client::AsyncCallerContext> context = Aws::MakeShared<UploadFileContext>(ALLOCATION_TAG, shared_from_this());
 
     GetS3Client()->UploadPartAsync(partRequest.m_partRequest, &TransferClient::OnUploadPartRequest, context);
@@ -577,7 +958,13 @@ bool UploadFileRequest::HandleUploadPartOutcome(const Aws::S3::Model::UploadPart
     Aws::StringStream outcomeETag;
     outcomeETag << outcome.GetResult().GetETag();
 
-    if (outcome.IsSuccess() && (md5Hex.str() == outcomeETag.str()))
+    bool partSucceeded = outcome.IsSuccess() && (md5Hex.str() == outcomeETag.str());
+    if (m_concurrencyController)
+    {
+        m_concurrencyController->RecordPart(static_cast<uint64_t>(request.GetContentLength()), partSucceeded, partRequest.m_startTime);
+    }
+
+    if (partSucceeded)
     {
         AddCompletedPart(partRequest, outcome.GetResult().GetETag());
         CheckReacquireBuffers();
@@ -595,9 +982,31 @@ void UploadFileRequest::ReusePart(PartRequestRecord& partRequest)
         std::lock_guard<std::mutex> pendingLock(m_pendingMutex);
         m_pendingParts.erase(partRequest.m_partRequest.GetPartNumber());
     }
+    if (ReleaseExcessBuffer(reuseBuffer))
+    {
+        return;
+    }
     ProcessBuffer(reuseBuffer);
 }
 
+bool UploadFileRequest::ReleaseExcessBuffer(const std::shared_ptr<UploadBuffer>& buffer)
+{
+    if (!m_concurrencyController)
+    {
+        return false;
+    }
+
+    // The pool only shrinks as buffers come back to it, and buffers normally stay with an upload until it is done.
+    // Keep the last one so the upload can still finish
+    std::lock_guard<std::mutex> resourceLock(m_resourceMutex);
+    if (!m_resources || GetResourcesInUse() <= std::max(m_concurrencyController->GetConcurrency(), 1u))
+    {
+        return false;
+    }
+
+    return m_resources->ReleaseResource(buffer);
+}
+
 void UploadFileRequest::AddCompletedPart(PartRequestRecord& partRequest, const Aws::String& eTag)
 {
     std::lock_guard<std::mutex> lockPart(m_completePartMutex);
@@ -607,6 +1016,11 @@ void UploadFileRequest::AddCompletedPart(PartRequestRecord& partRequest, const A
     thisPart.SetETag(eTag);
     m_completedParts[partRequest.m_partRequest.GetPartNumber()] = thisPart;
 
+    if (m_journal)
+    {
+        m_journal->Append({ JOURNAL_PART_RECORD, StringUtils::to_string(partRequest.m_partRequest.GetPartNumber()), eTag });
+    }
+
     if (m_completedParts.size() == GetTotalParts() && !IsDone())
     {
         CompleteUpload();
@@ -643,6 +1057,10 @@ bool UploadFileRequest::HandleCompleteMultipartUploadOutcome(const Aws::S3::Mode
 
     if (outcome.IsSuccess())
     {
+        if (m_journal)
+        {
+            m_journal->Remove();
+        }
         CheckConsistencyCompletion();
         return true;
     }
@@ -762,14 +1180,18 @@ bool UploadFileRequest::IsUsingBuffer(const std::shared_ptr<UploadBuffer>& buffe
     return (result != m_pendingParts.end());
 }
 
-bool UploadFileRequest::DoSingleObjectUpload(std::shared_ptr<Aws::IOStream>& streamBuf, uint64_t bytesRead) 
+bool UploadFileRequest::DoSingleObjectUpload(std::shared_ptr<Aws::IOStream>& streamBuf, uint64_t bytesRead, const MultiHash& bodyHash) 
 {
     PutObjectRequest putObjectRequest;
     putObjectRequest.SetBucket(GetBucketName());
 
     putObjectRequest.SetBody(streamBuf);
     putObjectRequest.SetContentLength(static_cast<long>(bytesRead));
-    putObjectRequest.SetContentMD5(HashingUtils::Base64Encode(HashingUtils::CalculateMD5(*putObjectRequest.GetBody())));
+    putObjectRequest.SetContentMD5(HashingUtils::Base64Encode(bodyHash.GetMD5()));
+    if (bodyHash.IsSuccess())
+    {
+        putObjectRequest.SetContentSHA256(HashingUtils::HexEncode(bodyHash.GetSHA256()));
+    }
     if (m_contentType.length())
     {
         putObjectRequest.SetContentType(m_contentType);
@@ -797,9 +1219,9 @@ void UploadFileRequest::OnDataSent(const Aws::Http::HttpRequest*, long long amou
 
 bool UploadFileRequest::HandlePutObjectOutcome(const Aws::S3::Model::PutObjectRequest& request, const Aws::S3::Model::PutObjectOutcome& outcome)
 {
-    //verify md5 sums between what was sent and what s3 told us they received.
+    //verify md5 sums between what was sent and what s3 told us they received. The body was hashed when the request was built.
     Aws::StringStream ss;
-    ss << "\"" << HashingUtils::HexEncode(HashingUtils::CalculateMD5(*request.GetBody())) << "\"";
+    ss << "\"" << HashingUtils::HexEncode(HashingUtils::Base64Decode(request.GetContentMD5())) << "\"";
 
     if (outcome.IsSuccess() && (ss.str() == outcome.GetResult().GetETag()))
     {